@@ -0,0 +1,7618 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 79 "cfg.y"
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/in_systm.h>
+#include <netinet/ip.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <errno.h>
+#include "route_struct.h"
+#include "globals.h"
+#include "route.h"
+#include "dprint.h"
+#include "cfg_pp.h"
+#include "sr_module.h"
+#include "modparam.h"
+#include "ip_addr.h"
+#include "resolve.h"
+#include "socket_info.h"
+#include "name_alias.h"
+#include "ut.h"
+#include "pt_scaling.h"
+#include "dset.h"
+#include "pvar.h"
+#include "blacklists.h"
+#include "xlog.h"
+#include "db/db_insertq.h"
+#include "bin_interface.h"
+#include "net/trans.h"
+#include "config.h"
+#include "mem/rpm_mem.h"
+#include "poll_types.h"
+
+#ifdef SHM_EXTRA_STATS
+#include "mem/module_info.h"
+#endif
+
+#ifdef DEBUG_DMALLOC
+#include <dmalloc.h>
+#endif
+
+/* hack to avoid alloca usage in the generated C file (needed for compiler
+ with no built in alloca, like icc*/
+#undef _ALLOCA_H
+
+#undef MIN
+#undef MAX
+
+extern int yylex();
+static void yyerror(char* s);
+static void yyerrorf(char* fmt, ...);
+static char* tmp;
+static int i_tmp, rc;
+static struct socket_id* lst_tmp;
+static int rt;  /* Type of route block for find_export */
+static str s_tmp;
+static str tstr;
+static struct net* net_tmp;
+static pv_spec_t *spec;
+static pv_elem_t *elem;
+static struct bl_rule *bl_head = 0;
+static struct bl_rule *bl_tail = 0;
+static struct script_route_ref *rt_ref = NULL;
+
+action_elem_t elems[MAX_ACTION_ELEMS];
+static action_elem_t route_elems[MAX_ACTION_ELEMS];
+action_elem_t *a_tmp;
+
+struct port_range {
+	int min;
+	int max;
+	struct port_range *next;
+} *pr_tmp;
+static struct script_return_param sr_tmp;
+
+static inline void warn(char* s);
+static struct socket_id* mk_listen_id(char*, enum sip_protos, int);
+static struct socket_id* mk_listen_id_range(char*, enum sip_protos, struct port_range *);
+static struct socket_id* set_listen_id_adv(struct socket_id *, char *, int);
+static struct multi_str *new_string(char *s);
+static struct port_range* mk_port_range(int, int);
+static int parse_ipnet(char *in, int len, struct net **ipnet);
+static struct script_return_param *mk_script_return(enum script_return_type type)
+{
+	struct script_return_param *param = pkg_malloc(sizeof *param);
+	if (!param)
+		return NULL;
+	*param = sr_tmp;
+	param->type = type;
+	param->next = NULL;
+	return param;
+}
+
+extern int line;
+extern int column;
+extern int startcolumn;
+extern char *finame;
+
+struct listen_param {
+	enum si_flags flags;
+	int workers;
+	int tos;
+	int recv_batch;
+	struct socket_id *socket;
+	char *tag;
+	char *auto_scaling_profile;
+} p_tmp;
+static void fill_socket_id(struct listen_param *param, struct socket_id *s);
+
+union route_name_var {
+	int iname;
+	struct _pv_spec *sname;
+	struct _pv_elem *ename;
+	void *data;
+} rn_tmp;
+
+#ifndef SHM_EXTRA_STATS
+struct multi_str{
+	char *s;
+	struct multi_str* next;
+};
+#else
+static struct multi_str *tmp_mod;
+#endif
+
+#define get_cfg_file_name \
+	((finame) ? finame : cfg_file ? cfg_file : "default")
+
+#define si_subdomain_to_alias_flag(_flags) (int) _flags & SI_ACCEPT_SUBDOMAIN_ALIAS
+
+#define mk_action_(_res, _type, _no, _elems) \
+	do { \
+		_res = mk_action(_type, _no, _elems, line, get_cfg_file_name); \
+	} while(0)
+#define mk_action0(_res, _type) \
+	do { \
+		_res = mk_action(_type, 0, 0, line, get_cfg_file_name); \
+	} while(0)
+#define mk_action1(_res, _type, _p1_type, _p1) \
+	do { \
+		elems[0].type = _p1_type; \
+		elems[0].u.data = _p1; \
+		_res = mk_action(_type, 1, elems, line, get_cfg_file_name); \
+	} while(0)
+#define	mk_action2(_res, _type, _p1_type, _p2_type, _p1, _p2) \
+	do { \
+		elems[0].type = _p1_type; \
+		elems[0].u.data = _p1; \
+		elems[1].type = _p2_type; \
+		elems[1].u.data = _p2; \
+		_res = mk_action(_type, 2, elems, line, get_cfg_file_name); \
+	} while(0)
+#define mk_action3(_res, _type, _p1_type, _p2_type, _p3_type, _p1, _p2, _p3) \
+	do { \
+		elems[0].type = _p1_type; \
+		elems[0].u.data = _p1; \
+		elems[1].type = _p2_type; \
+		elems[1].u.data = _p2; \
+		elems[2].type = _p3_type; \
+		elems[2].u.data = _p3; \
+		_res = mk_action(_type, 3, elems, line, get_cfg_file_name); \
+	} while(0)
+
+extern int cfg_parse_only_routes;
+#define IFOR(_instr) \
+	if (cfg_parse_only_routes==1) {_instr;break;}
+
+
+#line 243 "cfg.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cfg.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_DROP = 3,                       /* DROP  */
+  YYSYMBOL_ASSERT = 4,                     /* ASSERT  */
+  YYSYMBOL_EXIT = 5,                       /* EXIT  */
+  YYSYMBOL_RETURN = 6,                     /* RETURN  */
+  YYSYMBOL_LOG_TOK = 7,                    /* LOG_TOK  */
+  YYSYMBOL_ERROR = 8,                      /* ERROR  */
+  YYSYMBOL_ROUTE = 9,                      /* ROUTE  */
+  YYSYMBOL_ROUTE_FAILURE = 10,             /* ROUTE_FAILURE  */
+  YYSYMBOL_ROUTE_ONREPLY = 11,             /* ROUTE_ONREPLY  */
+  YYSYMBOL_ROUTE_BRANCH = 12,              /* ROUTE_BRANCH  */
+  YYSYMBOL_ROUTE_ERROR = 13,               /* ROUTE_ERROR  */
+  YYSYMBOL_ROUTE_LOCAL = 14,               /* ROUTE_LOCAL  */
+  YYSYMBOL_ROUTE_STARTUP = 15,             /* ROUTE_STARTUP  */
+  YYSYMBOL_ROUTE_TIMER = 16,               /* ROUTE_TIMER  */
+  YYSYMBOL_ROUTE_EVENT = 17,               /* ROUTE_EVENT  */
+  YYSYMBOL_IF = 18,                        /* IF  */
+  YYSYMBOL_ELSE = 19,                      /* ELSE  */
+  YYSYMBOL_SWITCH = 20,                    /* SWITCH  */
+  YYSYMBOL_CASE = 21,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 22,                   /* DEFAULT  */
+  YYSYMBOL_BREAK = 23,                     /* BREAK  */
+  YYSYMBOL_WHILE = 24,                     /* WHILE  */
+  YYSYMBOL_FOR = 25,                       /* FOR  */
+  YYSYMBOL_IN = 26,                        /* IN  */
+  YYSYMBOL_READONLY = 27,                  /* READONLY  */
+  YYSYMBOL_EXPIRE = 28,                    /* EXPIRE  */
+  YYSYMBOL_NULLV = 29,                     /* NULLV  */
+  YYSYMBOL_XDBG = 30,                      /* XDBG  */
+  YYSYMBOL_XLOG = 31,                      /* XLOG  */
+  YYSYMBOL_XLOG_BUF_SIZE = 32,             /* XLOG_BUF_SIZE  */
+  YYSYMBOL_XLOG_FORCE_COLOR = 33,          /* XLOG_FORCE_COLOR  */
+  YYSYMBOL_XLOG_PRINT_LEVEL = 34,          /* XLOG_PRINT_LEVEL  */
+  YYSYMBOL_XLOG_LEVEL = 35,                /* XLOG_LEVEL  */
+  YYSYMBOL_PV_PRINT_BUF_SIZE = 36,         /* PV_PRINT_BUF_SIZE  */
+  YYSYMBOL_DEBUG_MODE = 37,                /* DEBUG_MODE  */
+  YYSYMBOL_ENABLE_ASSERTS = 38,            /* ENABLE_ASSERTS  */
+  YYSYMBOL_ABORT_ON_ASSERT = 39,           /* ABORT_ON_ASSERT  */
+  YYSYMBOL_LOGLEVEL = 40,                  /* LOGLEVEL  */
+  YYSYMBOL_LOGPREFIX = 41,                 /* LOGPREFIX  */
+  YYSYMBOL_LOGSTDOUT = 42,                 /* LOGSTDOUT  */
+  YYSYMBOL_LOGSTDERROR = 43,               /* LOGSTDERROR  */
+  YYSYMBOL_STDERROR_ENABLED = 44,          /* STDERROR_ENABLED  */
+  YYSYMBOL_SYSLOG_ENABLED = 45,            /* SYSLOG_ENABLED  */
+  YYSYMBOL_LOG_EVENT_ENABLED = 46,         /* LOG_EVENT_ENABLED  */
+  YYSYMBOL_STDERROR_LEVEL_FILTER = 47,     /* STDERROR_LEVEL_FILTER  */
+  YYSYMBOL_SYSLOG_LEVEL_FILTER = 48,       /* SYSLOG_LEVEL_FILTER  */
+  YYSYMBOL_LOG_EVENT_LEVEL_FILTER = 49,    /* LOG_EVENT_LEVEL_FILTER  */
+  YYSYMBOL_STDERROR_FORMAT = 50,           /* STDERROR_FORMAT  */
+  YYSYMBOL_SYSLOG_FORMAT = 51,             /* SYSLOG_FORMAT  */
+  YYSYMBOL_LOG_JSON_BUF_SIZE = 52,         /* LOG_JSON_BUF_SIZE  */
+  YYSYMBOL_LOG_MSG_BUF_SIZE = 53,          /* LOG_MSG_BUF_SIZE  */
+  YYSYMBOL_LOGFACILITY = 54,               /* LOGFACILITY  */
+  YYSYMBOL_SYSLOG_FACILITY = 55,           /* SYSLOG_FACILITY  */
+  YYSYMBOL_LOGNAME = 56,                   /* LOGNAME  */
+  YYSYMBOL_SYSLOG_NAME = 57,               /* SYSLOG_NAME  */
+  YYSYMBOL_AVP_ALIASES = 58,               /* AVP_ALIASES  */
+  YYSYMBOL_LISTEN = 59,                    /* LISTEN  */
+  YYSYMBOL_SOCKET = 60,                    /* SOCKET  */
+  YYSYMBOL_MEMGROUP = 61,                  /* MEMGROUP  */
+  YYSYMBOL_ALIAS = 62,                     /* ALIAS  */
+  YYSYMBOL_AUTO_ALIASES = 63,              /* AUTO_ALIASES  */
+  YYSYMBOL_TAG = 64,                       /* TAG  */
+  YYSYMBOL_DNS = 65,                       /* DNS  */
+  YYSYMBOL_REV_DNS = 66,                   /* REV_DNS  */
+  YYSYMBOL_DNS_TRY_IPV6 = 67,              /* DNS_TRY_IPV6  */
+  YYSYMBOL_DNS_TRY_NAPTR = 68,             /* DNS_TRY_NAPTR  */
+  YYSYMBOL_DNS_RETR_TIME = 69,             /* DNS_RETR_TIME  */
+  YYSYMBOL_DNS_RETR_NO = 70,               /* DNS_RETR_NO  */
+  YYSYMBOL_DNS_SERVERS_NO = 71,            /* DNS_SERVERS_NO  */
+  YYSYMBOL_DNS_USE_SEARCH = 72,            /* DNS_USE_SEARCH  */
+  YYSYMBOL_MAX_WHILE_LOOPS = 73,           /* MAX_WHILE_LOOPS  */
+  YYSYMBOL_UDP_WORKERS = 74,               /* UDP_WORKERS  */
+  YYSYMBOL_CHECK_VIA = 75,                 /* CHECK_VIA  */
+  YYSYMBOL_SHM_HASH_SPLIT_PERCENTAGE = 76, /* SHM_HASH_SPLIT_PERCENTAGE  */
+  YYSYMBOL_SHM_SECONDARY_HASH_SIZE = 77,   /* SHM_SECONDARY_HASH_SIZE  */
+  YYSYMBOL_SHM_CACHE_SIZE = 78,            /* SHM_CACHE_SIZE  */
+  YYSYMBOL_PKG_ARENA_SIZE = 79,            /* PKG_ARENA_SIZE  */
+  YYSYMBOL_MEM_WARMING_ENABLED = 80,       /* MEM_WARMING_ENABLED  */
+  YYSYMBOL_MEM_WARMING_PATTERN_FILE = 81,  /* MEM_WARMING_PATTERN_FILE  */
+  YYSYMBOL_MEM_WARMING_PERCENTAGE = 82,    /* MEM_WARMING_PERCENTAGE  */
+  YYSYMBOL_RPM_MEM_FILE = 83,              /* RPM_MEM_FILE  */
+  YYSYMBOL_RPM_MEM_SIZE = 84,              /* RPM_MEM_SIZE  */
+  YYSYMBOL_MEMLOG = 85,                    /* MEMLOG  */
+  YYSYMBOL_MEMDUMP = 86,                   /* MEMDUMP  */
+  YYSYMBOL_SHM_MEMLOG_SIZE = 87,           /* SHM_MEMLOG_SIZE  */
+  YYSYMBOL_EXECMSGTHRESHOLD = 88,          /* EXECMSGTHRESHOLD  */
+  YYSYMBOL_EXECDNSTHRESHOLD = 89,          /* EXECDNSTHRESHOLD  */
+  YYSYMBOL_TCPTHRESHOLD = 90,              /* TCPTHRESHOLD  */
+  YYSYMBOL_EVENT_SHM_THRESHOLD = 91,       /* EVENT_SHM_THRESHOLD  */
+  YYSYMBOL_EVENT_PKG_THRESHOLD = 92,       /* EVENT_PKG_THRESHOLD  */
+  YYSYMBOL_QUERYBUFFERSIZE = 93,           /* QUERYBUFFERSIZE  */
+  YYSYMBOL_QUERYFLUSHTIME = 94,            /* QUERYFLUSHTIME  */
+  YYSYMBOL_SIP_WARNING = 95,               /* SIP_WARNING  */
+  YYSYMBOL_SERVER_SIGNATURE = 96,          /* SERVER_SIGNATURE  */
+  YYSYMBOL_SERVER_HEADER = 97,             /* SERVER_HEADER  */
+  YYSYMBOL_USER_AGENT_HEADER = 98,         /* USER_AGENT_HEADER  */
+  YYSYMBOL_LOADMODULE = 99,                /* LOADMODULE  */
+  YYSYMBOL_MPATH = 100,                    /* MPATH  */
+  YYSYMBOL_MODPARAM = 101,                 /* MODPARAM  */
+  YYSYMBOL_MAXBUFFER = 102,                /* MAXBUFFER  */
+  YYSYMBOL_CHROOT = 103,                   /* CHROOT  */
+  YYSYMBOL_WDIR = 104,                     /* WDIR  */
+  YYSYMBOL_MHOMED = 105,                   /* MHOMED  */
+  YYSYMBOL_POLL_METHOD = 106,              /* POLL_METHOD  */
+  YYSYMBOL_TCP_ACCEPT_ALIASES = 107,       /* TCP_ACCEPT_ALIASES  */
+  YYSYMBOL_TCP_WORKERS = 108,              /* TCP_WORKERS  */
+  YYSYMBOL_TCP_CONNECT_TIMEOUT = 109,      /* TCP_CONNECT_TIMEOUT  */
+  YYSYMBOL_TCP_CON_LIFETIME = 110,         /* TCP_CON_LIFETIME  */
+  YYSYMBOL_TCP_SOCKET_BACKLOG = 111,       /* TCP_SOCKET_BACKLOG  */
+  YYSYMBOL_TCP_MAX_CONNECTIONS = 112,      /* TCP_MAX_CONNECTIONS  */
+  YYSYMBOL_TCP_NO_NEW_CONN_BFLAG = 113,    /* TCP_NO_NEW_CONN_BFLAG  */
+  YYSYMBOL_TCP_NO_NEW_CONN_RPLFLAG = 114,  /* TCP_NO_NEW_CONN_RPLFLAG  */
+  YYSYMBOL_TCP_KEEPALIVE = 115,            /* TCP_KEEPALIVE  */
+  YYSYMBOL_TCP_KEEPCOUNT = 116,            /* TCP_KEEPCOUNT  */
+  YYSYMBOL_TCP_KEEPIDLE = 117,             /* TCP_KEEPIDLE  */
+  YYSYMBOL_TCP_KEEPINTERVAL = 118,         /* TCP_KEEPINTERVAL  */
+  YYSYMBOL_TCP_MAX_MSG_TIME = 119,         /* TCP_MAX_MSG_TIME  */
+  YYSYMBOL_TCP_PARALLEL_READ_ON_WORKERS = 120, /* TCP_PARALLEL_READ_ON_WORKERS  */
+  YYSYMBOL_TCP_STICKY_WORKERS = 121,       /* TCP_STICKY_WORKERS  */
+  YYSYMBOL_TCP_MAIN_SHARDS = 122,          /* TCP_MAIN_SHARDS  */
+  YYSYMBOL_TCP_HANDSHAKE_WORKERS = 123,    /* TCP_HANDSHAKE_WORKERS  */
+  YYSYMBOL_ADVERTISED_ADDRESS = 124,       /* ADVERTISED_ADDRESS  */
+  YYSYMBOL_ADVERTISED_PORT = 125,          /* ADVERTISED_PORT  */
+  YYSYMBOL_DISABLE_CORE = 126,             /* DISABLE_CORE  */
+  YYSYMBOL_OPEN_FD_LIMIT = 127,            /* OPEN_FD_LIMIT  */
+  YYSYMBOL_MCAST_LOOPBACK = 128,           /* MCAST_LOOPBACK  */
+  YYSYMBOL_MCAST_TTL = 129,                /* MCAST_TTL  */
+  YYSYMBOL_TOS = 130,                      /* TOS  */
+  YYSYMBOL_DISABLE_DNS_FAILOVER = 131,     /* DISABLE_DNS_FAILOVER  */
+  YYSYMBOL_DISABLE_DNS_BLACKLIST = 132,    /* DISABLE_DNS_BLACKLIST  */
+  YYSYMBOL_DST_BLACKLIST = 133,            /* DST_BLACKLIST  */
+  YYSYMBOL_DISABLE_STATELESS_FWD = 134,    /* DISABLE_STATELESS_FWD  */
+  YYSYMBOL_DB_VERSION_TABLE = 135,         /* DB_VERSION_TABLE  */
+  YYSYMBOL_DB_DEFAULT_URL = 136,           /* DB_DEFAULT_URL  */
+  YYSYMBOL_DB_MAX_ASYNC_CONNECTIONS = 137, /* DB_MAX_ASYNC_CONNECTIONS  */
+  YYSYMBOL_DISABLE_503_TRANSLATION = 138,  /* DISABLE_503_TRANSLATION  */
+  YYSYMBOL_SYNC_TOKEN = 139,               /* SYNC_TOKEN  */
+  YYSYMBOL_ASYNC_TOKEN = 140,              /* ASYNC_TOKEN  */
+  YYSYMBOL_LAUNCH_TOKEN = 141,             /* LAUNCH_TOKEN  */
+  YYSYMBOL_AUTO_SCALING_PROFILE = 142,     /* AUTO_SCALING_PROFILE  */
+  YYSYMBOL_AUTO_SCALING_CYCLE = 143,       /* AUTO_SCALING_CYCLE  */
+  YYSYMBOL_TIMER_WORKERS = 144,            /* TIMER_WORKERS  */
+  YYSYMBOL_EQUAL = 145,                    /* EQUAL  */
+  YYSYMBOL_EQUAL_T = 146,                  /* EQUAL_T  */
+  YYSYMBOL_GT = 147,                       /* GT  */
+  YYSYMBOL_LT = 148,                       /* LT  */
+  YYSYMBOL_GTE = 149,                      /* GTE  */
+  YYSYMBOL_LTE = 150,                      /* LTE  */
+  YYSYMBOL_DIFF = 151,                     /* DIFF  */
+  YYSYMBOL_MATCH = 152,                    /* MATCH  */
+  YYSYMBOL_NOTMATCH = 153,                 /* NOTMATCH  */
+  YYSYMBOL_COLONEQ = 154,                  /* COLONEQ  */
+  YYSYMBOL_PLUSEQ = 155,                   /* PLUSEQ  */
+  YYSYMBOL_MINUSEQ = 156,                  /* MINUSEQ  */
+  YYSYMBOL_SLASHEQ = 157,                  /* SLASHEQ  */
+  YYSYMBOL_MULTEQ = 158,                   /* MULTEQ  */
+  YYSYMBOL_MODULOEQ = 159,                 /* MODULOEQ  */
+  YYSYMBOL_BANDEQ = 160,                   /* BANDEQ  */
+  YYSYMBOL_BOREQ = 161,                    /* BOREQ  */
+  YYSYMBOL_BXOREQ = 162,                   /* BXOREQ  */
+  YYSYMBOL_OR = 163,                       /* OR  */
+  YYSYMBOL_AND = 164,                      /* AND  */
+  YYSYMBOL_BOR = 165,                      /* BOR  */
+  YYSYMBOL_BAND = 166,                     /* BAND  */
+  YYSYMBOL_BXOR = 167,                     /* BXOR  */
+  YYSYMBOL_BLSHIFT = 168,                  /* BLSHIFT  */
+  YYSYMBOL_BRSHIFT = 169,                  /* BRSHIFT  */
+  YYSYMBOL_PLUS = 170,                     /* PLUS  */
+  YYSYMBOL_MINUS = 171,                    /* MINUS  */
+  YYSYMBOL_MULT = 172,                     /* MULT  */
+  YYSYMBOL_MODULO = 173,                   /* MODULO  */
+  YYSYMBOL_NOT = 174,                      /* NOT  */
+  YYSYMBOL_BNOT = 175,                     /* BNOT  */
+  YYSYMBOL_NUMBER = 176,                   /* NUMBER  */
+  YYSYMBOL_ZERO = 177,                     /* ZERO  */
+  YYSYMBOL_ID = 178,                       /* ID  */
+  YYSYMBOL_STRING = 179,                   /* STRING  */
+  YYSYMBOL_SCRIPTVAR = 180,                /* SCRIPTVAR  */
+  YYSYMBOL_IPV6ADDR = 181,                 /* IPV6ADDR  */
+  YYSYMBOL_IPV4ADDR = 182,                 /* IPV4ADDR  */
+  YYSYMBOL_IPNET = 183,                    /* IPNET  */
+  YYSYMBOL_COMMA = 184,                    /* COMMA  */
+  YYSYMBOL_SEMICOLON = 185,                /* SEMICOLON  */
+  YYSYMBOL_RPAREN = 186,                   /* RPAREN  */
+  YYSYMBOL_LPAREN = 187,                   /* LPAREN  */
+  YYSYMBOL_LBRACE = 188,                   /* LBRACE  */
+  YYSYMBOL_RBRACE = 189,                   /* RBRACE  */
+  YYSYMBOL_LBRACK = 190,                   /* LBRACK  */
+  YYSYMBOL_RBRACK = 191,                   /* RBRACK  */
+  YYSYMBOL_SLASH = 192,                    /* SLASH  */
+  YYSYMBOL_AS = 193,                       /* AS  */
+  YYSYMBOL_USE_WORKERS = 194,              /* USE_WORKERS  */
+  YYSYMBOL_SOCK_TOS = 195,                 /* SOCK_TOS  */
+  YYSYMBOL_RECV_BATCH = 196,               /* RECV_BATCH  */
+  YYSYMBOL_USE_AUTO_SCALING_PROFILE = 197, /* USE_AUTO_SCALING_PROFILE  */
+  YYSYMBOL_MAX = 198,                      /* MAX  */
+  YYSYMBOL_MIN = 199,                      /* MIN  */
+  YYSYMBOL_DOT = 200,                      /* DOT  */
+  YYSYMBOL_CR = 201,                       /* CR  */
+  YYSYMBOL_COLON = 202,                    /* COLON  */
+  YYSYMBOL_ANY = 203,                      /* ANY  */
+  YYSYMBOL_ANYCAST = 204,                  /* ANYCAST  */
+  YYSYMBOL_ACCEPT_SUBDOMAIN = 205,         /* ACCEPT_SUBDOMAIN  */
+  YYSYMBOL_FRAG = 206,                     /* FRAG  */
+  YYSYMBOL_REUSE_PORT = 207,               /* REUSE_PORT  */
+  YYSYMBOL_SCRIPTVARERR = 208,             /* SCRIPTVARERR  */
+  YYSYMBOL_SCALE_UP_TO = 209,              /* SCALE_UP_TO  */
+  YYSYMBOL_SCALE_DOWN_TO = 210,            /* SCALE_DOWN_TO  */
+  YYSYMBOL_ON = 211,                       /* ON  */
+  YYSYMBOL_CYCLES = 212,                   /* CYCLES  */
+  YYSYMBOL_CYCLES_WITHIN = 213,            /* CYCLES_WITHIN  */
+  YYSYMBOL_PERCENTAGE = 214,               /* PERCENTAGE  */
+  YYSYMBOL_YYACCEPT = 215,                 /* $accept  */
+  YYSYMBOL_cfg = 216,                      /* cfg  */
+  YYSYMBOL_statements = 217,               /* statements  */
+  YYSYMBOL_statement = 218,                /* statement  */
+  YYSYMBOL_219_1 = 219,                    /* $@1  */
+  YYSYMBOL_220_2 = 220,                    /* $@2  */
+  YYSYMBOL_221_3 = 221,                    /* $@3  */
+  YYSYMBOL_222_4 = 222,                    /* $@4  */
+  YYSYMBOL_223_5 = 223,                    /* $@5  */
+  YYSYMBOL_224_6 = 224,                    /* $@6  */
+  YYSYMBOL_225_7 = 225,                    /* $@7  */
+  YYSYMBOL_226_8 = 226,                    /* $@8  */
+  YYSYMBOL_227_9 = 227,                    /* $@9  */
+  YYSYMBOL_listen_id = 228,                /* listen_id  */
+  YYSYMBOL_host_sep = 229,                 /* host_sep  */
+  YYSYMBOL_host = 230,                     /* host  */
+  YYSYMBOL_proto = 231,                    /* proto  */
+  YYSYMBOL_port = 232,                     /* port  */
+  YYSYMBOL_portrange = 233,                /* portrange  */
+  YYSYMBOL_snumber = 234,                  /* snumber  */
+  YYSYMBOL_phostport = 235,                /* phostport  */
+  YYSYMBOL_phostportrange = 236,           /* phostportrange  */
+  YYSYMBOL_any_alias = 237,                /* any_alias  */
+  YYSYMBOL_alias_def = 238,                /* alias_def  */
+  YYSYMBOL_id_lst = 239,                   /* id_lst  */
+  YYSYMBOL_listen_id_def = 240,            /* listen_id_def  */
+  YYSYMBOL_socket_def_param = 241,         /* socket_def_param  */
+  YYSYMBOL_socket_def_params = 242,        /* socket_def_params  */
+  YYSYMBOL_socket_def = 243,               /* socket_def  */
+  YYSYMBOL_244_10 = 244,                   /* $@10  */
+  YYSYMBOL_any_proto = 245,                /* any_proto  */
+  YYSYMBOL_multi_string = 246,             /* multi_string  */
+  YYSYMBOL_blst_elem = 247,                /* blst_elem  */
+  YYSYMBOL_blst_def = 248,                 /* blst_def  */
+  YYSYMBOL_blst_flag = 249,                /* blst_flag  */
+  YYSYMBOL_blst_flags = 250,               /* blst_flags  */
+  YYSYMBOL_blst_elem_list = 251,           /* blst_elem_list  */
+  YYSYMBOL_auto_scale_profile_def = 252,   /* auto_scale_profile_def  */
+  YYSYMBOL_assign_stm = 253,               /* assign_stm  */
+  YYSYMBOL_module_stm = 254,               /* module_stm  */
+  YYSYMBOL_ip = 255,                       /* ip  */
+  YYSYMBOL_ipv4 = 256,                     /* ipv4  */
+  YYSYMBOL_ipv6addr = 257,                 /* ipv6addr  */
+  YYSYMBOL_ipv6 = 258,                     /* ipv6  */
+  YYSYMBOL_ipnet = 259,                    /* ipnet  */
+  YYSYMBOL_folded_string = 260,            /* folded_string  */
+  YYSYMBOL_route_name = 261,               /* route_name  */
+  YYSYMBOL_route_name_var = 262,           /* route_name_var  */
+  YYSYMBOL_route_stm = 263,                /* route_stm  */
+  YYSYMBOL_failure_route_stm = 264,        /* failure_route_stm  */
+  YYSYMBOL_onreply_route_stm = 265,        /* onreply_route_stm  */
+  YYSYMBOL_branch_route_stm = 266,         /* branch_route_stm  */
+  YYSYMBOL_error_route_stm = 267,          /* error_route_stm  */
+  YYSYMBOL_local_route_stm = 268,          /* local_route_stm  */
+  YYSYMBOL_startup_route_stm = 269,        /* startup_route_stm  */
+  YYSYMBOL_timer_route_stm = 270,          /* timer_route_stm  */
+  YYSYMBOL_event_route_stm = 271,          /* event_route_stm  */
+  YYSYMBOL_exp = 272,                      /* exp  */
+  YYSYMBOL_equalop = 273,                  /* equalop  */
+  YYSYMBOL_compop = 274,                   /* compop  */
+  YYSYMBOL_matchop = 275,                  /* matchop  */
+  YYSYMBOL_intop = 276,                    /* intop  */
+  YYSYMBOL_strop = 277,                    /* strop  */
+  YYSYMBOL_script_var = 278,               /* script_var  */
+  YYSYMBOL_exp_elem = 279,                 /* exp_elem  */
+  YYSYMBOL_exp_cond = 280,                 /* exp_cond  */
+  YYSYMBOL_assignop = 281,                 /* assignop  */
+  YYSYMBOL_assignexp = 282,                /* assignexp  */
+  YYSYMBOL_assign_cmd = 283,               /* assign_cmd  */
+  YYSYMBOL_exp_stm = 284,                  /* exp_stm  */
+  YYSYMBOL_brk_stm = 285,                  /* brk_stm  */
+  YYSYMBOL_stm = 286,                      /* stm  */
+  YYSYMBOL_actions = 287,                  /* actions  */
+  YYSYMBOL_brk_actions = 288,              /* brk_actions  */
+  YYSYMBOL_action = 289,                   /* action  */
+  YYSYMBOL_brk_action = 290,               /* brk_action  */
+  YYSYMBOL_brk_if_cmd = 291,               /* brk_if_cmd  */
+  YYSYMBOL_if_cmd = 292,                   /* if_cmd  */
+  YYSYMBOL_while_cmd = 293,                /* while_cmd  */
+  YYSYMBOL_foreach_cmd = 294,              /* foreach_cmd  */
+  YYSYMBOL_switch_cmd = 295,               /* switch_cmd  */
+  YYSYMBOL_switch_stm = 296,               /* switch_stm  */
+  YYSYMBOL_case_stms = 297,                /* case_stms  */
+  YYSYMBOL_case_stm = 298,                 /* case_stm  */
+  YYSYMBOL_default_stm = 299,              /* default_stm  */
+  YYSYMBOL_func_param = 300,               /* func_param  */
+  YYSYMBOL_route_param = 301,              /* route_param  */
+  YYSYMBOL_async_func = 302,               /* async_func  */
+  YYSYMBOL_return_param = 303,             /* return_param  */
+  YYSYMBOL_return_params = 304,            /* return_params  */
+  YYSYMBOL_cmd = 305                       /* cmd  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  244
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   2350
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  215
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  91
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  550
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1045
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   469
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   534,   534,   537,   538,   539,   542,   543,   544,   544,
+     545,   545,   546,   546,   547,   547,   548,   548,   549,   549,
+     550,   550,   551,   551,   552,   552,   554,   557,   572,   581,
+     596,   597,   600,   601,   615,   620,   630,   631,   634,   647,
+     656,   663,   665,   666,   667,   671,   673,   675,   680,   688,
+     690,   692,   694,   696,   701,   708,   710,   712,   714,   718,
+     721,   722,   728,   729,   732,   734,   736,   742,   745,   748,
+     751,   754,   757,   760,   763,   766,   769,   774,   775,   778,
+     779,   779,   786,   787,   789,   790,   793,   801,   810,   816,
+     823,   829,   836,   842,   849,   855,   862,   868,   877,   878,
+     879,   882,   883,   884,   887,   888,   891,   892,   893,   897,
+     905,   913,   919,   927,   931,   943,   944,   945,   946,   947,
+     948,   963,   965,   968,   969,   990,   991,  1002,  1003,  1014,
+    1015,  1024,  1025,  1031,  1032,  1038,  1039,  1041,  1042,  1067,
+    1092,  1100,  1101,  1109,  1110,  1117,  1118,  1124,  1125,  1128,
+    1129,  1130,  1131,  1132,  1133,  1134,  1135,  1136,  1137,  1138,
+    1139,  1140,  1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,
+    1149,  1150,  1151,  1152,  1156,  1157,  1160,  1164,  1165,  1166,
+    1174,  1182,  1190,  1198,  1201,  1202,  1205,  1206,  1214,  1222,
+    1230,  1238,  1246,  1254,  1257,  1258,  1261,  1262,  1263,  1264,
+    1265,  1266,  1267,  1268,  1269,  1270,  1271,  1272,  1273,  1274,
+    1284,  1285,  1299,  1300,  1301,  1302,  1303,  1304,  1305,  1306,
+    1307,  1308,  1309,  1310,  1311,  1312,  1313,  1314,  1324,  1334,
+    1335,  1340,  1341,  1344,  1348,  1349,  1354,  1355,  1358,  1359,
+    1362,  1363,  1366,  1367,  1374,  1375,  1382,  1384,  1387,  1388,
+    1391,  1392,  1395,  1398,  1401,  1402,  1405,  1406,  1409,  1414,
+    1415,  1422,  1423,  1430,  1431,  1438,  1439,  1441,  1442,  1446,
+    1447,  1450,  1451,  1453,  1454,  1456,  1458,  1460,  1461,  1462,
+    1463,  1465,  1466,  1475,  1478,  1488,  1491,  1535,  1536,  1541,
+    1543,  1545,  1546,  1552,  1554,  1568,  1570,  1573,  1574,  1577,
+    1578,  1585,  1586,  1593,  1594,  1598,  1626,  1627,  1629,  1630,
+    1633,  1634,  1637,  1638,  1648,  1658,  1660,  1662,  1663,  1665,
+    1666,  1668,  1671,  1673,  1676,  1677,  1680,  1682,  1685,  1688,
+    1692,  1693,  1699,  1705,  1711,  1715,  1716,  1719,  1735,  1751,
+    1752,  1755,  1761,  1771,  1781,  1792,  1795,  1804,  1809,  1832,
+    1837,  1845,  1861,  1864,  1870,  1873,  1881,  1887,  1890,  1896,
+    1899,  1907,  1910,  1918,  1921,  1929,  1932,  1945,  1948,  1954,
+    1959,  1960,  1961,  1962,  1963,  1964,  1967,  1968,  1971,  1972,
+    1973,  1974,  1976,  1977,  1980,  1981,  1984,  1985,  1986,  1989,
+    2005,  2010,  2011,  2012,  2014,  2019,  2022,  2025,  2028,  2031,
+    2037,  2038,  2039,  2040,  2041,  2042,  2043,  2044,  2045,  2046,
+    2050,  2051,  2052,  2053,  2054,  2055,  2058,  2061,  2064,  2067,
+    2070,  2073,  2076,  2079,  2082,  2085,  2088,  2091,  2104,  2117,
+    2132,  2133,  2134,  2135,  2136,  2139,  2140,  2141,  2144,  2145,
+    2146,  2149,  2150,  2151,  2155,  2156,  2157,  2160,  2161,  2162,
+    2163,  2164,  2165,  2166,  2167,  2170,  2171,  2172,  2173,  2174,
+    2175,  2176,  2177,  2178,  2181,  2189,  2199,  2207,  2217,  2225,
+    2243,  2252,  2253,  2255,  2256,  2259,  2265,  2271,  2277,  2285,
+    2288,  2291,  2296,  2306,  2313,  2320,  2330,  2335,  2342,  2352,
+    2357,  2364,  2376,  2381,  2386,  2391,  2396,  2406,  2416,  2426,
+    2438,  2456,  2487,  2491,  2497,  2498,  2499,  2501,  2504,  2505,
+    2508,  2511,  2514,  2515,  2516,  2517,  2518,  2524,  2530,  2536,
+    2542,  2548,  2554,  2560,  2566,  2571,  2574,  2580,  2581,  2583,
+    2589,  2590,  2592,  2596,  2615,  2616,  2618,  2641,  2677,  2679,
+    2682,  2684,  2686,  2688,  2690,  2692,  2694,  2701,  2708,  2715,
+    2722
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "DROP", "ASSERT",
+  "EXIT", "RETURN", "LOG_TOK", "ERROR", "ROUTE", "ROUTE_FAILURE",
+  "ROUTE_ONREPLY", "ROUTE_BRANCH", "ROUTE_ERROR", "ROUTE_LOCAL",
+  "ROUTE_STARTUP", "ROUTE_TIMER", "ROUTE_EVENT", "IF", "ELSE", "SWITCH",
+  "CASE", "DEFAULT", "BREAK", "WHILE", "FOR", "IN", "READONLY", "EXPIRE",
+  "NULLV", "XDBG", "XLOG", "XLOG_BUF_SIZE", "XLOG_FORCE_COLOR",
+  "XLOG_PRINT_LEVEL", "XLOG_LEVEL", "PV_PRINT_BUF_SIZE", "DEBUG_MODE",
+  "ENABLE_ASSERTS", "ABORT_ON_ASSERT", "LOGLEVEL", "LOGPREFIX",
+  "LOGSTDOUT", "LOGSTDERROR", "STDERROR_ENABLED", "SYSLOG_ENABLED",
+  "LOG_EVENT_ENABLED", "STDERROR_LEVEL_FILTER", "SYSLOG_LEVEL_FILTER",
+  "LOG_EVENT_LEVEL_FILTER", "STDERROR_FORMAT", "SYSLOG_FORMAT",
+  "LOG_JSON_BUF_SIZE", "LOG_MSG_BUF_SIZE", "LOGFACILITY",
+  "SYSLOG_FACILITY", "LOGNAME", "SYSLOG_NAME", "AVP_ALIASES", "LISTEN",
+  "SOCKET", "MEMGROUP", "ALIAS", "AUTO_ALIASES", "TAG", "DNS", "REV_DNS",
+  "DNS_TRY_IPV6", "DNS_TRY_NAPTR", "DNS_RETR_TIME", "DNS_RETR_NO",
+  "DNS_SERVERS_NO", "DNS_USE_SEARCH", "MAX_WHILE_LOOPS", "UDP_WORKERS",
+  "CHECK_VIA", "SHM_HASH_SPLIT_PERCENTAGE", "SHM_SECONDARY_HASH_SIZE",
+  "SHM_CACHE_SIZE", "PKG_ARENA_SIZE", "MEM_WARMING_ENABLED",
+  "MEM_WARMING_PATTERN_FILE", "MEM_WARMING_PERCENTAGE", "RPM_MEM_FILE",
+  "RPM_MEM_SIZE", "MEMLOG", "MEMDUMP", "SHM_MEMLOG_SIZE",
+  "EXECMSGTHRESHOLD", "EXECDNSTHRESHOLD", "TCPTHRESHOLD",
+  "EVENT_SHM_THRESHOLD", "EVENT_PKG_THRESHOLD", "QUERYBUFFERSIZE",
+  "QUERYFLUSHTIME", "SIP_WARNING", "SERVER_SIGNATURE", "SERVER_HEADER",
+  "USER_AGENT_HEADER", "LOADMODULE", "MPATH", "MODPARAM", "MAXBUFFER",
+  "CHROOT", "WDIR", "MHOMED", "POLL_METHOD", "TCP_ACCEPT_ALIASES",
+  "TCP_WORKERS", "TCP_CONNECT_TIMEOUT", "TCP_CON_LIFETIME",
+  "TCP_SOCKET_BACKLOG", "TCP_MAX_CONNECTIONS", "TCP_NO_NEW_CONN_BFLAG",
+  "TCP_NO_NEW_CONN_RPLFLAG", "TCP_KEEPALIVE", "TCP_KEEPCOUNT",
+  "TCP_KEEPIDLE", "TCP_KEEPINTERVAL", "TCP_MAX_MSG_TIME",
+  "TCP_PARALLEL_READ_ON_WORKERS", "TCP_STICKY_WORKERS", "TCP_MAIN_SHARDS",
+  "TCP_HANDSHAKE_WORKERS", "ADVERTISED_ADDRESS", "ADVERTISED_PORT",
+  "DISABLE_CORE", "OPEN_FD_LIMIT", "MCAST_LOOPBACK", "MCAST_TTL", "TOS",
+  "DISABLE_DNS_FAILOVER", "DISABLE_DNS_BLACKLIST", "DST_BLACKLIST",
+  "DISABLE_STATELESS_FWD", "DB_VERSION_TABLE", "DB_DEFAULT_URL",
+  "DB_MAX_ASYNC_CONNECTIONS", "DISABLE_503_TRANSLATION", "SYNC_TOKEN",
+  "ASYNC_TOKEN", "LAUNCH_TOKEN", "AUTO_SCALING_PROFILE",
+  "AUTO_SCALING_CYCLE", "TIMER_WORKERS", "EQUAL", "EQUAL_T", "GT", "LT",
+  "GTE", "LTE", "DIFF", "MATCH", "NOTMATCH", "COLONEQ", "PLUSEQ",
+  "MINUSEQ", "SLASHEQ", "MULTEQ", "MODULOEQ", "BANDEQ", "BOREQ", "BXOREQ",
+  "OR", "AND", "BOR", "BAND", "BXOR", "BLSHIFT", "BRSHIFT", "PLUS",
+  "MINUS", "MULT", "MODULO", "NOT", "BNOT", "NUMBER", "ZERO", "ID",
+  "STRING", "SCRIPTVAR", "IPV6ADDR", "IPV4ADDR", "IPNET", "COMMA",
+  "SEMICOLON", "RPAREN", "LPAREN", "LBRACE", "RBRACE", "LBRACK", "RBRACK",
+  "SLASH", "AS", "USE_WORKERS", "SOCK_TOS", "RECV_BATCH",
+  "USE_AUTO_SCALING_PROFILE", "MAX", "MIN", "DOT", "CR", "COLON", "ANY",
+  "ANYCAST", "ACCEPT_SUBDOMAIN", "FRAG", "REUSE_PORT", "SCRIPTVARERR",
+  "SCALE_UP_TO", "SCALE_DOWN_TO", "ON", "CYCLES", "CYCLES_WITHIN",
+  "PERCENTAGE", "$accept", "cfg", "statements", "statement", "$@1", "$@2",
+  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "listen_id", "host_sep",
+  "host", "proto", "port", "portrange", "snumber", "phostport",
+  "phostportrange", "any_alias", "alias_def", "id_lst", "listen_id_def",
+  "socket_def_param", "socket_def_params", "socket_def", "$@10",
+  "any_proto", "multi_string", "blst_elem", "blst_def", "blst_flag",
+  "blst_flags", "blst_elem_list", "auto_scale_profile_def", "assign_stm",
+  "module_stm", "ip", "ipv4", "ipv6addr", "ipv6", "ipnet", "folded_string",
+  "route_name", "route_name_var", "route_stm", "failure_route_stm",
+  "onreply_route_stm", "branch_route_stm", "error_route_stm",
+  "local_route_stm", "startup_route_stm", "timer_route_stm",
+  "event_route_stm", "exp", "equalop", "compop", "matchop", "intop",
+  "strop", "script_var", "exp_elem", "exp_cond", "assignop", "assignexp",
+  "assign_cmd", "exp_stm", "brk_stm", "stm", "actions", "brk_actions",
+  "action", "brk_action", "brk_if_cmd", "if_cmd", "while_cmd",
+  "foreach_cmd", "switch_cmd", "switch_stm", "case_stms", "case_stm",
+  "default_stm", "func_param", "route_param", "async_func", "return_param",
+  "return_params", "cmd", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-894)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-480)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    2149,  -103,   -54,   -17,    10,    19,    35,   183,   201,   236,
+     242,   262,   263,   280,   288,   306,   341,   353,   356,   368,
+     369,   416,   431,   473,   521,   535,   539,   552,   555,   567,
+     568,   579,   580,   607,   612,    34,    36,   352,   367,   375,
+     533,   626,   627,   628,   631,   644,   690,   691,   693,   697,
+     750,   751,   753,   754,   756,   758,   763,   770,   772,   777,
+     780,   781,   785,   796,   800,   802,   804,    29,   805,    28,
+     806,   809,   810,   812,   819,   820,   821,   822,   823,   824,
+     826,   835,   839,   840,   841,   851,   852,   853,   856,   858,
+     869,   872,   873,   875,   884,   888,   889,   891,   892,   585,
+     586,   893,   895,   896,   912,   914,   916,   925,   936,   937,
+    -894,   154,  1979,  -894,   232,   412,   522,   757,   766,   776,
+     864,   963,   978,  -894,  -894,  -894,   158,   194,   277,   273,
+     359,   360,   388,   389,   -97,    46,   393,   399,   401,   402,
+     404,   339,   377,   384,   848,   894,   423,   428,    15,   103,
+     104,   114,   155,   165,   907,    58,   429,   430,   440,  -894,
+     911,  -894,   918,  -894,   921,  -894,   927,  -894,   929,  -894,
+     935,   441,   444,   456,   457,   458,   459,   462,   463,   117,
+     464,   121,   465,   403,   419,   427,   466,   467,   469,   470,
+     471,   478,   486,   491,   503,   126,   128,  -894,  -894,   131,
+    -894,   909,   510,   106,   110,   518,   119,   523,   525,   541,
+     543,   544,   545,   169,   170,   551,   565,   566,   584,   587,
+     590,   601,   618,   620,    22,   621,   622,   624,   643,   663,
+     166,  -894,   940,  -894,   942,   915,   943,   132,   146,   664,
+     667,   188,   668,   945,  -894,  -103,  -894,     9,  -894,    17,
+    -894,    63,  -894,    43,  -894,    26,  -894,    44,  -894,    75,
+    -894,    67,  -894,    68,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,   946,   949,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,   910,
+     859,  -894,  -894,  -894,   924,  -894,  1127,   938,  -894,  -894,
+    -894,   956,   941,  -894,  -111,   951,  -894,   933,  1213,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,   948,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+     955,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,   958,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,   983,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,   -76,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,   939,  -894,  -894,
+    -894,   987,  -894,  1798,   550,  -894,   550,  -894,  1798,   550,
+    -894,   550,  -894,  1798,  -894,  1798,  -894,  1798,  -894,   550,
+    -894,   550,  -894,  -894,  1282,  1469,   150,  -894,   994,   834,
+    -894,   272,   982,   834,  -894,  -894,  1009,  1013,  1023,  1024,
+     760,  1012,  -894,  1027,  1026,  1018,  1019,  1020,   734,    56,
+      65,    77,  1029,  1030,  1031,  1032,  1035,  1037,  1047,  1048,
+      81,  -894,  -894,  -894,  1385,  1028,   803,  -894,  -894,  -894,
+    -894,  -894,    50,  -894,  -894,  -894,  1045,  1046,   850,  1052,
+    1053,   882,   928,   969,  1055,  1054,  1056,  1057,  1070,   834,
+    1074,  1078,  1079,  1083,  -894,  -894,  -894,  -894,  1469,  -894,
+    -894,  1084,  -894,  -894,  1060,  -894,  -894,  1063,  -894,  1073,
+    -894,  -894,  -894,  -894,  -894,  -894,  -131,  1223,  1076,  -894,
+    1082,  1378,  1102,   594,  -894,  -894,  -894,   156,  -894,   151,
+    -894,    48,  1378,   -96,  1378,   -96,  1085,  1110,  1113,  1113,
+    -894,    96,  1263,  1264,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  1507,  -894,  -894,  -894,  -894,  -894,  -894,  1106,
+    1112,  -894,  1115,  1117,  -894,  -894,  -894,  1133,  1122,   673,
+     717,  -894,  1111,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+       7,    47,  1062,   760,  -894,   917,  -894,   -42,  -894,  -894,
+     102,  -894,  -894,  1136,  -894,  1378,  1378,  1570,  1507,  -894,
+     211,  1691,  -894,  -894,  -894,  -894,  -894,  -894,  -894,   320,
+    -894,   -26,     6,  1128,  1130,  1143,  1131,  1144,  1146,  -894,
+     198,  -894,   -18,  1149,   547,  1303,   -37,    -4,   -49,   220,
+      82,  1155,   212,  1151,  -894,   748,  -894,  -894,  -894,   268,
+    -894,  -894,  1507,  -894,  1507,  -894,  1022,  -894,  1561,  -894,
+    1798,  1798,  1798,  1798,  1166,  1798,  -894,  1187,  1175,  -894,
+    1175,   721,  -894,  -894,  -894,  -894,  -894,  -894,   294,  1174,
+     537,  -894,   -42,  -894,  -894,  -894,  1177,   297,  -894,  1159,
+    -894,  1191,  -894,   581,  -894,  1001,  1153,  1378,  1378,  1194,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,   295,
+     -87,  -894,   -97,   -70,  -894,  -894,  -894,  -894,  -894,   512,
+     320,  -894,   320,  -894,  -894,  -894,  1195,  -894,  1197,  -894,
+     351,  -894,  1611,  1181,  1419,   -96,  -894,  -894,  -894,  -894,
+    1201,  -894,  -894,  -894,   193,   550,   550,  -894,  -894,  -894,
+    -894,  -894,   944,  -894,  -894,  1104,  1507,  1507,  1507,  1507,
+    1507,  1507,  1507,  1507,  1507,  1507,  1071,  1126,  1158,  1190,
+    1200,  1222,  1214,  1217,  -894,  1175,  -894,  -894,  -894,  1215,
+     599,   902,  -109,  -894,  -894,  1376,  -894,  -894,  -894,  -894,
+    -894,  1228,  -894,  -894,  -894,  -894,  -894,   320,  -894,   615,
+     619,  1229,  1233,  -894,  -894,  -894,  -894,   629,  1694,  1401,
+    -894,  1400,  1242,  1246,  -894,  1471,  1249,  -894,  -894,  -894,
+    -894,  -894,  -894,    86,  1250,   564,   589,  1254,  -894,   634,
+     645,   661,  -894,  -894,  -894,  -894,   790,   790,   790,   790,
+     790,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,  -894,
+    1798,  -894,  -894,  1274,   902,  -109,  -894,   662,  1260,  1259,
+    -894,  -894,  -894,  -894,  -894,  -894,   392,  -894,  -894,  1277,
+    1611,  1262,  1258,   122,  -894,  1378,  -894,  -894,   652,  -894,
+    -894,  -894,  -894,  1419,  -894,  -894,  -894,  -894,  1272,  -894,
+    1273,  -894,  1347,  1275,   666,  1267,  -109,  -894,  -894,   -88,
+    -894,  -894,  -894,  -894,  -894,  -894,  1256,  1257,  -894,  1265,
+    -894,  -894,   595,  -894,  -894,  -894,  -894,  1270,  1279,  -894,
+    -894,  -109,  -894,  -894,   677,  1261,  1292,  1757,  1757,  1757,
+    1419,  -894,  -894,   698,  1290,  -894,  1294,  1271,   606,   684,
+     731,  1454,  1304,  -894,  1296,  1281,  1308,  1419,  1300,  -894,
+    1314,  1286,  -894,  -894,  1320,  1322,  1474,  1327,  1328,  1478,
+    1293,  1330,  -894,  1295,  -894
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      26,     0,     0,     4,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     6,     7,   328,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   157,
+       0,   159,     0,   161,     0,   163,     0,   165,     0,   167,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   330,   329,     0,
+     334,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   310,     0,   312,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     1,     5,     3,     0,     9,     0,
+      11,     0,    13,     0,    15,     0,    17,     0,    19,     0,
+      21,     0,    23,     0,    25,   277,   274,   278,   275,   279,
+     276,   281,     0,     0,    42,   280,   273,   272,   121,   120,
+     117,   116,   119,   118,   113,   115,   114,   123,   122,   125,
+     124,   127,   126,   129,   128,   131,   130,   133,   132,   135,
+     134,   137,   136,   138,   139,   141,   140,   143,   142,   145,
+     144,   147,   146,   149,   148,   151,   150,   285,    35,     0,
+      79,   284,   283,   282,     0,   289,     0,    32,    28,   338,
+     337,     0,     0,    55,    29,     0,    59,    60,    62,   288,
+      27,   335,   339,   336,   291,   290,   153,   152,   155,   154,
+     156,   158,   160,   162,   164,   166,   169,   168,   174,   172,
+     178,   177,   180,   179,   182,   181,   184,   183,   186,   185,
+     188,   187,   190,   189,   192,   191,   194,   193,   196,   195,
+     198,   197,   202,   201,   200,   199,   204,   203,   206,   205,
+     208,   207,   210,   209,   212,   211,   214,   213,   216,   215,
+     218,   217,   267,   266,   269,   268,   271,   270,   308,   307,
+       0,   171,   170,   221,   220,   219,   224,   223,   222,   226,
+     225,   229,   227,   228,   231,   230,   234,   232,   236,   235,
+     238,   237,   240,   239,   242,   241,   244,   243,   246,   245,
+     248,   247,   261,   260,   263,   262,   265,   264,   250,   249,
+     252,   251,   254,   253,   256,   255,   259,   257,   293,    32,
+     292,   295,   294,   297,   296,   299,   298,   301,   300,   303,
+     302,   306,   304,   305,   309,   311,   100,   315,   317,   316,
+     319,   318,   321,   320,   323,   322,   325,     0,   324,   327,
+     326,   175,   352,     0,     0,   354,     0,   357,     0,     0,
+     359,     0,   361,     0,   363,     0,   365,     0,   367,     0,
+     369,     0,    43,    44,     0,     0,     0,    48,     0,     0,
+      31,     0,     0,     0,    61,    63,     0,     0,     0,     0,
+       0,     0,   314,     0,     0,   512,     0,   514,   524,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   389,   453,   390,     0,     0,     0,   442,   448,   449,
+     450,   451,     0,   346,   345,   347,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    49,    50,     0,     0,
+       0,     0,     0,     0,    67,    70,    68,    69,    77,    81,
+     287,    84,   286,   340,    56,    34,    33,    45,   173,     0,
+     233,   258,   103,   101,   102,   105,   100,     0,     0,   176,
+       0,     0,     0,     0,   519,   516,   527,     0,   530,     0,
+     534,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     539,     0,   400,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,     0,   452,   443,   350,   441,   454,   447,     0,
+       0,   355,     0,     0,   360,   362,   364,     0,     0,     0,
+       0,    75,    64,    74,    71,    72,    73,    76,    78,    85,
+       0,     0,     0,     0,   313,     0,   341,     0,    99,   107,
+       0,   342,    96,     0,   513,     0,     0,     0,     0,   393,
+       0,   394,   375,   391,   432,   392,   431,   430,   515,     0,
+     522,     0,     0,     0,     0,     0,     0,     0,     0,   348,
+       0,   349,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   481,   483,   536,   486,   489,     0,
+     428,   429,     0,   411,     0,   410,   412,   413,   427,   414,
+       0,     0,     0,     0,     0,     0,    53,    41,    51,    54,
+      52,     0,    58,    36,    37,    57,    47,    46,     0,     0,
+       0,   104,     0,    97,    82,    83,     0,     0,   108,     0,
+      98,     0,   372,     0,   434,     0,     0,     0,     0,     0,
+     511,   376,   378,   379,   380,   381,   377,   382,   383,   384,
+     385,   388,     0,     0,   507,   506,   505,   504,   508,     0,
+       0,   520,     0,   517,   528,   525,     0,   531,     0,   535,
+       0,   532,     0,     0,     0,     0,   343,   540,   344,   541,
+       0,   542,   543,   503,     0,     0,     0,   550,   538,   484,
+     487,   490,   485,   537,   425,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    66,    65,   331,   333,   332,     0,
+       0,     0,     0,    94,   106,     0,   373,   433,   374,   371,
+     370,     0,   398,   399,   397,   396,   395,     0,   523,     0,
+       0,     0,     0,   494,   492,   493,   495,     0,     0,   466,
+     438,     0,     0,     0,   462,     0,     0,   468,   435,   457,
+     458,   459,   460,     0,     0,     0,     0,     0,   500,     0,
+       0,     0,   482,   488,   491,   426,   421,   420,   422,   423,
+     424,   415,   416,   417,   419,   418,   351,   353,   356,   358,
+       0,   368,    40,    39,     0,     0,    95,     0,     0,     0,
+     510,   509,   521,   518,   526,   529,     0,   533,   440,     0,
+       0,     0,     0,   472,   474,     0,   455,   437,     0,   445,
+     461,   463,   456,     0,   544,   545,   502,   501,     0,   546,
+       0,   549,     0,     0,     0,     0,     0,    90,    92,     0,
+     499,   496,   497,   498,   439,   467,     0,     0,   470,     0,
+     473,   471,     0,   446,   436,   444,   469,     0,     0,   366,
+      38,     0,    91,    93,     0,   112,     0,   478,   476,   480,
+       0,   547,   548,     0,     0,    88,     0,   111,     0,     0,
+       0,   464,     0,    89,     0,     0,     0,     0,     0,    86,
+       0,     0,   465,    87,     0,     0,     0,     0,     0,     0,
+       0,     0,   110,     0,   109
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -894,  -894,  -894,  1396,  -894,  -894,  -894,  -894,  -894,  -894,
+    -894,  -894,  -894,  -220,  -894,  -894,  -154,  -645,  -620,  -129,
+    -894,  -894,  -894,  -894,  1171,  -894,  -894,   932,  1364,  -894,
+     759,   931,   755,   920,   855,  -894,  -894,  -894,  -894,  -894,
+    -152,  -894,  1192,  -894,  -639,  -607,  -468,  -894,  -894,  -894,
+    -894,  -894,  -894,  -894,  -894,  -894,  -894,  -600,  -894,  -894,
+    -894,  -894,  -894,  -523,  -894,  -605,  -894,   206,  -572,  -894,
+    -893,   600,  -496,  -357,  -510,  -142,  -894,  -590,  -789,  -502,
+    -469,  -894,  -894,   576,  -894,   707,  -894,   905,   658,  -725,
+    -426
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   333,   522,   334,   319,   755,   748,   735,
+     336,   320,   337,   338,   339,   663,   588,   589,   321,   515,
+     766,   592,   679,   532,   605,   606,   680,   488,   123,   124,
+     681,   341,   342,   343,   682,   717,   566,   710,   248,   250,
+     252,   254,   256,   258,   260,   262,   264,   690,   789,   790,
+     791,   792,   793,   554,   692,   737,   642,   738,   555,   695,
+     897,   889,   556,   958,   557,   898,   899,   558,   559,   560,
+     561,   952,   953,   954,   991,   729,   887,   721,   798,   799,
+     562
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     275,   335,   568,   340,   460,   284,   693,   571,   752,   572,
+     492,   573,   298,   300,   302,   615,   309,   693,   495,   693,
+     719,   696,   712,   458,   714,   900,   757,   502,   567,   200,
+     197,   569,   696,   570,   696,   159,   763,   161,   767,   694,
+     750,   574,   125,   575,   500,   504,   646,   285,   756,   708,
+     694,   647,   694,   673,   381,   383,   385,   616,   646,   325,
+     520,   646,   646,   646,   497,   760,   618,   753,   508,   510,
+     996,   531,   340,   272,   273,   879,   506,   880,   620,   274,
+     693,   693,   630,   823,   551,   772,   773,   961,   691,   521,
+     702,   126,  -387,  -387,   754,   696,   696,   723,   711,   691,
+     713,   691,   715,   768,   311,   313,   900,   413,   728,   875,
+     551,   416,   553,   694,   694,   315,   530,  1021,   372,   736,
+     421,  -387,   376,   860,  1005,  1006,   531,   404,   127,   406,
+     816,   855,   408,   478,  1032,   820,   318,   821,   553,   329,
+     330,   676,   816,   951,   989,   777,   778,   480,   331,   817,
+     873,   590,   706,   709,   244,   128,   317,   703,   800,   265,
+     801,   764,   691,   691,   129,   736,   322,   471,   812,   900,
+     436,   438,   693,   693,   900,   818,   797,   869,   870,   160,
+     130,   162,   819,   753,   335,   697,   340,   696,   696,   486,
+     802,   775,   803,   310,   907,   267,   697,   493,   697,   494,
+     459,   328,   831,   329,   330,   694,   694,   496,   198,   736,
+     754,   736,   331,   906,   503,   201,   739,   938,   900,   900,
+     900,   900,   937,   753,   563,   286,   564,   565,   551,   900,
+     900,   900,   505,   501,   326,   648,   327,   328,   900,   329,
+     330,   247,   896,   617,   846,   847,   848,   849,   331,   851,
+     754,   498,   619,   499,   691,   691,   553,   509,   511,   697,
+     697,   332,   739,   507,   621,   646,   272,   273,   631,   824,
+     876,   962,   274,   595,   271,   724,   551,   797,   269,   797,
+     725,   312,   726,   314,   414,   415,   769,   886,   417,   418,
+     975,   770,   904,   316,   577,   974,   373,   422,   423,   594,
+     377,   728,   890,   597,   553,   405,   739,   407,   739,   914,
+     409,   479,   901,   736,   736,   736,   736,   736,   736,   736,
+     736,   736,   736,   896,   872,   481,   272,   273,   131,   591,
+     707,  1004,   274,   318,   266,   704,   646,   646,   646,   646,
+     297,   646,   472,   318,   473,   902,   132,   437,   439,   794,
+     693,   697,   697,   163,   797,   992,  1013,   910,   911,   662,
+     276,   278,   340,   272,   273,   696,   487,   340,   165,   274,
+     268,   340,   724,   551,   777,   778,   167,   725,   299,   908,
+     883,   133,   810,   694,   811,   301,   896,   134,   903,   280,
+     282,   896,   949,   901,   287,   779,   826,   780,   827,   818,
+     289,   553,   291,   293,   380,   295,   822,   135,   136,   614,
+     739,   739,   739,   739,   739,   739,   739,   739,   739,   739,
+     382,   980,   249,   983,   305,   137,   902,   340,   384,   307,
+     344,   346,   691,   138,   972,   896,   896,   896,   896,   646,
+     890,   348,   356,   272,   273,   358,   896,   896,   896,   274,
+     -30,   139,   832,   270,   833,   896,   901,   360,   362,   364,
+     366,   901,   646,   368,   370,   374,   378,   386,   388,   903,
+     390,   392,   394,   816,  -386,  -386,   329,   330,   676,   396,
+     856,   862,   689,   863,   701,   331,   140,   398,   705,   902,
+     272,   273,   400,   689,   902,   689,   274,   164,   141,   795,
+     551,   142,   727,  -386,   402,   901,   901,   901,   901,   272,
+     273,   411,   166,   143,   144,   274,   901,   901,   901,   419,
+     168,   272,   273,   765,   424,   901,   426,   274,   553,   697,
+     884,   551,   903,   251,   169,   277,   279,   903,   902,   902,
+     902,   902,   428,   759,   430,   432,   434,   272,   273,   902,
+     902,   902,   440,   274,   272,   273,   689,   689,   902,   553,
+     274,   145,   272,   273,   281,   283,   442,   444,   274,   288,
+     796,   981,   551,   272,   273,   290,   146,   292,   294,   274,
+     296,   903,   903,   903,   903,   446,   231,   233,   448,   272,
+     273,   450,   903,   903,   903,   274,   830,   272,   273,   306,
+     553,   903,   452,   274,   308,   345,   347,   993,   765,   535,
+     536,   537,   538,   539,   540,   541,   349,   357,   147,   454,
+     359,   456,   461,   463,   892,   465,   543,  -477,  -477,   893,
+     544,   545,   361,   363,   365,   367,   546,   547,   369,   371,
+     375,   379,   387,   389,   467,   391,   393,   395,   689,   689,
+    1018,  1019,  1020,   993,   397,   535,   536,   537,   538,   539,
+     540,   541,   399,   874,   469,   482,   148,   401,   484,   489,
+     892,   796,   543,   796,   746,   893,   544,   545,   170,   403,
+     149,   885,   546,   547,   150,   993,   412,   535,   536,   537,
+     538,   539,   540,   541,   420,   727,   877,   151,   878,   425,
+     152,   427,   892,   913,   543,  -475,  -475,   893,   544,   545,
+     777,   778,   153,   154,   546,   547,   818,   429,   749,   431,
+     433,   435,   854,   858,   155,   156,   563,   441,   564,   565,
+     232,   234,   993,   814,   535,   536,   537,   538,   539,   540,
+     541,   443,   445,   816,   777,   778,   548,   549,   796,   892,
+     964,   543,   157,   959,   893,   544,   545,   158,   777,   778,
+     447,   546,   547,   449,   272,   273,   451,   866,   818,   253,
+     274,   171,   172,   173,   551,   965,   174,   453,   699,   255,
+     700,  1010,   602,   935,   550,   936,   551,   603,   604,   175,
+     257,   894,   548,   549,   455,  -477,   457,   462,   464,   877,
+     466,   942,   553,   877,   644,   943,   535,   536,   537,   538,
+     539,   540,   541,   946,   553,   947,   995,   982,   832,   468,
+     967,   542,   987,   543,   548,   549,   689,   544,   545,   968,
+     550,   969,   551,   546,   547,   176,   177,   894,   178,   470,
+     483,   994,   179,   485,   490,   970,   976,   971,   977,   747,
+    1001,   644,  1002,   535,   536,   537,   538,   539,   540,   541,
+     553,  1014,   550,  1015,   551,   959,   959,   959,   542,   894,
+     543,   548,   549,  -475,   544,   545,   995,   995,   995,   259,
+     546,   547,  1022,   644,  1023,   535,   536,   537,   538,   539,
+     540,   541,   553,   747,   776,   180,   181,   747,   182,   183,
+     542,   184,   543,   185,   272,   273,   544,   545,   186,   550,
+     274,   551,   546,   547,   551,   187,   894,   188,   272,   273,
+    -479,   613,   189,   -80,   274,   190,   191,   829,   551,   644,
+     192,   535,   536,   537,   538,   539,   540,   541,   834,   553,
+     835,   193,   553,   548,   549,   194,   542,   195,   543,   196,
+     199,   202,   544,   545,   203,   204,   553,   205,   546,   547,
+     841,   842,   843,   844,   206,   207,   208,   209,   210,   211,
+     644,   212,   535,   536,   537,   538,   539,   540,   541,   261,
+     213,   550,   845,   551,   214,   215,   216,   542,   552,   543,
+     548,   549,   645,   544,   545,   263,   217,   218,   219,   546,
+     547,   220,   644,   221,   535,   536,   537,   538,   539,   540,
+     541,   553,   459,   328,   222,   329,   330,   223,   224,   542,
+     225,   543,   548,   549,   331,   544,   545,   303,   550,   226,
+     551,   546,   547,   227,   228,   552,   229,   230,   235,   651,
+     236,   237,   916,   917,   918,   919,   920,   921,   922,   923,
+     924,   925,   -80,   -80,   -80,   -80,   -80,   238,   553,   239,
+     550,   240,   551,   -80,   -80,   -80,   -80,   552,   548,   549,
+     241,   654,   644,   304,   535,   536,   537,   538,   539,   540,
+     541,   242,   243,   329,   330,   676,   324,   350,   410,   542,
+     553,   543,   331,   476,   351,   544,   545,   352,   329,   330,
+     676,   546,   547,   353,   762,   354,   550,   331,   551,   548,
+     549,   355,   514,   552,   272,   273,   474,   655,   475,   477,
+     274,   491,   512,   912,   551,   513,   516,   644,   517,   535,
+     536,   537,   538,   539,   540,   541,   553,   329,   524,   527,
+     -35,   548,   549,   519,   542,   526,   543,   550,   533,   551,
+     544,   545,   553,   523,   552,   528,   546,   547,   656,   644,
+     596,   535,   536,   537,   538,   539,   540,   541,   781,   782,
+     783,   784,   785,   786,   787,   788,   542,   553,   543,   550,
+     529,   551,   544,   545,   534,   593,   552,   598,   546,   547,
+     867,   644,   599,   535,   536,   537,   538,   539,   540,   541,
+     607,   600,   601,   608,   609,   610,   611,   612,   542,   553,
+     543,   548,   549,   643,   544,   545,   622,   623,   624,   625,
+     546,   547,   626,   644,   627,   535,   536,   537,   538,   539,
+     540,   541,   272,   273,   628,   629,   649,   650,   274,   657,
+     542,   758,   543,   652,   653,   658,   544,   545,   661,   550,
+     664,   551,   546,   547,   665,   666,   552,   672,   659,   660,
+     926,   667,   670,   591,   716,   671,   548,   549,   684,   836,
+     837,   838,   839,   840,   841,   842,   843,   844,   644,   553,
+     535,   536,   537,   538,   539,   540,   541,   683,   698,   718,
+     915,   720,   730,   731,   740,   542,   845,   543,   548,   549,
+     741,   544,   545,   742,   550,   743,   551,   546,   547,   744,
+     745,   552,   771,   751,   804,   927,   805,   807,   836,   837,
+     838,   839,   840,   841,   842,   843,   844,   806,   808,   815,
+     548,   549,   809,   675,   553,   813,   550,   828,   551,   825,
+     329,   330,   676,   552,   868,   845,   677,   928,   644,   331,
+     535,   536,   537,   538,   539,   540,   541,   850,   852,   853,
+     857,   861,   548,   549,   865,   542,   553,   543,   550,   891,
+     551,   544,   545,   871,   881,   552,   882,   546,   547,   929,
+     905,   535,   536,   537,   538,   539,   540,   541,   930,   326,
+     932,   327,   328,   933,   329,   330,   542,   675,   553,   934,
+     550,   939,   551,   331,   329,   330,   676,   552,   546,   547,
+     677,   931,   678,   331,   940,   944,   332,   548,   549,   945,
+     950,   951,   535,   536,   537,   538,   539,   540,   541,   955,
+     553,   956,   272,   273,   960,   979,   963,   892,   274,   543,
+     966,   986,   893,   544,   545,   973,   978,   988,   997,   546,
+     547,  1000,   998,  1003,   576,   550,  1011,   551,  1007,  1008,
+     459,   328,   552,   329,   330,  1012,   984,  1009,  1017,  1024,
+    1025,  1016,   331,  1027,   535,   536,   537,   538,   539,   540,
+     541,  1026,  1029,  1028,  1031,   553,  1033,   548,   549,   892,
+    1034,   543,  1030,  1036,   893,   544,   545,  1035,  1037,  1038,
+    1039,   546,   547,  1041,  1040,  1042,  1043,  1044,   246,   525,
+     535,   536,   537,   538,   539,   540,   541,   323,   548,   549,
+     668,   859,   669,   518,   864,   550,   674,   551,   761,   990,
+     632,   909,   552,   578,   722,   941,   999,   546,   547,   633,
+     634,   635,   636,   637,   638,   639,   640,   641,   272,   273,
+     985,     0,   685,     0,   274,   553,   550,     0,   551,   548,
+     549,     0,     0,     0,     0,   686,   687,     0,   688,     0,
+       0,     0,     0,   535,   536,   537,   538,   539,   540,   541,
+       0,     0,     0,     0,     0,     0,   553,     0,   542,     0,
+     543,     0,     0,     0,   544,   545,     0,   550,     0,   551,
+     546,   547,     0,     0,   894,     0,     0,   895,     0,     0,
+       0,   548,   549,     0,   535,   536,   537,   538,   539,   540,
+     541,     0,     0,     0,     0,     0,     0,   553,     0,   542,
+       0,   543,     0,     0,     0,   544,   545,     0,     0,     0,
+       0,   546,   547,     0,     0,     0,     0,   548,   549,   550,
+       0,   551,     0,     0,     0,     0,   894,     0,     0,     0,
+     957,     0,   579,   580,   581,   582,   583,     0,     0,     0,
+       0,     0,     0,   584,   585,   586,   587,   272,   273,   553,
+       0,     0,   732,   274,     0,   550,   733,   551,     0,     0,
+       0,     0,     0,     0,   734,     0,     0,   535,   536,   537,
+     538,   539,   540,   541,     0,     0,     0,     0,     0,     0,
+     548,   549,   542,     0,   543,   553,     0,     0,   544,   545,
+       0,     0,     0,     0,   546,   547,   836,   837,   838,   839,
+     840,   841,   842,   843,   844,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   550,     0,
+     551,   548,   549,   845,     0,   552,     0,     0,     0,   774,
+     535,   536,   537,   538,   539,   540,   541,     0,     0,     0,
+       0,     0,     0,     0,     0,   892,     0,   543,   553,     0,
+     893,   544,   545,     0,     0,     0,     0,   546,   547,   550,
+       0,   551,     0,     0,     0,     0,   552,     0,     0,   888,
+       0,   535,   536,   537,   538,   539,   540,   541,     0,     0,
+       0,     0,     0,     0,     0,     0,   542,     0,   543,   553,
+       0,     0,   544,   545,     0,     0,     0,     0,   546,   547,
+       0,     0,     0,     0,   548,   549,   632,   781,   782,   783,
+     784,   785,   786,   787,   788,   633,   634,   635,   636,   637,
+     638,   639,   640,   641,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   550,     0,   551,     0,     0,     0,     0,   552,
+       0,     0,     0,   948,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   548,   549,     0,
+       0,     0,   553,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   550,     0,   551,   548,   549,
+       0,     0,   894,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   553,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   550,     0,   551,    -2,
+     245,     0,     0,   552,     0,     0,     0,     0,    -8,   -10,
+     -12,   -14,   -16,   -18,   -20,   -22,   -24,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   553,     0,     0,     0,
+       0,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,     0,    28,    29,
+      30,    31,    32,     0,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,     0,     0,
+       0,   107,   108,   109,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       1,     0,     0,     0,     0,     0,     0,     0,    -8,   -10,
+     -12,   -14,   -16,   -18,   -20,   -22,   -24,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     110,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,     0,    28,    29,
+      30,    31,    32,     0,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,     0,     0,
+       0,   107,   108,   109,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     110
+};
+
+static const yytype_int16 yycheck[] =
+{
+     129,   155,   498,   155,   224,   134,   611,   503,     1,   505,
+       1,   507,   141,   142,   143,   538,     1,   622,     1,   624,
+     627,   611,   622,     1,   624,   814,   671,     1,   496,     1,
+       1,   499,   622,   501,   624,     1,   675,     1,   677,   611,
+     660,   509,   145,   511,     1,     1,   556,     1,     1,     1,
+     622,     1,   624,   184,   183,   184,   185,     1,   568,     1,
+     171,   571,   572,   573,     1,   672,     1,   176,     1,     1,
+     963,   202,   224,   170,   171,   800,     1,   802,     1,   176,
+     685,   686,     1,     1,   180,   685,   686,     1,   611,   200,
+     613,   145,   179,   180,   203,   685,   686,     1,   621,   622,
+     623,   624,   625,     1,     1,     1,   895,     1,   631,   179,
+     180,     1,   208,   685,   686,     1,   192,  1010,     1,   642,
+       1,   208,     1,   762,   212,   213,   202,     1,   145,     1,
+     179,   751,     1,     1,  1027,   184,   178,   186,   208,   181,
+     182,   183,   179,    21,    22,   163,   164,     1,   190,   186,
+     789,     1,     1,   621,     0,   145,     1,     1,   184,     1,
+     186,   203,   685,   686,   145,   688,     1,     1,   186,   958,
+       1,     1,   777,   778,   963,   179,   699,   777,   778,   145,
+     145,   145,   186,   176,   338,   611,   338,   777,   778,     1,
+     184,   687,   186,   178,     1,     1,   622,   188,   624,   190,
+     178,   179,   725,   181,   182,   777,   778,   190,   179,   732,
+     203,   734,   190,   820,   188,   187,   642,   862,  1007,  1008,
+    1009,  1010,   861,   176,   176,   179,   178,   179,   180,  1018,
+    1019,  1020,   188,   190,   176,   185,   178,   179,  1027,   181,
+     182,     9,   814,   187,   740,   741,   742,   743,   190,   745,
+     203,   188,   187,   190,   777,   778,   208,   190,   190,   685,
+     686,   203,   688,   188,   187,   775,   170,   171,   187,   187,
+     793,   185,   176,     1,     1,   179,   180,   800,     1,   802,
+     184,   178,   186,   179,   178,   179,   184,   810,   178,   179,
+     935,   189,   815,   179,   514,   934,   179,   178,   179,   519,
+     179,   824,   812,   523,   208,   179,   732,   179,   734,   832,
+     179,   179,   814,   836,   837,   838,   839,   840,   841,   842,
+     843,   844,   845,   895,    29,   179,   170,   171,   145,   179,
+     179,   976,   176,   178,   176,   179,   846,   847,   848,   849,
+       1,   851,   176,   178,   178,   814,   145,   178,   178,    29,
+     955,   777,   778,     1,   877,   955,  1001,   825,   826,   579,
+       1,     1,   514,   170,   171,   955,   178,   519,     1,   176,
+     176,   523,   179,   180,   163,   164,     1,   184,     1,   186,
+      29,   145,   184,   955,   186,     1,   958,   145,   814,     1,
+       1,   963,   888,   895,     1,   184,   184,   186,   186,   179,
+       1,   208,     1,     1,     1,     1,   186,   145,   145,   538,
+     836,   837,   838,   839,   840,   841,   842,   843,   844,   845,
+       1,    29,    10,   946,     1,   145,   895,   579,     1,     1,
+       1,     1,   955,   145,   930,  1007,  1008,  1009,  1010,   949,
+     950,     1,     1,   170,   171,     1,  1018,  1019,  1020,   176,
+     178,   145,   184,   176,   186,  1027,   958,     1,     1,     1,
+       1,   963,   972,     1,     1,     1,     1,     1,     1,   895,
+       1,     1,     1,   179,   179,   180,   181,   182,   183,     1,
+     186,   184,   611,   186,   613,   190,   145,     1,   617,   958,
+     170,   171,     1,   622,   963,   624,   176,   145,   145,   179,
+     180,   145,   631,   208,     1,  1007,  1008,  1009,  1010,   170,
+     171,     1,   145,   145,   145,   176,  1018,  1019,  1020,     1,
+     145,   170,   171,   677,     1,  1027,     1,   176,   208,   955,
+     179,   180,   958,    11,     1,   176,   176,   963,  1007,  1008,
+    1009,  1010,     1,   672,     1,     1,     1,   170,   171,  1018,
+    1019,  1020,     1,   176,   170,   171,   685,   686,  1027,   208,
+     176,   145,   170,   171,   176,   176,     1,     1,   176,   176,
+     699,   179,   180,   170,   171,   176,   145,   176,   176,   176,
+     176,  1007,  1008,  1009,  1010,     1,     1,     1,     1,   170,
+     171,     1,  1018,  1019,  1020,   176,   725,   170,   171,   176,
+     208,  1027,     1,   176,   176,   176,   176,     1,   762,     3,
+       4,     5,     6,     7,     8,     9,   176,   176,   145,     1,
+     176,     1,     1,     1,    18,     1,    20,    21,    22,    23,
+      24,    25,   176,   176,   176,   176,    30,    31,   176,   176,
+     176,   176,   176,   176,     1,   176,   176,   176,   777,   778,
+    1007,  1008,  1009,     1,   176,     3,     4,     5,     6,     7,
+       8,     9,   176,   792,     1,     1,   145,   176,     1,     1,
+      18,   800,    20,   802,     1,    23,    24,    25,   145,   176,
+     145,   810,    30,    31,   145,     1,   176,     3,     4,     5,
+       6,     7,     8,     9,   176,   824,   184,   145,   186,   176,
+     145,   176,    18,   832,    20,    21,    22,    23,    24,    25,
+     163,   164,   145,   145,    30,    31,   179,   176,     1,   176,
+     176,   176,     1,   186,   145,   145,   176,   176,   178,   179,
+     145,   145,     1,   186,     3,     4,     5,     6,     7,     8,
+       9,   176,   176,   179,   163,   164,   140,   141,   877,    18,
+     186,    20,   145,   895,    23,    24,    25,   145,   163,   164,
+     176,    30,    31,   176,   170,   171,   176,   186,   179,    12,
+     176,   145,   145,   145,   180,   186,   145,   176,   184,    13,
+     186,   186,    22,   184,   178,   186,   180,    27,    28,   145,
+      14,   185,   140,   141,   176,   189,   176,   176,   176,   184,
+     176,   186,   208,   184,     1,   186,     3,     4,     5,     6,
+       7,     8,     9,   184,   208,   186,   958,   946,   184,   176,
+     186,    18,   951,    20,   140,   141,   955,    24,    25,   184,
+     178,   186,   180,    30,    31,   145,   145,   185,   145,   176,
+     176,   189,   145,   176,   176,   184,   184,   186,   186,   176,
+     184,     1,   186,     3,     4,     5,     6,     7,     8,     9,
+     208,   184,   178,   186,   180,  1007,  1008,  1009,    18,   185,
+      20,   140,   141,   189,    24,    25,  1018,  1019,  1020,    15,
+      30,    31,   184,     1,   186,     3,     4,     5,     6,     7,
+       8,     9,   208,   176,   688,   145,   145,   176,   145,   145,
+      18,   145,    20,   145,   170,   171,    24,    25,   145,   178,
+     176,   180,    30,    31,   180,   145,   185,   145,   170,   171,
+     189,   187,   145,    64,   176,   145,   145,   179,   180,     1,
+     145,     3,     4,     5,     6,     7,     8,     9,   732,   208,
+     734,   145,   208,   140,   141,   145,    18,   145,    20,   145,
+     145,   145,    24,    25,   145,   145,   208,   145,    30,    31,
+     170,   171,   172,   173,   145,   145,   145,   145,   145,   145,
+       1,   145,     3,     4,     5,     6,     7,     8,     9,    16,
+     145,   178,   192,   180,   145,   145,   145,    18,   185,    20,
+     140,   141,   189,    24,    25,    17,   145,   145,   145,    30,
+      31,   145,     1,   145,     3,     4,     5,     6,     7,     8,
+       9,   208,   178,   179,   145,   181,   182,   145,   145,    18,
+     145,    20,   140,   141,   190,    24,    25,   179,   178,   145,
+     180,    30,    31,   145,   145,   185,   145,   145,   145,   189,
+     145,   145,   836,   837,   838,   839,   840,   841,   842,   843,
+     844,   845,   193,   194,   195,   196,   197,   145,   208,   145,
+     178,   145,   180,   204,   205,   206,   207,   185,   140,   141,
+     145,   189,     1,   179,     3,     4,     5,     6,     7,     8,
+       9,   145,   145,   181,   182,   183,   179,   176,   179,    18,
+     208,    20,   190,   178,   176,    24,    25,   176,   181,   182,
+     183,    30,    31,   176,   187,   176,   178,   190,   180,   140,
+     141,   176,   202,   185,   170,   171,   176,   189,   176,   176,
+     176,   176,   176,   179,   180,   176,   202,     1,     1,     3,
+       4,     5,     6,     7,     8,     9,   208,   181,   205,   184,
+     202,   140,   141,   202,    18,   197,    20,   178,   209,   180,
+      24,    25,   208,   202,   185,   197,    30,    31,   189,     1,
+     178,     3,     4,     5,     6,     7,     8,     9,   146,   147,
+     148,   149,   150,   151,   152,   153,    18,   208,    20,   178,
+     197,   180,    24,    25,   197,   191,   185,   178,    30,    31,
+     189,     1,   179,     3,     4,     5,     6,     7,     8,     9,
+     188,   178,   178,   176,   178,   187,   187,   187,    18,   208,
+      20,   140,   141,   185,    24,    25,   187,   187,   187,   187,
+      30,    31,   187,     1,   187,     3,     4,     5,     6,     7,
+       8,     9,   170,   171,   187,   187,   191,   191,   176,   184,
+      18,   179,    20,   191,   191,   191,    24,    25,   178,   178,
+     176,   180,    30,    31,   176,   176,   185,   184,   202,   202,
+     189,   178,   202,   179,   179,   202,   140,   141,   186,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,     1,   208,
+       3,     4,     5,     6,     7,     8,     9,   211,   186,   179,
+     186,   178,    29,    29,   188,    18,   192,    20,   140,   141,
+     188,    24,    25,   188,   178,   188,   180,    30,    31,   176,
+     188,   185,   176,   202,   186,   189,   186,   186,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   184,   184,    26,
+     140,   141,   186,   174,   208,   186,   178,   186,   180,   184,
+     181,   182,   183,   185,   191,   192,   187,   189,     1,   190,
+       3,     4,     5,     6,     7,     8,     9,   191,   171,   184,
+     186,   184,   140,   141,   173,    18,   208,    20,   178,   188,
+     180,    24,    25,   179,   179,   185,   179,    30,    31,   189,
+     179,     3,     4,     5,     6,     7,     8,     9,   188,   176,
+     176,   178,   179,   176,   181,   182,    18,   174,   208,   184,
+     178,    25,   180,   190,   181,   182,   183,   185,    30,    31,
+     187,   189,   189,   190,   186,   186,   203,   140,   141,   186,
+      19,    21,     3,     4,     5,     6,     7,     8,     9,   187,
+     208,   185,   170,   171,   185,   176,   186,    18,   176,    20,
+     186,   179,    23,    24,    25,   171,   186,   189,   176,    30,
+      31,   176,   179,   186,   172,   178,   186,   180,   202,   202,
+     178,   179,   185,   181,   182,   186,   189,   202,   176,   179,
+     176,   210,   190,    19,     3,     4,     5,     6,     7,     8,
+       9,   210,   186,   179,   176,   208,   186,   140,   141,    18,
+     176,    20,   211,   173,    23,    24,    25,   211,   176,    25,
+     173,    30,    31,    25,   176,   212,   176,   212,   112,   338,
+       3,     4,     5,     6,     7,     8,     9,   153,   140,   141,
+     588,   762,   591,   331,   769,   178,   606,   180,   673,   953,
+     145,   824,   185,    64,   629,   877,   189,    30,    31,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   170,   171,
+     950,    -1,   174,    -1,   176,   208,   178,    -1,   180,   140,
+     141,    -1,    -1,    -1,    -1,   187,   188,    -1,   190,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      -1,    -1,    -1,    -1,    -1,    -1,   208,    -1,    18,    -1,
+      20,    -1,    -1,    -1,    24,    25,    -1,   178,    -1,   180,
+      30,    31,    -1,    -1,   185,    -1,    -1,   188,    -1,    -1,
+      -1,   140,   141,    -1,     3,     4,     5,     6,     7,     8,
+       9,    -1,    -1,    -1,    -1,    -1,    -1,   208,    -1,    18,
+      -1,    20,    -1,    -1,    -1,    24,    25,    -1,    -1,    -1,
+      -1,    30,    31,    -1,    -1,    -1,    -1,   140,   141,   178,
+      -1,   180,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,
+     189,    -1,   193,   194,   195,   196,   197,    -1,    -1,    -1,
+      -1,    -1,    -1,   204,   205,   206,   207,   170,   171,   208,
+      -1,    -1,   175,   176,    -1,   178,   179,   180,    -1,    -1,
+      -1,    -1,    -1,    -1,   187,    -1,    -1,     3,     4,     5,
+       6,     7,     8,     9,    -1,    -1,    -1,    -1,    -1,    -1,
+     140,   141,    18,    -1,    20,   208,    -1,    -1,    24,    25,
+      -1,    -1,    -1,    -1,    30,    31,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   178,    -1,
+     180,   140,   141,   192,    -1,   185,    -1,    -1,    -1,   189,
+       3,     4,     5,     6,     7,     8,     9,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    18,    -1,    20,   208,    -1,
+      23,    24,    25,    -1,    -1,    -1,    -1,    30,    31,   178,
+      -1,   180,    -1,    -1,    -1,    -1,   185,    -1,    -1,   188,
+      -1,     3,     4,     5,     6,     7,     8,     9,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    18,    -1,    20,   208,
+      -1,    -1,    24,    25,    -1,    -1,    -1,    -1,    30,    31,
+      -1,    -1,    -1,    -1,   140,   141,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   178,    -1,   180,    -1,    -1,    -1,    -1,   185,
+      -1,    -1,    -1,   189,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   140,   141,    -1,
+      -1,    -1,   208,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   178,    -1,   180,   140,   141,
+      -1,    -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   208,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   178,    -1,   180,     0,
+       1,    -1,    -1,   185,    -1,    -1,    -1,    -1,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   208,    -1,    -1,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    -1,    59,    60,
+      61,    62,    63,    -1,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,    -1,    -1,
+      -1,   142,   143,   144,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     201,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    -1,    59,    60,
+      61,    62,    63,    -1,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,    -1,    -1,
+      -1,   142,   143,   144,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     201
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     1,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    59,    60,
+      61,    62,    63,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   142,   143,   144,
+     201,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   253,   254,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,     1,
+     145,     1,   145,     1,   145,     1,   145,     1,   145,     1,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,     1,   179,   145,
+       1,   187,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,     1,   145,     1,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,     0,     1,   218,     9,   263,    10,
+     264,    11,   265,    12,   266,    13,   267,    14,   268,    15,
+     269,    16,   270,    17,   271,     1,   176,     1,   176,     1,
+     176,     1,   170,   171,   176,   234,     1,   176,     1,   176,
+       1,   176,     1,   176,   234,     1,   179,     1,   176,     1,
+     176,     1,   176,     1,   176,     1,   176,     1,   234,     1,
+     234,     1,   234,   179,   179,     1,   176,     1,   176,     1,
+     178,     1,   178,     1,   179,     1,   179,     1,   178,   231,
+     236,   243,     1,   243,   179,     1,   176,   178,   179,   181,
+     182,   190,   203,   228,   230,   231,   235,   237,   238,   239,
+     255,   256,   257,   258,     1,   176,     1,   176,     1,   176,
+     176,   176,   176,   176,   176,   176,     1,   176,     1,   176,
+       1,   176,     1,   176,     1,   176,     1,   176,     1,   176,
+       1,   176,     1,   179,     1,   176,     1,   179,     1,   176,
+       1,   234,     1,   234,     1,   234,     1,   176,     1,   176,
+       1,   176,     1,   176,     1,   176,     1,   176,     1,   176,
+       1,   176,     1,   176,     1,   179,     1,   179,     1,   179,
+     179,     1,   176,     1,   178,   179,     1,   178,   179,     1,
+     176,     1,   178,   179,     1,   176,     1,   176,     1,   176,
+       1,   176,     1,   176,     1,   176,     1,   178,     1,   178,
+       1,   176,     1,   176,     1,   176,     1,   176,     1,   176,
+       1,   176,     1,   176,     1,   176,     1,   176,     1,   178,
+     228,     1,   176,     1,   176,     1,   176,     1,   176,     1,
+     176,     1,   176,   178,   176,   176,   178,   176,     1,   179,
+       1,   179,     1,   176,     1,   176,     1,   178,   252,     1,
+     176,   176,     1,   188,   190,     1,   190,     1,   188,   190,
+       1,   190,     1,   188,     1,   188,     1,   188,     1,   190,
+       1,   190,   176,   176,   202,   244,   202,     1,   257,   202,
+     171,   200,   229,   202,   205,   239,   197,   184,   197,   197,
+     192,   202,   248,   209,   197,     3,     4,     5,     6,     7,
+       8,     9,    18,    20,    24,    25,    30,    31,   140,   141,
+     178,   180,   185,   208,   278,   283,   287,   289,   292,   293,
+     294,   295,   305,   176,   178,   179,   261,   261,   287,   261,
+     261,   287,   287,   287,   261,   261,   172,   228,    64,   193,
+     194,   195,   196,   197,   204,   205,   206,   207,   241,   242,
+       1,   179,   246,   191,   228,     1,   178,   228,   178,   179,
+     178,   178,    22,    27,    28,   249,   250,   188,   176,   178,
+     187,   187,   187,   187,   234,   278,     1,   187,     1,   187,
+       1,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+       1,   187,   145,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   281,   185,     1,   189,   289,     1,   185,   191,
+     191,   189,   191,   191,   189,   189,   189,   184,   191,   202,
+     202,   178,   228,   240,   176,   176,   176,   178,   242,   246,
+     202,   202,   184,   184,   248,   174,   183,   187,   189,   247,
+     251,   255,   259,   211,   186,   174,   187,   188,   190,   234,
+     272,   278,   279,   280,   283,   284,   292,   305,   186,   184,
+     186,   234,   278,     1,   179,   234,     1,   179,     1,   261,
+     262,   278,   272,   278,   272,   278,   179,   260,   179,   260,
+     178,   302,   302,     1,   179,   184,   186,   234,   278,   300,
+      29,    29,   175,   179,   187,   234,   278,   280,   282,   305,
+     188,   188,   188,   188,   176,   188,     1,   176,   233,     1,
+     233,   202,     1,   176,   203,   232,     1,   232,   179,   234,
+     260,   249,   187,   259,   203,   231,   245,   259,     1,   184,
+     189,   176,   272,   272,   189,   287,   282,   163,   164,   184,
+     186,   146,   147,   148,   149,   150,   151,   152,   153,   273,
+     274,   275,   276,   277,    29,   179,   234,   278,   303,   304,
+     184,   186,   184,   186,   186,   186,   184,   186,   184,   186,
+     184,   186,   186,   186,   186,    26,   179,   186,   179,   186,
+     184,   186,   186,     1,   187,   184,   184,   186,   186,   179,
+     234,   278,   184,   186,   282,   282,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,   192,   287,   287,   287,   287,
+     191,   287,   171,   184,     1,   233,   186,   186,   186,   245,
+     259,   184,   184,   186,   247,   173,   186,   189,   191,   272,
+     272,   179,    29,   259,   234,   179,   278,   184,   186,   304,
+     304,   179,   179,    29,   179,   234,   278,   301,   188,   286,
+     289,   188,    18,    23,   185,   188,   283,   285,   290,   291,
+     293,   294,   295,   305,   278,   179,   260,     1,   186,   300,
+     261,   261,   179,   234,   278,   186,   282,   282,   282,   282,
+     282,   282,   282,   282,   282,   282,   189,   189,   189,   189,
+     188,   189,   176,   176,   184,   184,   186,   259,   232,    25,
+     186,   303,   186,   186,   186,   186,   184,   186,   189,   287,
+      19,    21,   296,   297,   298,   187,   185,   189,   288,   290,
+     185,     1,   185,   186,   186,   186,   186,   186,   184,   186,
+     184,   186,   287,   171,   259,   232,   184,   186,   186,   176,
+      29,   179,   234,   278,   189,   286,   179,   234,   189,    22,
+     298,   299,   272,     1,   189,   290,   285,   176,   179,   189,
+     176,   184,   186,   186,   232,   212,   213,   202,   202,   202,
+     186,   186,   186,   232,   184,   186,   210,   176,   288,   288,
+     288,   285,   184,   186,   179,   176,   210,    19,   179,   186,
+     211,   176,   285,   186,   176,   211,   173,   176,    25,   173,
+     176,    25,   212,   176,   212
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   215,   216,   217,   217,   217,   218,   218,   219,   218,
+     220,   218,   221,   218,   222,   218,   223,   218,   224,   218,
+     225,   218,   226,   218,   227,   218,   218,   228,   228,   228,
+     229,   229,   230,   230,   230,   231,   232,   232,   233,   233,
+     233,   233,   234,   234,   234,   235,   235,   235,   235,   236,
+     236,   236,   236,   236,   236,   237,   237,   237,   237,   237,
+     238,   238,   239,   239,   240,   240,   240,   241,   241,   241,
+     241,   241,   241,   241,   241,   241,   241,   242,   242,   243,
+     244,   243,   245,   245,   246,   246,   247,   247,   247,   247,
+     247,   247,   247,   247,   247,   247,   247,   247,   248,   248,
+     248,   249,   249,   249,   250,   250,   251,   251,   251,   252,
+     252,   252,   252,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   254,
+     254,   254,   254,   254,   254,   255,   255,   256,   257,   258,
+     258,   259,   259,   260,   260,   261,   261,   261,   262,   262,
+     263,   263,   263,   264,   264,   265,   265,   265,   266,   266,
+     267,   267,   268,   268,   269,   269,   270,   270,   271,   271,
+     272,   272,   272,   272,   272,   272,   273,   273,   274,   274,
+     274,   274,   275,   275,   276,   276,   277,   277,   277,   278,
+     278,   279,   279,   279,   279,   280,   280,   280,   280,   280,
+     281,   281,   281,   281,   281,   281,   281,   281,   281,   281,
+     282,   282,   282,   282,   282,   282,   282,   282,   282,   282,
+     282,   282,   282,   282,   282,   282,   282,   283,   283,   283,
+     284,   284,   284,   284,   284,   285,   285,   285,   286,   286,
+     286,   287,   287,   287,   288,   288,   288,   289,   289,   289,
+     289,   289,   289,   289,   289,   290,   290,   290,   290,   290,
+     290,   290,   290,   290,   291,   291,   292,   292,   293,   294,
+     295,   296,   296,   297,   297,   298,   298,   298,   298,   299,
+     299,   300,   300,   300,   300,   300,   300,   300,   300,   300,
+     300,   300,   301,   301,   301,   301,   301,   301,   301,   301,
+     302,   302,   302,   302,   303,   303,   303,   303,   304,   304,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
+     305
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     1,     1,     0,     2,
+       0,     2,     0,     2,     0,     2,     0,     2,     0,     2,
+       0,     2,     0,     2,     0,     2,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     1,     1,     1,     5,     3,
+       3,     1,     1,     2,     2,     3,     5,     5,     2,     3,
+       3,     5,     5,     5,     5,     1,     3,     5,     5,     1,
+       1,     2,     1,     2,     1,     3,     3,     1,     1,     1,
+       1,     2,     2,     2,     2,     2,     2,     1,     2,     1,
+       0,     3,     1,     1,     1,     2,     9,    10,     7,     8,
+       5,     6,     5,     6,     3,     4,     1,     2,     4,     3,
+       0,     1,     1,     1,     3,     1,     3,     1,     2,    18,
+      17,    10,     9,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     3,
+       3,     3,     3,     5,     3,     3,     5,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     5,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     5,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     5,     5,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       2,     3,     2,     6,     4,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     2,     2,
+       2,     8,     8,     8,     2,     1,     1,     1,     1,     1,
+       3,     1,     1,     2,     2,     1,     1,     1,     1,     1,
+       4,     7,     2,     7,     2,     4,     7,     2,     7,     2,
+       4,     2,     4,     2,     4,     2,     9,     2,     7,     2,
+       3,     3,     2,     3,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     3,     3,     3,     3,
+       1,     1,     1,     3,     2,     1,     3,     2,     1,     3,
+       2,     2,     1,     2,     2,     1,     2,     2,     1,     1,
+       1,     1,     2,     1,     2,     2,     2,     1,     1,     1,
+       1,     2,     1,     2,     5,     7,     5,     7,     5,     7,
+       7,     2,     1,     2,     1,     4,     3,     4,     3,     3,
+       2,     1,     3,     1,     2,     2,     1,     2,     3,     1,
+       2,     3,     1,     1,     1,     1,     3,     3,     3,     3,
+       3,     4,     4,     2,     1,     1,     1,     1,     1,     3,
+       6,     4,     1,     3,     1,     3,     2,     4,     6,     2,
+       4,     6,     3,     5,     1,     4,     6,     2,     4,     6,
+       2,     4,     4,     6,     2,     4,     3,     4,     4,     2,
+       4,     4,     4,     4,     6,     6,     6,     8,     8,     6,
+       4
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* statements: statements statement  */
+#line 537 "cfg.y"
+                                     {}
+#line 2570 "cfg.tab.c"
+    break;
+
+  case 4: /* statements: statement  */
+#line 538 "cfg.y"
+                            {}
+#line 2576 "cfg.tab.c"
+    break;
+
+  case 5: /* statements: statements error  */
+#line 539 "cfg.y"
+                                   { yyerror(""); YYABORT;}
+#line 2582 "cfg.tab.c"
+    break;
+
+  case 8: /* $@1: %empty  */
+#line 544 "cfg.y"
+                  {rt=REQUEST_ROUTE;}
+#line 2588 "cfg.tab.c"
+    break;
+
+  case 10: /* $@2: %empty  */
+#line 545 "cfg.y"
+                  {rt=FAILURE_ROUTE;}
+#line 2594 "cfg.tab.c"
+    break;
+
+  case 12: /* $@3: %empty  */
+#line 546 "cfg.y"
+                  {rt=ONREPLY_ROUTE;}
+#line 2600 "cfg.tab.c"
+    break;
+
+  case 14: /* $@4: %empty  */
+#line 547 "cfg.y"
+                  {rt=BRANCH_ROUTE;}
+#line 2606 "cfg.tab.c"
+    break;
+
+  case 16: /* $@5: %empty  */
+#line 548 "cfg.y"
+                  {rt=ERROR_ROUTE;}
+#line 2612 "cfg.tab.c"
+    break;
+
+  case 18: /* $@6: %empty  */
+#line 549 "cfg.y"
+                  {rt=LOCAL_ROUTE;}
+#line 2618 "cfg.tab.c"
+    break;
+
+  case 20: /* $@7: %empty  */
+#line 550 "cfg.y"
+                  {rt=STARTUP_ROUTE;}
+#line 2624 "cfg.tab.c"
+    break;
+
+  case 22: /* $@8: %empty  */
+#line 551 "cfg.y"
+                  {rt=TIMER_ROUTE;}
+#line 2630 "cfg.tab.c"
+    break;
+
+  case 24: /* $@9: %empty  */
+#line 552 "cfg.y"
+                  {rt=EVENT_ROUTE;}
+#line 2636 "cfg.tab.c"
+    break;
+
+  case 27: /* listen_id: ip  */
+#line 557 "cfg.y"
+                                        { IFOR();
+							tmp=ip_addr2a((yyvsp[0].ipaddr));
+							if(tmp==0){
+								LM_CRIT("cfg. parser: bad ip address.\n");
+								(yyval.strval)=0;
+							}else{
+								(yyval.strval)=pkg_malloc(strlen(tmp)+1);
+								if ((yyval.strval)==0){
+									LM_CRIT("cfg. parser: out of memory.\n");
+									YYABORT;
+								}else{
+									memcpy((yyval.strval), tmp, strlen(tmp)+1);
+								}
+							}
+						}
+#line 2656 "cfg.tab.c"
+    break;
+
+  case 28: /* listen_id: STRING  */
+#line 572 "cfg.y"
+                                        { IFOR();
+							(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+							if ((yyval.strval)==0){
+									LM_CRIT("cfg. parser: out of memory.\n");
+									YYABORT;
+							}else{
+									memcpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+							}
+						}
+#line 2670 "cfg.tab.c"
+    break;
+
+  case 29: /* listen_id: host  */
+#line 581 "cfg.y"
+                                        { IFOR();
+							if ((yyvsp[0].strval)==0) {
+								(yyval.strval) = 0;
+							} else {
+								(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+								if ((yyval.strval)==0){
+									LM_CRIT("cfg. parser: out of memory.\n");
+									YYABORT;
+								}else{
+									memcpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+								}
+							}
+						}
+#line 2688 "cfg.tab.c"
+    break;
+
+  case 30: /* host_sep: DOT  */
+#line 596 "cfg.y"
+                    {(yyval.strval)=".";}
+#line 2694 "cfg.tab.c"
+    break;
+
+  case 31: /* host_sep: MINUS  */
+#line 597 "cfg.y"
+                              {(yyval.strval)="-"; }
+#line 2700 "cfg.tab.c"
+    break;
+
+  case 32: /* host: ID  */
+#line 600 "cfg.y"
+                                        { (yyval.strval)=(yyvsp[0].strval); }
+#line 2706 "cfg.tab.c"
+    break;
+
+  case 33: /* host: host host_sep ID  */
+#line 601 "cfg.y"
+                                { IFOR();
+						(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+						if ((yyval.strval)==0){
+							LM_CRIT("cfg. parser: memory allocation"
+										" failure while parsing host\n");
+							YYABORT;
+						}else{
+							memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+							(yyval.strval)[strlen((yyvsp[-2].strval))]=*(yyvsp[-1].strval);
+							memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+							(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+						}
+						pkg_free((yyvsp[-2].strval)); pkg_free((yyvsp[0].strval));
+					}
+#line 2725 "cfg.tab.c"
+    break;
+
+  case 34: /* host: host DOT error  */
+#line 615 "cfg.y"
+                         { (yyval.strval)=0; pkg_free((yyvsp[-2].strval));
+					yyerror("invalid hostname (use quotes if hostname "
+						"has config keywords)"); }
+#line 2733 "cfg.tab.c"
+    break;
+
+  case 35: /* proto: ID  */
+#line 620 "cfg.y"
+           { IFOR();
+		if (parse_proto((unsigned char *)(yyvsp[0].strval), strlen((yyvsp[0].strval)), &i_tmp) < 0) {
+			yyerrorf("cannot handle protocol <%s>\n", (yyvsp[0].strval));
+			YYABORT;
+		}
+		pkg_free((yyvsp[0].strval));
+		(yyval.intval) = i_tmp;
+	 }
+#line 2746 "cfg.tab.c"
+    break;
+
+  case 36: /* port: NUMBER  */
+#line 630 "cfg.y"
+                        { (yyval.intval)=(yyvsp[0].intval); }
+#line 2752 "cfg.tab.c"
+    break;
+
+  case 37: /* port: ANY  */
+#line 631 "cfg.y"
+                                { (yyval.intval)=0; }
+#line 2758 "cfg.tab.c"
+    break;
+
+  case 38: /* portrange: portrange COMMA NUMBER MINUS NUMBER  */
+#line 634 "cfg.y"
+                                               { IFOR();
+				if ((yyvsp[-2].intval) > (yyvsp[0].intval)) {
+					yyerrorf("invalid port range (%d > %d)\n", (int)(yyvsp[-2].intval), (int)(yyvsp[0].intval));
+					YYABORT;
+				}
+				pr_tmp = mk_port_range((yyvsp[-2].intval), (yyvsp[0].intval));
+				if (!pr_tmp) {
+					yyerror("cannot allocate new portrange\n");
+					YYABORT;
+				}
+				pr_tmp->next = (yyvsp[-4].portrange);
+				(yyval.portrange) = pr_tmp;
+			}
+#line 2776 "cfg.tab.c"
+    break;
+
+  case 39: /* portrange: portrange COMMA NUMBER  */
+#line 647 "cfg.y"
+                                          { IFOR();
+				pr_tmp = mk_port_range((yyvsp[0].intval), (yyvsp[0].intval));
+				if (!pr_tmp) {
+					yyerror("cannot allocate new portrange\n");
+					YYABORT;
+				}
+				pr_tmp->next = (yyvsp[-2].portrange);
+				(yyval.portrange) = pr_tmp;
+			}
+#line 2790 "cfg.tab.c"
+    break;
+
+  case 40: /* portrange: NUMBER MINUS NUMBER  */
+#line 656 "cfg.y"
+                                       { IFOR();
+				if ((yyvsp[-2].intval) > (yyvsp[0].intval)) {
+					yyerrorf("invalid port range (%d > %d)\n", (int)(yyvsp[-2].intval), (int)(yyvsp[0].intval));
+					YYABORT;
+				}
+				(yyval.portrange)=mk_port_range((yyvsp[-2].intval), (yyvsp[0].intval));
+			}
+#line 2802 "cfg.tab.c"
+    break;
+
+  case 41: /* portrange: NUMBER  */
+#line 663 "cfg.y"
+                          { IFOR(); (yyval.portrange)=mk_port_range((yyvsp[0].intval), (yyvsp[0].intval)); }
+#line 2808 "cfg.tab.c"
+    break;
+
+  case 42: /* snumber: NUMBER  */
+#line 665 "cfg.y"
+                        { (yyval.intval)=(yyvsp[0].intval); }
+#line 2814 "cfg.tab.c"
+    break;
+
+  case 43: /* snumber: PLUS NUMBER  */
+#line 666 "cfg.y"
+                                { (yyval.intval)=(yyvsp[0].intval); }
+#line 2820 "cfg.tab.c"
+    break;
+
+  case 44: /* snumber: MINUS NUMBER  */
+#line 667 "cfg.y"
+                                { (yyval.intval)=-(yyvsp[0].intval); }
+#line 2826 "cfg.tab.c"
+    break;
+
+  case 45: /* phostport: proto COLON listen_id  */
+#line 671 "cfg.y"
+                                        { IFOR();
+				(yyval.sockid)=mk_listen_id((yyvsp[0].strval), (yyvsp[-2].intval), 0); }
+#line 2833 "cfg.tab.c"
+    break;
+
+  case 46: /* phostport: proto COLON listen_id COLON port  */
+#line 673 "cfg.y"
+                                                                { IFOR();
+				(yyval.sockid)=mk_listen_id((yyvsp[-2].strval), (yyvsp[-4].intval), (yyvsp[0].intval));}
+#line 2840 "cfg.tab.c"
+    break;
+
+  case 47: /* phostport: proto COLON listen_id COLON error  */
+#line 675 "cfg.y"
+                                                            {
+				(yyval.sockid)=0;
+				yyerror("port number expected");
+				YYABORT;
+				}
+#line 2850 "cfg.tab.c"
+    break;
+
+  case 48: /* phostport: NUMBER error  */
+#line 680 "cfg.y"
+                                       { (yyval.sockid)=0;
+				yyerror("protocol expected");
+				YYABORT;
+			}
+#line 2859 "cfg.tab.c"
+    break;
+
+  case 49: /* phostportrange: proto COLON MULT  */
+#line 688 "cfg.y"
+                                                                { IFOR();
+				(yyval.sockid)=mk_listen_id(0, (yyvsp[-2].intval), 0); }
+#line 2866 "cfg.tab.c"
+    break;
+
+  case 50: /* phostportrange: proto COLON listen_id  */
+#line 690 "cfg.y"
+                                                { IFOR();
+				(yyval.sockid)=mk_listen_id_range((yyvsp[0].strval), (yyvsp[-2].intval), 0); }
+#line 2873 "cfg.tab.c"
+    break;
+
+  case 51: /* phostportrange: proto COLON MULT COLON portrange  */
+#line 692 "cfg.y"
+                                                                { IFOR();
+				(yyval.sockid)=mk_listen_id_range(0, (yyvsp[-4].intval), (yyvsp[0].portrange)); }
+#line 2880 "cfg.tab.c"
+    break;
+
+  case 52: /* phostportrange: proto COLON listen_id COLON portrange  */
+#line 694 "cfg.y"
+                                                                { IFOR();
+				(yyval.sockid)=mk_listen_id_range((yyvsp[-2].strval), (yyvsp[-4].intval), (yyvsp[0].portrange)); }
+#line 2887 "cfg.tab.c"
+    break;
+
+  case 53: /* phostportrange: proto COLON MULT COLON error  */
+#line 696 "cfg.y"
+                                                        { IFOR();
+				(yyval.sockid)=0;
+				yyerror("invalid port range");
+				YYABORT;
+			}
+#line 2897 "cfg.tab.c"
+    break;
+
+  case 54: /* phostportrange: proto COLON listen_id COLON error  */
+#line 701 "cfg.y"
+                                                                { IFOR();
+				(yyval.sockid)=0;
+				yyerror("invalid port range");
+				YYABORT;
+			}
+#line 2907 "cfg.tab.c"
+    break;
+
+  case 55: /* any_alias: listen_id  */
+#line 708 "cfg.y"
+                                                                        { IFOR();
+				(yyval.sockid)=mk_listen_id((yyvsp[0].strval), PROTO_NONE, 0); }
+#line 2914 "cfg.tab.c"
+    break;
+
+  case 56: /* any_alias: ANY COLON listen_id  */
+#line 710 "cfg.y"
+                                                                        { IFOR();
+		 		(yyval.sockid)=mk_listen_id((yyvsp[0].strval), PROTO_NONE, 0); }
+#line 2921 "cfg.tab.c"
+    break;
+
+  case 57: /* any_alias: ANY COLON listen_id COLON port  */
+#line 712 "cfg.y"
+                                                        { IFOR();
+		 		(yyval.sockid)=mk_listen_id((yyvsp[-2].strval), PROTO_NONE, (yyvsp[0].intval)); }
+#line 2928 "cfg.tab.c"
+    break;
+
+  case 58: /* any_alias: ANY COLON listen_id COLON error  */
+#line 714 "cfg.y"
+                                                        {
+				(yyval.sockid)=0;
+				yyerror(" port number expected");
+				}
+#line 2937 "cfg.tab.c"
+    break;
+
+  case 60: /* alias_def: any_alias  */
+#line 721 "cfg.y"
+                                              { (yyval.sockid)=(yyvsp[0].sockid); }
+#line 2943 "cfg.tab.c"
+    break;
+
+  case 61: /* alias_def: any_alias ACCEPT_SUBDOMAIN  */
+#line 722 "cfg.y"
+                                              {
+				(yyval.sockid)=(yyvsp[-1].sockid);
+				(yyval.sockid)->flags |= SI_ACCEPT_SUBDOMAIN_ALIAS;
+				}
+#line 2952 "cfg.tab.c"
+    break;
+
+  case 62: /* id_lst: alias_def  */
+#line 728 "cfg.y"
+                                        { IFOR();  (yyval.sockid)=(yyvsp[0].sockid) ; }
+#line 2958 "cfg.tab.c"
+    break;
+
+  case 63: /* id_lst: alias_def id_lst  */
+#line 729 "cfg.y"
+                                        { IFOR(); (yyval.sockid)=(yyvsp[-1].sockid); (yyval.sockid)->next=(yyvsp[0].sockid); }
+#line 2964 "cfg.tab.c"
+    break;
+
+  case 64: /* listen_id_def: listen_id  */
+#line 732 "cfg.y"
+                                                                { IFOR();
+					(yyval.sockid)=mk_listen_id((yyvsp[0].strval), PROTO_NONE, 0); }
+#line 2971 "cfg.tab.c"
+    break;
+
+  case 65: /* listen_id_def: listen_id COLON portrange  */
+#line 734 "cfg.y"
+                                                                { IFOR();
+					(yyval.sockid)=mk_listen_id_range((yyvsp[-2].strval), PROTO_NONE, (yyvsp[0].portrange)); }
+#line 2978 "cfg.tab.c"
+    break;
+
+  case 66: /* listen_id_def: listen_id COLON error  */
+#line 736 "cfg.y"
+                                                      {
+					(yyval.sockid)=0;
+					yyerror(" port number expected");
+					}
+#line 2987 "cfg.tab.c"
+    break;
+
+  case 67: /* socket_def_param: ANYCAST  */
+#line 742 "cfg.y"
+                          { IFOR();
+					p_tmp.flags |= SI_IS_ANYCAST;
+					}
+#line 2995 "cfg.tab.c"
+    break;
+
+  case 68: /* socket_def_param: FRAG  */
+#line 745 "cfg.y"
+                                       { IFOR();
+					p_tmp.flags |= SI_FRAG;
+					}
+#line 3003 "cfg.tab.c"
+    break;
+
+  case 69: /* socket_def_param: REUSE_PORT  */
+#line 748 "cfg.y"
+                                             { IFOR();
+					p_tmp.flags |= SI_REUSEPORT;
+					}
+#line 3011 "cfg.tab.c"
+    break;
+
+  case 70: /* socket_def_param: ACCEPT_SUBDOMAIN  */
+#line 751 "cfg.y"
+                                                   { IFOR();
+					p_tmp.flags |= SI_ACCEPT_SUBDOMAIN_ALIAS;
+					}
+#line 3019 "cfg.tab.c"
+    break;
+
+  case 71: /* socket_def_param: USE_WORKERS NUMBER  */
+#line 754 "cfg.y"
+                                                     { IFOR();
+					p_tmp.workers=(yyvsp[0].intval);
+					}
+#line 3027 "cfg.tab.c"
+    break;
+
+  case 72: /* socket_def_param: SOCK_TOS NUMBER  */
+#line 757 "cfg.y"
+                                                  { IFOR();
+					p_tmp.tos=(yyvsp[0].intval);
+					}
+#line 3035 "cfg.tab.c"
+    break;
+
+  case 73: /* socket_def_param: RECV_BATCH NUMBER  */
+#line 760 "cfg.y"
+                                                    { IFOR();
+					p_tmp.recv_batch=(yyvsp[0].intval);
+					}
+#line 3043 "cfg.tab.c"
+    break;
+
+  case 74: /* socket_def_param: AS listen_id_def  */
+#line 763 "cfg.y"
+                                                   { IFOR();
+					p_tmp.socket = (yyvsp[0].sockid);
+					}
+#line 3051 "cfg.tab.c"
+    break;
+
+  case 75: /* socket_def_param: TAG ID  */
+#line 766 "cfg.y"
+                                         { IFOR();
+					p_tmp.tag = (yyvsp[0].strval);
+					}
+#line 3059 "cfg.tab.c"
+    break;
+
+  case 76: /* socket_def_param: USE_AUTO_SCALING_PROFILE ID  */
+#line 769 "cfg.y"
+                                                              { IFOR();
+					p_tmp.auto_scaling_profile=(yyvsp[0].strval);
+					}
+#line 3067 "cfg.tab.c"
+    break;
+
+  case 79: /* socket_def: phostportrange  */
+#line 778 "cfg.y"
+                                { (yyval.sockid)=(yyvsp[0].sockid); }
+#line 3073 "cfg.tab.c"
+    break;
+
+  case 80: /* $@10: %empty  */
+#line 779 "cfg.y"
+                                         { IFOR();
+					memset(&p_tmp, 0, sizeof(p_tmp));
+				}
+#line 3081 "cfg.tab.c"
+    break;
+
+  case 81: /* socket_def: phostportrange $@10 socket_def_params  */
+#line 781 "cfg.y"
+                                                        { IFOR();
+					(yyval.sockid)=(yyvsp[-2].sockid); fill_socket_id(&p_tmp, (yyval.sockid));
+				}
+#line 3089 "cfg.tab.c"
+    break;
+
+  case 82: /* any_proto: ANY  */
+#line 786 "cfg.y"
+                        { (yyval.intval)=PROTO_NONE; }
+#line 3095 "cfg.tab.c"
+    break;
+
+  case 83: /* any_proto: proto  */
+#line 787 "cfg.y"
+                                { (yyval.intval)=(yyvsp[0].intval); }
+#line 3101 "cfg.tab.c"
+    break;
+
+  case 84: /* multi_string: STRING  */
+#line 789 "cfg.y"
+                       {  IFOR(); (yyval.multistr)=new_string((yyvsp[0].strval)); }
+#line 3107 "cfg.tab.c"
+    break;
+
+  case 85: /* multi_string: STRING multi_string  */
+#line 790 "cfg.y"
+                                      { IFOR(); (yyval.multistr)=new_string((yyvsp[-1].strval)); (yyval.multistr)->next=(yyvsp[0].multistr); }
+#line 3113 "cfg.tab.c"
+    break;
+
+  case 86: /* blst_elem: LPAREN any_proto COMMA ipnet COMMA port COMMA STRING RPAREN  */
+#line 793 "cfg.y"
+                                                                       {
+				IFOR(pkg_free((yyvsp[-5].ipnet)));
+				s_tmp.s=(yyvsp[-1].strval);
+				s_tmp.len=strlen((yyvsp[-1].strval));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-5].ipnet),&s_tmp,(yyvsp[-3].intval),(yyvsp[-7].intval),0)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3126 "cfg.tab.c"
+    break;
+
+  case 87: /* blst_elem: NOT LPAREN any_proto COMMA ipnet COMMA port COMMA STRING RPAREN  */
+#line 801 "cfg.y"
+                                                                                  {
+				IFOR(pkg_free((yyvsp[-5].ipnet)));
+				s_tmp.s=(yyvsp[-1].strval);
+				s_tmp.len=strlen((yyvsp[-1].strval));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-5].ipnet),&s_tmp,
+				(yyvsp[-3].intval),(yyvsp[-7].intval),BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3140 "cfg.tab.c"
+    break;
+
+  case 88: /* blst_elem: LPAREN any_proto COMMA ipnet COMMA port RPAREN  */
+#line 810 "cfg.y"
+                                                                 {
+				IFOR(pkg_free((yyvsp[-3].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-3].ipnet),NULL,(yyvsp[-1].intval),(yyvsp[-5].intval),0)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3151 "cfg.tab.c"
+    break;
+
+  case 89: /* blst_elem: NOT LPAREN any_proto COMMA ipnet COMMA port RPAREN  */
+#line 816 "cfg.y"
+                                                                     {
+				IFOR(pkg_free((yyvsp[-3].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-3].ipnet),NULL,
+				(yyvsp[-1].intval),(yyvsp[-5].intval),BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3163 "cfg.tab.c"
+    break;
+
+  case 90: /* blst_elem: LPAREN any_proto COMMA ipnet RPAREN  */
+#line 823 "cfg.y"
+                                                      {
+				IFOR(pkg_free((yyvsp[-1].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-1].ipnet),NULL,0,(yyvsp[-3].intval),0)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3174 "cfg.tab.c"
+    break;
+
+  case 91: /* blst_elem: NOT LPAREN any_proto COMMA ipnet RPAREN  */
+#line 829 "cfg.y"
+                                                          {
+				IFOR(pkg_free((yyvsp[-1].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-1].ipnet),NULL,
+				0,(yyvsp[-3].intval),BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3186 "cfg.tab.c"
+    break;
+
+  case 92: /* blst_elem: LPAREN ipnet COMMA port RPAREN  */
+#line 836 "cfg.y"
+                                                 {
+				IFOR(pkg_free((yyvsp[-3].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-3].ipnet),NULL,(yyvsp[-1].intval),PROTO_NONE,0)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3197 "cfg.tab.c"
+    break;
+
+  case 93: /* blst_elem: NOT LPAREN ipnet COMMA port RPAREN  */
+#line 842 "cfg.y"
+                                                     {
+				IFOR(pkg_free((yyvsp[-3].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-3].ipnet),NULL,
+				(yyvsp[-1].intval),PROTO_NONE,BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3209 "cfg.tab.c"
+    break;
+
+  case 94: /* blst_elem: LPAREN ipnet RPAREN  */
+#line 849 "cfg.y"
+                                      {
+				IFOR(pkg_free((yyvsp[-1].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-1].ipnet),NULL,0,PROTO_NONE,0)) {
+					yyerror("failed to add backlist element\n"); YYABORT;
+				}
+			}
+#line 3220 "cfg.tab.c"
+    break;
+
+  case 95: /* blst_elem: NOT LPAREN ipnet RPAREN  */
+#line 855 "cfg.y"
+                                          {
+				IFOR(pkg_free((yyvsp[-1].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[-1].ipnet),NULL,
+				0,PROTO_NONE,BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3232 "cfg.tab.c"
+    break;
+
+  case 96: /* blst_elem: ipnet  */
+#line 862 "cfg.y"
+                        {
+				IFOR(pkg_free((yyvsp[0].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[0].ipnet),NULL,0,PROTO_NONE,0)) {
+					yyerror("failed to add backlist element\n"); YYABORT;
+				}
+			}
+#line 3243 "cfg.tab.c"
+    break;
+
+  case 97: /* blst_elem: NOT ipnet  */
+#line 868 "cfg.y"
+                            {
+				IFOR(pkg_free((yyvsp[0].ipnet)));
+				if (add_rule_to_list(&bl_head,&bl_tail,(yyvsp[0].ipnet),NULL,
+				0,PROTO_NONE,BLR_APPLY_CONTRARY)) {
+					yyerror("failed to add backlist element\n");YYABORT;
+				}
+			}
+#line 3255 "cfg.tab.c"
+    break;
+
+  case 101: /* blst_flag: READONLY  */
+#line 882 "cfg.y"
+                    { (yyval.intval) = BL_READONLY_LIST; }
+#line 3261 "cfg.tab.c"
+    break;
+
+  case 102: /* blst_flag: EXPIRE  */
+#line 883 "cfg.y"
+                          { (yyval.intval) = BL_DO_EXPIRE; }
+#line 3267 "cfg.tab.c"
+    break;
+
+  case 103: /* blst_flag: DEFAULT  */
+#line 884 "cfg.y"
+                           { (yyval.intval) = BL_BY_DEFAULT; }
+#line 3273 "cfg.tab.c"
+    break;
+
+  case 104: /* blst_flags: blst_flags COMMA blst_flag  */
+#line 887 "cfg.y"
+                                       { (yyval.intval) = (yyvsp[-2].intval) | (yyvsp[0].intval); }
+#line 3279 "cfg.tab.c"
+    break;
+
+  case 105: /* blst_flags: blst_flag  */
+#line 888 "cfg.y"
+                            {}
+#line 3285 "cfg.tab.c"
+    break;
+
+  case 106: /* blst_elem_list: blst_elem_list COMMA blst_elem  */
+#line 891 "cfg.y"
+                                               {}
+#line 3291 "cfg.tab.c"
+    break;
+
+  case 107: /* blst_elem_list: blst_elem  */
+#line 892 "cfg.y"
+                            {}
+#line 3297 "cfg.tab.c"
+    break;
+
+  case 108: /* blst_elem_list: blst_elem_list error  */
+#line 893 "cfg.y"
+                                       { yyerror("bad black list element");}
+#line 3303 "cfg.tab.c"
+    break;
+
+  case 109: /* auto_scale_profile_def: ID SCALE_UP_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES_WITHIN NUMBER SCALE_DOWN_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES  */
+#line 900 "cfg.y"
+                                              { IFOR();
+			if (create_auto_scaling_profile((yyvsp[-17].strval),(yyvsp[-15].intval),(yyvsp[-13].intval),(yyvsp[-10].intval),(yyvsp[-8].intval),
+			(yyvsp[-6].intval), (yyvsp[-4].intval), (yyvsp[-1].intval),10*(yyvsp[-1].intval))<0)
+				yyerror("failed to create auto scaling profile");
+		 }
+#line 3313 "cfg.tab.c"
+    break;
+
+  case 110: /* auto_scale_profile_def: ID SCALE_UP_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES SCALE_DOWN_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES  */
+#line 908 "cfg.y"
+                                              { IFOR();
+			if (create_auto_scaling_profile((yyvsp[-16].strval),(yyvsp[-14].intval),(yyvsp[-12].intval),(yyvsp[-9].intval),(yyvsp[-9].intval),
+			(yyvsp[-6].intval), (yyvsp[-4].intval), (yyvsp[-1].intval), 10*(yyvsp[-1].intval))<0)
+				yyerror("failed to create auto scaling profile");
+		 }
+#line 3323 "cfg.tab.c"
+    break;
+
+  case 111: /* auto_scale_profile_def: ID SCALE_UP_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES_WITHIN NUMBER  */
+#line 914 "cfg.y"
+                                                            { IFOR();
+			if (create_auto_scaling_profile((yyvsp[-9].strval),(yyvsp[-7].intval),(yyvsp[-5].intval),(yyvsp[-2].intval),(yyvsp[0].intval),
+			0, 0, 0, 0)<0)
+				yyerror("failed to create auto scaling profile");
+		}
+#line 3333 "cfg.tab.c"
+    break;
+
+  case 112: /* auto_scale_profile_def: ID SCALE_UP_TO NUMBER ON NUMBER MODULO FOR NUMBER CYCLES  */
+#line 920 "cfg.y"
+                                              { IFOR();
+			if (create_auto_scaling_profile((yyvsp[-8].strval),(yyvsp[-6].intval),(yyvsp[-4].intval),(yyvsp[-1].intval),(yyvsp[-1].intval),
+			0, 0, 0, 0)<0)
+				yyerror("failed to create auto scaling profile");
+		}
+#line 3343 "cfg.tab.c"
+    break;
+
+  case 113: /* assign_stm: LOGLEVEL EQUAL snumber  */
+#line 927 "cfg.y"
+                                   { IFOR();
+			/* in debug mode, force logging to DEBUG level*/
+			*log_level = debug_mode?L_DBG:(yyvsp[0].intval);
+			}
+#line 3352 "cfg.tab.c"
+    break;
+
+  case 114: /* assign_stm: LOGPREFIX EQUAL STRING  */
+#line 931 "cfg.y"
+                                         { IFOR();
+			if (*(yyvsp[0].strval)) {
+				int len = strlen((yyvsp[0].strval));
+				char *buf = pkg_malloc(len + 2);
+				if (!buf)
+					yyerror("oom");
+				sprintf(buf, "%s:", (yyvsp[0].strval));
+				log_prefix = buf;
+			} else {
+				log_prefix = (yyvsp[0].strval);
+			}
+			}
+#line 3369 "cfg.tab.c"
+    break;
+
+  case 115: /* assign_stm: LOGPREFIX EQUAL error  */
+#line 943 "cfg.y"
+                                         { yyerror("string value expected"); }
+#line 3375 "cfg.tab.c"
+    break;
+
+  case 116: /* assign_stm: ENABLE_ASSERTS EQUAL NUMBER  */
+#line 944 "cfg.y"
+                                               { IFOR(); enable_asserts=(yyvsp[0].intval); }
+#line 3381 "cfg.tab.c"
+    break;
+
+  case 117: /* assign_stm: ENABLE_ASSERTS EQUAL error  */
+#line 945 "cfg.y"
+                                              { yyerror("boolean value expected"); }
+#line 3387 "cfg.tab.c"
+    break;
+
+  case 118: /* assign_stm: ABORT_ON_ASSERT EQUAL NUMBER  */
+#line 946 "cfg.y"
+                                                { IFOR(); abort_on_assert=(yyvsp[0].intval); }
+#line 3393 "cfg.tab.c"
+    break;
+
+  case 119: /* assign_stm: ABORT_ON_ASSERT EQUAL error  */
+#line 947 "cfg.y"
+                                               { yyerror("boolean value expected"); }
+#line 3399 "cfg.tab.c"
+    break;
+
+  case 120: /* assign_stm: DEBUG_MODE EQUAL NUMBER  */
+#line 948 "cfg.y"
+                                           { IFOR();
+			debug_mode=(yyvsp[0].intval);
+			if (debug_mode) {
+				*log_level = L_DBG;
+				stderr_enabled=1;
+				syslog_enabled=0;
+
+				s_tmp.s=STDERR_CONSUMER_NAME;
+				s_tmp.len=strlen(STDERR_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, 0);
+				s_tmp.s=SYSLOG_CONSUMER_NAME;
+				s_tmp.len=strlen(SYSLOG_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, 1);
+			}
+			}
+#line 3419 "cfg.tab.c"
+    break;
+
+  case 121: /* assign_stm: DEBUG_MODE EQUAL error  */
+#line 964 "cfg.y"
+                        { yyerror("boolean value expected for debug_mode"); }
+#line 3425 "cfg.tab.c"
+    break;
+
+  case 122: /* assign_stm: LOGSTDOUT EQUAL NUMBER  */
+#line 967 "cfg.y"
+                        { IFOR(); log_stdout=(yyvsp[0].intval); }
+#line 3431 "cfg.tab.c"
+    break;
+
+  case 123: /* assign_stm: LOGSTDOUT EQUAL error  */
+#line 968 "cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 3437 "cfg.tab.c"
+    break;
+
+  case 124: /* assign_stm: LOGSTDERROR EQUAL NUMBER  */
+#line 969 "cfg.y"
+                                           {
+			IFOR();
+			warn("'log_stderror' is deprecated, use 'stderror_enabled' and/or"
+				"'syslog_enabled' instead");
+			if (!config_check && !debug_mode) {
+				if ((yyvsp[0].intval)) {
+					stderr_enabled=1;
+					syslog_enabled=0;
+				} else {
+					stderr_enabled=0;
+					syslog_enabled=1;
+				}
+
+				s_tmp.s=STDERR_CONSUMER_NAME;
+				s_tmp.len=strlen(STDERR_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, !(yyvsp[0].intval));
+				s_tmp.s=SYSLOG_CONSUMER_NAME;
+				s_tmp.len=strlen(SYSLOG_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, (yyvsp[0].intval));
+			}
+			}
+#line 3463 "cfg.tab.c"
+    break;
+
+  case 125: /* assign_stm: LOGSTDERROR EQUAL error  */
+#line 990 "cfg.y"
+                                          { yyerror("boolean value expected"); }
+#line 3469 "cfg.tab.c"
+    break;
+
+  case 126: /* assign_stm: STDERROR_ENABLED EQUAL NUMBER  */
+#line 991 "cfg.y"
+                                                {
+			/* in config-check or debug mode we force logging
+			 * to standard error */
+			IFOR();
+			if (!config_check && !debug_mode) {
+				stderr_enabled=(yyvsp[0].intval);
+				s_tmp.s=STDERR_CONSUMER_NAME;
+				s_tmp.len=strlen(STDERR_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, !(yyvsp[0].intval));
+			}
+			}
+#line 3485 "cfg.tab.c"
+    break;
+
+  case 127: /* assign_stm: STDERROR_ENABLED EQUAL error  */
+#line 1002 "cfg.y"
+                                               { yyerror("boolean value expected"); }
+#line 3491 "cfg.tab.c"
+    break;
+
+  case 128: /* assign_stm: SYSLOG_ENABLED EQUAL NUMBER  */
+#line 1003 "cfg.y"
+                                              {
+			IFOR();
+			/* in config-check or debug mode we force logging
+			 * to standard error */
+			if (!config_check && !debug_mode) {
+				syslog_enabled=(yyvsp[0].intval);
+				s_tmp.s=SYSLOG_CONSUMER_NAME;
+				s_tmp.len=strlen(SYSLOG_CONSUMER_NAME);
+				set_log_consumer_mute_state(&s_tmp, !(yyvsp[0].intval));
+			}
+			}
+#line 3507 "cfg.tab.c"
+    break;
+
+  case 129: /* assign_stm: SYSLOG_ENABLED EQUAL error  */
+#line 1014 "cfg.y"
+                                             { yyerror("boolean value expected"); }
+#line 3513 "cfg.tab.c"
+    break;
+
+  case 130: /* assign_stm: LOG_EVENT_ENABLED EQUAL NUMBER  */
+#line 1015 "cfg.y"
+                                                 {
+			IFOR();
+			if ((yyvsp[0].intval)) {
+				if (init_log_msg_buf(0) < 0) {
+					yyerror("failed to allocate msg log buffer");
+					YYABORT;
+				}
+			}
+			log_event_enabled=(yyvsp[0].intval); }
+#line 3527 "cfg.tab.c"
+    break;
+
+  case 131: /* assign_stm: LOG_EVENT_ENABLED EQUAL error  */
+#line 1024 "cfg.y"
+                                                { yyerror("boolean value expected"); }
+#line 3533 "cfg.tab.c"
+    break;
+
+  case 132: /* assign_stm: STDERROR_LEVEL_FILTER EQUAL snumber  */
+#line 1025 "cfg.y"
+                                                      {
+			IFOR();
+			s_tmp.s=STDERR_CONSUMER_NAME;
+			s_tmp.len=strlen(STDERR_CONSUMER_NAME);
+			set_log_consumer_level_filter(&s_tmp, (yyvsp[0].intval));
+			}
+#line 3544 "cfg.tab.c"
+    break;
+
+  case 133: /* assign_stm: STDERROR_LEVEL_FILTER EQUAL error  */
+#line 1031 "cfg.y"
+                                                    { yyerror("number expected"); }
+#line 3550 "cfg.tab.c"
+    break;
+
+  case 134: /* assign_stm: SYSLOG_LEVEL_FILTER EQUAL snumber  */
+#line 1032 "cfg.y"
+                                                    {
+			IFOR();
+			s_tmp.s=SYSLOG_CONSUMER_NAME;
+			s_tmp.len=strlen(SYSLOG_CONSUMER_NAME);
+			set_log_consumer_level_filter(&s_tmp, (yyvsp[0].intval));
+			}
+#line 3561 "cfg.tab.c"
+    break;
+
+  case 135: /* assign_stm: SYSLOG_LEVEL_FILTER EQUAL error  */
+#line 1038 "cfg.y"
+                                                  { yyerror("number expected"); }
+#line 3567 "cfg.tab.c"
+    break;
+
+  case 136: /* assign_stm: LOG_EVENT_LEVEL_FILTER EQUAL snumber  */
+#line 1039 "cfg.y"
+                                                       { IFOR();
+							log_event_level_filter = (yyvsp[0].intval); }
+#line 3574 "cfg.tab.c"
+    break;
+
+  case 137: /* assign_stm: LOG_EVENT_LEVEL_FILTER EQUAL error  */
+#line 1041 "cfg.y"
+                                                     { yyerror("number expected"); }
+#line 3580 "cfg.tab.c"
+    break;
+
+  case 138: /* assign_stm: STDERROR_FORMAT EQUAL STRING  */
+#line 1042 "cfg.y"
+                                               { IFOR();
+			s_tmp.s = (yyvsp[0].strval);
+			s_tmp.len = strlen((yyvsp[0].strval));
+			if ((i_tmp = parse_log_format(&s_tmp)) < 0) {
+				yyerror("unknown log format");
+			} else {
+				if (i_tmp != LOG_FORMAT_PLAIN) {
+					if (init_log_json_buf(0) < 0) {
+						yyerror("failed to allocate json log buffer");
+						YYABORT;
+					}
+					if (init_log_msg_buf(0) < 0) {
+						yyerror("failed to allocate msg log buffer");
+						YYABORT;
+					}
+
+					if (i_tmp == LOG_FORMAT_JSON_CEE && init_log_cee_hostname() < 0) {
+						yyerror("failed to allocate hostname buffer");
+						YYABORT;
+					}
+				}
+
+				stderr_log_format = i_tmp;
+			}
+			}
+#line 3610 "cfg.tab.c"
+    break;
+
+  case 139: /* assign_stm: SYSLOG_FORMAT EQUAL STRING  */
+#line 1067 "cfg.y"
+                                             { IFOR();
+			s_tmp.s = (yyvsp[0].strval);
+			s_tmp.len = strlen((yyvsp[0].strval));
+			if ((i_tmp = parse_log_format(&s_tmp)) < 0) {
+				yyerror("unknown log format");
+			} else {
+				if (i_tmp != LOG_FORMAT_PLAIN) {
+					if (init_log_json_buf(0) < 0) {
+						yyerror("failed to allocate json log buffer");
+						YYABORT;
+					}
+					if (init_log_msg_buf(0) < 0) {
+						yyerror("failed to allocate msg log buffer");
+						YYABORT;
+					}
+
+					if (i_tmp == LOG_FORMAT_JSON_CEE && init_log_cee_hostname() < 0) {
+						yyerror("failed to allocate hostname buffer");
+						YYABORT;
+					}
+				}
+
+				syslog_log_format = i_tmp;
+			}
+			}
+#line 3640 "cfg.tab.c"
+    break;
+
+  case 140: /* assign_stm: LOG_JSON_BUF_SIZE EQUAL NUMBER  */
+#line 1092 "cfg.y"
+                                                 {
+			IFOR();
+			log_json_buf_size = (yyvsp[0].intval);
+			if (init_log_json_buf(1) < 0) {
+				yyerror("failed to realloc json log buffer");
+				YYABORT;
+			}
+			}
+#line 3653 "cfg.tab.c"
+    break;
+
+  case 141: /* assign_stm: LOG_JSON_BUF_SIZE EQUAL error  */
+#line 1100 "cfg.y"
+                                                { yyerror("number expected"); }
+#line 3659 "cfg.tab.c"
+    break;
+
+  case 142: /* assign_stm: LOG_MSG_BUF_SIZE EQUAL NUMBER  */
+#line 1101 "cfg.y"
+                                                {
+			IFOR();
+			log_msg_buf_size = (yyvsp[0].intval);
+			if (init_log_msg_buf(1) < 0) {
+				yyerror("failed to realloc msg log buffer");
+				YYABORT;
+			}
+			}
+#line 3672 "cfg.tab.c"
+    break;
+
+  case 143: /* assign_stm: LOG_MSG_BUF_SIZE EQUAL error  */
+#line 1109 "cfg.y"
+                                               { yyerror("number expected"); }
+#line 3678 "cfg.tab.c"
+    break;
+
+  case 144: /* assign_stm: LOGFACILITY EQUAL ID  */
+#line 1110 "cfg.y"
+                                       { IFOR();
+			warn("'log_facility' is deprecated, use 'syslog_facility' instead");
+			if ( (i_tmp=str2facility((yyvsp[0].strval)))==-1)
+				yyerror("bad facility (see syslog(3) man page)");
+			if (!config_check)
+				log_facility=i_tmp;
+			}
+#line 3690 "cfg.tab.c"
+    break;
+
+  case 145: /* assign_stm: LOGFACILITY EQUAL error  */
+#line 1117 "cfg.y"
+                                          { yyerror("ID expected"); }
+#line 3696 "cfg.tab.c"
+    break;
+
+  case 146: /* assign_stm: SYSLOG_FACILITY EQUAL ID  */
+#line 1118 "cfg.y"
+                                           { IFOR();
+			if ( (i_tmp=str2facility((yyvsp[0].strval)))==-1)
+				yyerror("bad facility (see syslog(3) man page)");
+			if (!config_check)
+				log_facility=i_tmp;
+			}
+#line 3707 "cfg.tab.c"
+    break;
+
+  case 147: /* assign_stm: SYSLOG_FACILITY EQUAL error  */
+#line 1124 "cfg.y"
+                                              { yyerror("ID expected"); }
+#line 3713 "cfg.tab.c"
+    break;
+
+  case 148: /* assign_stm: LOGNAME EQUAL STRING  */
+#line 1125 "cfg.y"
+                                       { IFOR();
+			warn("'log_name' is deprecated, use 'syslog_name' instead");
+			log_name=(yyvsp[0].strval); }
+#line 3721 "cfg.tab.c"
+    break;
+
+  case 149: /* assign_stm: LOGNAME EQUAL error  */
+#line 1128 "cfg.y"
+                                      { yyerror("string value expected"); }
+#line 3727 "cfg.tab.c"
+    break;
+
+  case 150: /* assign_stm: SYSLOG_NAME EQUAL STRING  */
+#line 1129 "cfg.y"
+                                           { IFOR(); log_name=(yyvsp[0].strval); }
+#line 3733 "cfg.tab.c"
+    break;
+
+  case 151: /* assign_stm: SYSLOG_NAME EQUAL error  */
+#line 1130 "cfg.y"
+                                          { yyerror("string value expected"); }
+#line 3739 "cfg.tab.c"
+    break;
+
+  case 152: /* assign_stm: DNS EQUAL NUMBER  */
+#line 1131 "cfg.y"
+                                     { IFOR(); received_dns|= ((yyvsp[0].intval))?DO_DNS:0; }
+#line 3745 "cfg.tab.c"
+    break;
+
+  case 153: /* assign_stm: DNS EQUAL error  */
+#line 1132 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 3751 "cfg.tab.c"
+    break;
+
+  case 154: /* assign_stm: REV_DNS EQUAL NUMBER  */
+#line 1133 "cfg.y"
+                                       { IFOR(); received_dns|= ((yyvsp[0].intval))?DO_REV_DNS:0; }
+#line 3757 "cfg.tab.c"
+    break;
+
+  case 155: /* assign_stm: REV_DNS EQUAL error  */
+#line 1134 "cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 3763 "cfg.tab.c"
+    break;
+
+  case 156: /* assign_stm: DNS_TRY_IPV6 EQUAL NUMBER  */
+#line 1135 "cfg.y"
+                                              { IFOR(); dns_try_ipv6=(yyvsp[0].intval); }
+#line 3769 "cfg.tab.c"
+    break;
+
+  case 157: /* assign_stm: DNS_TRY_IPV6 error  */
+#line 1136 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 3775 "cfg.tab.c"
+    break;
+
+  case 158: /* assign_stm: DNS_TRY_NAPTR EQUAL NUMBER  */
+#line 1137 "cfg.y"
+                                               { IFOR(); dns_try_naptr=(yyvsp[0].intval); }
+#line 3781 "cfg.tab.c"
+    break;
+
+  case 159: /* assign_stm: DNS_TRY_NAPTR error  */
+#line 1138 "cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 3787 "cfg.tab.c"
+    break;
+
+  case 160: /* assign_stm: DNS_RETR_TIME EQUAL NUMBER  */
+#line 1139 "cfg.y"
+                                               { IFOR(); dns_retr_time=(yyvsp[0].intval); }
+#line 3793 "cfg.tab.c"
+    break;
+
+  case 161: /* assign_stm: DNS_RETR_TIME error  */
+#line 1140 "cfg.y"
+                                      { yyerror("number expected"); }
+#line 3799 "cfg.tab.c"
+    break;
+
+  case 162: /* assign_stm: DNS_RETR_NO EQUAL NUMBER  */
+#line 1141 "cfg.y"
+                                             { IFOR(); dns_retr_no=(yyvsp[0].intval); }
+#line 3805 "cfg.tab.c"
+    break;
+
+  case 163: /* assign_stm: DNS_RETR_NO error  */
+#line 1142 "cfg.y"
+                                    { yyerror("number expected"); }
+#line 3811 "cfg.tab.c"
+    break;
+
+  case 164: /* assign_stm: DNS_SERVERS_NO EQUAL NUMBER  */
+#line 1143 "cfg.y"
+                                                { IFOR(); dns_servers_no=(yyvsp[0].intval); }
+#line 3817 "cfg.tab.c"
+    break;
+
+  case 165: /* assign_stm: DNS_SERVERS_NO error  */
+#line 1144 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 3823 "cfg.tab.c"
+    break;
+
+  case 166: /* assign_stm: DNS_USE_SEARCH EQUAL NUMBER  */
+#line 1145 "cfg.y"
+                                                { IFOR(); dns_search_list=(yyvsp[0].intval); }
+#line 3829 "cfg.tab.c"
+    break;
+
+  case 167: /* assign_stm: DNS_USE_SEARCH error  */
+#line 1146 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 3835 "cfg.tab.c"
+    break;
+
+  case 168: /* assign_stm: MAX_WHILE_LOOPS EQUAL NUMBER  */
+#line 1147 "cfg.y"
+                                               { IFOR(); max_while_loops=(yyvsp[0].intval); }
+#line 3841 "cfg.tab.c"
+    break;
+
+  case 169: /* assign_stm: MAX_WHILE_LOOPS EQUAL error  */
+#line 1148 "cfg.y"
+                                              { yyerror("number expected"); }
+#line 3847 "cfg.tab.c"
+    break;
+
+  case 170: /* assign_stm: MAXBUFFER EQUAL NUMBER  */
+#line 1149 "cfg.y"
+                                         { IFOR(); maxbuffer=(yyvsp[0].intval); }
+#line 3853 "cfg.tab.c"
+    break;
+
+  case 171: /* assign_stm: MAXBUFFER EQUAL error  */
+#line 1150 "cfg.y"
+                                        { yyerror("number expected"); }
+#line 3859 "cfg.tab.c"
+    break;
+
+  case 172: /* assign_stm: UDP_WORKERS EQUAL NUMBER  */
+#line 1151 "cfg.y"
+                                           { IFOR(); udp_workers_no=(yyvsp[0].intval); }
+#line 3865 "cfg.tab.c"
+    break;
+
+  case 173: /* assign_stm: UDP_WORKERS EQUAL NUMBER USE_AUTO_SCALING_PROFILE ID  */
+#line 1152 "cfg.y"
+                                                                       { IFOR();
+				udp_workers_no=(yyvsp[-2].intval);
+				udp_auto_scaling_profile=(yyvsp[0].strval);
+		}
+#line 3874 "cfg.tab.c"
+    break;
+
+  case 174: /* assign_stm: UDP_WORKERS EQUAL error  */
+#line 1156 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 3880 "cfg.tab.c"
+    break;
+
+  case 175: /* assign_stm: TIMER_WORKERS EQUAL NUMBER  */
+#line 1157 "cfg.y"
+                                             { IFOR();
+				timer_workers_no=(yyvsp[0].intval);
+		}
+#line 3888 "cfg.tab.c"
+    break;
+
+  case 176: /* assign_stm: TIMER_WORKERS EQUAL NUMBER USE_AUTO_SCALING_PROFILE ID  */
+#line 1160 "cfg.y"
+                                                                         { IFOR();
+				timer_workers_no=(yyvsp[-2].intval);
+				timer_auto_scaling_profile=(yyvsp[0].strval);
+		}
+#line 3897 "cfg.tab.c"
+    break;
+
+  case 177: /* assign_stm: CHECK_VIA EQUAL NUMBER  */
+#line 1164 "cfg.y"
+                                         { check_via=(yyvsp[0].intval); }
+#line 3903 "cfg.tab.c"
+    break;
+
+  case 178: /* assign_stm: CHECK_VIA EQUAL error  */
+#line 1165 "cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 3909 "cfg.tab.c"
+    break;
+
+  case 179: /* assign_stm: SHM_HASH_SPLIT_PERCENTAGE EQUAL NUMBER  */
+#line 1166 "cfg.y"
+                                                         { IFOR();
+			#ifdef HP_MALLOC
+			shm_hash_split_percentage=(yyvsp[0].intval);
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+			}
+#line 3922 "cfg.tab.c"
+    break;
+
+  case 180: /* assign_stm: SHM_HASH_SPLIT_PERCENTAGE EQUAL error  */
+#line 1174 "cfg.y"
+                                                        {
+			#ifdef HP_MALLOC
+			yyerror("number expected");
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+				}
+#line 3935 "cfg.tab.c"
+    break;
+
+  case 181: /* assign_stm: SHM_SECONDARY_HASH_SIZE EQUAL NUMBER  */
+#line 1182 "cfg.y"
+                                                       { IFOR();
+			#ifdef HP_MALLOC
+			shm_secondary_hash_size=(yyvsp[0].intval);
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support"
+				" for HP_MALLOC\n");
+			#endif
+			}
+#line 3948 "cfg.tab.c"
+    break;
+
+  case 182: /* assign_stm: SHM_SECONDARY_HASH_SIZE EQUAL error  */
+#line 1190 "cfg.y"
+                                                      {
+			#ifdef HP_MALLOC
+			yyerror("number expected");
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+			}
+#line 3961 "cfg.tab.c"
+    break;
+
+  case 183: /* assign_stm: SHM_CACHE_SIZE EQUAL NUMBER  */
+#line 1198 "cfg.y"
+                                              { IFOR();
+			shm_cache_size=(yyvsp[0].intval);
+			}
+#line 3969 "cfg.tab.c"
+    break;
+
+  case 184: /* assign_stm: SHM_CACHE_SIZE EQUAL error  */
+#line 1201 "cfg.y"
+                                             { yyerror("number expected"); }
+#line 3975 "cfg.tab.c"
+    break;
+
+  case 185: /* assign_stm: PKG_ARENA_SIZE EQUAL NUMBER  */
+#line 1202 "cfg.y"
+                                              { IFOR();
+			pkg_arena_size=(yyvsp[0].intval);
+			}
+#line 3983 "cfg.tab.c"
+    break;
+
+  case 186: /* assign_stm: PKG_ARENA_SIZE EQUAL error  */
+#line 1205 "cfg.y"
+                                             { yyerror("number expected"); }
+#line 3989 "cfg.tab.c"
+    break;
+
+  case 187: /* assign_stm: MEM_WARMING_ENABLED EQUAL NUMBER  */
+#line 1206 "cfg.y"
+                                                   { IFOR();
+			#ifdef HP_MALLOC
+			mem_warming_enabled = (yyvsp[0].intval);
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support"
+				" for HP_MALLOC\n");
+			#endif
+			}
+#line 4002 "cfg.tab.c"
+    break;
+
+  case 188: /* assign_stm: MEM_WARMING_ENABLED EQUAL error  */
+#line 1214 "cfg.y"
+                                                  {
+			#ifdef HP_MALLOC
+			yyerror("number expected");
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+			}
+#line 4015 "cfg.tab.c"
+    break;
+
+  case 189: /* assign_stm: MEM_WARMING_PATTERN_FILE EQUAL STRING  */
+#line 1222 "cfg.y"
+                                                        { IFOR();
+			#ifdef HP_MALLOC
+			mem_warming_pattern_file = (yyvsp[0].strval);
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with "
+				"support for HP_MALLOC\n");
+			#endif
+			}
+#line 4028 "cfg.tab.c"
+    break;
+
+  case 190: /* assign_stm: MEM_WARMING_PATTERN_FILE EQUAL error  */
+#line 1230 "cfg.y"
+                                                       {
+			#ifdef HP_MALLOC
+			yyerror("string expected");
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+			}
+#line 4041 "cfg.tab.c"
+    break;
+
+  case 191: /* assign_stm: MEM_WARMING_PERCENTAGE EQUAL NUMBER  */
+#line 1238 "cfg.y"
+                                                      { IFOR();
+			#ifdef HP_MALLOC
+			mem_warming_percentage = (yyvsp[0].intval);
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with "
+				"support for HP_MALLOC\n");
+			#endif
+			}
+#line 4054 "cfg.tab.c"
+    break;
+
+  case 192: /* assign_stm: MEM_WARMING_PERCENTAGE EQUAL error  */
+#line 1246 "cfg.y"
+                                                     {
+			#ifdef HP_MALLOC
+			yyerror("number expected");
+			#else
+			LM_ERR("Cannot set parameter; Please recompile with support "
+				"for HP_MALLOC\n");
+			#endif
+			}
+#line 4067 "cfg.tab.c"
+    break;
+
+  case 193: /* assign_stm: RPM_MEM_FILE EQUAL STRING  */
+#line 1254 "cfg.y"
+                                            { IFOR();
+			rpm_mem_file = (yyvsp[0].strval);
+			}
+#line 4075 "cfg.tab.c"
+    break;
+
+  case 194: /* assign_stm: RPM_MEM_FILE EQUAL error  */
+#line 1257 "cfg.y"
+                                           { yyerror("string value expected"); }
+#line 4081 "cfg.tab.c"
+    break;
+
+  case 195: /* assign_stm: RPM_MEM_SIZE EQUAL NUMBER  */
+#line 1258 "cfg.y"
+                                            { IFOR();
+			rpm_mem_size = (yyvsp[0].intval) * 1024 * 1024;
+			}
+#line 4089 "cfg.tab.c"
+    break;
+
+  case 196: /* assign_stm: RPM_MEM_SIZE EQUAL error  */
+#line 1261 "cfg.y"
+                                           { yyerror("int value expected"); }
+#line 4095 "cfg.tab.c"
+    break;
+
+  case 197: /* assign_stm: MEMLOG EQUAL snumber  */
+#line 1262 "cfg.y"
+                                       { IFOR(); memlog=(yyvsp[0].intval); memdump=(yyvsp[0].intval); }
+#line 4101 "cfg.tab.c"
+    break;
+
+  case 198: /* assign_stm: MEMLOG EQUAL error  */
+#line 1263 "cfg.y"
+                                     { yyerror("int value expected"); }
+#line 4107 "cfg.tab.c"
+    break;
+
+  case 199: /* assign_stm: SHM_MEMLOG_SIZE EQUAL snumber  */
+#line 1264 "cfg.y"
+                                                { IFOR(); shm_memlog_size=(yyvsp[0].intval);}
+#line 4113 "cfg.tab.c"
+    break;
+
+  case 200: /* assign_stm: SHM_MEMLOG_SIZE EQUAL error  */
+#line 1265 "cfg.y"
+                                              { yyerror("int value expected"); }
+#line 4119 "cfg.tab.c"
+    break;
+
+  case 201: /* assign_stm: MEMDUMP EQUAL snumber  */
+#line 1266 "cfg.y"
+                                        { IFOR(); memdump=(yyvsp[0].intval); }
+#line 4125 "cfg.tab.c"
+    break;
+
+  case 202: /* assign_stm: MEMDUMP EQUAL error  */
+#line 1267 "cfg.y"
+                                      { yyerror("int value expected"); }
+#line 4131 "cfg.tab.c"
+    break;
+
+  case 203: /* assign_stm: EXECMSGTHRESHOLD EQUAL NUMBER  */
+#line 1268 "cfg.y"
+                                                {  IFOR();execmsgthreshold=(yyvsp[0].intval); }
+#line 4137 "cfg.tab.c"
+    break;
+
+  case 204: /* assign_stm: EXECMSGTHRESHOLD EQUAL error  */
+#line 1269 "cfg.y"
+                                               { yyerror("int value expected"); }
+#line 4143 "cfg.tab.c"
+    break;
+
+  case 205: /* assign_stm: EXECDNSTHRESHOLD EQUAL NUMBER  */
+#line 1270 "cfg.y"
+                                                { IFOR(); execdnsthreshold=(yyvsp[0].intval); }
+#line 4149 "cfg.tab.c"
+    break;
+
+  case 206: /* assign_stm: EXECDNSTHRESHOLD EQUAL error  */
+#line 1271 "cfg.y"
+                                               { yyerror("int value expected"); }
+#line 4155 "cfg.tab.c"
+    break;
+
+  case 207: /* assign_stm: TCPTHRESHOLD EQUAL NUMBER  */
+#line 1272 "cfg.y"
+                                            { IFOR(); tcpthreshold=(yyvsp[0].intval); }
+#line 4161 "cfg.tab.c"
+    break;
+
+  case 208: /* assign_stm: TCPTHRESHOLD EQUAL error  */
+#line 1273 "cfg.y"
+                                           { yyerror("int value expected"); }
+#line 4167 "cfg.tab.c"
+    break;
+
+  case 209: /* assign_stm: EVENT_SHM_THRESHOLD EQUAL NUMBER  */
+#line 1274 "cfg.y"
+                                                   { IFOR();
+			#ifdef STATISTICS
+			if ((yyvsp[0].intval) < 0 || (yyvsp[0].intval) > 100)
+				yyerror("SHM threshold has to be a percentage between"
+					" 0 and 100");
+			event_shm_threshold=(yyvsp[0].intval);
+			#else
+			yyerror("statistics support not compiled in");
+			#endif /* STATISTICS */
+			}
+#line 4182 "cfg.tab.c"
+    break;
+
+  case 210: /* assign_stm: EVENT_SHM_THRESHOLD EQUAL error  */
+#line 1284 "cfg.y"
+                                                  { yyerror("int value expected"); }
+#line 4188 "cfg.tab.c"
+    break;
+
+  case 211: /* assign_stm: EVENT_PKG_THRESHOLD EQUAL NUMBER  */
+#line 1285 "cfg.y"
+                                                   { IFOR();
+			#ifdef PKG_MALLOC
+			#ifdef STATISTICS
+			if ((yyvsp[0].intval) < 0 || (yyvsp[0].intval) > 100)
+				yyerror("PKG threshold has to be a percentage between "
+					"0 and 100");
+			event_pkg_threshold=(yyvsp[0].intval);
+			#else
+			yyerror("statistics support not compiled in");
+			#endif
+			#else
+			yyerror("pkg_malloc support not compiled in");
+			#endif
+			}
+#line 4207 "cfg.tab.c"
+    break;
+
+  case 212: /* assign_stm: EVENT_PKG_THRESHOLD EQUAL error  */
+#line 1299 "cfg.y"
+                                                  { yyerror("int value expected"); }
+#line 4213 "cfg.tab.c"
+    break;
+
+  case 213: /* assign_stm: QUERYBUFFERSIZE EQUAL NUMBER  */
+#line 1300 "cfg.y"
+                                               { IFOR(); query_buffer_size=(yyvsp[0].intval); }
+#line 4219 "cfg.tab.c"
+    break;
+
+  case 214: /* assign_stm: QUERYBUFFERSIZE EQUAL error  */
+#line 1301 "cfg.y"
+                                              { yyerror("int value expected"); }
+#line 4225 "cfg.tab.c"
+    break;
+
+  case 215: /* assign_stm: QUERYFLUSHTIME EQUAL NUMBER  */
+#line 1302 "cfg.y"
+                                              { IFOR(); query_flush_time=(yyvsp[0].intval); }
+#line 4231 "cfg.tab.c"
+    break;
+
+  case 216: /* assign_stm: QUERYFLUSHTIME EQUAL error  */
+#line 1303 "cfg.y"
+                                             { yyerror("int value expected"); }
+#line 4237 "cfg.tab.c"
+    break;
+
+  case 217: /* assign_stm: SIP_WARNING EQUAL NUMBER  */
+#line 1304 "cfg.y"
+                                           { IFOR(); sip_warning=(yyvsp[0].intval); }
+#line 4243 "cfg.tab.c"
+    break;
+
+  case 218: /* assign_stm: SIP_WARNING EQUAL error  */
+#line 1305 "cfg.y"
+                                          { yyerror("boolean value expected"); }
+#line 4249 "cfg.tab.c"
+    break;
+
+  case 219: /* assign_stm: CHROOT EQUAL STRING  */
+#line 1306 "cfg.y"
+                                          { IFOR(); chroot_dir=(yyvsp[0].strval); }
+#line 4255 "cfg.tab.c"
+    break;
+
+  case 220: /* assign_stm: CHROOT EQUAL ID  */
+#line 1307 "cfg.y"
+                                          { IFOR(); chroot_dir=(yyvsp[0].strval); }
+#line 4261 "cfg.tab.c"
+    break;
+
+  case 221: /* assign_stm: CHROOT EQUAL error  */
+#line 1308 "cfg.y"
+                                          { yyerror("string value expected"); }
+#line 4267 "cfg.tab.c"
+    break;
+
+  case 222: /* assign_stm: WDIR EQUAL STRING  */
+#line 1309 "cfg.y"
+                                        { IFOR(); working_dir=(yyvsp[0].strval); }
+#line 4273 "cfg.tab.c"
+    break;
+
+  case 223: /* assign_stm: WDIR EQUAL ID  */
+#line 1310 "cfg.y"
+                                        { IFOR(); working_dir=(yyvsp[0].strval); }
+#line 4279 "cfg.tab.c"
+    break;
+
+  case 224: /* assign_stm: WDIR EQUAL error  */
+#line 1311 "cfg.y"
+                                        { yyerror("string value expected"); }
+#line 4285 "cfg.tab.c"
+    break;
+
+  case 225: /* assign_stm: MHOMED EQUAL NUMBER  */
+#line 1312 "cfg.y"
+                                      { IFOR(); mhomed=(yyvsp[0].intval); }
+#line 4291 "cfg.tab.c"
+    break;
+
+  case 226: /* assign_stm: MHOMED EQUAL error  */
+#line 1313 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 4297 "cfg.tab.c"
+    break;
+
+  case 227: /* assign_stm: POLL_METHOD EQUAL ID  */
+#line 1314 "cfg.y"
+                                       { IFOR();
+									io_poll_method=get_poll_type((yyvsp[0].strval));
+									if (io_poll_method==POLL_NONE){
+										LM_CRIT("bad poll method name:"
+											" %s\n, try one of %s.\n",
+											(yyvsp[0].strval), poll_support);
+										yyerror("bad poll_method "
+											"value");
+									}
+								}
+#line 4312 "cfg.tab.c"
+    break;
+
+  case 228: /* assign_stm: POLL_METHOD EQUAL STRING  */
+#line 1324 "cfg.y"
+                                           { IFOR();
+									io_poll_method=get_poll_type((yyvsp[0].strval));
+									if (io_poll_method==POLL_NONE){
+										LM_CRIT("bad poll method name:"
+											" %s\n, try one of %s.\n",
+											(yyvsp[0].strval), poll_support);
+										yyerror("bad poll_method "
+											"value");
+									}
+									}
+#line 4327 "cfg.tab.c"
+    break;
+
+  case 229: /* assign_stm: POLL_METHOD EQUAL error  */
+#line 1334 "cfg.y"
+                                          { yyerror("poll method name expected"); }
+#line 4333 "cfg.tab.c"
+    break;
+
+  case 230: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL NUMBER  */
+#line 1335 "cfg.y"
+                                                  { IFOR();
+				if ((yyvsp[0].intval) < TCP_ALIAS_NEVER || (yyvsp[0].intval) > TCP_ALIAS_ALWAYS)
+					yyerror("invalid 'tcp_accept_aliases' value");
+				tcp_accept_aliases=(yyvsp[0].intval);
+		}
+#line 4343 "cfg.tab.c"
+    break;
+
+  case 231: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL error  */
+#line 1340 "cfg.y"
+                                                 { yyerror("boolean value expected"); }
+#line 4349 "cfg.tab.c"
+    break;
+
+  case 232: /* assign_stm: TCP_WORKERS EQUAL NUMBER  */
+#line 1341 "cfg.y"
+                                           { IFOR();
+				tcp_workers_no=(yyvsp[0].intval);
+		}
+#line 4357 "cfg.tab.c"
+    break;
+
+  case 233: /* assign_stm: TCP_WORKERS EQUAL NUMBER USE_AUTO_SCALING_PROFILE ID  */
+#line 1344 "cfg.y"
+                                                                      { IFOR();
+				tcp_workers_no=(yyvsp[-2].intval);
+				tcp_auto_scaling_profile=(yyvsp[0].strval);
+		}
+#line 4366 "cfg.tab.c"
+    break;
+
+  case 234: /* assign_stm: TCP_WORKERS EQUAL error  */
+#line 1348 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 4372 "cfg.tab.c"
+    break;
+
+  case 235: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL NUMBER  */
+#line 1349 "cfg.y"
+                                                   { IFOR();
+				if ((yyvsp[0].intval) <= 0)
+					yyerror("invalid 'tcp_connect_timeout' (value too low!)");
+				tcp_connect_timeout=(yyvsp[0].intval);
+		}
+#line 4382 "cfg.tab.c"
+    break;
+
+  case 236: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL error  */
+#line 1354 "cfg.y"
+                                                  { yyerror("number expected"); }
+#line 4388 "cfg.tab.c"
+    break;
+
+  case 237: /* assign_stm: TCP_CON_LIFETIME EQUAL NUMBER  */
+#line 1355 "cfg.y"
+                                                { IFOR();
+				tcp_con_lifetime=(yyvsp[0].intval);
+		}
+#line 4396 "cfg.tab.c"
+    break;
+
+  case 238: /* assign_stm: TCP_CON_LIFETIME EQUAL error  */
+#line 1358 "cfg.y"
+                                               { yyerror("number expected"); }
+#line 4402 "cfg.tab.c"
+    break;
+
+  case 239: /* assign_stm: TCP_SOCKET_BACKLOG EQUAL NUMBER  */
+#line 1359 "cfg.y"
+                                                  { IFOR();
+				tcp_socket_backlog=(yyvsp[0].intval);
+		}
+#line 4410 "cfg.tab.c"
+    break;
+
+  case 240: /* assign_stm: TCP_SOCKET_BACKLOG EQUAL error  */
+#line 1362 "cfg.y"
+                                                 { yyerror("number expected"); }
+#line 4416 "cfg.tab.c"
+    break;
+
+  case 241: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL NUMBER  */
+#line 1363 "cfg.y"
+                                                   { IFOR();
+				tcp_max_connections=(yyvsp[0].intval);
+		}
+#line 4424 "cfg.tab.c"
+    break;
+
+  case 242: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL error  */
+#line 1366 "cfg.y"
+                                                  { yyerror("number expected"); }
+#line 4430 "cfg.tab.c"
+    break;
+
+  case 243: /* assign_stm: TCP_NO_NEW_CONN_BFLAG EQUAL ID  */
+#line 1367 "cfg.y"
+                                                 { IFOR();
+				tcp_no_new_conn_bflag =
+					get_flag_id_by_name(FLAG_TYPE_BRANCH, (yyvsp[0].strval), 0);
+				if (!flag_in_range( (flag_t)tcp_no_new_conn_bflag ) )
+					yyerror("invalid TCP no_new_conn Branch Flag");
+				flag_idx2mask( &tcp_no_new_conn_bflag );
+		}
+#line 4442 "cfg.tab.c"
+    break;
+
+  case 244: /* assign_stm: TCP_NO_NEW_CONN_BFLAG EQUAL error  */
+#line 1374 "cfg.y"
+                                                    { yyerror("number value expected"); }
+#line 4448 "cfg.tab.c"
+    break;
+
+  case 245: /* assign_stm: TCP_NO_NEW_CONN_RPLFLAG EQUAL ID  */
+#line 1375 "cfg.y"
+                                                   { IFOR();
+				tcp_no_new_conn_rplflag =
+					get_flag_id_by_name(FLAG_TYPE_MSG, (yyvsp[0].strval), 0);
+				if (!flag_in_range( (flag_t)tcp_no_new_conn_rplflag ) )
+					yyerror("invalid TCP no_new_conn RePLy Flag");
+				flag_idx2mask( &tcp_no_new_conn_rplflag );
+		}
+#line 4460 "cfg.tab.c"
+    break;
+
+  case 246: /* assign_stm: TCP_NO_NEW_CONN_RPLFLAG EQUAL error  */
+#line 1382 "cfg.y"
+                                                      { yyerror("number value expected"); }
+#line 4466 "cfg.tab.c"
+    break;
+
+  case 247: /* assign_stm: TCP_KEEPALIVE EQUAL NUMBER  */
+#line 1384 "cfg.y"
+                                             { IFOR();
+				tcp_keepalive=!!(yyvsp[0].intval);
+		}
+#line 4474 "cfg.tab.c"
+    break;
+
+  case 248: /* assign_stm: TCP_KEEPALIVE EQUAL error  */
+#line 1387 "cfg.y"
+                                            { yyerror("boolean value expected"); }
+#line 4480 "cfg.tab.c"
+    break;
+
+  case 249: /* assign_stm: TCP_MAX_MSG_TIME EQUAL NUMBER  */
+#line 1388 "cfg.y"
+                                                { IFOR();
+				tcp_max_msg_time=(yyvsp[0].intval);
+		}
+#line 4488 "cfg.tab.c"
+    break;
+
+  case 250: /* assign_stm: TCP_MAX_MSG_TIME EQUAL error  */
+#line 1391 "cfg.y"
+                                               { yyerror("boolean value expected"); }
+#line 4494 "cfg.tab.c"
+    break;
+
+  case 251: /* assign_stm: TCP_PARALLEL_READ_ON_WORKERS EQUAL NUMBER  */
+#line 1392 "cfg.y"
+                                                            { IFOR();
+				tcp_parallel_read_on_workers=!!(yyvsp[0].intval);
+		}
+#line 4502 "cfg.tab.c"
+    break;
+
+  case 252: /* assign_stm: TCP_PARALLEL_READ_ON_WORKERS EQUAL error  */
+#line 1395 "cfg.y"
+                                                           {
+			yyerror("boolean value expected");
+		}
+#line 4510 "cfg.tab.c"
+    break;
+
+  case 253: /* assign_stm: TCP_STICKY_WORKERS EQUAL NUMBER  */
+#line 1398 "cfg.y"
+                                                  { IFOR();
+				tcp_sticky_workers=(yyvsp[0].intval);
+		}
+#line 4518 "cfg.tab.c"
+    break;
+
+  case 254: /* assign_stm: TCP_STICKY_WORKERS EQUAL error  */
+#line 1401 "cfg.y"
+                                                 { yyerror("number expected"); }
+#line 4524 "cfg.tab.c"
+    break;
+
+  case 255: /* assign_stm: TCP_MAIN_SHARDS EQUAL NUMBER  */
+#line 1402 "cfg.y"
+                                               { IFOR();
+				tcp_main_shards=(yyvsp[0].intval);
+		}
+#line 4532 "cfg.tab.c"
+    break;
+
+  case 256: /* assign_stm: TCP_MAIN_SHARDS EQUAL error  */
+#line 1405 "cfg.y"
+                                              { yyerror("number expected"); }
+#line 4538 "cfg.tab.c"
+    break;
+
+  case 257: /* assign_stm: TCP_HANDSHAKE_WORKERS EQUAL NUMBER  */
+#line 1406 "cfg.y"
+                                                     { IFOR();
+				tcp_hs_workers_no=(yyvsp[0].intval);
+		}
+#line 4546 "cfg.tab.c"
+    break;
+
+  case 258: /* assign_stm: TCP_HANDSHAKE_WORKERS EQUAL NUMBER USE_AUTO_SCALING_PROFILE ID  */
+#line 1409 "cfg.y"
+                                                                                {
+				IFOR();
+				tcp_hs_workers_no=(yyvsp[-2].intval);
+				tcp_hs_auto_scaling_profile=(yyvsp[0].strval);
+		}
+#line 4556 "cfg.tab.c"
+    break;
+
+  case 259: /* assign_stm: TCP_HANDSHAKE_WORKERS EQUAL error  */
+#line 1414 "cfg.y"
+                                                    { yyerror("number expected"); }
+#line 4562 "cfg.tab.c"
+    break;
+
+  case 260: /* assign_stm: TCP_KEEPCOUNT EQUAL NUMBER  */
+#line 1415 "cfg.y"
+                                                        { IFOR();
+			#ifndef HAVE_TCP_KEEPCNT
+				warn("cannot be enabled TCP_KEEPCOUNT (no OS support)");
+			#else
+				tcp_keepcount=(yyvsp[0].intval);
+			#endif
+		}
+#line 4574 "cfg.tab.c"
+    break;
+
+  case 261: /* assign_stm: TCP_KEEPCOUNT EQUAL error  */
+#line 1422 "cfg.y"
+                                            { yyerror("int value expected"); }
+#line 4580 "cfg.tab.c"
+    break;
+
+  case 262: /* assign_stm: TCP_KEEPIDLE EQUAL NUMBER  */
+#line 1423 "cfg.y"
+                                                        { IFOR();
+			#ifndef HAVE_TCP_KEEPIDLE
+				warn("cannot be enabled TCP_KEEPIDLE (no OS support)");
+			#else
+				tcp_keepidle=(yyvsp[0].intval);
+			#endif
+		}
+#line 4592 "cfg.tab.c"
+    break;
+
+  case 263: /* assign_stm: TCP_KEEPIDLE EQUAL error  */
+#line 1430 "cfg.y"
+                                           { yyerror("int value expected"); }
+#line 4598 "cfg.tab.c"
+    break;
+
+  case 264: /* assign_stm: TCP_KEEPINTERVAL EQUAL NUMBER  */
+#line 1431 "cfg.y"
+                                                { IFOR();
+			#ifndef HAVE_TCP_KEEPINTVL
+				warn("cannot be enabled TCP_KEEPINTERVAL (no OS support)");
+			#else
+				tcp_keepinterval=(yyvsp[0].intval);
+			 #endif
+		}
+#line 4610 "cfg.tab.c"
+    break;
+
+  case 265: /* assign_stm: TCP_KEEPINTERVAL EQUAL error  */
+#line 1438 "cfg.y"
+                                               { yyerror("int value expected"); }
+#line 4616 "cfg.tab.c"
+    break;
+
+  case 266: /* assign_stm: SERVER_SIGNATURE EQUAL NUMBER  */
+#line 1439 "cfg.y"
+                                                { IFOR();
+							server_signature=(yyvsp[0].intval); }
+#line 4623 "cfg.tab.c"
+    break;
+
+  case 267: /* assign_stm: SERVER_SIGNATURE EQUAL error  */
+#line 1441 "cfg.y"
+                                               { yyerror("boolean value expected"); }
+#line 4629 "cfg.tab.c"
+    break;
+
+  case 268: /* assign_stm: SERVER_HEADER EQUAL STRING  */
+#line 1442 "cfg.y"
+                                             { IFOR();
+							server_header->s=(yyvsp[0].strval);
+							server_header->len=strlen((yyvsp[0].strval));
+							}
+#line 4638 "cfg.tab.c"
+    break;
+
+  case 269: /* assign_stm: SERVER_HEADER EQUAL error  */
+#line 1446 "cfg.y"
+                                            { yyerror("string value expected"); }
+#line 4644 "cfg.tab.c"
+    break;
+
+  case 270: /* assign_stm: USER_AGENT_HEADER EQUAL STRING  */
+#line 1447 "cfg.y"
+                                                 { user_agent_header->s=(yyvsp[0].strval);
+			user_agent_header->len=strlen((yyvsp[0].strval));
+									}
+#line 4652 "cfg.tab.c"
+    break;
+
+  case 271: /* assign_stm: USER_AGENT_HEADER EQUAL error  */
+#line 1450 "cfg.y"
+                                                { yyerror("string value expected"); }
+#line 4658 "cfg.tab.c"
+    break;
+
+  case 272: /* assign_stm: PV_PRINT_BUF_SIZE EQUAL NUMBER  */
+#line 1451 "cfg.y"
+                                                 { IFOR();
+							pv_print_buf_size = (yyvsp[0].intval); }
+#line 4665 "cfg.tab.c"
+    break;
+
+  case 273: /* assign_stm: PV_PRINT_BUF_SIZE EQUAL error  */
+#line 1453 "cfg.y"
+                                                { yyerror("number expected"); }
+#line 4671 "cfg.tab.c"
+    break;
+
+  case 274: /* assign_stm: XLOG_BUF_SIZE EQUAL NUMBER  */
+#line 1454 "cfg.y"
+                                             { IFOR();
+							xlog_buf_size = (yyvsp[0].intval); }
+#line 4678 "cfg.tab.c"
+    break;
+
+  case 275: /* assign_stm: XLOG_FORCE_COLOR EQUAL NUMBER  */
+#line 1456 "cfg.y"
+                                                { IFOR();
+							xlog_force_color = (yyvsp[0].intval); }
+#line 4685 "cfg.tab.c"
+    break;
+
+  case 276: /* assign_stm: XLOG_PRINT_LEVEL EQUAL NUMBER  */
+#line 1458 "cfg.y"
+                                                { IFOR();
+							xlog_print_level = (yyvsp[0].intval); }
+#line 4692 "cfg.tab.c"
+    break;
+
+  case 277: /* assign_stm: XLOG_BUF_SIZE EQUAL error  */
+#line 1460 "cfg.y"
+                                            { yyerror("number expected"); }
+#line 4698 "cfg.tab.c"
+    break;
+
+  case 278: /* assign_stm: XLOG_FORCE_COLOR EQUAL error  */
+#line 1461 "cfg.y"
+                                               { yyerror("boolean value expected"); }
+#line 4704 "cfg.tab.c"
+    break;
+
+  case 279: /* assign_stm: XLOG_PRINT_LEVEL EQUAL error  */
+#line 1462 "cfg.y"
+                                               { yyerror("number expected"); }
+#line 4710 "cfg.tab.c"
+    break;
+
+  case 280: /* assign_stm: XLOG_LEVEL EQUAL snumber  */
+#line 1463 "cfg.y"
+                                           { IFOR();
+							*xlog_level = (yyvsp[0].intval); }
+#line 4717 "cfg.tab.c"
+    break;
+
+  case 281: /* assign_stm: XLOG_LEVEL EQUAL error  */
+#line 1465 "cfg.y"
+                                         { yyerror("number expected"); }
+#line 4723 "cfg.tab.c"
+    break;
+
+  case 282: /* assign_stm: SOCKET EQUAL socket_def  */
+#line 1466 "cfg.y"
+                                          { IFOR();
+							for (lst_tmp = (yyvsp[0].sockid); lst_tmp; lst_tmp = lst_tmp->next) {
+								if (add_listening_socket(lst_tmp)!=0){
+									LM_CRIT("cfg. parser: failed"
+											" to add listening socket\n");
+									break;
+								}
+							}
+						}
+#line 4737 "cfg.tab.c"
+    break;
+
+  case 283: /* assign_stm: SOCKET EQUAL error  */
+#line 1475 "cfg.y"
+                                      { yyerror("ip address or hostname "
+						"expected (use quotes if the hostname includes"
+						" config keywords)"); }
+#line 4745 "cfg.tab.c"
+    break;
+
+  case 284: /* assign_stm: LISTEN EQUAL socket_def  */
+#line 1478 "cfg.y"
+                                          { IFOR();
+							warn("'listen' is deprecated, use 'socket' instead");
+							for (lst_tmp = (yyvsp[0].sockid); lst_tmp; lst_tmp = lst_tmp->next) {
+								if (add_listening_socket(lst_tmp)!=0){
+									LM_CRIT("cfg. parser: failed"
+											" to add listen address\n");
+									break;
+								}
+							}
+						}
+#line 4760 "cfg.tab.c"
+    break;
+
+  case 285: /* assign_stm: LISTEN EQUAL error  */
+#line 1488 "cfg.y"
+                                      { yyerror("ip address or hostname "
+						"expected (use quotes if the hostname includes"
+						" config keywords)"); }
+#line 4768 "cfg.tab.c"
+    break;
+
+  case 286: /* assign_stm: MEMGROUP EQUAL STRING COLON multi_string  */
+#line 1491 "cfg.y"
+                                                           { IFOR();
+							/* convert STIRNG ($3) to an ID */
+							/* update the memstats type for each module */
+							#ifndef SHM_EXTRA_STATS
+								LM_CRIT("SHM_EXTRA_STATS not defined");
+								YYABORT;
+							#else
+
+							#ifdef SHM_SHOW_DEFAULT_GROUP
+							if(strcmp((yyvsp[-2].strval), "default") == 0){
+								LM_CRIT("default group  name is not allowed");
+								YYABORT;
+							}
+							#endif
+
+							for(tmp_mod = mod_names; tmp_mod; tmp_mod=tmp_mod->next){
+								if(strcmp((yyvsp[-2].strval), tmp_mod->s) == 0){
+									LM_CRIT("The same mem-group name is used twice: [%s] [%s]\n", (yyvsp[-2].strval), tmp_mod->s);
+									YYABORT;
+								}
+							}
+
+							tmp_mod = pkg_malloc(sizeof(struct multi_str));
+							if(!tmp_mod){
+								LM_CRIT("out of pkg memory");
+								YYABORT;
+							}
+
+							tmp_mod->s = (yyvsp[-2].strval);
+							tmp_mod->next = mod_names;
+							mod_names = tmp_mod;
+							for (tmp_mod = (yyvsp[0].multistr); tmp_mod; tmp_mod = tmp_mod->next){
+								if(set_mem_idx(tmp_mod->s, mem_free_idx)){
+									YYABORT;
+								}
+							}
+
+							mem_free_idx++;
+
+							if(alloc_group_stat()){
+								YYABORT;
+							}
+							#endif
+						}
+#line 4817 "cfg.tab.c"
+    break;
+
+  case 287: /* assign_stm: MEMGROUP EQUAL STRING COLON error  */
+#line 1535 "cfg.y"
+                                                    { yyerror("invalid or no module specified"); }
+#line 4823 "cfg.tab.c"
+    break;
+
+  case 288: /* assign_stm: ALIAS EQUAL id_lst  */
+#line 1536 "cfg.y"
+                                      { IFOR();
+							for(lst_tmp=(yyvsp[0].sockid); lst_tmp; lst_tmp=lst_tmp->next)
+								add_alias(lst_tmp->name, strlen(lst_tmp->name),
+											lst_tmp->port, lst_tmp->proto, si_subdomain_to_alias_flag(lst_tmp->flags));
+							  }
+#line 4833 "cfg.tab.c"
+    break;
+
+  case 289: /* assign_stm: ALIAS EQUAL error  */
+#line 1541 "cfg.y"
+                                      { yyerror("hostname expected (use quotes"
+							" if the hostname includes config keywords)"); }
+#line 4840 "cfg.tab.c"
+    break;
+
+  case 290: /* assign_stm: AUTO_ALIASES EQUAL NUMBER  */
+#line 1543 "cfg.y"
+                                            { IFOR();
+								auto_aliases=(yyvsp[0].intval); }
+#line 4847 "cfg.tab.c"
+    break;
+
+  case 291: /* assign_stm: AUTO_ALIASES EQUAL error  */
+#line 1545 "cfg.y"
+                                            { yyerror("number  expected"); }
+#line 4853 "cfg.tab.c"
+    break;
+
+  case 292: /* assign_stm: ADVERTISED_ADDRESS EQUAL listen_id  */
+#line 1546 "cfg.y"
+                                                     { IFOR();
+								if ((yyvsp[0].strval)) {
+									default_global_address->s=(yyvsp[0].strval);
+									default_global_address->len=strlen((yyvsp[0].strval));
+								}
+								}
+#line 4864 "cfg.tab.c"
+    break;
+
+  case 293: /* assign_stm: ADVERTISED_ADDRESS EQUAL error  */
+#line 1552 "cfg.y"
+                                                 {yyerror("ip address or hostname "
+												"expected"); }
+#line 4871 "cfg.tab.c"
+    break;
+
+  case 294: /* assign_stm: ADVERTISED_PORT EQUAL NUMBER  */
+#line 1554 "cfg.y"
+                                               { IFOR();
+								tmp = int2str((yyvsp[0].intval), &i_tmp);
+								if (i_tmp > default_global_port->len)
+									default_global_port->s =
+									pkg_realloc(default_global_port->s, i_tmp);
+								if (!default_global_port->s) {
+									LM_CRIT("cfg. parser: out of memory.\n");
+									YYABORT;
+								} else {
+									default_global_port->len = i_tmp;
+									memcpy(default_global_port->s, tmp,
+											default_global_port->len);
+								}
+								}
+#line 4890 "cfg.tab.c"
+    break;
+
+  case 295: /* assign_stm: ADVERTISED_PORT EQUAL error  */
+#line 1568 "cfg.y"
+                                             {yyerror("ip address or hostname "
+												"expected"); }
+#line 4897 "cfg.tab.c"
+    break;
+
+  case 296: /* assign_stm: DISABLE_CORE EQUAL NUMBER  */
+#line 1570 "cfg.y"
+                                            { IFOR();
+										disable_core_dump=(yyvsp[0].intval);
+									}
+#line 4905 "cfg.tab.c"
+    break;
+
+  case 297: /* assign_stm: DISABLE_CORE EQUAL error  */
+#line 1573 "cfg.y"
+                                           { yyerror("boolean value expected"); }
+#line 4911 "cfg.tab.c"
+    break;
+
+  case 298: /* assign_stm: OPEN_FD_LIMIT EQUAL NUMBER  */
+#line 1574 "cfg.y"
+                                             { IFOR();
+										open_files_limit=(yyvsp[0].intval);
+									}
+#line 4919 "cfg.tab.c"
+    break;
+
+  case 299: /* assign_stm: OPEN_FD_LIMIT EQUAL error  */
+#line 1577 "cfg.y"
+                                            { yyerror("number expected"); }
+#line 4925 "cfg.tab.c"
+    break;
+
+  case 300: /* assign_stm: MCAST_LOOPBACK EQUAL NUMBER  */
+#line 1578 "cfg.y"
+                                              { IFOR();
+								#ifdef USE_MCAST
+										mcast_loopback=(yyvsp[0].intval);
+								#else
+									warn("no multicast support compiled in");
+								#endif
+		  }
+#line 4937 "cfg.tab.c"
+    break;
+
+  case 301: /* assign_stm: MCAST_LOOPBACK EQUAL error  */
+#line 1585 "cfg.y"
+                                             { yyerror("boolean value expected"); }
+#line 4943 "cfg.tab.c"
+    break;
+
+  case 302: /* assign_stm: MCAST_TTL EQUAL NUMBER  */
+#line 1586 "cfg.y"
+                                         { IFOR();
+								#ifdef USE_MCAST
+										mcast_ttl=(yyvsp[0].intval);
+								#else
+									warn("no multicast support compiled in");
+								#endif
+		  }
+#line 4955 "cfg.tab.c"
+    break;
+
+  case 303: /* assign_stm: MCAST_TTL EQUAL error  */
+#line 1593 "cfg.y"
+                                        { yyerror("number expected as tos"); }
+#line 4961 "cfg.tab.c"
+    break;
+
+  case 304: /* assign_stm: TOS EQUAL NUMBER  */
+#line 1594 "cfg.y"
+                                   { IFOR(); tos = (yyvsp[0].intval);
+							if (tos<0)
+								yyerror("invalid tos value");
+		 }
+#line 4970 "cfg.tab.c"
+    break;
+
+  case 305: /* assign_stm: TOS EQUAL ID  */
+#line 1598 "cfg.y"
+                               { IFOR();
+							if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWDELAY")) {
+								tos=IPTOS_LOWDELAY;
+							} else if (strcasecmp((yyvsp[0].strval),"IPTOS_THROUGHPUT")) {
+								tos=IPTOS_THROUGHPUT;
+							} else if (strcasecmp((yyvsp[0].strval),"IPTOS_RELIABILITY")) {
+								tos=IPTOS_RELIABILITY;
+#if defined(IPTOS_MINCOST)
+							} else if (strcasecmp((yyvsp[0].strval),"IPTOS_MINCOST")) {
+								tos=IPTOS_MINCOST;
+#endif
+#if defined(IPTOS_LOWCOST)
+							} else if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWCOST")) {
+								tos=IPTOS_LOWCOST;
+#endif
+							} else {
+								yyerror("invalid tos value - allowed: "
+									"IPTOS_LOWDELAY,IPTOS_THROUGHPUT,"
+									"IPTOS_RELIABILITY"
+#if defined(IPTOS_LOWCOST)
+									",IPTOS_LOWCOST"
+#endif
+#if defined(IPTOS_MINCOST)
+									",IPTOS_MINCOST"
+#endif
+									"\n");
+							}
+		 }
+#line 5003 "cfg.tab.c"
+    break;
+
+  case 306: /* assign_stm: TOS EQUAL error  */
+#line 1626 "cfg.y"
+                                  { yyerror("number expected"); }
+#line 5009 "cfg.tab.c"
+    break;
+
+  case 307: /* assign_stm: MPATH EQUAL STRING  */
+#line 1627 "cfg.y"
+                                     {IFOR();
+				add_mpath((yyvsp[0].strval)); }
+#line 5016 "cfg.tab.c"
+    break;
+
+  case 308: /* assign_stm: MPATH EQUAL error  */
+#line 1629 "cfg.y"
+                                     { yyerror("string value expected"); }
+#line 5022 "cfg.tab.c"
+    break;
+
+  case 309: /* assign_stm: DISABLE_DNS_FAILOVER EQUAL NUMBER  */
+#line 1630 "cfg.y"
+                                                    { IFOR();
+										disable_dns_failover=(yyvsp[0].intval);
+									}
+#line 5030 "cfg.tab.c"
+    break;
+
+  case 310: /* assign_stm: DISABLE_DNS_FAILOVER error  */
+#line 1633 "cfg.y"
+                                             { yyerror("boolean value expected"); }
+#line 5036 "cfg.tab.c"
+    break;
+
+  case 311: /* assign_stm: DISABLE_DNS_BLACKLIST EQUAL NUMBER  */
+#line 1634 "cfg.y"
+                                                     { IFOR();
+										disable_dns_blacklist=(yyvsp[0].intval);
+									}
+#line 5044 "cfg.tab.c"
+    break;
+
+  case 312: /* assign_stm: DISABLE_DNS_BLACKLIST error  */
+#line 1637 "cfg.y"
+                                              { yyerror("boolean value expected"); }
+#line 5050 "cfg.tab.c"
+    break;
+
+  case 313: /* assign_stm: DST_BLACKLIST EQUAL ID SLASH blst_flags blst_def  */
+#line 1638 "cfg.y"
+                                                                   { IFOR();
+				s_tmp.s = (yyvsp[-3].strval);
+				s_tmp.len = strlen((yyvsp[-3].strval));
+				if (create_bl_head(_str("script"), (yyvsp[-1].intval),
+				    bl_head, bl_tail, &s_tmp)==0) {
+					yyerror("failed to create blacklist\n");
+					YYABORT;
+				}
+				bl_head = bl_tail = NULL;
+				}
+#line 5065 "cfg.tab.c"
+    break;
+
+  case 314: /* assign_stm: DST_BLACKLIST EQUAL ID blst_def  */
+#line 1648 "cfg.y"
+                                                  { IFOR();
+				s_tmp.s = (yyvsp[-1].strval);
+				s_tmp.len = strlen((yyvsp[-1].strval));
+				if (create_bl_head(_str("script"), BL_READONLY_LIST,
+				    bl_head, bl_tail, &s_tmp)==0) {
+					yyerror("failed to create blacklist\n");
+					YYABORT;
+				}
+				bl_head = bl_tail = NULL;
+				}
+#line 5080 "cfg.tab.c"
+    break;
+
+  case 315: /* assign_stm: DISABLE_STATELESS_FWD EQUAL NUMBER  */
+#line 1658 "cfg.y"
+                                                     { IFOR();
+				sl_fwd_disabled=(yyvsp[0].intval); }
+#line 5087 "cfg.tab.c"
+    break;
+
+  case 316: /* assign_stm: DB_VERSION_TABLE EQUAL STRING  */
+#line 1660 "cfg.y"
+                                                { IFOR();
+				db_version_table=(yyvsp[0].strval); }
+#line 5094 "cfg.tab.c"
+    break;
+
+  case 317: /* assign_stm: DB_VERSION_TABLE EQUAL error  */
+#line 1662 "cfg.y"
+                                               { yyerror("string value expected"); }
+#line 5100 "cfg.tab.c"
+    break;
+
+  case 318: /* assign_stm: DB_DEFAULT_URL EQUAL STRING  */
+#line 1663 "cfg.y"
+                                              { IFOR();
+				db_default_url=(yyvsp[0].strval); }
+#line 5107 "cfg.tab.c"
+    break;
+
+  case 319: /* assign_stm: DB_DEFAULT_URL EQUAL error  */
+#line 1665 "cfg.y"
+                                             { yyerror("string value expected"); }
+#line 5113 "cfg.tab.c"
+    break;
+
+  case 320: /* assign_stm: DB_MAX_ASYNC_CONNECTIONS EQUAL NUMBER  */
+#line 1666 "cfg.y"
+                                                        { IFOR();
+				db_max_async_connections=(yyvsp[0].intval); }
+#line 5120 "cfg.tab.c"
+    break;
+
+  case 321: /* assign_stm: DB_MAX_ASYNC_CONNECTIONS EQUAL error  */
+#line 1668 "cfg.y"
+                                                       {
+				yyerror("integer value expected");
+				}
+#line 5128 "cfg.tab.c"
+    break;
+
+  case 322: /* assign_stm: DISABLE_503_TRANSLATION EQUAL NUMBER  */
+#line 1671 "cfg.y"
+                                                       { IFOR();
+				disable_503_translation=(yyvsp[0].intval); }
+#line 5135 "cfg.tab.c"
+    break;
+
+  case 323: /* assign_stm: DISABLE_503_TRANSLATION EQUAL error  */
+#line 1673 "cfg.y"
+                                                      {
+				yyerror("integer value expected");
+				}
+#line 5143 "cfg.tab.c"
+    break;
+
+  case 324: /* assign_stm: AUTO_SCALING_PROFILE EQUAL auto_scale_profile_def  */
+#line 1676 "cfg.y"
+                                                                    {}
+#line 5149 "cfg.tab.c"
+    break;
+
+  case 325: /* assign_stm: AUTO_SCALING_PROFILE EQUAL error  */
+#line 1677 "cfg.y"
+                                                   {
+				yyerror("bad auto-scaling profile definition");
+				}
+#line 5157 "cfg.tab.c"
+    break;
+
+  case 326: /* assign_stm: AUTO_SCALING_CYCLE EQUAL NUMBER  */
+#line 1680 "cfg.y"
+                                                  { IFOR();
+				auto_scaling_cycle=(yyvsp[0].intval); }
+#line 5164 "cfg.tab.c"
+    break;
+
+  case 327: /* assign_stm: AUTO_SCALING_CYCLE EQUAL error  */
+#line 1682 "cfg.y"
+                                                 {
+				yyerror("integer value expected");
+				}
+#line 5172 "cfg.tab.c"
+    break;
+
+  case 328: /* assign_stm: error EQUAL  */
+#line 1685 "cfg.y"
+                              { yyerror("unknown config variable"); }
+#line 5178 "cfg.tab.c"
+    break;
+
+  case 329: /* module_stm: LOADMODULE STRING  */
+#line 1688 "cfg.y"
+                                        { IFOR();
+			if (load_module((yyvsp[0].strval)) < 0)
+				yyerrorf("failed to load module %s\n", (yyvsp[0].strval));
+		}
+#line 5187 "cfg.tab.c"
+    break;
+
+  case 330: /* module_stm: LOADMODULE error  */
+#line 1692 "cfg.y"
+                                        { yyerror("string expected");  }
+#line 5193 "cfg.tab.c"
+    break;
+
+  case 331: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA STRING RPAREN  */
+#line 1693 "cfg.y"
+                                                                          { IFOR();
+				if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), STR_PARAM, (yyvsp[-1].strval)) != 0) {
+					yyerrorf("Parameter <%s> not found in module <%s> - "
+						"can't set", (yyvsp[-3].strval), (yyvsp[-5].strval));
+				}
+			}
+#line 5204 "cfg.tab.c"
+    break;
+
+  case 332: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA folded_string RPAREN  */
+#line 1699 "cfg.y"
+                                                                                 { IFOR();
+				if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), STR_PARAM, (yyvsp[-1].strval)) != 0) {
+					yyerrorf("Parameter <%s> not found in module <%s> - "
+						"can't set", (yyvsp[-3].strval), (yyvsp[-5].strval));
+				}
+			}
+#line 5215 "cfg.tab.c"
+    break;
+
+  case 333: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA snumber RPAREN  */
+#line 1705 "cfg.y"
+                                                                           { IFOR();
+				if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), INT_PARAM, (void*)(yyvsp[-1].intval)) != 0) {
+					yyerrorf("Parameter <%s> not found in module <%s> - "
+						"can't set", (yyvsp[-3].strval), (yyvsp[-5].strval));
+				}
+			}
+#line 5226 "cfg.tab.c"
+    break;
+
+  case 334: /* module_stm: MODPARAM error  */
+#line 1711 "cfg.y"
+                                 { yyerror("Invalid arguments"); }
+#line 5232 "cfg.tab.c"
+    break;
+
+  case 335: /* ip: ipv4  */
+#line 1715 "cfg.y"
+                       { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 5238 "cfg.tab.c"
+    break;
+
+  case 336: /* ip: ipv6  */
+#line 1716 "cfg.y"
+                       { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 5244 "cfg.tab.c"
+    break;
+
+  case 337: /* ipv4: IPV4ADDR  */
+#line 1719 "cfg.y"
+                 {
+					(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+					if ((yyval.ipaddr)==0){
+						LM_CRIT("ERROR: cfg. parser: out of memory.\n");
+						YYABORT;
+					}else{
+						memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+						(yyval.ipaddr)->af=AF_INET;
+						(yyval.ipaddr)->len=16;
+						if (inet_pton(AF_INET, (yyvsp[0].strval), (yyval.ipaddr)->u.addr)<=0){
+							yyerror("bad ipv4 address");
+						}
+					}
+				}
+#line 5263 "cfg.tab.c"
+    break;
+
+  case 338: /* ipv6addr: IPV6ADDR  */
+#line 1735 "cfg.y"
+                         {
+					(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+					if ((yyval.ipaddr)==0){
+						LM_CRIT("ERROR: cfg. parser: out of memory.\n");
+						YYABORT;
+					}else{
+						memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+						(yyval.ipaddr)->af=AF_INET6;
+						(yyval.ipaddr)->len=16;
+						if (inet_pton(AF_INET6, (yyvsp[0].strval), (yyval.ipaddr)->u.addr)<=0){
+							yyerror("bad ipv6 address");
+						}
+					}
+				}
+#line 5282 "cfg.tab.c"
+    break;
+
+  case 339: /* ipv6: ipv6addr  */
+#line 1751 "cfg.y"
+                 { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 5288 "cfg.tab.c"
+    break;
+
+  case 340: /* ipv6: LBRACK ipv6addr RBRACK  */
+#line 1752 "cfg.y"
+                                 {(yyval.ipaddr)=(yyvsp[-1].ipaddr); }
+#line 5294 "cfg.tab.c"
+    break;
+
+  case 341: /* ipnet: IPNET  */
+#line 1755 "cfg.y"
+                {
+				if (parse_ipnet((yyvsp[0].strval), strlen((yyvsp[0].strval)), &net_tmp) < 0)
+					yyerror("unable to parse ip and/or netmask\n");
+
+				(yyval.ipnet) = net_tmp;
+			}
+#line 5305 "cfg.tab.c"
+    break;
+
+  case 342: /* ipnet: ip  */
+#line 1761 "cfg.y"
+                        {
+				(yyval.ipnet)=mk_net_bitlen((yyvsp[0].ipaddr), (yyvsp[0].ipaddr)->len*8);
+				pkg_free((yyvsp[0].ipaddr));
+			}
+#line 5314 "cfg.tab.c"
+    break;
+
+  case 343: /* folded_string: STRING STRING  */
+#line 1771 "cfg.y"
+                              {
+				(yyval.strval) = pkg_malloc( strlen((yyvsp[-1].strval)) + strlen((yyvsp[0].strval)) + 1);
+				if ((yyval.strval)==0){
+					yyerror("cfg. parser: out of memory");
+					YYABORT;
+				} else {
+					strcpy((yyval.strval),(yyvsp[-1].strval)); strcat((yyval.strval),(yyvsp[0].strval));
+					pkg_free((yyvsp[-1].strval)); pkg_free((yyvsp[0].strval));
+				}
+			}
+#line 5329 "cfg.tab.c"
+    break;
+
+  case 344: /* folded_string: folded_string STRING  */
+#line 1781 "cfg.y"
+                                       {
+				(yyval.strval) = pkg_malloc( strlen((yyvsp[-1].strval)) + strlen((yyvsp[0].strval)) + 1);
+				if ((yyval.strval)==0){
+					LM_CRIT("ERROR: cfg. parser: out of memory.\n");
+					YYABORT;
+				} else {
+					strcpy((yyval.strval),(yyvsp[-1].strval)); strcat((yyval.strval),(yyvsp[0].strval));
+					pkg_free((yyvsp[-1].strval)); pkg_free((yyvsp[0].strval));
+				}
+			}
+#line 5344 "cfg.tab.c"
+    break;
+
+  case 345: /* route_name: ID  */
+#line 1792 "cfg.y"
+                {
+				(yyval.strval) = (yyvsp[0].strval);
+				}
+#line 5352 "cfg.tab.c"
+    break;
+
+  case 346: /* route_name: NUMBER  */
+#line 1795 "cfg.y"
+                         {
+				tmp=int2str((yyvsp[0].intval), &i_tmp);
+				if (((yyval.strval)=pkg_malloc(i_tmp+1))==0) {
+					yyerror("cfg. parser: out of memory.\n");
+					YYABORT;
+				}
+				memcpy( (yyval.strval), tmp, i_tmp);
+				(yyval.strval)[i_tmp] = 0;
+				}
+#line 5366 "cfg.tab.c"
+    break;
+
+  case 347: /* route_name: STRING  */
+#line 1804 "cfg.y"
+                        {
+				(yyval.strval) = (yyvsp[0].strval);
+		}
+#line 5374 "cfg.tab.c"
+    break;
+
+  case 348: /* route_name_var: route_name  */
+#line 1809 "cfg.y"
+                           {
+				/* check to see if there are any "$" in the string name */
+				tmp = strchr((yyvsp[0].strval), '$');
+				if (!tmp) {
+					/* route name is a cosntant string - search for the route */
+					rn_tmp.data = 0;
+					rn_tmp.iname = get_script_route_idx((yyvsp[0].strval), sroutes->request,
+							RT_NO, 0);
+					if (rn_tmp.iname==-1)
+						yyerror("too many script routes");
+					(yyval.intval) = NUMBER_ST;
+				} else {
+					tstr.s = (yyvsp[0].strval);
+					tstr.len = strlen(tstr.s);
+					if (pv_parse_format(&tstr, &elem) < 0) {
+						yyerror("cannot parse format");
+						YYABORT;
+					}
+					/* the route name is a format, so we can't evaluate it now */
+					rn_tmp.ename = elem;
+					(yyval.intval) = SCRIPTVAR_ELEM_ST;
+				}
+			}
+#line 5402 "cfg.tab.c"
+    break;
+
+  case 349: /* route_name_var: script_var  */
+#line 1832 "cfg.y"
+                             {
+				rn_tmp.sname = (yyvsp[0].specval);
+				(yyval.intval) = SCRIPTVAR_ST;
+		}
+#line 5411 "cfg.tab.c"
+    break;
+
+  case 350: /* route_stm: ROUTE LBRACE actions RBRACE  */
+#line 1837 "cfg.y"
+                                        {
+						if (sroutes->request[DEFAULT_RT].a!=0) {
+							yyerror("overwriting default "
+								"request routing table");
+							YYABORT;
+						}
+						push((yyvsp[-1].action), &sroutes->request[DEFAULT_RT].a);
+					}
+#line 5424 "cfg.tab.c"
+    break;
+
+  case 351: /* route_stm: ROUTE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1845 "cfg.y"
+                                                                       {
+						if ( strtol((yyvsp[-4].strval),&tmp,10)==0 && *tmp==0) {
+							/* route[0] detected */
+							if (sroutes->request[DEFAULT_RT].a!=0) {
+								yyerror("overwriting(2) default "
+									"request routing table");
+								YYABORT;
+							}
+							push((yyvsp[-1].action), &sroutes->request[DEFAULT_RT].a);
+						} else {
+							i_tmp = get_script_route_idx( (yyvsp[-4].strval),
+								sroutes->request, RT_NO,1);
+							if (i_tmp==-1) YYABORT;
+							push((yyvsp[-1].action), &sroutes->request[i_tmp].a);
+						}
+					}
+#line 5445 "cfg.tab.c"
+    break;
+
+  case 352: /* route_stm: ROUTE error  */
+#line 1861 "cfg.y"
+                              { yyerror("invalid  route  statement"); }
+#line 5451 "cfg.tab.c"
+    break;
+
+  case 353: /* failure_route_stm: ROUTE_FAILURE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1864 "cfg.y"
+                                                                                {
+						i_tmp = get_script_route_idx( (yyvsp[-4].strval), sroutes->failure,
+							FAILURE_RT_NO,1);
+						if (i_tmp==-1) YYABORT;
+						push((yyvsp[-1].action), &sroutes->failure[i_tmp].a);
+					}
+#line 5462 "cfg.tab.c"
+    break;
+
+  case 354: /* failure_route_stm: ROUTE_FAILURE error  */
+#line 1870 "cfg.y"
+                                      { yyerror("invalid failure_route statement"); }
+#line 5468 "cfg.tab.c"
+    break;
+
+  case 355: /* onreply_route_stm: ROUTE_ONREPLY LBRACE actions RBRACE  */
+#line 1873 "cfg.y"
+                                                       {
+						if (sroutes->onreply[DEFAULT_RT].a!=0) {
+							yyerror("overwriting default "
+								"onreply routing table");
+							YYABORT;
+						}
+						push((yyvsp[-1].action), &sroutes->onreply[DEFAULT_RT].a);
+					}
+#line 5481 "cfg.tab.c"
+    break;
+
+  case 356: /* onreply_route_stm: ROUTE_ONREPLY LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1881 "cfg.y"
+                                                                               {
+						i_tmp = get_script_route_idx( (yyvsp[-4].strval), sroutes->onreply,
+							ONREPLY_RT_NO,1);
+						if (i_tmp==-1) YYABORT;
+						push((yyvsp[-1].action), &sroutes->onreply[i_tmp].a);
+					}
+#line 5492 "cfg.tab.c"
+    break;
+
+  case 357: /* onreply_route_stm: ROUTE_ONREPLY error  */
+#line 1887 "cfg.y"
+                                      { yyerror("invalid onreply_route statement"); }
+#line 5498 "cfg.tab.c"
+    break;
+
+  case 358: /* branch_route_stm: ROUTE_BRANCH LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1890 "cfg.y"
+                                                                              {
+						i_tmp = get_script_route_idx( (yyvsp[-4].strval), sroutes->branch,
+							BRANCH_RT_NO,1);
+						if (i_tmp==-1) YYABORT;
+						push((yyvsp[-1].action), &sroutes->branch[i_tmp].a);
+					}
+#line 5509 "cfg.tab.c"
+    break;
+
+  case 359: /* branch_route_stm: ROUTE_BRANCH error  */
+#line 1896 "cfg.y"
+                                     { yyerror("invalid branch_route statement"); }
+#line 5515 "cfg.tab.c"
+    break;
+
+  case 360: /* error_route_stm: ROUTE_ERROR LBRACE actions RBRACE  */
+#line 1899 "cfg.y"
+                                                    {
+						if (sroutes->error.a!=0) {
+							yyerror("overwriting default "
+								"error routing table");
+							YYABORT;
+						}
+						push((yyvsp[-1].action), &sroutes->error.a);
+					}
+#line 5528 "cfg.tab.c"
+    break;
+
+  case 361: /* error_route_stm: ROUTE_ERROR error  */
+#line 1907 "cfg.y"
+                                    { yyerror("invalid error_route statement"); }
+#line 5534 "cfg.tab.c"
+    break;
+
+  case 362: /* local_route_stm: ROUTE_LOCAL LBRACE actions RBRACE  */
+#line 1910 "cfg.y"
+                                                    {
+						if (sroutes->local.a!=0) {
+							yyerror("re-definition of local "
+								"route detected");
+							YYABORT;
+						}
+						push((yyvsp[-1].action), &sroutes->local.a);
+					}
+#line 5547 "cfg.tab.c"
+    break;
+
+  case 363: /* local_route_stm: ROUTE_LOCAL error  */
+#line 1918 "cfg.y"
+                                    { yyerror("invalid local_route statement"); }
+#line 5553 "cfg.tab.c"
+    break;
+
+  case 364: /* startup_route_stm: ROUTE_STARTUP LBRACE actions RBRACE  */
+#line 1921 "cfg.y"
+                                                        {
+						if (sroutes->startup.a!=0) {
+							yyerror("re-definition of startup "
+								"route detected");
+							YYABORT;
+						}
+						push((yyvsp[-1].action), &sroutes->startup.a);
+					}
+#line 5566 "cfg.tab.c"
+    break;
+
+  case 365: /* startup_route_stm: ROUTE_STARTUP error  */
+#line 1929 "cfg.y"
+                                      { yyerror("invalid startup_route statement"); }
+#line 5572 "cfg.tab.c"
+    break;
+
+  case 366: /* timer_route_stm: ROUTE_TIMER LBRACK route_name COMMA NUMBER RBRACK LBRACE actions RBRACE  */
+#line 1932 "cfg.y"
+                                                                                          {
+						i_tmp = 0;
+						while(i_tmp<TIMER_RT_NO && sroutes->timer[i_tmp].a!=0){
+							i_tmp++;
+						}
+						if(i_tmp == TIMER_RT_NO) {
+							yyerror("Too many timer routes defined\n");
+							YYABORT;
+						}
+						sroutes->timer[i_tmp].name = (yyvsp[-6].strval);
+						sroutes->timer[i_tmp].interval = (yyvsp[-4].intval);
+						push((yyvsp[-1].action), &sroutes->timer[i_tmp].a);
+					}
+#line 5590 "cfg.tab.c"
+    break;
+
+  case 367: /* timer_route_stm: ROUTE_TIMER error  */
+#line 1945 "cfg.y"
+                                    { yyerror("invalid timer_route statement"); }
+#line 5596 "cfg.tab.c"
+    break;
+
+  case 368: /* event_route_stm: ROUTE_EVENT LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1948 "cfg.y"
+                                                                            {
+						i_tmp = get_script_route_idx((yyvsp[-4].strval), sroutes->event,
+								EVENT_RT_NO,1);
+						if (i_tmp==-1) YYABORT;
+						push((yyvsp[-1].action), &sroutes->event[i_tmp].a);
+					}
+#line 5607 "cfg.tab.c"
+    break;
+
+  case 369: /* event_route_stm: ROUTE_EVENT error  */
+#line 1954 "cfg.y"
+                                    { yyerror("invalid event_route statement"); }
+#line 5613 "cfg.tab.c"
+    break;
+
+  case 370: /* exp: exp AND exp  */
+#line 1959 "cfg.y"
+                        { (yyval.expr)=mk_exp(AND_OP, (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 5619 "cfg.tab.c"
+    break;
+
+  case 371: /* exp: exp OR exp  */
+#line 1960 "cfg.y"
+                                { (yyval.expr)=mk_exp(OR_OP, (yyvsp[-2].expr), (yyvsp[0].expr));  }
+#line 5625 "cfg.tab.c"
+    break;
+
+  case 372: /* exp: NOT exp  */
+#line 1961 "cfg.y"
+                                        { (yyval.expr)=mk_exp(NOT_OP, (yyvsp[0].expr), 0);  }
+#line 5631 "cfg.tab.c"
+    break;
+
+  case 373: /* exp: LPAREN exp RPAREN  */
+#line 1962 "cfg.y"
+                                { (yyval.expr)=mk_exp(EVAL_OP, (yyvsp[-1].expr), 0); }
+#line 5637 "cfg.tab.c"
+    break;
+
+  case 374: /* exp: LBRACK assignexp RBRACK  */
+#line 1963 "cfg.y"
+                                  { (yyval.expr)=(yyvsp[-1].expr); }
+#line 5643 "cfg.tab.c"
+    break;
+
+  case 375: /* exp: exp_elem  */
+#line 1964 "cfg.y"
+                                        { (yyval.expr)=(yyvsp[0].expr); }
+#line 5649 "cfg.tab.c"
+    break;
+
+  case 376: /* equalop: EQUAL_T  */
+#line 1967 "cfg.y"
+                          {(yyval.intval)=EQUAL_OP; }
+#line 5655 "cfg.tab.c"
+    break;
+
+  case 377: /* equalop: DIFF  */
+#line 1968 "cfg.y"
+                                {(yyval.intval)=DIFF_OP; }
+#line 5661 "cfg.tab.c"
+    break;
+
+  case 378: /* compop: GT  */
+#line 1971 "cfg.y"
+                {(yyval.intval)=GT_OP; }
+#line 5667 "cfg.tab.c"
+    break;
+
+  case 379: /* compop: LT  */
+#line 1972 "cfg.y"
+                        {(yyval.intval)=LT_OP; }
+#line 5673 "cfg.tab.c"
+    break;
+
+  case 380: /* compop: GTE  */
+#line 1973 "cfg.y"
+                        {(yyval.intval)=GTE_OP; }
+#line 5679 "cfg.tab.c"
+    break;
+
+  case 381: /* compop: LTE  */
+#line 1974 "cfg.y"
+                        {(yyval.intval)=LTE_OP; }
+#line 5685 "cfg.tab.c"
+    break;
+
+  case 382: /* matchop: MATCH  */
+#line 1976 "cfg.y"
+                {(yyval.intval)=MATCH_OP; }
+#line 5691 "cfg.tab.c"
+    break;
+
+  case 383: /* matchop: NOTMATCH  */
+#line 1977 "cfg.y"
+                                {(yyval.intval)=NOTMATCH_OP; }
+#line 5697 "cfg.tab.c"
+    break;
+
+  case 384: /* intop: equalop  */
+#line 1980 "cfg.y"
+                {(yyval.intval)=(yyvsp[0].intval); }
+#line 5703 "cfg.tab.c"
+    break;
+
+  case 385: /* intop: compop  */
+#line 1981 "cfg.y"
+                        {(yyval.intval)=(yyvsp[0].intval); }
+#line 5709 "cfg.tab.c"
+    break;
+
+  case 386: /* strop: equalop  */
+#line 1984 "cfg.y"
+                {(yyval.intval)=(yyvsp[0].intval); }
+#line 5715 "cfg.tab.c"
+    break;
+
+  case 387: /* strop: compop  */
+#line 1985 "cfg.y"
+                     {(yyval.intval)=(yyvsp[0].intval); }
+#line 5721 "cfg.tab.c"
+    break;
+
+  case 388: /* strop: matchop  */
+#line 1986 "cfg.y"
+                                {(yyval.intval)=(yyvsp[0].intval); }
+#line 5727 "cfg.tab.c"
+    break;
+
+  case 389: /* script_var: SCRIPTVAR  */
+#line 1989 "cfg.y"
+                                {
+				spec = (pv_spec_t*)pkg_malloc(sizeof(pv_spec_t));
+				if (spec==NULL){
+					yyerror("no more pkg memory\n");
+					YYABORT;
+				}
+				memset(spec, 0, sizeof(pv_spec_t));
+				tstr.s = (yyvsp[0].strval);
+				tstr.len = strlen(tstr.s);
+				if(pv_parse_spec(&tstr, spec)==NULL)
+				{
+					yyerror("unknown script variable");
+				}
+
+				(yyval.specval) = spec;
+			}
+#line 5748 "cfg.tab.c"
+    break;
+
+  case 390: /* script_var: SCRIPTVARERR  */
+#line 2005 "cfg.y"
+                               {
+			(yyval.specval)=0; yyerror("invalid script variable name");
+		}
+#line 5756 "cfg.tab.c"
+    break;
+
+  case 391: /* exp_elem: exp_cond  */
+#line 2010 "cfg.y"
+                                {(yyval.expr)=(yyvsp[0].expr); }
+#line 5762 "cfg.tab.c"
+    break;
+
+  case 392: /* exp_elem: exp_stm  */
+#line 2011 "cfg.y"
+                                        {(yyval.expr)=mk_elem( NO_OP, ACTION_O, 0, ACTIONS_ST, (yyvsp[0].action) ); }
+#line 5768 "cfg.tab.c"
+    break;
+
+  case 393: /* exp_elem: snumber  */
+#line 2012 "cfg.y"
+                                        {(yyval.expr)=mk_elem( NO_OP, NUMBER_O, 0, NUMBER_ST,
+											(void*)(yyvsp[0].intval) ); }
+#line 5775 "cfg.tab.c"
+    break;
+
+  case 394: /* exp_elem: script_var  */
+#line 2014 "cfg.y"
+                                {
+				(yyval.expr)=mk_elem(NO_OP, SCRIPTVAR_O,0,SCRIPTVAR_ST,(void*)(yyvsp[0].specval));
+			}
+#line 5783 "cfg.tab.c"
+    break;
+
+  case 395: /* exp_cond: script_var strop script_var  */
+#line 2019 "cfg.y"
+                                      {
+				(yyval.expr)=mk_elem( (yyvsp[-1].intval), SCRIPTVAR_O,(void*)(yyvsp[-2].specval),SCRIPTVAR_ST,(void*)(yyvsp[0].specval));
+			}
+#line 5791 "cfg.tab.c"
+    break;
+
+  case 396: /* exp_cond: script_var strop STRING  */
+#line 2022 "cfg.y"
+                                          {
+				(yyval.expr)=mk_elem( (yyvsp[-1].intval), SCRIPTVAR_O,(void*)(yyvsp[-2].specval),STR_ST,(yyvsp[0].strval));
+			}
+#line 5799 "cfg.tab.c"
+    break;
+
+  case 397: /* exp_cond: script_var intop snumber  */
+#line 2025 "cfg.y"
+                                           {
+				(yyval.expr)=mk_elem( (yyvsp[-1].intval), SCRIPTVAR_O,(void*)(yyvsp[-2].specval),NUMBER_ST,(void *)(yyvsp[0].intval));
+			}
+#line 5807 "cfg.tab.c"
+    break;
+
+  case 398: /* exp_cond: script_var equalop NULLV  */
+#line 2028 "cfg.y"
+                                                {
+				(yyval.expr)=mk_elem( (yyvsp[-1].intval), SCRIPTVAR_O,(void*)(yyvsp[-2].specval), NULLV_ST, 0);
+			}
+#line 5815 "cfg.tab.c"
+    break;
+
+  case 399: /* exp_cond: script_var equalop ipnet  */
+#line 2031 "cfg.y"
+                                           {
+				(yyval.expr)=mk_elem((yyvsp[-1].intval), SCRIPTVAR_O, (void*)(yyvsp[-2].specval), NET_ST, (yyvsp[0].ipnet));
+			}
+#line 5823 "cfg.tab.c"
+    break;
+
+  case 400: /* assignop: EQUAL  */
+#line 2037 "cfg.y"
+              { (yyval.intval) = EQ_T; }
+#line 5829 "cfg.tab.c"
+    break;
+
+  case 401: /* assignop: COLONEQ  */
+#line 2038 "cfg.y"
+                  { (yyval.intval) = COLONEQ_T; }
+#line 5835 "cfg.tab.c"
+    break;
+
+  case 402: /* assignop: PLUSEQ  */
+#line 2039 "cfg.y"
+                 { (yyval.intval) = PLUSEQ_T; }
+#line 5841 "cfg.tab.c"
+    break;
+
+  case 403: /* assignop: MINUSEQ  */
+#line 2040 "cfg.y"
+                  { (yyval.intval) = MINUSEQ_T;}
+#line 5847 "cfg.tab.c"
+    break;
+
+  case 404: /* assignop: SLASHEQ  */
+#line 2041 "cfg.y"
+                  { (yyval.intval) = DIVEQ_T; }
+#line 5853 "cfg.tab.c"
+    break;
+
+  case 405: /* assignop: MULTEQ  */
+#line 2042 "cfg.y"
+                 { (yyval.intval) = MULTEQ_T; }
+#line 5859 "cfg.tab.c"
+    break;
+
+  case 406: /* assignop: MODULOEQ  */
+#line 2043 "cfg.y"
+                   { (yyval.intval) = MODULOEQ_T; }
+#line 5865 "cfg.tab.c"
+    break;
+
+  case 407: /* assignop: BANDEQ  */
+#line 2044 "cfg.y"
+                 { (yyval.intval) = BANDEQ_T; }
+#line 5871 "cfg.tab.c"
+    break;
+
+  case 408: /* assignop: BOREQ  */
+#line 2045 "cfg.y"
+                { (yyval.intval) = BOREQ_T; }
+#line 5877 "cfg.tab.c"
+    break;
+
+  case 409: /* assignop: BXOREQ  */
+#line 2046 "cfg.y"
+                 { (yyval.intval) = BXOREQ_T; }
+#line 5883 "cfg.tab.c"
+    break;
+
+  case 410: /* assignexp: snumber  */
+#line 2050 "cfg.y"
+                { (yyval.expr) = mk_elem(VALUE_OP, NUMBERV_O, (void*)(yyvsp[0].intval), 0, 0); }
+#line 5889 "cfg.tab.c"
+    break;
+
+  case 411: /* assignexp: STRING  */
+#line 2051 "cfg.y"
+                 { (yyval.expr) = mk_elem(VALUE_OP, STRINGV_O, (yyvsp[0].strval), 0, 0); }
+#line 5895 "cfg.tab.c"
+    break;
+
+  case 412: /* assignexp: script_var  */
+#line 2052 "cfg.y"
+                     { (yyval.expr) = mk_elem(VALUE_OP, SCRIPTVAR_O, (yyvsp[0].specval), 0, 0); }
+#line 5901 "cfg.tab.c"
+    break;
+
+  case 413: /* assignexp: exp_cond  */
+#line 2053 "cfg.y"
+                   { (yyval.expr)= (yyvsp[0].expr); }
+#line 5907 "cfg.tab.c"
+    break;
+
+  case 414: /* assignexp: cmd  */
+#line 2054 "cfg.y"
+              { (yyval.expr)=mk_elem( NO_OP, ACTION_O, 0, ACTIONS_ST, (yyvsp[0].action) ); }
+#line 5913 "cfg.tab.c"
+    break;
+
+  case 415: /* assignexp: assignexp PLUS assignexp  */
+#line 2055 "cfg.y"
+                                   {
+				(yyval.expr) = mk_elem(PLUS_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5921 "cfg.tab.c"
+    break;
+
+  case 416: /* assignexp: assignexp MINUS assignexp  */
+#line 2058 "cfg.y"
+                                    {
+				(yyval.expr) = mk_elem(MINUS_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5929 "cfg.tab.c"
+    break;
+
+  case 417: /* assignexp: assignexp MULT assignexp  */
+#line 2061 "cfg.y"
+                                   {
+				(yyval.expr) = mk_elem(MULT_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5937 "cfg.tab.c"
+    break;
+
+  case 418: /* assignexp: assignexp SLASH assignexp  */
+#line 2064 "cfg.y"
+                                    {
+				(yyval.expr) = mk_elem(DIV_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5945 "cfg.tab.c"
+    break;
+
+  case 419: /* assignexp: assignexp MODULO assignexp  */
+#line 2067 "cfg.y"
+                                     {
+				(yyval.expr) = mk_elem(MODULO_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5953 "cfg.tab.c"
+    break;
+
+  case 420: /* assignexp: assignexp BAND assignexp  */
+#line 2070 "cfg.y"
+                                   {
+				(yyval.expr) = mk_elem(BAND_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5961 "cfg.tab.c"
+    break;
+
+  case 421: /* assignexp: assignexp BOR assignexp  */
+#line 2073 "cfg.y"
+                                  {
+				(yyval.expr) = mk_elem(BOR_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5969 "cfg.tab.c"
+    break;
+
+  case 422: /* assignexp: assignexp BXOR assignexp  */
+#line 2076 "cfg.y"
+                                   {
+				(yyval.expr) = mk_elem(BXOR_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5977 "cfg.tab.c"
+    break;
+
+  case 423: /* assignexp: assignexp BLSHIFT assignexp  */
+#line 2079 "cfg.y"
+                                      {
+				(yyval.expr) = mk_elem(BLSHIFT_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5985 "cfg.tab.c"
+    break;
+
+  case 424: /* assignexp: assignexp BRSHIFT assignexp  */
+#line 2082 "cfg.y"
+                                      {
+				(yyval.expr) = mk_elem(BRSHIFT_OP, EXPR_O, (yyvsp[-2].expr), EXPR_ST, (yyvsp[0].expr));
+			}
+#line 5993 "cfg.tab.c"
+    break;
+
+  case 425: /* assignexp: BNOT assignexp  */
+#line 2085 "cfg.y"
+                         {
+				(yyval.expr) = mk_elem(BNOT_OP, EXPR_O, (yyvsp[0].expr), 0, 0);
+			}
+#line 6001 "cfg.tab.c"
+    break;
+
+  case 426: /* assignexp: LPAREN assignexp RPAREN  */
+#line 2088 "cfg.y"
+                                  { (yyval.expr) = (yyvsp[-1].expr); }
+#line 6007 "cfg.tab.c"
+    break;
+
+  case 427: /* assign_cmd: script_var assignop assignexp  */
+#line 2091 "cfg.y"
+                                          {
+			if(!pv_is_w((yyvsp[-2].specval)))
+				yyerror("invalid left operand in assignment");
+			if((yyvsp[-2].specval)->trans!=0)
+				yyerror("transformations not accepted in left side "
+					"of assignment");
+
+			mk_action2( (yyval.action), (yyvsp[-1].intval),
+					SCRIPTVAR_ST,
+					EXPR_ST,
+					(yyvsp[-2].specval),
+					(yyvsp[0].expr));
+		}
+#line 6025 "cfg.tab.c"
+    break;
+
+  case 428: /* assign_cmd: script_var EQUAL NULLV  */
+#line 2104 "cfg.y"
+                                  {
+			if(!pv_is_w((yyvsp[-2].specval)))
+				yyerror("invalid left operand in assignment");
+			if((yyvsp[-2].specval)->trans!=0)
+				yyerror("transformations not accepted in left side "
+					"of assignment");
+
+			mk_action2( (yyval.action), EQ_T,
+					SCRIPTVAR_ST,
+					NULLV_ST,
+					(yyvsp[-2].specval),
+					0);
+		}
+#line 6043 "cfg.tab.c"
+    break;
+
+  case 429: /* assign_cmd: script_var COLONEQ NULLV  */
+#line 2117 "cfg.y"
+                                    {
+			if(!pv_is_w((yyvsp[-2].specval)))
+				yyerror("invalid left operand in assignment");
+			if((yyvsp[-2].specval)->trans!=0)
+				yyerror("transformations not accepted in left side "
+					"of assignment");
+
+			mk_action2( (yyval.action), COLONEQ_T,
+					SCRIPTVAR_ST,
+					NULLV_ST,
+					(yyvsp[-2].specval),
+					0);
+		}
+#line 6061 "cfg.tab.c"
+    break;
+
+  case 430: /* exp_stm: cmd  */
+#line 2132 "cfg.y"
+                                                                { (yyval.action)=(yyvsp[0].action); }
+#line 6067 "cfg.tab.c"
+    break;
+
+  case 431: /* exp_stm: if_cmd  */
+#line 2133 "cfg.y"
+                                                                { (yyval.action)=(yyvsp[0].action); }
+#line 6073 "cfg.tab.c"
+    break;
+
+  case 432: /* exp_stm: assign_cmd  */
+#line 2134 "cfg.y"
+                                                                { (yyval.action)=(yyvsp[0].action); }
+#line 6079 "cfg.tab.c"
+    break;
+
+  case 433: /* exp_stm: LBRACE actions RBRACE  */
+#line 2135 "cfg.y"
+                                                { (yyval.action)=(yyvsp[-1].action); }
+#line 6085 "cfg.tab.c"
+    break;
+
+  case 434: /* exp_stm: LBRACE RBRACE  */
+#line 2136 "cfg.y"
+                                                        { (yyval.action)=0; }
+#line 6091 "cfg.tab.c"
+    break;
+
+  case 435: /* brk_stm: brk_action  */
+#line 2139 "cfg.y"
+                                                                { (yyval.action)=(yyvsp[0].action); }
+#line 6097 "cfg.tab.c"
+    break;
+
+  case 436: /* brk_stm: LBRACE brk_actions RBRACE  */
+#line 2140 "cfg.y"
+                                                        { (yyval.action)=(yyvsp[-1].action); }
+#line 6103 "cfg.tab.c"
+    break;
+
+  case 437: /* brk_stm: LBRACE RBRACE  */
+#line 2141 "cfg.y"
+                                                        { (yyval.action)=0; }
+#line 6109 "cfg.tab.c"
+    break;
+
+  case 438: /* stm: action  */
+#line 2144 "cfg.y"
+                                                        { (yyval.action)=(yyvsp[0].action); }
+#line 6115 "cfg.tab.c"
+    break;
+
+  case 439: /* stm: LBRACE actions RBRACE  */
+#line 2145 "cfg.y"
+                                                { (yyval.action)=(yyvsp[-1].action); }
+#line 6121 "cfg.tab.c"
+    break;
+
+  case 440: /* stm: LBRACE RBRACE  */
+#line 2146 "cfg.y"
+                                                        { (yyval.action)=0; }
+#line 6127 "cfg.tab.c"
+    break;
+
+  case 441: /* actions: actions action  */
+#line 2149 "cfg.y"
+                                {(yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 6133 "cfg.tab.c"
+    break;
+
+  case 442: /* actions: action  */
+#line 2150 "cfg.y"
+                                                {(yyval.action)=(yyvsp[0].action);}
+#line 6139 "cfg.tab.c"
+    break;
+
+  case 443: /* actions: actions error  */
+#line 2151 "cfg.y"
+                                { (yyval.action)=0; yyerror("bad command!)"); }
+#line 6145 "cfg.tab.c"
+    break;
+
+  case 444: /* brk_actions: brk_actions brk_action  */
+#line 2155 "cfg.y"
+                                        {(yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 6151 "cfg.tab.c"
+    break;
+
+  case 445: /* brk_actions: brk_action  */
+#line 2156 "cfg.y"
+                                                {(yyval.action)=(yyvsp[0].action);}
+#line 6157 "cfg.tab.c"
+    break;
+
+  case 446: /* brk_actions: brk_actions error  */
+#line 2157 "cfg.y"
+                                    { (yyval.action)=0; yyerror("bad command!)"); }
+#line 6163 "cfg.tab.c"
+    break;
+
+  case 447: /* action: cmd SEMICOLON  */
+#line 2160 "cfg.y"
+                              {(yyval.action)=(yyvsp[-1].action);}
+#line 6169 "cfg.tab.c"
+    break;
+
+  case 448: /* action: if_cmd  */
+#line 2161 "cfg.y"
+                         {(yyval.action)=(yyvsp[0].action);}
+#line 6175 "cfg.tab.c"
+    break;
+
+  case 449: /* action: while_cmd  */
+#line 2162 "cfg.y"
+                            {(yyval.action)=(yyvsp[0].action);}
+#line 6181 "cfg.tab.c"
+    break;
+
+  case 450: /* action: foreach_cmd  */
+#line 2163 "cfg.y"
+                              {(yyval.action)=(yyvsp[0].action);}
+#line 6187 "cfg.tab.c"
+    break;
+
+  case 451: /* action: switch_cmd  */
+#line 2164 "cfg.y"
+                             {(yyval.action)=(yyvsp[0].action);}
+#line 6193 "cfg.tab.c"
+    break;
+
+  case 452: /* action: assign_cmd SEMICOLON  */
+#line 2165 "cfg.y"
+                                       {(yyval.action)=(yyvsp[-1].action);}
+#line 6199 "cfg.tab.c"
+    break;
+
+  case 453: /* action: SEMICOLON  */
+#line 2166 "cfg.y"
+                                              {(yyval.action)=0;}
+#line 6205 "cfg.tab.c"
+    break;
+
+  case 454: /* action: cmd error  */
+#line 2167 "cfg.y"
+                            { (yyval.action)=0; yyerror("bad command: missing ';'?"); }
+#line 6211 "cfg.tab.c"
+    break;
+
+  case 455: /* brk_action: BREAK SEMICOLON  */
+#line 2170 "cfg.y"
+                            { mk_action0((yyval.action), BREAK_T);}
+#line 6217 "cfg.tab.c"
+    break;
+
+  case 456: /* brk_action: cmd SEMICOLON  */
+#line 2171 "cfg.y"
+                                {(yyval.action)=(yyvsp[-1].action);}
+#line 6223 "cfg.tab.c"
+    break;
+
+  case 457: /* brk_action: brk_if_cmd  */
+#line 2172 "cfg.y"
+                             {(yyval.action)=(yyvsp[0].action);}
+#line 6229 "cfg.tab.c"
+    break;
+
+  case 458: /* brk_action: while_cmd  */
+#line 2173 "cfg.y"
+                            {(yyval.action)=(yyvsp[0].action);}
+#line 6235 "cfg.tab.c"
+    break;
+
+  case 459: /* brk_action: foreach_cmd  */
+#line 2174 "cfg.y"
+                              {(yyval.action)=(yyvsp[0].action);}
+#line 6241 "cfg.tab.c"
+    break;
+
+  case 460: /* brk_action: switch_cmd  */
+#line 2175 "cfg.y"
+                             {(yyval.action)=(yyvsp[0].action);}
+#line 6247 "cfg.tab.c"
+    break;
+
+  case 461: /* brk_action: assign_cmd SEMICOLON  */
+#line 2176 "cfg.y"
+                                       {(yyval.action)=(yyvsp[-1].action);}
+#line 6253 "cfg.tab.c"
+    break;
+
+  case 462: /* brk_action: SEMICOLON  */
+#line 2177 "cfg.y"
+                                              {(yyval.action)=0;}
+#line 6259 "cfg.tab.c"
+    break;
+
+  case 463: /* brk_action: cmd error  */
+#line 2178 "cfg.y"
+                            { (yyval.action)=0; yyerror("bad command: missing ';'?"); }
+#line 6265 "cfg.tab.c"
+    break;
+
+  case 464: /* brk_if_cmd: IF LPAREN exp RPAREN brk_stm  */
+#line 2181 "cfg.y"
+                                                                { mk_action3( (yyval.action), IF_T,
+													 EXPR_ST,
+													 ACTIONS_ST,
+													 NOSUBTYPE,
+													 (yyvsp[-2].expr),
+													 (yyvsp[0].action),
+													 0);
+									}
+#line 6278 "cfg.tab.c"
+    break;
+
+  case 465: /* brk_if_cmd: IF LPAREN exp RPAREN brk_stm ELSE brk_stm  */
+#line 2189 "cfg.y"
+                                                                        { mk_action3( (yyval.action), IF_T,
+													 EXPR_ST,
+													 ACTIONS_ST,
+													 ACTIONS_ST,
+													 (yyvsp[-4].expr),
+													 (yyvsp[-2].action),
+													 (yyvsp[0].action));
+									}
+#line 6291 "cfg.tab.c"
+    break;
+
+  case 466: /* if_cmd: IF LPAREN exp RPAREN stm  */
+#line 2199 "cfg.y"
+                                                                        { mk_action3( (yyval.action), IF_T,
+													 EXPR_ST,
+													 ACTIONS_ST,
+													 NOSUBTYPE,
+													 (yyvsp[-2].expr),
+													 (yyvsp[0].action),
+													 0);
+									}
+#line 6304 "cfg.tab.c"
+    break;
+
+  case 467: /* if_cmd: IF LPAREN exp RPAREN stm ELSE stm  */
+#line 2207 "cfg.y"
+                                                                { mk_action3( (yyval.action), IF_T,
+													 EXPR_ST,
+													 ACTIONS_ST,
+													 ACTIONS_ST,
+													 (yyvsp[-4].expr),
+													 (yyvsp[-2].action),
+													 (yyvsp[0].action));
+									}
+#line 6317 "cfg.tab.c"
+    break;
+
+  case 468: /* while_cmd: WHILE LPAREN exp RPAREN brk_stm  */
+#line 2217 "cfg.y"
+                                                        { mk_action2( (yyval.action), WHILE_T,
+													 EXPR_ST,
+													 ACTIONS_ST,
+													 (yyvsp[-2].expr),
+													 (yyvsp[0].action));
+									}
+#line 6328 "cfg.tab.c"
+    break;
+
+  case 469: /* foreach_cmd: FOR LPAREN script_var IN script_var RPAREN brk_stm  */
+#line 2225 "cfg.y"
+                                                                   {
+					if ((yyvsp[-4].specval)->type != PVT_SCRIPTVAR &&
+					    (yyvsp[-4].specval)->type != PVT_AVP &&
+						pv_type((yyvsp[-4].specval)->type) != PVT_JSON) {
+						yyerror("\nfor-each statement: only \"var\", \"avp\" "
+					            "and \"json\" iterators are supported!");
+					}
+
+					mk_action3( (yyval.action), FOR_EACH_T,
+					            SCRIPTVAR_ST,
+					            SCRIPTVAR_ST,
+					            ACTIONS_ST,
+					            (yyvsp[-4].specval),
+					            (yyvsp[-2].specval),
+					            (yyvsp[0].action));
+					}
+#line 6349 "cfg.tab.c"
+    break;
+
+  case 470: /* switch_cmd: SWITCH LPAREN script_var RPAREN LBRACE switch_stm RBRACE  */
+#line 2243 "cfg.y"
+                                                                                        {
+											mk_action2( (yyval.action), SWITCH_T,
+														SCRIPTVAR_ST,
+														ACTIONS_ST,
+														(yyvsp[-4].specval),
+														(yyvsp[-1].action));
+									}
+#line 6361 "cfg.tab.c"
+    break;
+
+  case 471: /* switch_stm: case_stms default_stm  */
+#line 2252 "cfg.y"
+                                  { (yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 6367 "cfg.tab.c"
+    break;
+
+  case 472: /* switch_stm: case_stms  */
+#line 2253 "cfg.y"
+                                                { (yyval.action)=(yyvsp[0].action); }
+#line 6373 "cfg.tab.c"
+    break;
+
+  case 473: /* case_stms: case_stms case_stm  */
+#line 2255 "cfg.y"
+                                        {(yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 6379 "cfg.tab.c"
+    break;
+
+  case 474: /* case_stms: case_stm  */
+#line 2256 "cfg.y"
+                                                {(yyval.action)=(yyvsp[0].action);}
+#line 6385 "cfg.tab.c"
+    break;
+
+  case 475: /* case_stm: CASE snumber COLON brk_actions  */
+#line 2259 "cfg.y"
+                                         { mk_action2( (yyval.action), CASE_T,
+													NUMBER_ST,
+													ACTIONS_ST,
+													(void*)(yyvsp[-2].intval),
+													(yyvsp[0].action));
+											}
+#line 6396 "cfg.tab.c"
+    break;
+
+  case 476: /* case_stm: CASE snumber COLON  */
+#line 2265 "cfg.y"
+                                     { mk_action2( (yyval.action), CASE_T,
+													NUMBER_ST,
+													ACTIONS_ST,
+													(void*)(yyvsp[-1].intval),
+													NULL);
+							}
+#line 6407 "cfg.tab.c"
+    break;
+
+  case 477: /* case_stm: CASE STRING COLON brk_actions  */
+#line 2271 "cfg.y"
+                                                { mk_action2( (yyval.action), CASE_T,
+													STR_ST,
+													ACTIONS_ST,
+													(void*)(yyvsp[-2].strval),
+													(yyvsp[0].action));
+											}
+#line 6418 "cfg.tab.c"
+    break;
+
+  case 478: /* case_stm: CASE STRING COLON  */
+#line 2277 "cfg.y"
+                                    { mk_action2( (yyval.action), CASE_T,
+													STR_ST,
+													ACTIONS_ST,
+													(void*)(yyvsp[-1].strval),
+													NULL);
+							}
+#line 6429 "cfg.tab.c"
+    break;
+
+  case 479: /* default_stm: DEFAULT COLON brk_actions  */
+#line 2285 "cfg.y"
+                                       { mk_action1( (yyval.action), DEFAULT_T,
+													ACTIONS_ST, (yyvsp[0].action));
+									}
+#line 6437 "cfg.tab.c"
+    break;
+
+  case 480: /* default_stm: DEFAULT COLON  */
+#line 2288 "cfg.y"
+                                { mk_action1( (yyval.action), DEFAULT_T, ACTIONS_ST, NULL); }
+#line 6443 "cfg.tab.c"
+    break;
+
+  case 481: /* func_param: STRING  */
+#line 2291 "cfg.y"
+                   {
+										elems[1].type = STR_ST;
+										elems[1].u.data = (yyvsp[0].strval);
+										(yyval.intval)=1;
+										}
+#line 6453 "cfg.tab.c"
+    break;
+
+  case 482: /* func_param: func_param COMMA STRING  */
+#line 2296 "cfg.y"
+                                          {
+										if ((yyvsp[-2].intval)+1>=MAX_ACTION_ELEMS) {
+											yyerror("too many arguments "
+												"in function\n");
+											(yyval.intval)=0;
+										}
+										elems[(yyvsp[-2].intval)+1].type = STR_ST;
+										elems[(yyvsp[-2].intval)+1].u.data = (yyvsp[0].strval);
+										(yyval.intval)=(yyvsp[-2].intval)+1;
+										}
+#line 6468 "cfg.tab.c"
+    break;
+
+  case 483: /* func_param: COMMA  */
+#line 2306 "cfg.y"
+                        {
+										elems[1].type = NULLV_ST;
+										elems[1].u.data = NULL;
+										elems[2].type = NULLV_ST;
+										elems[2].u.data = NULL;
+										(yyval.intval)=2;
+										}
+#line 6480 "cfg.tab.c"
+    break;
+
+  case 484: /* func_param: COMMA STRING  */
+#line 2313 "cfg.y"
+                               {
+										elems[1].type = NULLV_ST;
+										elems[1].u.data = NULL;
+										elems[2].type = STR_ST;
+										elems[2].u.data = (yyvsp[0].strval);
+										(yyval.intval)=2;
+										}
+#line 6492 "cfg.tab.c"
+    break;
+
+  case 485: /* func_param: func_param COMMA  */
+#line 2320 "cfg.y"
+                                   {
+										if ((yyvsp[-1].intval)+1>=MAX_ACTION_ELEMS) {
+											yyerror("too many arguments "
+												"in function\n");
+											(yyval.intval)=0;
+										}
+										elems[(yyvsp[-1].intval)+1].type = NULLV_ST;
+										elems[(yyvsp[-1].intval)+1].u.data = NULL;
+										(yyval.intval)=(yyvsp[-1].intval)+1;
+										}
+#line 6507 "cfg.tab.c"
+    break;
+
+  case 486: /* func_param: snumber  */
+#line 2330 "cfg.y"
+                          {
+										elems[1].type = NUMBER_ST;
+										elems[1].u.number = (yyvsp[0].intval);
+										(yyval.intval)=1;
+										}
+#line 6517 "cfg.tab.c"
+    break;
+
+  case 487: /* func_param: COMMA snumber  */
+#line 2335 "cfg.y"
+                                {
+										elems[1].type = NULLV_ST;
+										elems[1].u.data = NULL;
+										elems[2].type = NUMBER_ST;
+										elems[2].u.number = (yyvsp[0].intval);
+										(yyval.intval)=2;
+										}
+#line 6529 "cfg.tab.c"
+    break;
+
+  case 488: /* func_param: func_param COMMA snumber  */
+#line 2342 "cfg.y"
+                                           {
+										if ((yyvsp[-2].intval)+1>=MAX_ACTION_ELEMS) {
+											yyerror("too many arguments "
+												"in function\n");
+											(yyval.intval)=0;
+										}
+										elems[(yyvsp[-2].intval)+1].type = NUMBER_ST;
+										elems[(yyvsp[-2].intval)+1].u.number = (yyvsp[0].intval);
+										(yyval.intval)=(yyvsp[-2].intval)+1;
+										}
+#line 6544 "cfg.tab.c"
+    break;
+
+  case 489: /* func_param: script_var  */
+#line 2352 "cfg.y"
+                             {
+										elems[1].type = SCRIPTVAR_ST;
+										elems[1].u.data = (yyvsp[0].specval);
+										(yyval.intval)=1;
+										}
+#line 6554 "cfg.tab.c"
+    break;
+
+  case 490: /* func_param: COMMA script_var  */
+#line 2357 "cfg.y"
+                                   {
+										elems[1].type = NULLV_ST;
+										elems[1].u.data = NULL;
+										elems[2].type = SCRIPTVAR_ST;
+										elems[2].u.data = (yyvsp[0].specval);
+										(yyval.intval)=2;
+										}
+#line 6566 "cfg.tab.c"
+    break;
+
+  case 491: /* func_param: func_param COMMA script_var  */
+#line 2364 "cfg.y"
+                                              {
+										if ((yyvsp[-2].intval)+1>=MAX_ACTION_ELEMS) {
+											yyerror("too many arguments "
+												"in function\n");
+											(yyval.intval)=0;
+										}
+										elems[(yyvsp[-2].intval)+1].type = SCRIPTVAR_ST;
+										elems[(yyvsp[-2].intval)+1].u.data = (yyvsp[0].specval);
+										(yyval.intval)=(yyvsp[-2].intval)+1;
+										}
+#line 6581 "cfg.tab.c"
+    break;
+
+  case 492: /* route_param: STRING  */
+#line 2376 "cfg.y"
+                    {
+						route_elems[0].type = STRING_ST;
+						route_elems[0].u.string = (yyvsp[0].strval);
+						(yyval.intval)=1;
+			}
+#line 6591 "cfg.tab.c"
+    break;
+
+  case 493: /* route_param: snumber  */
+#line 2381 "cfg.y"
+                          {
+						route_elems[0].type = NUMBER_ST;
+						route_elems[0].u.number = (long)(yyvsp[0].intval);
+						(yyval.intval)=1;
+			}
+#line 6601 "cfg.tab.c"
+    break;
+
+  case 494: /* route_param: NULLV  */
+#line 2386 "cfg.y"
+                        {
+						route_elems[0].type = NULLV_ST;
+						route_elems[0].u.data = 0;
+						(yyval.intval)=1;
+			}
+#line 6611 "cfg.tab.c"
+    break;
+
+  case 495: /* route_param: script_var  */
+#line 2391 "cfg.y"
+                             {
+						route_elems[0].type = SCRIPTVAR_ST;
+						route_elems[0].u.data = (yyvsp[0].specval);
+						(yyval.intval)=1;
+			}
+#line 6621 "cfg.tab.c"
+    break;
+
+  case 496: /* route_param: route_param COMMA STRING  */
+#line 2396 "cfg.y"
+                                           {
+						if ((yyvsp[-2].intval)>=MAX_ACTION_ELEMS) {
+							yyerror("too many arguments in function\n");
+							(yyval.intval)=-1;
+						} else {
+							route_elems[(yyvsp[-2].intval)].type = STRING_ST;
+							route_elems[(yyvsp[-2].intval)].u.data = (yyvsp[0].strval);
+							(yyval.intval)=(yyvsp[-2].intval)+1;
+						}
+			}
+#line 6636 "cfg.tab.c"
+    break;
+
+  case 497: /* route_param: route_param COMMA snumber  */
+#line 2406 "cfg.y"
+                                            {
+						if ((yyvsp[-2].intval)>=MAX_ACTION_ELEMS) {
+							yyerror("too many arguments in function\n");
+							(yyval.intval)=-1;
+						} else {
+							route_elems[(yyvsp[-2].intval)].type = NUMBER_ST;
+							route_elems[(yyvsp[-2].intval)].u.data = (void*)(long)(yyvsp[0].intval);
+							(yyval.intval)=(yyvsp[-2].intval)+1;
+						}
+			}
+#line 6651 "cfg.tab.c"
+    break;
+
+  case 498: /* route_param: route_param COMMA script_var  */
+#line 2416 "cfg.y"
+                                               {
+						if ((yyvsp[-2].intval)+1>=MAX_ACTION_ELEMS) {
+							yyerror("too many arguments in function\n");
+							(yyval.intval)=-1;
+						} else {
+							route_elems[(yyvsp[-2].intval)].type = SCRIPTVAR_ST;
+							route_elems[(yyvsp[-2].intval)].u.data = (yyvsp[0].specval);
+							(yyval.intval)=(yyvsp[-2].intval)+1;
+						}
+			}
+#line 6666 "cfg.tab.c"
+    break;
+
+  case 499: /* route_param: route_param COMMA NULLV  */
+#line 2426 "cfg.y"
+                                          {
+						if ((yyvsp[-2].intval)+1>=MAX_ACTION_ELEMS) {
+							yyerror("too many arguments in function\n");
+							(yyval.intval)=-1;
+						} else {
+							route_elems[(yyvsp[-2].intval)].type = NULLV_ST;
+							route_elems[(yyvsp[-2].intval)].u.data = 0;
+							(yyval.intval)=(yyvsp[-2].intval)+1;
+						}
+			}
+#line 6681 "cfg.tab.c"
+    break;
+
+  case 500: /* async_func: ID LPAREN RPAREN  */
+#line 2438 "cfg.y"
+                             {
+				const acmd_export_t* acmd_tmp=find_mod_acmd_export_t((yyvsp[-2].strval));
+				if (acmd_tmp==0){
+					yyerrorf("unknown async command <%s>, "
+						"missing loadmodule?", (yyvsp[-2].strval));
+					(yyval.action)=0;
+				}else{
+					if (check_acmd_call_params(acmd_tmp,elems,0)<0) {
+						yyerrorf("too few parameters "
+							"for command <%s>\n", (yyvsp[-2].strval));
+						(yyval.action)=0;
+					} else {
+						elems[0].type = ACMD_ST;
+						elems[0].u.data_const = acmd_tmp;
+						mk_action_((yyval.action), AMODULE_T, 1, elems);
+					}
+				}
+			}
+#line 6704 "cfg.tab.c"
+    break;
+
+  case 501: /* async_func: ID LPAREN func_param RPAREN  */
+#line 2456 "cfg.y"
+                                                      {
+				const acmd_export_t* acmd_tmp=find_mod_acmd_export_t((yyvsp[-3].strval));
+				if (acmd_tmp==0){
+					yyerrorf("unknown async command <%s>, "
+						"missing loadmodule?", (yyvsp[-3].strval));
+					(yyval.action)=0;
+				}else{
+					rc = check_acmd_call_params(acmd_tmp,elems,(yyvsp[-1].intval));
+					switch (rc) {
+					case -1:
+						yyerrorf("too few parameters "
+							"for async command <%s>\n", (yyvsp[-3].strval));
+						(yyval.action)=0;
+						break;
+					case -2:
+						yyerrorf("too many parameters "
+							"for async command <%s>\n", (yyvsp[-3].strval));
+						(yyval.action)=0;
+						break;
+					case -3:
+						yyerrorf("mandatory parameter "
+							" omitted for async command <%s>\n", (yyvsp[-3].strval));
+						(yyval.action)=0;
+						break;
+					default:
+						elems[0].type = ACMD_ST;
+						elems[0].u.data_const = acmd_tmp;
+						mk_action_((yyval.action), AMODULE_T, (yyvsp[-1].intval)+1, elems);
+					}
+				}
+			}
+#line 6740 "cfg.tab.c"
+    break;
+
+  case 502: /* async_func: ID LPAREN error RPAREN  */
+#line 2487 "cfg.y"
+                                                 {
+				(yyval.action)=0;
+				yyerrorf("bad arguments for command <%s>", (yyvsp[-3].strval));
+			}
+#line 6749 "cfg.tab.c"
+    break;
+
+  case 503: /* async_func: ID error  */
+#line 2491 "cfg.y"
+                                   {
+				(yyval.action)=0;
+				yyerrorf("bare word <%s> found, command calls need '()'", (yyvsp[-1].strval));
+			}
+#line 6758 "cfg.tab.c"
+    break;
+
+  case 504: /* return_param: script_var  */
+#line 2497 "cfg.y"
+                         { sr_tmp.rspec = (yyvsp[0].specval); (yyval.return_params) = mk_script_return(SCRIPT_ROUTE_RET_VAR);}
+#line 6764 "cfg.tab.c"
+    break;
+
+  case 505: /* return_param: snumber  */
+#line 2498 "cfg.y"
+                          { sr_tmp.rint = (yyvsp[0].intval); (yyval.return_params) = mk_script_return(SCRIPT_ROUTE_RET_INT);}
+#line 6770 "cfg.tab.c"
+    break;
+
+  case 506: /* return_param: STRING  */
+#line 2499 "cfg.y"
+                         { sr_tmp.rstr.s = (yyvsp[0].strval); sr_tmp.rstr.len = strlen((yyvsp[0].strval));
+					(yyval.return_params) = mk_script_return(SCRIPT_ROUTE_RET_STR);}
+#line 6777 "cfg.tab.c"
+    break;
+
+  case 507: /* return_param: NULLV  */
+#line 2501 "cfg.y"
+                        { (yyval.return_params) = mk_script_return(SCRIPT_ROUTE_RET_NULL);}
+#line 6783 "cfg.tab.c"
+    break;
+
+  case 508: /* return_params: return_param  */
+#line 2504 "cfg.y"
+                            { (yyval.return_params) = (yyvsp[0].return_params); }
+#line 6789 "cfg.tab.c"
+    break;
+
+  case 509: /* return_params: return_params COMMA return_param  */
+#line 2505 "cfg.y"
+                                                   { (yyvsp[0].return_params)->next = (yyvsp[-2].return_params); (yyval.return_params) = (yyvsp[0].return_params); }
+#line 6795 "cfg.tab.c"
+    break;
+
+  case 510: /* cmd: ASSERT LPAREN exp COMMA STRING RPAREN  */
+#line 2508 "cfg.y"
+                                                 {
+			mk_action2( (yyval.action), ASSERT_T, EXPR_ST, STRING_ST, (yyvsp[-3].expr), (yyvsp[-1].strval));
+			}
+#line 6803 "cfg.tab.c"
+    break;
+
+  case 511: /* cmd: ASSERT LPAREN exp RPAREN  */
+#line 2511 "cfg.y"
+                                                 {
+			mk_action2( (yyval.action), ASSERT_T, EXPR_ST, STRING_ST, (yyvsp[-1].expr), NULL);
+			}
+#line 6811 "cfg.tab.c"
+    break;
+
+  case 512: /* cmd: DROP  */
+#line 2514 "cfg.y"
+                                                 {mk_action0( (yyval.action), DROP_T); }
+#line 6817 "cfg.tab.c"
+    break;
+
+  case 513: /* cmd: DROP LPAREN RPAREN  */
+#line 2515 "cfg.y"
+                                     {mk_action0( (yyval.action), DROP_T); }
+#line 6823 "cfg.tab.c"
+    break;
+
+  case 514: /* cmd: EXIT  */
+#line 2516 "cfg.y"
+                                                 {mk_action0( (yyval.action), EXIT_T); }
+#line 6829 "cfg.tab.c"
+    break;
+
+  case 515: /* cmd: EXIT LPAREN RPAREN  */
+#line 2517 "cfg.y"
+                                     {mk_action0( (yyval.action), EXIT_T); }
+#line 6835 "cfg.tab.c"
+    break;
+
+  case 516: /* cmd: RETURN script_var  */
+#line 2519 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								SCRIPTVAR_ST,
+								NULLV_ST,
+								(void*)(yyvsp[0].specval),
+								NULL); }
+#line 6845 "cfg.tab.c"
+    break;
+
+  case 517: /* cmd: RETURN LPAREN script_var RPAREN  */
+#line 2525 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								SCRIPTVAR_ST,
+								NULLV_ST,
+								(void*)(yyvsp[-1].specval),
+								NULL); }
+#line 6855 "cfg.tab.c"
+    break;
+
+  case 518: /* cmd: RETURN LPAREN script_var COMMA return_params RPAREN  */
+#line 2531 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								SCRIPTVAR_ST,
+								EXPR_ST,
+								(void*)(yyvsp[-3].specval),
+								(yyvsp[-1].return_params)); }
+#line 6865 "cfg.tab.c"
+    break;
+
+  case 519: /* cmd: RETURN snumber  */
+#line 2537 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								NULLV_ST,
+								(void*)(yyvsp[0].intval),
+								NULL); }
+#line 6875 "cfg.tab.c"
+    break;
+
+  case 520: /* cmd: RETURN LPAREN snumber RPAREN  */
+#line 2543 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								NULLV_ST,
+								(void*)(yyvsp[-1].intval),
+								NULL); }
+#line 6885 "cfg.tab.c"
+    break;
+
+  case 521: /* cmd: RETURN LPAREN snumber COMMA return_params RPAREN  */
+#line 2549 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								EXPR_ST,
+								(void*)(yyvsp[-3].intval),
+								(yyvsp[-1].return_params)); }
+#line 6895 "cfg.tab.c"
+    break;
+
+  case 522: /* cmd: RETURN LPAREN RPAREN  */
+#line 2555 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								NULLV_ST,
+								(void*)1,
+								NULL); }
+#line 6905 "cfg.tab.c"
+    break;
+
+  case 523: /* cmd: RETURN LPAREN COMMA return_params RPAREN  */
+#line 2561 "cfg.y"
+                                                         {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								EXPR_ST,
+								(void*)1,
+								(yyvsp[-1].return_params)); }
+#line 6915 "cfg.tab.c"
+    break;
+
+  case 524: /* cmd: RETURN  */
+#line 2566 "cfg.y"
+                                                 {mk_action2( (yyval.action), RETURN_T,
+								NUMBER_ST,
+								NULLV_ST,
+								(void*)1,
+								NULL); }
+#line 6925 "cfg.tab.c"
+    break;
+
+  case 525: /* cmd: LOG_TOK LPAREN STRING RPAREN  */
+#line 2571 "cfg.y"
+                                                {mk_action2( (yyval.action), LOG_T, NUMBER_ST,
+													STRING_ST,(void*)4,(yyvsp[-1].strval));
+									}
+#line 6933 "cfg.tab.c"
+    break;
+
+  case 526: /* cmd: LOG_TOK LPAREN snumber COMMA STRING RPAREN  */
+#line 2574 "cfg.y"
+                                                                {mk_action2( (yyval.action), LOG_T,
+																NUMBER_ST,
+																STRING_ST,
+																(void*)(yyvsp[-3].intval),
+																(yyvsp[-1].strval));
+												}
+#line 6944 "cfg.tab.c"
+    break;
+
+  case 527: /* cmd: LOG_TOK error  */
+#line 2580 "cfg.y"
+                                { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 6950 "cfg.tab.c"
+    break;
+
+  case 528: /* cmd: LOG_TOK LPAREN error RPAREN  */
+#line 2581 "cfg.y"
+                                              { (yyval.action)=0; yyerror("bad log"
+									"argument"); }
+#line 6957 "cfg.tab.c"
+    break;
+
+  case 529: /* cmd: ERROR LPAREN STRING COMMA STRING RPAREN  */
+#line 2583 "cfg.y"
+                                                          {mk_action2( (yyval.action), ERROR_T,
+																STRING_ST,
+																STRING_ST,
+																(yyvsp[-3].strval),
+																(yyvsp[-1].strval));
+												  }
+#line 6968 "cfg.tab.c"
+    break;
+
+  case 530: /* cmd: ERROR error  */
+#line 2589 "cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 6974 "cfg.tab.c"
+    break;
+
+  case 531: /* cmd: ERROR LPAREN error RPAREN  */
+#line 2590 "cfg.y"
+                                            { (yyval.action)=0; yyerror("bad error"
+														"argument"); }
+#line 6981 "cfg.tab.c"
+    break;
+
+  case 532: /* cmd: ROUTE LPAREN route_name_var RPAREN  */
+#line 2592 "cfg.y"
+                                                        {
+						mk_action2( (yyval.action), ROUTE_T, (yyvsp[-1].intval), 0, rn_tmp.data, 0);
+					}
+#line 6989 "cfg.tab.c"
+    break;
+
+  case 533: /* cmd: ROUTE LPAREN route_name_var COMMA route_param RPAREN  */
+#line 2596 "cfg.y"
+                                                                        {
+						if ((yyvsp[-1].intval) <= 0) yyerror("too many route parameters");
+
+						/* duplicate the list */
+						a_tmp = pkg_malloc((yyvsp[-1].intval) * sizeof(action_elem_t));
+						if (!a_tmp) {
+							yyerror("no more pkg memory");
+							YYABORT;
+						}
+						memcpy(a_tmp, route_elems, (yyvsp[-1].intval)*sizeof(action_elem_t));
+
+						mk_action3( (yyval.action), ROUTE_T, (yyvsp[-3].intval),	/* route idx */
+							NUMBER_ST,					/* number of params */
+							SCRIPTVAR_ST,				/* parameters */
+							rn_tmp.data,
+							(void*)(long)(yyvsp[-1].intval),
+							(void*)a_tmp);
+					}
+#line 7012 "cfg.tab.c"
+    break;
+
+  case 534: /* cmd: ROUTE error  */
+#line 2615 "cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 7018 "cfg.tab.c"
+    break;
+
+  case 535: /* cmd: ROUTE LPAREN error RPAREN  */
+#line 2616 "cfg.y"
+                                            { (yyval.action)=0; yyerror("bad route"
+						"argument"); }
+#line 7025 "cfg.tab.c"
+    break;
+
+  case 536: /* cmd: ID LPAREN RPAREN  */
+#line 2618 "cfg.y"
+                                        {
+								const cmd_export_t* cmd_tmp=find_cmd_export_t((yyvsp[-2].strval), rt);
+								if (cmd_tmp==0){
+									if (find_cmd_export_t((yyvsp[-2].strval), 0)) {
+										yyerrorf("Command <%s> cannot be "
+											"used in the block\n", (yyvsp[-2].strval));
+									} else {
+										yyerrorf("unknown command <%s>, "
+											"missing loadmodule?", (yyvsp[-2].strval));
+									}
+									(yyval.action)=0;
+								}else{
+									if (check_cmd_call_params(cmd_tmp,elems,0)<0) {
+										yyerrorf("too few parameters "
+											"for command <%s>\n", (yyvsp[-2].strval));
+										(yyval.action)=0;
+									} else {
+										elems[0].type = CMD_ST;
+										elems[0].u.data_const = cmd_tmp;
+										mk_action_((yyval.action), CMD_T, 1, elems);
+									}
+								}
+							}
+#line 7053 "cfg.tab.c"
+    break;
+
+  case 537: /* cmd: ID LPAREN func_param RPAREN  */
+#line 2641 "cfg.y"
+                                                {
+								const cmd_export_t* cmd_tmp=find_cmd_export_t((yyvsp[-3].strval), rt);
+								if (cmd_tmp==0){
+									if (find_cmd_export_t((yyvsp[-3].strval), 0)) {
+										yyerrorf("Command <%s> cannot be "
+											"used in the block\n", (yyvsp[-3].strval));
+									} else {
+										yyerrorf("unknown command <%s>, "
+											"missing loadmodule?", (yyvsp[-3].strval));
+									}
+									(yyval.action)=0;
+								}else{
+									rc = check_cmd_call_params(cmd_tmp,elems,(yyvsp[-1].intval));
+									switch (rc) {
+									case -1:
+										yyerrorf("too few parameters "
+											"for command <%s>\n", (yyvsp[-3].strval));
+										(yyval.action)=0;
+										break;
+									case -2:
+										yyerrorf("too many parameters "
+											"for command <%s>\n", (yyvsp[-3].strval));
+										(yyval.action)=0;
+										break;
+									case -3:
+										yyerrorf("mandatory parameter "
+											"omitted for command <%s>\n", (yyvsp[-3].strval));
+										(yyval.action)=0;
+										break;
+									default:
+										elems[0].type = CMD_ST;
+										elems[0].u.data_const = cmd_tmp;
+										mk_action_((yyval.action), CMD_T, (yyvsp[-1].intval)+1, elems);
+									}
+								}
+							}
+#line 7094 "cfg.tab.c"
+    break;
+
+  case 538: /* cmd: ID LPAREN error RPAREN  */
+#line 2677 "cfg.y"
+                                         { (yyval.action)=0; yyerrorf("bad arguments for "
+												"command <%s>", (yyvsp[-3].strval)); }
+#line 7101 "cfg.tab.c"
+    break;
+
+  case 539: /* cmd: ID error  */
+#line 2679 "cfg.y"
+                           { (yyval.action)=0;
+			yyerrorf("bare word <%s> found, command calls need '()'", (yyvsp[-1].strval));
+			}
+#line 7109 "cfg.tab.c"
+    break;
+
+  case 540: /* cmd: XDBG LPAREN STRING RPAREN  */
+#line 2682 "cfg.y"
+                                            {
+				mk_action1((yyval.action), XDBG_T, STR_ST, (yyvsp[-1].strval));	}
+#line 7116 "cfg.tab.c"
+    break;
+
+  case 541: /* cmd: XDBG LPAREN folded_string RPAREN  */
+#line 2684 "cfg.y"
+                                                   {
+				mk_action1((yyval.action), XDBG_T, STR_ST, (yyvsp[-1].strval));	}
+#line 7123 "cfg.tab.c"
+    break;
+
+  case 542: /* cmd: XLOG LPAREN STRING RPAREN  */
+#line 2686 "cfg.y"
+                                            {
+				mk_action1((yyval.action), XLOG_T, STR_ST, (yyvsp[-1].strval)); }
+#line 7130 "cfg.tab.c"
+    break;
+
+  case 543: /* cmd: XLOG LPAREN folded_string RPAREN  */
+#line 2688 "cfg.y"
+                                                   {
+				mk_action1((yyval.action), XLOG_T, STR_ST, (yyvsp[-1].strval)); }
+#line 7137 "cfg.tab.c"
+    break;
+
+  case 544: /* cmd: XLOG LPAREN STRING COMMA STRING RPAREN  */
+#line 2690 "cfg.y"
+                                                         {
+				mk_action2((yyval.action), XLOG_T, STR_ST, STR_ST, (yyvsp[-3].strval), (yyvsp[-1].strval)); }
+#line 7144 "cfg.tab.c"
+    break;
+
+  case 545: /* cmd: XLOG LPAREN STRING COMMA folded_string RPAREN  */
+#line 2692 "cfg.y"
+                                                                {
+				mk_action2((yyval.action), XLOG_T, STR_ST, STR_ST, (yyvsp[-3].strval), (yyvsp[-1].strval)); }
+#line 7151 "cfg.tab.c"
+    break;
+
+  case 546: /* cmd: ASYNC_TOKEN LPAREN async_func COMMA route_name RPAREN  */
+#line 2694 "cfg.y"
+                                                                        {
+				rt_ref = ref_script_route_by_name( (yyvsp[-1].strval), sroutes->request,
+					RT_NO, REQUEST_ROUTE, 0);
+				if (rt_ref==NULL) yyerror("fail to create route reference");
+				mk_action2((yyval.action), ASYNC_T, ACTIONS_ST, ROUTE_REF_ST,
+						(yyvsp[-3].action), (void*)rt_ref);
+				}
+#line 7163 "cfg.tab.c"
+    break;
+
+  case 547: /* cmd: ASYNC_TOKEN LPAREN async_func COMMA route_name COMMA NUMBER RPAREN  */
+#line 2701 "cfg.y"
+                                                                                     {
+				rt_ref = ref_script_route_by_name( (yyvsp[-3].strval), sroutes->request,
+					RT_NO, REQUEST_ROUTE, 0);
+				if (rt_ref==NULL) yyerror("fail to create route reference");
+				mk_action3((yyval.action), ASYNC_T, ACTIONS_ST, ROUTE_REF_ST, NUMBER_ST,
+						(yyvsp[-5].action), (void*)rt_ref, (void*)(long)(yyvsp[-1].intval));
+				}
+#line 7175 "cfg.tab.c"
+    break;
+
+  case 548: /* cmd: LAUNCH_TOKEN LPAREN async_func COMMA route_name COMMA STRING RPAREN  */
+#line 2708 "cfg.y"
+                                                                                      {
+				rt_ref = ref_script_route_by_name( (yyvsp[-3].strval), sroutes->request,
+					RT_NO, REQUEST_ROUTE, 0);
+				if (rt_ref==NULL) yyerror("fail to create route reference");
+				mk_action3((yyval.action), LAUNCH_T, ACTIONS_ST, ROUTE_REF_ST, STRING_ST,
+						(yyvsp[-5].action), (void*)rt_ref, (yyvsp[-1].strval));
+				}
+#line 7187 "cfg.tab.c"
+    break;
+
+  case 549: /* cmd: LAUNCH_TOKEN LPAREN async_func COMMA route_name RPAREN  */
+#line 2715 "cfg.y"
+                                                                         {
+				rt_ref = ref_script_route_by_name( (yyvsp[-1].strval), sroutes->request,
+					RT_NO, REQUEST_ROUTE, 0);
+				if (rt_ref==NULL) yyerror("fail to create route reference");
+				mk_action2((yyval.action), LAUNCH_T, ACTIONS_ST, ROUTE_REF_ST,
+						(yyvsp[-3].action), (void*)rt_ref);
+				}
+#line 7199 "cfg.tab.c"
+    break;
+
+  case 550: /* cmd: LAUNCH_TOKEN LPAREN async_func RPAREN  */
+#line 2722 "cfg.y"
+                                                        {
+				mk_action2((yyval.action), LAUNCH_T, ACTIONS_ST, ROUTE_REF_ST,
+						(yyvsp[-1].action), (void*)NULL);
+				}
+#line 7208 "cfg.tab.c"
+    break;
+
+
+#line 7212 "cfg.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 2729 "cfg.y"
+
+
+static inline void ALLOW_UNUSED warn(char* s)
+{
+	LM_WARN("warning in config file %s, line %d, column %d-%d: %s\n",
+			get_cfg_file_name, line, startcolumn, column, s);
+}
+
+static void yyerror(char* s)
+{
+	cfg_dump_backtrace();
+	LM_CRIT("parse error in %s:%d:%d-%d: %s\n",
+			get_cfg_file_name, line, startcolumn, column, s);
+	_cfg_dump_context(get_cfg_file_name, line, startcolumn, column, 1);
+	cfg_errors++;
+}
+
+#define ERROR_MAXLEN 1024
+static void yyerrorf(char *fmt, ...)
+{
+	char *tmp = pkg_malloc(ERROR_MAXLEN);
+	va_list ap;
+	va_start(ap, fmt);
+
+	vsnprintf(tmp, ERROR_MAXLEN, fmt, ap);
+	yyerror(tmp);
+
+	pkg_free(tmp);
+	va_end(ap);
+}
+
+
+static struct socket_id* mk_listen_id(char* host, enum sip_protos proto,
+																	int port)
+{
+	struct socket_id* l;
+	l=pkg_malloc(sizeof(struct socket_id));
+	if (l==0){
+		LM_CRIT("cfg. parser: out of memory.\n");
+	}else{
+		memset(l, 0, sizeof(*l));
+		l->name     = host;
+		l->proto    = proto;
+		l->port     = port;
+	}
+
+	return l;
+}
+
+static struct socket_id* mk_listen_id_range(char* host, enum sip_protos proto, struct port_range *pr)
+{
+	int port;
+	struct socket_id *sid, *first_sid = NULL;
+	if (!pr)
+		return mk_listen_id(host, proto, 0);
+	while (pr) {
+		for (port = pr->max; port >= pr->min; port--) {
+			sid = mk_listen_id(host, proto, port);
+			if (!sid)
+				return first_sid;
+			sid->next = first_sid;
+			first_sid = sid;
+		}
+		pr = pr->next;
+	}
+	return first_sid;
+}
+
+static void fill_socket_id(struct listen_param *param, struct socket_id *s)
+{
+	int warn;
+	struct socket_id *socket;
+	while (s) {
+		s->flags |= param->flags;
+		s->workers = param->workers;
+		s->tos = param->tos;
+		s->recv_batch = param->recv_batch;
+		s->auto_scaling_profile = param->auto_scaling_profile;
+		s->tag = param->tag;
+		if (param->socket) {
+			socket = param->socket;
+			param->socket = param->socket->next;
+			set_listen_id_adv(s, socket->name, socket->port);
+			pkg_free(socket);
+		} else if (!warn) {
+			LM_WARN("inconsistent port range with advertised ports - skipping advertised\n");
+			warn = 1;
+		}
+		s = s->next;
+	}
+	/* free remaining sockets, if any */
+	while (param->socket) {
+		if (!warn) {
+			LM_WARN("inconsistent port range with advertised ports - too many adverised\n");
+			warn = 1;
+		}
+		socket = param->socket->next;
+		param->socket = param->socket->next;
+		pkg_free(socket);
+	}
+}
+
+static struct multi_str *new_string(char *s)
+{
+	struct multi_str *ms = pkg_malloc(sizeof(struct multi_str));
+	if (!ms) {
+		LM_CRIT("cfg. parser: out of memory.\n");
+	}else{
+		ms->s    = s;
+		ms->next = NULL;
+	}
+	return ms;
+}
+
+static struct port_range* mk_port_range(int min, int max)
+{
+	struct port_range *pr = pkg_malloc(sizeof *pr);
+	if (pr) {
+		memset(pr, 0, sizeof *pr);
+		pr->min = min;
+		pr->max = max;
+		pr->next = NULL;
+	} else {
+		LM_CRIT("cfg. parser: out of memory.\n");
+	}
+	return pr;
+}
+
+static struct socket_id* set_listen_id_adv(struct socket_id* sock,
+											char *adv_name,
+											int adv_port)
+{
+	sock->adv_name=adv_name;
+	sock->adv_port=adv_port;
+	return sock;
+}
+
+static int parse_ipnet(char *in, int len, struct net **ipnet)
+{
+	char *p = NULL;
+	str ip_s, mask_s;
+	struct ip_addr *ip = NULL, *mask = NULL, *ip_tmp;
+	int af;
+	unsigned int bitlen;
+
+	p = q_memchr(in, '.', len);
+	if (p)
+		af = AF_INET;
+	else if (q_memchr(in, ':', len)) {
+		af = AF_INET6;
+	} else {
+		LM_ERR("Not an IP");
+		return -1;
+	}
+
+	p = q_memchr(in, '/', len);
+	if (!p) {
+		LM_ERR("No netmask\n");
+		return -1;
+	}
+	ip_s.s = in;
+	ip_s.len = p - in;
+
+	mask_s.s = p + 1;
+	mask_s.len = len - ip_s.len - 1;
+	if (!mask_s.s || mask_s.len == 0) {
+		LM_ERR("Empty netmask\n");
+		return -1;
+	}
+
+	ip_tmp = (af == AF_INET) ? str2ip(&ip_s) : str2ip6(&ip_s);
+	if (!ip_tmp) {
+		LM_ERR("Invalid IP\n");
+		return -1;
+	}
+	ip = pkg_malloc(sizeof *ip);
+	if (!ip) {
+		LM_CRIT("No more pkg memory\n");
+		return -1;
+	}
+	memcpy(ip, ip_tmp, sizeof *ip);
+
+	p = (af == AF_INET) ? q_memchr(p, '.', len-(p-in)+1) : q_memchr(p, ':', len-(p-in)+1);
+	if (p) {
+		ip_tmp = (af == AF_INET) ? str2ip(&mask_s) : str2ip6(&mask_s);
+		if (!ip_tmp) {
+			LM_ERR("Invalid netmask\n");
+			return -1;
+		}
+		mask = pkg_malloc(sizeof *mask);
+		if (!mask) {
+			LM_CRIT("No more pkg memory\n");
+			return -1;
+		}
+		memcpy(mask, ip_tmp, sizeof *mask);
+
+		*ipnet = mk_net(ip, mask);
+	} else {
+		if (str2int(&mask_s, &bitlen) < 0) {
+			LM_ERR("Invalid netmask bitlen\n");
+			return -1;
+		}
+
+		*ipnet = mk_net_bitlen(ip, bitlen);
+	}
+
+	pkg_free(ip);
+	pkg_free(mask);
+
+	if (*ipnet == NULL)
+			return -1;
+
+	return 0;
+}
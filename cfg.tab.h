@@ -0,0 +1,308 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_CFG_TAB_H_INCLUDED
+# define YY_YY_CFG_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    DROP = 258,                    /* DROP  */
+    ASSERT = 259,                  /* ASSERT  */
+    EXIT = 260,                    /* EXIT  */
+    RETURN = 261,                  /* RETURN  */
+    LOG_TOK = 262,                 /* LOG_TOK  */
+    ERROR = 263,                   /* ERROR  */
+    ROUTE = 264,                   /* ROUTE  */
+    ROUTE_FAILURE = 265,           /* ROUTE_FAILURE  */
+    ROUTE_ONREPLY = 266,           /* ROUTE_ONREPLY  */
+    ROUTE_BRANCH = 267,            /* ROUTE_BRANCH  */
+    ROUTE_ERROR = 268,             /* ROUTE_ERROR  */
+    ROUTE_LOCAL = 269,             /* ROUTE_LOCAL  */
+    ROUTE_STARTUP = 270,           /* ROUTE_STARTUP  */
+    ROUTE_TIMER = 271,             /* ROUTE_TIMER  */
+    ROUTE_EVENT = 272,             /* ROUTE_EVENT  */
+    IF = 273,                      /* IF  */
+    ELSE = 274,                    /* ELSE  */
+    SWITCH = 275,                  /* SWITCH  */
+    CASE = 276,                    /* CASE  */
+    DEFAULT = 277,                 /* DEFAULT  */
+    BREAK = 278,                   /* BREAK  */
+    WHILE = 279,                   /* WHILE  */
+    FOR = 280,                     /* FOR  */
+    IN = 281,                      /* IN  */
+    READONLY = 282,                /* READONLY  */
+    EXPIRE = 283,                  /* EXPIRE  */
+    NULLV = 284,                   /* NULLV  */
+    XDBG = 285,                    /* XDBG  */
+    XLOG = 286,                    /* XLOG  */
+    XLOG_BUF_SIZE = 287,           /* XLOG_BUF_SIZE  */
+    XLOG_FORCE_COLOR = 288,        /* XLOG_FORCE_COLOR  */
+    XLOG_PRINT_LEVEL = 289,        /* XLOG_PRINT_LEVEL  */
+    XLOG_LEVEL = 290,              /* XLOG_LEVEL  */
+    PV_PRINT_BUF_SIZE = 291,       /* PV_PRINT_BUF_SIZE  */
+    DEBUG_MODE = 292,              /* DEBUG_MODE  */
+    ENABLE_ASSERTS = 293,          /* ENABLE_ASSERTS  */
+    ABORT_ON_ASSERT = 294,         /* ABORT_ON_ASSERT  */
+    LOGLEVEL = 295,                /* LOGLEVEL  */
+    LOGPREFIX = 296,               /* LOGPREFIX  */
+    LOGSTDOUT = 297,               /* LOGSTDOUT  */
+    LOGSTDERROR = 298,             /* LOGSTDERROR  */
+    STDERROR_ENABLED = 299,        /* STDERROR_ENABLED  */
+    SYSLOG_ENABLED = 300,          /* SYSLOG_ENABLED  */
+    LOG_EVENT_ENABLED = 301,       /* LOG_EVENT_ENABLED  */
+    STDERROR_LEVEL_FILTER = 302,   /* STDERROR_LEVEL_FILTER  */
+    SYSLOG_LEVEL_FILTER = 303,     /* SYSLOG_LEVEL_FILTER  */
+    LOG_EVENT_LEVEL_FILTER = 304,  /* LOG_EVENT_LEVEL_FILTER  */
+    STDERROR_FORMAT = 305,         /* STDERROR_FORMAT  */
+    SYSLOG_FORMAT = 306,           /* SYSLOG_FORMAT  */
+    LOG_JSON_BUF_SIZE = 307,       /* LOG_JSON_BUF_SIZE  */
+    LOG_MSG_BUF_SIZE = 308,        /* LOG_MSG_BUF_SIZE  */
+    LOGFACILITY = 309,             /* LOGFACILITY  */
+    SYSLOG_FACILITY = 310,         /* SYSLOG_FACILITY  */
+    LOGNAME = 311,                 /* LOGNAME  */
+    SYSLOG_NAME = 312,             /* SYSLOG_NAME  */
+    AVP_ALIASES = 313,             /* AVP_ALIASES  */
+    LISTEN = 314,                  /* LISTEN  */
+    SOCKET = 315,                  /* SOCKET  */
+    MEMGROUP = 316,                /* MEMGROUP  */
+    ALIAS = 317,                   /* ALIAS  */
+    AUTO_ALIASES = 318,            /* AUTO_ALIASES  */
+    TAG = 319,                     /* TAG  */
+    DNS = 320,                     /* DNS  */
+    REV_DNS = 321,                 /* REV_DNS  */
+    DNS_TRY_IPV6 = 322,            /* DNS_TRY_IPV6  */
+    DNS_TRY_NAPTR = 323,           /* DNS_TRY_NAPTR  */
+    DNS_RETR_TIME = 324,           /* DNS_RETR_TIME  */
+    DNS_RETR_NO = 325,             /* DNS_RETR_NO  */
+    DNS_SERVERS_NO = 326,          /* DNS_SERVERS_NO  */
+    DNS_USE_SEARCH = 327,          /* DNS_USE_SEARCH  */
+    MAX_WHILE_LOOPS = 328,         /* MAX_WHILE_LOOPS  */
+    UDP_WORKERS = 329,             /* UDP_WORKERS  */
+    CHECK_VIA = 330,               /* CHECK_VIA  */
+    SHM_HASH_SPLIT_PERCENTAGE = 331, /* SHM_HASH_SPLIT_PERCENTAGE  */
+    SHM_SECONDARY_HASH_SIZE = 332, /* SHM_SECONDARY_HASH_SIZE  */
+    SHM_CACHE_SIZE = 333,          /* SHM_CACHE_SIZE  */
+    PKG_ARENA_SIZE = 334,          /* PKG_ARENA_SIZE  */
+    MEM_WARMING_ENABLED = 335,     /* MEM_WARMING_ENABLED  */
+    MEM_WARMING_PATTERN_FILE = 336, /* MEM_WARMING_PATTERN_FILE  */
+    MEM_WARMING_PERCENTAGE = 337,  /* MEM_WARMING_PERCENTAGE  */
+    RPM_MEM_FILE = 338,            /* RPM_MEM_FILE  */
+    RPM_MEM_SIZE = 339,            /* RPM_MEM_SIZE  */
+    MEMLOG = 340,                  /* MEMLOG  */
+    MEMDUMP = 341,                 /* MEMDUMP  */
+    SHM_MEMLOG_SIZE = 342,         /* SHM_MEMLOG_SIZE  */
+    EXECMSGTHRESHOLD = 343,        /* EXECMSGTHRESHOLD  */
+    EXECDNSTHRESHOLD = 344,        /* EXECDNSTHRESHOLD  */
+    TCPTHRESHOLD = 345,            /* TCPTHRESHOLD  */
+    EVENT_SHM_THRESHOLD = 346,     /* EVENT_SHM_THRESHOLD  */
+    EVENT_PKG_THRESHOLD = 347,     /* EVENT_PKG_THRESHOLD  */
+    QUERYBUFFERSIZE = 348,         /* QUERYBUFFERSIZE  */
+    QUERYFLUSHTIME = 349,          /* QUERYFLUSHTIME  */
+    SIP_WARNING = 350,             /* SIP_WARNING  */
+    SERVER_SIGNATURE = 351,        /* SERVER_SIGNATURE  */
+    SERVER_HEADER = 352,           /* SERVER_HEADER  */
+    USER_AGENT_HEADER = 353,       /* USER_AGENT_HEADER  */
+    LOADMODULE = 354,              /* LOADMODULE  */
+    MPATH = 355,                   /* MPATH  */
+    MODPARAM = 356,                /* MODPARAM  */
+    MAXBUFFER = 357,               /* MAXBUFFER  */
+    CHROOT = 358,                  /* CHROOT  */
+    WDIR = 359,                    /* WDIR  */
+    MHOMED = 360,                  /* MHOMED  */
+    POLL_METHOD = 361,             /* POLL_METHOD  */
+    TCP_ACCEPT_ALIASES = 362,      /* TCP_ACCEPT_ALIASES  */
+    TCP_WORKERS = 363,             /* TCP_WORKERS  */
+    TCP_CONNECT_TIMEOUT = 364,     /* TCP_CONNECT_TIMEOUT  */
+    TCP_CON_LIFETIME = 365,        /* TCP_CON_LIFETIME  */
+    TCP_SOCKET_BACKLOG = 366,      /* TCP_SOCKET_BACKLOG  */
+    TCP_MAX_CONNECTIONS = 367,     /* TCP_MAX_CONNECTIONS  */
+    TCP_NO_NEW_CONN_BFLAG = 368,   /* TCP_NO_NEW_CONN_BFLAG  */
+    TCP_NO_NEW_CONN_RPLFLAG = 369, /* TCP_NO_NEW_CONN_RPLFLAG  */
+    TCP_KEEPALIVE = 370,           /* TCP_KEEPALIVE  */
+    TCP_KEEPCOUNT = 371,           /* TCP_KEEPCOUNT  */
+    TCP_KEEPIDLE = 372,            /* TCP_KEEPIDLE  */
+    TCP_KEEPINTERVAL = 373,        /* TCP_KEEPINTERVAL  */
+    TCP_MAX_MSG_TIME = 374,        /* TCP_MAX_MSG_TIME  */
+    TCP_PARALLEL_READ_ON_WORKERS = 375, /* TCP_PARALLEL_READ_ON_WORKERS  */
+    TCP_STICKY_WORKERS = 376,      /* TCP_STICKY_WORKERS  */
+    TCP_MAIN_SHARDS = 377,         /* TCP_MAIN_SHARDS  */
+    TCP_HANDSHAKE_WORKERS = 378,   /* TCP_HANDSHAKE_WORKERS  */
+    ADVERTISED_ADDRESS = 379,      /* ADVERTISED_ADDRESS  */
+    ADVERTISED_PORT = 380,         /* ADVERTISED_PORT  */
+    DISABLE_CORE = 381,            /* DISABLE_CORE  */
+    OPEN_FD_LIMIT = 382,           /* OPEN_FD_LIMIT  */
+    MCAST_LOOPBACK = 383,          /* MCAST_LOOPBACK  */
+    MCAST_TTL = 384,               /* MCAST_TTL  */
+    TOS = 385,                     /* TOS  */
+    DISABLE_DNS_FAILOVER = 386,    /* DISABLE_DNS_FAILOVER  */
+    DISABLE_DNS_BLACKLIST = 387,   /* DISABLE_DNS_BLACKLIST  */
+    DST_BLACKLIST = 388,           /* DST_BLACKLIST  */
+    DISABLE_STATELESS_FWD = 389,   /* DISABLE_STATELESS_FWD  */
+    DB_VERSION_TABLE = 390,        /* DB_VERSION_TABLE  */
+    DB_DEFAULT_URL = 391,          /* DB_DEFAULT_URL  */
+    DB_MAX_ASYNC_CONNECTIONS = 392, /* DB_MAX_ASYNC_CONNECTIONS  */
+    DISABLE_503_TRANSLATION = 393, /* DISABLE_503_TRANSLATION  */
+    SYNC_TOKEN = 394,              /* SYNC_TOKEN  */
+    ASYNC_TOKEN = 395,             /* ASYNC_TOKEN  */
+    LAUNCH_TOKEN = 396,            /* LAUNCH_TOKEN  */
+    AUTO_SCALING_PROFILE = 397,    /* AUTO_SCALING_PROFILE  */
+    AUTO_SCALING_CYCLE = 398,      /* AUTO_SCALING_CYCLE  */
+    TIMER_WORKERS = 399,           /* TIMER_WORKERS  */
+    EQUAL = 400,                   /* EQUAL  */
+    EQUAL_T = 401,                 /* EQUAL_T  */
+    GT = 402,                      /* GT  */
+    LT = 403,                      /* LT  */
+    GTE = 404,                     /* GTE  */
+    LTE = 405,                     /* LTE  */
+    DIFF = 406,                    /* DIFF  */
+    MATCH = 407,                   /* MATCH  */
+    NOTMATCH = 408,                /* NOTMATCH  */
+    COLONEQ = 409,                 /* COLONEQ  */
+    PLUSEQ = 410,                  /* PLUSEQ  */
+    MINUSEQ = 411,                 /* MINUSEQ  */
+    SLASHEQ = 412,                 /* SLASHEQ  */
+    MULTEQ = 413,                  /* MULTEQ  */
+    MODULOEQ = 414,                /* MODULOEQ  */
+    BANDEQ = 415,                  /* BANDEQ  */
+    BOREQ = 416,                   /* BOREQ  */
+    BXOREQ = 417,                  /* BXOREQ  */
+    OR = 418,                      /* OR  */
+    AND = 419,                     /* AND  */
+    BOR = 420,                     /* BOR  */
+    BAND = 421,                    /* BAND  */
+    BXOR = 422,                    /* BXOR  */
+    BLSHIFT = 423,                 /* BLSHIFT  */
+    BRSHIFT = 424,                 /* BRSHIFT  */
+    PLUS = 425,                    /* PLUS  */
+    MINUS = 426,                   /* MINUS  */
+    MULT = 427,                    /* MULT  */
+    MODULO = 428,                  /* MODULO  */
+    NOT = 429,                     /* NOT  */
+    BNOT = 430,                    /* BNOT  */
+    NUMBER = 431,                  /* NUMBER  */
+    ZERO = 432,                    /* ZERO  */
+    ID = 433,                      /* ID  */
+    STRING = 434,                  /* STRING  */
+    SCRIPTVAR = 435,               /* SCRIPTVAR  */
+    IPV6ADDR = 436,                /* IPV6ADDR  */
+    IPV4ADDR = 437,                /* IPV4ADDR  */
+    IPNET = 438,                   /* IPNET  */
+    COMMA = 439,                   /* COMMA  */
+    SEMICOLON = 440,               /* SEMICOLON  */
+    RPAREN = 441,                  /* RPAREN  */
+    LPAREN = 442,                  /* LPAREN  */
+    LBRACE = 443,                  /* LBRACE  */
+    RBRACE = 444,                  /* RBRACE  */
+    LBRACK = 445,                  /* LBRACK  */
+    RBRACK = 446,                  /* RBRACK  */
+    SLASH = 447,                   /* SLASH  */
+    AS = 448,                      /* AS  */
+    USE_WORKERS = 449,             /* USE_WORKERS  */
+    SOCK_TOS = 450,                /* SOCK_TOS  */
+    RECV_BATCH = 451,              /* RECV_BATCH  */
+    USE_AUTO_SCALING_PROFILE = 452, /* USE_AUTO_SCALING_PROFILE  */
+    MAX = 453,                     /* MAX  */
+    MIN = 454,                     /* MIN  */
+    DOT = 455,                     /* DOT  */
+    CR = 456,                      /* CR  */
+    COLON = 457,                   /* COLON  */
+    ANY = 458,                     /* ANY  */
+    ANYCAST = 459,                 /* ANYCAST  */
+    ACCEPT_SUBDOMAIN = 460,        /* ACCEPT_SUBDOMAIN  */
+    FRAG = 461,                    /* FRAG  */
+    REUSE_PORT = 462,              /* REUSE_PORT  */
+    SCRIPTVARERR = 463,            /* SCRIPTVARERR  */
+    SCALE_UP_TO = 464,             /* SCALE_UP_TO  */
+    SCALE_DOWN_TO = 465,           /* SCALE_DOWN_TO  */
+    ON = 466,                      /* ON  */
+    CYCLES = 467,                  /* CYCLES  */
+    CYCLES_WITHIN = 468,           /* CYCLES_WITHIN  */
+    PERCENTAGE = 469               /* PERCENTAGE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 252 "cfg.y"
+
+	long intval;
+	unsigned long uval;
+	char* strval;
+	struct expr* expr;
+	struct action* action;
+	struct net* ipnet;
+	struct ip_addr* ipaddr;
+	struct socket_id* sockid;
+	struct listen_param* listen_param;
+	struct _pv_spec *specval;
+	struct multi_str* multistr;
+	struct port_range* portrange;
+	struct script_return_param* return_params;
+
+#line 294 "cfg.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_CFG_TAB_H_INCLUDED  */
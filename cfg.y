@@ -181,6 +181,7 @@ struct listen_param {
 	enum si_flags flags;
 	int workers;
 	int tos;
+	int recv_batch;
 	struct socket_id *socket;
 	char *tag;
 	char *auto_scaling_profile;
@@ -345,6 +346,8 @@ extern int cfg_parse_only_routes;
 %token CHECK_VIA
 %token SHM_HASH_SPLIT_PERCENTAGE
 %token SHM_SECONDARY_HASH_SIZE
+%token SHM_CACHE_SIZE
+%token PKG_ARENA_SIZE
 %token MEM_WARMING_ENABLED
 %token MEM_WARMING_PATTERN_FILE
 %token MEM_WARMING_PERCENTAGE
@@ -386,6 +389,9 @@ extern int cfg_parse_only_routes;
 %token TCP_KEEPINTERVAL
 %token TCP_MAX_MSG_TIME
 %token TCP_PARALLEL_READ_ON_WORKERS
+%token TCP_STICKY_WORKERS
+%token TCP_MAIN_SHARDS
+%token TCP_HANDSHAKE_WORKERS
 %token ADVERTISED_ADDRESS
 %token ADVERTISED_PORT
 %token DISABLE_CORE
@@ -460,6 +466,7 @@ extern int cfg_parse_only_routes;
 %token AS
 %token USE_WORKERS
 %token SOCK_TOS
+%token RECV_BATCH
 %token USE_AUTO_SCALING_PROFILE
 %token MAX
 %token MIN
@@ -750,6 +757,9 @@ socket_def_param: ANYCAST { IFOR();
 				| SOCK_TOS NUMBER { IFOR();
 					p_tmp.tos=$2;
 					}
+				| RECV_BATCH NUMBER { IFOR();
+					p_tmp.recv_batch=$2;
+					}
 				| AS listen_id_def { IFOR();
 					p_tmp.socket = $2;
 					}
@@ -1185,6 +1195,14 @@ assign_stm: LOGLEVEL EQUAL snumber { IFOR();
 				"for HP_MALLOC\n");
 			#endif
 			}
+		| SHM_CACHE_SIZE EQUAL NUMBER { IFOR();
+			shm_cache_size=$3;
+			}
+		| SHM_CACHE_SIZE EQUAL error { yyerror("number expected"); }
+		| PKG_ARENA_SIZE EQUAL NUMBER { IFOR();
+			pkg_arena_size=$3;
+			}
+		| PKG_ARENA_SIZE EQUAL error { yyerror("number expected"); }
 		| MEM_WARMING_ENABLED EQUAL NUMBER { IFOR();
 			#ifdef HP_MALLOC
 			mem_warming_enabled = $3;
@@ -1377,6 +1395,23 @@ assign_stm: LOGLEVEL EQUAL snumber { IFOR();
 		| TCP_PARALLEL_READ_ON_WORKERS EQUAL error {
 			yyerror("boolean value expected");
 		}
+		| TCP_STICKY_WORKERS EQUAL NUMBER { IFOR();
+				tcp_sticky_workers=$3;
+		}
+		| TCP_STICKY_WORKERS EQUAL error { yyerror("number expected"); }
+		| TCP_MAIN_SHARDS EQUAL NUMBER { IFOR();
+				tcp_main_shards=$3;
+		}
+		| TCP_MAIN_SHARDS EQUAL error { yyerror("number expected"); }
+		| TCP_HANDSHAKE_WORKERS EQUAL NUMBER { IFOR();
+				tcp_hs_workers_no=$3;
+		}
+		| TCP_HANDSHAKE_WORKERS EQUAL NUMBER USE_AUTO_SCALING_PROFILE ID{
+				IFOR();
+				tcp_hs_workers_no=$3;
+				tcp_hs_auto_scaling_profile=$5;
+		}
+		| TCP_HANDSHAKE_WORKERS EQUAL error { yyerror("number expected"); }
 		| TCP_KEEPCOUNT EQUAL NUMBER 		{ IFOR();
 			#ifndef HAVE_TCP_KEEPCNT
 				warn("cannot be enabled TCP_KEEPCOUNT (no OS support)");
@@ -2767,6 +2802,7 @@ static void fill_socket_id(struct listen_param *param, struct socket_id *s)
 		s->flags |= param->flags;
 		s->workers = param->workers;
 		s->tos = param->tos;
+		s->recv_batch = param->recv_batch;
 		s->auto_scaling_profile = param->auto_scaling_profile;
 		s->tag = param->tag;
 		if (param->socket) {
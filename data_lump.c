@@ -127,7 +127,7 @@ struct lump* insert_new_lump_after( struct lump* after, char* new_hdr,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(after, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -153,7 +153,7 @@ struct lump* insert_new_lump_before( struct lump* before, char* new_hdr,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(before, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -179,7 +179,7 @@ struct lump* insert_subst_lump_after( struct lump* after,enum lump_subst subst,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(after, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -206,7 +206,7 @@ struct lump* insert_subst_lump_before(	struct lump* before,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(before, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -232,7 +232,7 @@ struct lump* insert_cond_lump_after( struct lump* after,enum lump_conditions c,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(after, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -259,7 +259,7 @@ struct lump* insert_cond_lump_before(	struct lump* before,
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(before, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -284,7 +284,7 @@ struct lump* insert_skip_lump_after( struct lump* after)
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(after, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -306,7 +306,7 @@ struct lump* insert_skip_lump_before( struct lump* before )
 {
 	struct lump* tmp;
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_near_malloc(before, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -349,7 +349,7 @@ struct lump* del_lump(struct sip_msg* msg, unsigned int offset,
 		LM_WARN("called with 0 len (offset =%d)\n",	offset);
 	}
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_msg_malloc(msg, sizeof(struct lump));
 	if (tmp==0){
 		LM_ERR("out of pkg memory\n");
 		return 0;
@@ -399,7 +399,7 @@ struct lump* anchor_lump(struct sip_msg* msg, unsigned int offset,
 		abort();
 	}
 
-	tmp=pkg_malloc(sizeof(struct lump));
+	tmp=pkg_msg_malloc(msg, sizeof(struct lump));
 	if (tmp==0){
 		ser_error=E_OUT_OF_MEM;
 		LM_ERR("out of pkg memory\n");
@@ -49,6 +49,8 @@ typedef enum db_cap {
 	DB_CAP_INSERT_UPDATE    = 1 << 9,  /**< driver can insert data into database and update on duplicate */
 	DB_CAP_MULTIPLE_INSERT  = 1 << 10,  /**< driver can insert multiple rows at once */
 	DB_CAP_PREPARED_STMT    = 1 << 11,  /**< driver supports prep statements */
+	DB_CAP_MULTIPLE_INSERT_UPDATE = 1 << 12,  /**< driver can insert/update
+										    multiple rows at once */
 } db_cap_t;
 
 
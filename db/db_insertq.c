@@ -135,8 +135,8 @@ void flush_query_list(void)
 			for (i=0;i<it->no_rows;i++)
 			{
 				CON_SET_CURR_PS(it->conn[process_no], &my_ps);
-				if (it->dbf.insert(it->conn[process_no],it->cols,it->rows[i],
-							it->col_no) < 0)
+				if (QL_FLUSH_FUNC(&it->dbf,it)(it->conn[process_no],it->cols,
+							it->rows[i],it->col_no) < 0)
 					LM_ERR("failed to insert into DB\n");
 
 				shm_free(it->rows[i]);
@@ -326,7 +326,7 @@ int ql_row_add(query_list_t *entry,const db_val_t *row,db_val_t ***ins_rows)
 }
 
 /* initializez a new query entry */
-query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
+query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no,int upsert)
 {
 	int key_size,row_q_size,size,i;
 	char *pos;
@@ -349,6 +349,7 @@ query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
 	}
 
 	memset(entry,0,size);
+	entry->upsert = upsert;
 	LM_DBG("alloced %p for %d bytes\n",entry,size);
 
 	entry->lock = lock_alloc();
@@ -410,7 +411,8 @@ query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
  * else, return NULL
  * assumes ql_lock is acquired
  */
-query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,int col_no)
+query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,
+		int col_no,int upsert)
 {
 	query_list_t *it,*entry=NULL;
 	int i;
@@ -421,6 +423,10 @@ query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,int col_no)
 	{
 		LM_DBG("iterating through %p\n",it);
 
+		/* inserts and upserts are never queued together */
+		if (it->upsert != upsert)
+			continue;
+
 		/* match number of columns */
 		if (it->col_no != col_no)
 		{
@@ -462,13 +468,13 @@ next_query:
 	return entry;
 }
 
-/* set's the query_list that will be used for inserts
+/* set's the query_list that will be used for inserts (or upserts)
  * on the provided db connection
  *
  * also takes care of initialisation of this is the first process
  * attempting to execute this type of query */
-int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
-							db_key_t *cols,int col_no)
+static int _con_set_list(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no,int upsert)
 {
 	query_list_t *entry;
 
@@ -477,9 +483,10 @@ int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
 		return 0;
 
 	/* if buffering is enabled, but user is using a module
-	 * that does not support multiple inserts,
+	 * that does not support multiple inserts (or upserts),
 	 * also ignore */
-	if (!DB_CAPABILITY(*dbf,DB_CAP_MULTIPLE_INSERT))
+	if (!DB_CAPABILITY(*dbf,
+			upsert ? DB_CAP_MULTIPLE_INSERT_UPDATE : DB_CAP_MULTIPLE_INSERT))
 		return 0;
 
 	if (list == NULL)
@@ -490,14 +497,14 @@ int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
 	{
 		LM_DBG("first inslist call. searching for query list \n");
 		lock_get(ql_lock);
-		entry = find_query_list_unsafe(con->table,cols,col_no);
+		entry = find_query_list_unsafe(con->table,cols,col_no,upsert);
 		if (entry == NULL)
 		{
 			LM_DBG("couldn't find entry for this query\n");
 			/* first query of this type is done from this process,
 			 * it's my job to initialize the query list
 			 * and save for later use */
-			entry = ql_init(con,cols,col_no);
+			entry = ql_init(con,cols,col_no,upsert);
 			if (entry == NULL)
 			{
 				LM_ERR("failed to initialize ins queue\n");
@@ -532,6 +539,20 @@ int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
 	return 0;
 }
 
+int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no)
+{
+	return _con_set_list(dbf,con,list,cols,col_no,0);
+}
+
+/* same as con_set_inslist(), but the queued rows will be flushed
+ * with insert_update(), as a multi-row "insert or update" query */
+int con_set_upsertlist(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no)
+{
+	return _con_set_list(dbf,con,list,cols,col_no,1);
+}
+
 /* clean shm memory used by the rows */
 void cleanup_rows(db_val_t **rows)
 {
@@ -601,8 +622,8 @@ void ql_timer_routine(unsigned int ticks,void *param)
 			CON_FLUSH_UNSAFE(it->conn[process_no]);
 
 			/* no actual new row to provide, flush existing ones */
-			if (it->dbf.insert(it->conn[process_no],it->cols,(db_val_t *)-1,
-						it->col_no) < 0)
+			if (QL_FLUSH_FUNC(&it->dbf,it)(it->conn[process_no],it->cols,
+						(db_val_t *)-1,it->col_no) < 0)
 				LM_ERR("failed to insert rows to DB\n");
 		}
 		else
@@ -621,7 +642,8 @@ int ql_flush_rows(db_func_t *dbf,db_con_t *conn,query_list_t *entry)
 	CON_FLUSH_SAFE(conn);
 
 	/* no actual new row to provide, flush existing ones */
-	if (dbf->insert(conn,entry->cols,(db_val_t *)-1,entry->col_no) < 0)
+	if (QL_FLUSH_FUNC(dbf,entry)(conn,entry->cols,(db_val_t *)-1,
+				entry->col_no) < 0)
 	{
 		LM_ERR("failed to flush rows to DB\n");
 		return -1;
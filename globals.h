@@ -74,6 +74,10 @@ extern int tcp_no_new_conn;
 extern int tcp_no_new_conn_bflag;
 extern int tcp_no_new_conn_rplflag;
 extern int tcp_parallel_read_on_workers;
+extern int tcp_sticky_workers;
+extern int tcp_main_shards;
+extern char* tcp_hs_auto_scaling_profile;
+extern int tcp_hs_workers_no;
 extern struct tcp_conn_profile tcp_con_df_profile;
 
 extern int no_daemon_mode;
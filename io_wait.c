@@ -40,6 +40,10 @@
 #include <unistd.h> /* close, ioctl */
 #endif
 
+#ifdef HAVE_IO_URING
+#include <sys/mman.h> /* mmap */
+#endif
+
 #include <sys/utsname.h> /* uname() */
 #include <stdlib.h> /* strtol() */
 #include "io_wait.h"
@@ -70,11 +74,15 @@ char* poll_support="poll"
 #ifdef HAVE_DEVPOLL
 ", /dev/poll"
 #endif
+#ifdef HAVE_IO_URING
+", io_uring"
+#endif
 ;
 
 /*! supported poll methods */
 char* poll_method_str[POLL_END]={ "none", "poll", "epoll",
-								  "sigio_rt", "select", "kqueue",  "/dev/poll"
+								  "sigio_rt", "select", "kqueue",  "/dev/poll",
+								  "io_uring"
 								};
 
 #ifdef HAVE_SIGIO_RT
@@ -297,6 +305,160 @@ static void destroy_devpoll(io_wait_h* h)
 
 
 
+#ifdef HAVE_IO_URING
+/* size of the SQ ring; if it gets full, the pending SQEs are flushed */
+#define IO_URING_SQ_ENTRIES 1024
+
+static void destroy_io_uring(io_wait_h* h);
+
+/*!
+ * \brief io_uring specific init
+ * \param h IO handle
+ * \return -1 on error, 0 on success
+ */
+static int init_io_uring(io_wait_h* h)
+{
+	struct io_uring_ring *r = &h->uring;
+	struct io_uring_params p;
+
+	memset(&p, 0, sizeof p);
+	/* the CQ ring must fit a completion for each watched fd */
+	p.flags = IORING_SETUP_CQSIZE|IORING_SETUP_CLAMP;
+	p.cq_entries = (h->max_fd_no > 2*IO_URING_SQ_ENTRIES) ?
+		h->max_fd_no : 2*IO_URING_SQ_ENTRIES;
+
+again:
+	r->fd = syscall(__NR_io_uring_setup, IO_URING_SQ_ENTRIES, &p);
+	if (r->fd==-1) {
+		if (errno==EINTR) goto again;
+		LM_ERR("io_uring_setup: %s [%d]\n", strerror(errno), errno);
+		return -1;
+	}
+
+	if (!(p.features & IORING_FEAT_EXT_ARG)) {
+		LM_ERR("io_uring wait timeouts not supported by the kernel\n");
+		goto error;
+	}
+
+	r->entries = p.sq_entries;
+	r->sq_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	r->cq_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (r->cq_sz > r->sq_sz)
+			r->sq_sz = r->cq_sz;
+		r->cq_sz = r->sq_sz;
+	}
+
+	r->sq_ptr = mmap(0, r->sq_sz, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+	if (r->sq_ptr==MAP_FAILED) {
+		r->sq_ptr = NULL;
+		LM_ERR("mmap of the SQ ring failed: %s [%d]\n",
+			strerror(errno), errno);
+		goto error;
+	}
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		r->cq_ptr = r->sq_ptr;
+	} else {
+		r->cq_ptr = mmap(0, r->cq_sz, PROT_READ|PROT_WRITE,
+			MAP_SHARED|MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+		if (r->cq_ptr==MAP_FAILED) {
+			r->cq_ptr = NULL;
+			LM_ERR("mmap of the CQ ring failed: %s [%d]\n",
+				strerror(errno), errno);
+			goto error;
+		}
+	}
+
+	r->sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+	r->sqes = mmap(0, r->sqes_sz, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, r->fd, IORING_OFF_SQES);
+	if (r->sqes==MAP_FAILED) {
+		r->sqes = NULL;
+		LM_ERR("mmap of the SQEs failed: %s [%d]\n", strerror(errno), errno);
+		goto error;
+	}
+
+	r->sq_head = (unsigned int *)((char *)r->sq_ptr + p.sq_off.head);
+	r->sq_tail = (unsigned int *)((char *)r->sq_ptr + p.sq_off.tail);
+	r->sq_mask = *(unsigned int *)((char *)r->sq_ptr + p.sq_off.ring_mask);
+	r->sq_array = (unsigned int *)((char *)r->sq_ptr + p.sq_off.array);
+
+	r->cq_head = (unsigned int *)((char *)r->cq_ptr + p.cq_off.head);
+	r->cq_tail = (unsigned int *)((char *)r->cq_ptr + p.cq_off.tail);
+	r->cq_mask = *(unsigned int *)((char *)r->cq_ptr + p.cq_off.ring_mask);
+	r->cqes = (struct io_uring_cqe *)((char *)r->cq_ptr + p.cq_off.cqes);
+
+	r->to_submit = 0;
+
+	r->fd_gen = local_malloc(sizeof(*(r->fd_gen))*h->max_fd_no);
+	if (r->fd_gen==0) {
+		LM_CRIT("could not alloc io_uring fd generations array\n");
+		goto error;
+	}
+	memset((void*)r->fd_gen, 0, sizeof(*(r->fd_gen))*h->max_fd_no);
+
+	return 0;
+error:
+	destroy_io_uring(h);
+	return -1;
+}
+
+
+/*!
+ * \brief io_uring specific destroy
+ * \param h IO handle
+ */
+static void destroy_io_uring(io_wait_h* h)
+{
+	struct io_uring_ring *r = &h->uring;
+
+	if (r->sqes) {
+		munmap(r->sqes, r->sqes_sz);
+		r->sqes = NULL;
+	}
+	if (r->cq_ptr && r->cq_ptr!=r->sq_ptr)
+		munmap(r->cq_ptr, r->cq_sz);
+	r->cq_ptr = NULL;
+	if (r->sq_ptr) {
+		munmap(r->sq_ptr, r->sq_sz);
+		r->sq_ptr = NULL;
+	}
+	if (r->fd!=-1) {
+		close(r->fd);
+		r->fd = -1;
+	}
+	if (r->fd_gen) {
+		local_free(r->fd_gen);
+		r->fd_gen = NULL;
+	}
+}
+
+
+int io_uring_flush(io_wait_h* h)
+{
+	struct io_uring_ring *r = &h->uring;
+	int n;
+
+	while (r->to_submit) {
+		n = syscall(__NR_io_uring_enter, r->fd, r->to_submit, 0, 0, NULL, 0);
+		if (n==-1) {
+			if (errno==EINTR || errno==EAGAIN || errno==EBUSY)
+				continue;
+			LM_ERR("[%s] io_uring_enter submit failed: %s [%d]\n",
+				h->name, strerror(errno), errno);
+			return -1;
+		}
+		r->to_submit -= n;
+	}
+
+	return 0;
+}
+#endif
+
+
+
 #ifdef HAVE_SELECT
 /*!
  * \brief select specific init
@@ -411,6 +573,17 @@ char* check_poll_method(enum poll_types poll_method)
 			if (os_ver<0x0209) /* if ver < 2.9 ? */
 				ret="kqueue not supported on OpenBSD < 2.9 (?)";
 	#endif /* assume that the rest support kqueue ifdef HAVE_KQUEUE */
+#endif
+			break;
+		case POLL_IO_URING:
+#ifndef HAVE_IO_URING
+			ret="io_uring not supported, try re-compiling with"
+					" -DHAVE_IO_URING";
+#else
+			/* wait timeouts (IORING_FEAT_EXT_ARG) are available only
+			 * in 5.11+ */
+			if (os_ver<0x050b00) /* if ver < 5.11 */
+				ret="io_uring not supported on kernels < 5.11";
 #endif
 			break;
 		case POLL_DEVPOLL:
@@ -538,6 +711,9 @@ int init_io_wait(io_wait_h* h, char *name, int max_fd,
 #endif
 #ifdef HAVE_DEVPOLL
 	h->dpoll_fd=-1;
+#endif
+#ifdef HAVE_IO_URING
+	h->uring.fd=-1;
 #endif
 	poll_err=check_poll_method(poll_method);
 
@@ -653,6 +829,14 @@ int init_io_wait(io_wait_h* h, char *name, int max_fd,
 				goto error;
 			}
 			break;
+#endif
+#ifdef HAVE_IO_URING
+		case POLL_IO_URING:
+			if (init_io_uring(h)<0){
+				LM_CRIT("io_uring init failed\n");
+				goto error;
+			}
+			break;
 #endif
 		default:
 			LM_CRIT("unknown/unsupported poll method %s (%d)\n",
@@ -708,6 +892,11 @@ void destroy_io_wait(io_wait_h* h)
 				h->dp_changes=0;
 			}
 			break;
+#endif
+#ifdef HAVE_IO_URING
+		case POLL_IO_URING:
+			destroy_io_uring(h);
+			break;
 #endif
 		default: /*do  nothing*/
 			;
@@ -24,6 +24,7 @@
  *  2005-06-26  added kqueue (andrei)
  *  2005-07-01  added /dev/poll (andrei)
  *  2014-08-25  looping functions moved to io_wait_loop.h (bogdan)
+ *  2026-10-16  added io_uring
  */
 
 /*!
@@ -74,6 +75,12 @@
 #ifdef HAVE_DEVPOLL
 #include <sys/devpoll.h>
 #endif
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <endian.h>
+#endif
 #ifdef HAVE_SELECT
 /* needed on openbsd for select*/
 #include <sys/time.h>
@@ -132,6 +139,41 @@ struct fd_map {
 #endif
 
 
+#ifdef HAVE_IO_URING
+/*! \brief io_uring instance, with the mmap'ed SQ and CQ rings */
+struct io_uring_ring {
+	int fd;
+	unsigned int entries;     /* size of the SQ ring */
+	/* submission queue */
+	unsigned int *sq_head;
+	unsigned int *sq_tail;
+	unsigned int sq_mask;
+	unsigned int *sq_array;
+	struct io_uring_sqe *sqes;
+	unsigned int to_submit;   /* SQEs queued, but not yet submitted */
+	/* completion queue */
+	unsigned int *cq_head;
+	unsigned int *cq_tail;
+	unsigned int cq_mask;
+	struct io_uring_cqe *cqes;
+	/* the mmap'ed areas */
+	void *sq_ptr;
+	size_t sq_sz;
+	void *cq_ptr;
+	size_t cq_sz;
+	size_t sqes_sz;
+	/* per fd generation, bumped each time a poll request is cancelled,
+	 * so the completions of the old requests can be recognized */
+	unsigned int *fd_gen;
+};
+
+/* user_data of the poll removal SQEs; their completions are ignored */
+#define IO_URING_UD_REMOVE  (1ULL<<63)
+#define io_uring_ud(_fd, _gen) \
+	(((unsigned long long)(_gen)<<32) | (unsigned int)(_fd))
+#endif
+
+
 #define IO_FD_CLOSING 16
 
 /*! \brief handler structure */
@@ -157,6 +199,9 @@ struct io_wait_handler{
 	int dpoll_fd;
 	struct pollfd* dp_changes;
 #endif
+#ifdef HAVE_IO_URING
+	struct io_uring_ring uring;
+#endif
 #ifdef HAVE_SELECT
 	fd_set master_set;
 	int max_fd_select; /* maximum select used fd */
@@ -282,10 +327,128 @@ again:
 #define IO_WATCH_TIMEOUT         (1<<3)
 /* 24 starting are reserved, do not attempt to use */
 #define IO_WATCH_PRV_FILTER      ((1<<24)-1)
+/* fd shared between processes - wake up only one of them per event
+ * (EPOLLEXCLUSIVE); ignored by the poll methods not supporting it */
+#define IO_WATCH_EXCLUSIVE       (1<<28)
 #define IO_WATCH_PRV_CHECKED     (1<<29)
 #define IO_WATCH_PRV_TRIG_READ   (1<<30)
 #define IO_WATCH_PRV_TRIG_WRITE  (1<<31)
 
+#if defined(HAVE_EPOLL) && defined(EPOLLEXCLUSIVE)
+/*! \brief epoll specific function: EPOLL_CTL_MOD is not allowed on the
+ * fds added with EPOLLEXCLUSIVE, so such fds are deleted and re-added
+ * with the new set of events
+ * returns: -1 on error, 0 on success
+ */
+static inline int epoll_reregister_exclusive(io_wait_h* h, int fd,
+											struct epoll_event *ev)
+{
+	ev->events |= EPOLLEXCLUSIVE;
+	if (epoll_ctl(h->epfd, EPOLL_CTL_DEL, fd, ev)==-1 ||
+	epoll_ctl(h->epfd, EPOLL_CTL_ADD, fd, ev)==-1) {
+		LM_ERR("[%s] epoll_ctl re-add of exclusive fd %d failed: %s [%d]\n",
+			h->name, fd, strerror(errno), errno);
+		return -1;
+	}
+	return 0;
+}
+#endif
+
+#ifdef HAVE_IO_URING
+/*! \brief submits to the kernel all the queued SQEs, without waiting */
+int io_uring_flush(io_wait_h* h);
+
+/*
+ * io_uring specific function: gets a free SQE (if the SQ ring is full, the
+ * pending SQEs are submitted first); the SQE must be committed with
+ * io_uring_commit_sqe() after being filled in
+ * returns: NULL on error
+ */
+static inline struct io_uring_sqe* io_uring_get_sqe(io_wait_h* h)
+{
+	struct io_uring_ring *r = &h->uring;
+	struct io_uring_sqe *sqe;
+	unsigned int tail;
+
+	tail = *r->sq_tail;
+	if (tail - __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE) >= r->entries) {
+		LM_DBG("[%s] io_uring SQ ring full, flushing\n", h->name);
+		if (io_uring_flush(h)<0)
+			return NULL;
+	}
+
+	sqe = &r->sqes[tail & r->sq_mask];
+	memset(sqe, 0, sizeof *sqe);
+	return sqe;
+}
+
+static inline void io_uring_commit_sqe(io_wait_h* h)
+{
+	struct io_uring_ring *r = &h->uring;
+	unsigned int tail;
+
+	tail = *r->sq_tail;
+	r->sq_array[tail & r->sq_mask] = tail & r->sq_mask;
+	/* make the SQE visible to the kernel only after being filled in */
+	__atomic_store_n(r->sq_tail, tail+1, __ATOMIC_RELEASE);
+	r->to_submit++;
+}
+
+/*
+ * io_uring specific function: queues a (one-shot) poll request for the fd,
+ * according to the IO_WATCH_* flags of its fd_map; the request is submitted
+ * to the kernel at the next io_uring_enter() (usually the reactor wait)
+ * returns: -1 on error, 0 on success
+ */
+static inline int io_uring_arm_poll(io_wait_h* h, struct fd_map *e)
+{
+	struct io_uring_sqe *sqe;
+	unsigned int events = 0;
+
+	if (e->flags & IO_WATCH_READ)
+		events |= POLLIN;
+	if (e->flags & IO_WATCH_WRITE)
+		events |= POLLOUT;
+
+	if ((sqe=io_uring_get_sqe(h))==NULL)
+		return -1;
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = e->fd;
+#if __BYTE_ORDER == __BIG_ENDIAN
+	/* the kernel expects the 32 bits mask with the half-words swapped */
+	events = (events<<16) | (events>>16);
+#endif
+	sqe->poll32_events = events;
+	sqe->user_data = io_uring_ud(e->fd, h->uring.fd_gen[e->fd]);
+	io_uring_commit_sqe(h);
+
+	return 0;
+}
+
+/*
+ * io_uring specific function: cancels the current poll request of the fd
+ * (if any) and bumps the fd generation, so any already generated
+ * completion for it gets ignored
+ * returns: -1 on error, 0 on success
+ */
+static inline int io_uring_disarm_poll(io_wait_h* h, int fd)
+{
+	struct io_uring_sqe *sqe;
+
+	if ((sqe=io_uring_get_sqe(h))==NULL)
+		return -1;
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = io_uring_ud(fd, h->uring.fd_gen[fd]);
+	sqe->user_data = IO_URING_UD_REMOVE;
+	io_uring_commit_sqe(h);
+
+	h->uring.fd_gen[fd]++;
+
+	return 0;
+}
+#endif
+
 #define fd_array_print \
 	do { \
 		int k;\
@@ -462,7 +625,7 @@ inline static int io_watch_add(	io_wait_h* h, // lgtm [cpp/use-of-goto]
 			fd, type, data, flags, already);
 	}
 
-	if (e->flags & flags){
+	if (e->flags & flags & IO_WATCH_PRV_FILTER){
 		if (e->data != data) {
 			LM_BUG("[%s] BUG trying to overwrite entry %d"
 					" in the hash(%d, %d, %p,%d) with (%d, %d, %p,%d)\n",
@@ -534,24 +697,36 @@ inline static int io_watch_add(	io_wait_h* h, // lgtm [cpp/use-of-goto]
 				ep_event.events|=EPOLLOUT;
 			if (!already) {
 again1:
-#if 0
-/* This is currently broken, because when using EPOLLEXCLUSIVE, the OS will
- * send sequential events to the same process - thus our pseudo-dispatcher
- * will no longer work, since events on a pipe will be queued by a single
- * process. - razvanc
- */
-#if (defined __OS_linux) && (__GLIBC__ >= 2) && (__GLIBC_MINOR__ >= 24)
-				if (e->flags & IO_WATCH_READ)
+#ifdef EPOLLEXCLUSIVE
+				/* only for the fds explicitly asking for it (like the shared
+				 * UDP listeners) - using it on the shared IPC pipes would
+				 * make a single process queue all the dispatched jobs */
+				if (e->flags & IO_WATCH_EXCLUSIVE)
 					ep_event.events|=EPOLLEXCLUSIVE;
-#endif
 #endif
 				n=epoll_ctl(h->epfd, EPOLL_CTL_ADD, fd, &ep_event);
 				if (n==-1){
 					if (errno==EAGAIN) goto again1;
+#ifdef EPOLLEXCLUSIVE
+					if (errno==EINVAL && (e->flags & IO_WATCH_EXCLUSIVE)) {
+						/* kernel older than 4.5, fallback to shared wakeups */
+						LM_WARN("[%s] exclusive wakeups not supported for "
+							"fd %d, using shared ones\n", h->name, fd);
+						e->flags &= ~IO_WATCH_EXCLUSIVE;
+						ep_event.events &= ~EPOLLEXCLUSIVE;
+						goto again1;
+					}
+#endif
 					LM_ERR("[%s] epoll_ctl ADD failed: %s [%d]\n",
 						h->name,strerror(errno), errno);
 					goto error;
 				}
+#ifdef EPOLLEXCLUSIVE
+			} else if (e->flags & IO_WATCH_EXCLUSIVE) {
+				/* exclusive fds cannot be modified, only re-added */
+				if (epoll_reregister_exclusive(h, fd, &ep_event)<0)
+					goto error;
+#endif
 			} else {
 again11:
 				n=epoll_ctl(h->epfd, EPOLL_CTL_MOD, fd, &ep_event);
@@ -570,6 +745,16 @@ again11:
 				goto error;
 			break;
 #endif
+#ifdef HAVE_IO_URING
+		case POLL_IO_URING:
+			/* a poll request cannot be changed, so cancel the old one
+			 * (if the fd is already watched) and arm a new one */
+			if (already && io_uring_disarm_poll(h, fd)<0)
+				goto error;
+			if (io_uring_arm_poll(h, e)<0)
+				goto error;
+			break;
+#endif
 #ifdef HAVE_DEVPOLL
 		case POLL_DEVPOLL:
 			pfd.fd=fd;
@@ -821,6 +1006,13 @@ inline static int io_watch_del(io_wait_h* h, int fd, int idx,
 						ep_event.events|=EPOLLIN;
 					if (e->flags & IO_WATCH_WRITE)
 						ep_event.events|=EPOLLOUT;
+#ifdef EPOLLEXCLUSIVE
+					if (e->flags & IO_WATCH_EXCLUSIVE) {
+						if (epoll_reregister_exclusive(h, fd, &ep_event)<0)
+							goto error;
+						break;
+					}
+#endif
 					n=epoll_ctl(h->epfd, EPOLL_CTL_MOD, fd, &ep_event);
 					if (n==-1){
 						LM_ERR("[%s] epoll_ctl failed: %s [%d]\n",
@@ -841,6 +1033,16 @@ inline static int io_watch_del(io_wait_h* h, int fd, int idx,
 			}
 			break;
 #endif
+#ifdef HAVE_IO_URING
+		case POLL_IO_URING:
+			/* the pending poll request holds a reference to the file, so
+			 * it must be cancelled even if the fd is about to be closed */
+			if (io_uring_disarm_poll(h, fd)<0)
+				goto error;
+			if (!erase && io_uring_arm_poll(h, e)<0)
+				goto error;
+			break;
+#endif
 #ifdef HAVE_DEVPOLL
 		case POLL_DEVPOLL:
 				/* for /dev/poll the closed fds _must_ be removed
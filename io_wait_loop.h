@@ -496,6 +496,119 @@ error:
 
 
 
+#ifdef HAVE_IO_URING
+/*! \brief io_uring version - the queued poll requests are submitted and the
+ * completions waited for with a single io_uring_enter() call. As the poll
+ * requests are one-shot, each triggered fd gets re-armed after being
+ * handled (level-triggered semantics, like the other methods) */
+inline static int io_wait_loop_io_uring(io_wait_h* h, int t, int repeat)
+{
+	struct io_uring_ring *ur = &h->uring;
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	struct io_uring_cqe *cqe;
+	struct fd_map *e;
+	unsigned int head, tail, gen;
+	unsigned int curr_time;
+	int ret, n, r, fd;
+
+	memset(&arg, 0, sizeof arg);
+	ts.tv_sec = t;
+	ts.tv_nsec = 0;
+	arg.ts = (unsigned long long)(unsigned long)&ts;
+
+again:
+		n=syscall(__NR_io_uring_enter, ur->fd, ur->to_submit, 1,
+			IORING_ENTER_GETEVENTS|IORING_ENTER_EXT_ARG, &arg, sizeof arg);
+		if (n==-1){
+			if (errno==EINTR) goto again; /* signal, ignore it */
+			if (errno!=ETIME && errno!=EBUSY) {
+				LM_ERR("[%s] io_uring_enter(%d, %u): %s [%d]\n",
+					h->name, ur->fd, ur->to_submit, strerror(errno), errno);
+				return -1;
+			}
+		} else {
+			/* the returned value is the number of submitted SQEs */
+			ur->to_submit -= n;
+		}
+
+		curr_time = get_ticks();
+
+		ret = 0;
+		head = *ur->cq_head;
+		tail = __atomic_load_n(ur->cq_tail, __ATOMIC_ACQUIRE);
+		for( ; head!=tail ; head++) {
+			cqe = &ur->cqes[head & ur->cq_mask];
+
+			/* completions of the poll removals */
+			if (cqe->user_data & IO_URING_UD_REMOVE)
+				continue;
+
+			fd = (int)(cqe->user_data & 0xffffffff);
+			gen = (unsigned int)(cqe->user_data >> 32);
+			if (fd<0 || fd>=h->max_fd_no) {
+				LM_BUG("[%s] bogus fd %d in io_uring completion\n",h->name,fd);
+				continue;
+			}
+			e = get_fd_map(h, fd);
+			/* completion of an already cancelled/replaced poll request */
+			if (gen!=ur->fd_gen[fd] || e->type==0 || e->fd!=fd)
+				continue;
+
+			if (cqe->res<0) {
+				if (cqe->res!=-ECANCELED)
+					LM_ERR("[%s] poll on fd %d failed: %s [%d]\n", h->name,
+						fd, strerror(-cqe->res), -cqe->res);
+				/* nothing armed anymore on this fd, try again */
+				io_uring_arm_poll(h, e);
+				continue;
+			}
+
+			ret++;
+			/* anything containing POLLIN (like HUP or ERR) goes as a READ */
+			if (cqe->res & POLLIN)
+				e->flags |= IO_WATCH_PRV_TRIG_READ;
+			else if (cqe->res & POLLOUT)
+				e->flags |= IO_WATCH_PRV_TRIG_WRITE;
+			/* ERR or HUP only - look back at the IO flags we set */
+			else if (e->flags & IO_WATCH_WRITE)
+				e->flags |= IO_WATCH_PRV_TRIG_WRITE;
+			else
+				e->flags |= IO_WATCH_PRV_TRIG_READ;
+		}
+		__atomic_store_n(ur->cq_head, head, __ATOMIC_RELEASE);
+
+		/* now do the actual running of IO handlers */
+		for(r=h->fd_no-1; (r>=0) ; r--) {
+			e = get_fd_map(h, h->fd_array[r].fd);
+			fd = h->fd_array[r].fd;
+			gen = ur->fd_gen[fd];
+			if ( e->flags & IO_WATCH_PRV_TRIG_READ ) {
+				e->flags &= ~IO_WATCH_PRV_TRIG_READ;
+				while((handle_io( e, r, IO_WATCH_READ)>0) && repeat);
+			} else if ( e->flags & IO_WATCH_PRV_TRIG_WRITE ){
+				e->flags &= ~IO_WATCH_PRV_TRIG_WRITE;
+				handle_io( e, r, IO_WATCH_WRITE);
+			} else {
+				if ( e->timeout!=0 && e->timeout<=curr_time ) {
+					e->timeout = 0;
+					handle_io( e, r, IO_WATCH_TIMEOUT);
+				}
+				continue;
+			}
+			/* re-arm the fired poll request, unless the handler already
+			 * removed or changed the watching of the fd */
+			if (gen==ur->fd_gen[fd] && e->fd==fd &&
+			(e->flags&(IO_WATCH_READ|IO_WATCH_WRITE)))
+				io_uring_arm_poll(h, e);
+		}
+
+	return ret;
+}
+#endif
+
+
+
 #ifdef HAVE_DEVPOLL
 inline static int io_wait_loop_devpoll(io_wait_h* h, int t, int repeat)
 {
@@ -123,6 +123,7 @@ struct socket_id {
 	int port;
 	int workers;
 	int tos;
+	int recv_batch;
 	enum si_flags flags;
 	struct socket_id* next;
 };
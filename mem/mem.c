@@ -215,6 +215,45 @@ int init_pkg_mallocs(void)
 	return 0;
 }
 
+unsigned int pkg_arena_size = 0;
+
+#ifdef PKG_MALLOC
+struct pkg_arena pkg_arena;
+
+void *pkg_arena_enter(void)
+{
+	char *block;
+
+	if (pkg_arena_size == 0)
+		return NULL;
+
+	if (!pkg_arena.start) {
+		block = pkg_malloc(pkg_arena_size);
+		if (!block) {
+			LM_ERR("oom for the %u bytes pkg arena, disabling it\n",
+				pkg_arena_size);
+			pkg_arena_size = 0;
+			return NULL;
+		}
+
+		pkg_arena.start = pkg_arena.pos = block;
+		pkg_arena.end = block + pkg_arena_size;
+	}
+
+	pkg_arena.depth++;
+	return pkg_arena.owner;
+}
+
+void pkg_arena_leave(void *prev_owner)
+{
+	if (pkg_arena.depth == 0)
+		return;
+
+	pkg_arena.owner = prev_owner;
+	if (--pkg_arena.depth == 0)
+		pkg_arena.pos = pkg_arena.start;
+}
+#endif
 
 
 #if defined(PKG_MALLOC) && defined(STATISTICS)
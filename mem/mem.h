@@ -25,6 +25,7 @@
 #define mem_h
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "../config.h"
 #include "../dprint.h"
@@ -128,15 +129,74 @@ extern unsigned long (*gen_pkg_get_frags)(void *blk);
 #define PKG_GET_FRAGS()        gen_pkg_get_frags(mem_block)
 #endif /* INLINE_ALLOC */
 
+/*
+ * Per-message arena: the pkg structures owned by the SIP message being
+ * processed by receive_msg() (the message itself, its header fields and
+ * their parsed bodies, its lumps) are taken from a per-process bump
+ * allocator, wiped in one shot once the message is released.
+ *
+ * Only the allocations done via pkg_msg_malloc() (for the arena owner
+ * message) or via pkg_near_malloc() (for something already in the arena)
+ * go there; everything else (and everything, once the arena is full) is
+ * served by the pkg allocator. pkg_free() does nothing for a pointer in
+ * the arena, while pkg_realloc() moves it into regular pkg memory.
+ */
+struct pkg_arena {
+	char *start;
+	char *end;
+	char *pos;
+	void *owner;   /* the message the allocations belong to */
+	int depth;     /* nested receive_msg() calls */
+};
+
+extern struct pkg_arena pkg_arena;
+
+#define PKG_ARENA_ALIGN   sizeof(long long)
+#define PKG_ARENA_HDR     PKG_ARENA_ALIGN
+
+#define pkg_in_arena(_p) \
+	((char *)(_p) >= pkg_arena.start && (char *)(_p) < pkg_arena.end)
+
+/* size of an arena allocation (as requested, rounded) */
+#define pkg_arena_frag_size(_p) \
+	(*(unsigned long *)((char *)(_p) - PKG_ARENA_HDR))
+
+/* starts the arena scope of a new message, returns the previous owner */
+void *pkg_arena_enter(void);
+/* ends the arena scope of a message, wiping the arena for the last one */
+void pkg_arena_leave(void *prev_owner);
+
+#define pkg_arena_set_owner(_msg) \
+	do { \
+		pkg_arena.owner = (_msg); \
+	} while (0)
+
+inline static void *_pkg_arena_malloc(unsigned long size)
+{
+	char *p;
+
+	size = (size + PKG_ARENA_ALIGN - 1) & ~(PKG_ARENA_ALIGN - 1);
+	if (pkg_arena.depth == 0 ||
+	        (unsigned long)(pkg_arena.end - pkg_arena.pos) < size + PKG_ARENA_HDR)
+		return NULL;
+
+	p = pkg_arena.pos;
+	pkg_arena.pos += size + PKG_ARENA_HDR;
+	*(unsigned long *)p = size;
+	return p + PKG_ARENA_HDR;
+}
+
 #ifdef DBG_MALLOC
 #ifdef __SUNPRO_C
 #define __FUNCTION__ ""  /* gcc specific */
 #endif
 #define pkg_malloc(s)     PKG_MALLOC_(mem_block, (s), \
                                       __FILE__, __FUNCTION__, __LINE__)
-#define pkg_free(p)       PKG_FREE(mem_block, (p), \
+#define pkg_free(p)       pkg_free_func((p), \
                                       __FILE__, __FUNCTION__, __LINE__)
-#define pkg_realloc(p, s) PKG_REALLOC(mem_block, (p), (s), \
+#define pkg_realloc(p, s) pkg_realloc_func((p), (s), \
+                                      __FILE__, __FUNCTION__, __LINE__)
+#define pkg_arena_malloc(s) pkg_arena_malloc_func((s), \
                                       __FILE__, __FUNCTION__, __LINE__)
 #define pkg_info(i)       PKG_INFO(mem_block, i)
 inline static void *pkg_malloc_func(unsigned long size,
@@ -145,38 +205,95 @@ inline static void *pkg_malloc_func(unsigned long size,
 	return PKG_MALLOC_(mem_block, size, file, function, line);
 }
 
+inline static void *pkg_arena_malloc_func(unsigned long size,
+		const char *file, const char *function, unsigned int line)
+{
+	void *p;
+
+	if ((p = _pkg_arena_malloc(size)))
+		return p;
+
+	return PKG_MALLOC_(mem_block, size, file, function, line);
+}
+
 inline static void* pkg_realloc_func(void *ptr, unsigned long size,
 		const char* file, const char* function, unsigned int line)
 {
+	void *p;
+
+	if (pkg_in_arena(ptr)) {
+		p = PKG_MALLOC_(mem_block, size, file, function, line);
+		if (p)
+			memcpy(p, ptr, pkg_arena_frag_size(ptr) < size ?
+				pkg_arena_frag_size(ptr) : size);
+		return p;
+	}
+
 	return PKG_REALLOC(mem_block, ptr, size, file, function, line);
 }
 
 inline static void pkg_free_func(void *ptr,
 		const char* file, const char* function, unsigned int line)
 {
+	if (pkg_in_arena(ptr))
+		return;
+
 	return PKG_FREE(mem_block, ptr, file, function, line);
 }
 #else
 #define pkg_malloc(s)     PKG_MALLOC_(mem_block, (s))
-#define pkg_realloc(p, s) PKG_REALLOC(mem_block, (p), (s))
-#define pkg_free(p)       PKG_FREE(mem_block, (p))
+#define pkg_realloc(p, s) pkg_realloc_func((p), (s))
+#define pkg_free(p)       pkg_free_func((p))
+#define pkg_arena_malloc(s) pkg_arena_malloc_func((s))
 #define pkg_info(i)       PKG_INFO(mem_block, i)
 inline static void *pkg_malloc_func(unsigned long size)
 {
 	return PKG_MALLOC_(mem_block, size);
 }
 
+inline static void *pkg_arena_malloc_func(unsigned long size)
+{
+	void *p;
+
+	if ((p = _pkg_arena_malloc(size)))
+		return p;
+
+	return PKG_MALLOC_(mem_block, size);
+}
+
 inline static void* pkg_realloc_func(void *ptr, unsigned long size)
 {
+	void *p;
+
+	if (pkg_in_arena(ptr)) {
+		p = PKG_MALLOC_(mem_block, size);
+		if (p)
+			memcpy(p, ptr, pkg_arena_frag_size(ptr) < size ?
+				pkg_arena_frag_size(ptr) : size);
+		return p;
+	}
+
 	return PKG_REALLOC(mem_block, ptr, size);
 }
 
 inline static void pkg_free_func(void *ptr)
 {
+	if (pkg_in_arena(ptr))
+		return;
+
 	return PKG_FREE(mem_block, ptr);
 }
 #endif
 
+/* allocates a structure owned by message @_msg */
+#define pkg_msg_malloc(_msg, _size) \
+	((void *)(_msg) == pkg_arena.owner ? \
+		pkg_arena_malloc(_size) : pkg_malloc(_size))
+
+/* allocates a structure owned by (and living as long as) @_p */
+#define pkg_near_malloc(_p, _size) \
+	(pkg_in_arena(_p) ? pkg_arena_malloc(_size) : pkg_malloc(_size))
+
 #define pkg_status()      PKG_STATUS(mem_block)
 
 #else
@@ -194,6 +311,13 @@ void sys_free(void *, const char *, const char *, unsigned int);
 #define pkg_realloc(ptr, s) sys_realloc((ptr), (s), __FILE__, __FUNCTION__, __LINE__)
 #define pkg_free_func sys_free
 #define pkg_free(p) sys_free((p), __FILE__, __FUNCTION__, __LINE__)
+#define pkg_in_arena(_p)            0
+#define pkg_arena_enter()           NULL
+#define pkg_arena_leave(_o)
+#define pkg_arena_set_owner(_msg)
+#define pkg_arena_malloc(s)         pkg_malloc(s)
+#define pkg_msg_malloc(_msg, _size) pkg_malloc(_size)
+#define pkg_near_malloc(_p, _size)  pkg_malloc(_size)
 #define pkg_status()
 #define PKG_GET_SIZE()
 #define PKG_GET_USED()
@@ -203,6 +327,9 @@ void sys_free(void *, const char *, const char *, unsigned int);
 #define PKG_GET_FRAGS()
 #endif
 
+/* size of the per-message pkg arena, 0 disables it */
+extern unsigned int pkg_arena_size;
+
 int init_pkg_mallocs();
 int init_shm_mallocs();
 int init_dbg_shm_mallocs();
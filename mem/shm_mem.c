@@ -87,6 +87,9 @@ stat_export_t shm_stats[] = {
 	{"real_used_size" , STAT_IS_FUNC,    (stat_var**)shm_get_rused },
 	{"fragments" ,      STAT_IS_FUNC,    (stat_var**)shm_get_frags },
 #endif
+	{"cache_hits" ,     STAT_IS_FUNC,    (stat_var**)shm_get_cache_hits },
+	{"cache_misses" ,   STAT_IS_FUNC,    (stat_var**)shm_get_cache_misses },
+	{"cache_held_size", STAT_IS_FUNC,    (stat_var**)shm_get_cache_held },
 	{0,0,0}
 };
 #endif
@@ -933,6 +936,136 @@ int shm_dbg_mem_init(void)
 }
 #endif
 
+/* max number of cached fragments per size class, 0 disables the cache */
+unsigned int shm_cache_size = 0;
+int shm_cache_active = 0;
+struct shm_cache_class shm_cache[SHM_CACHE_CLASSES];
+struct shm_cache_stats *shm_cache_stat;
+
+static struct shm_cache_stats *shm_cache_stats;
+static int shm_cache_procs;
+
+int init_shm_cache(int procs)
+{
+	if (shm_cache_size == 0)
+		return 0;
+
+#ifdef SHM_EXTRA_STATS
+	LM_WARN("shm cache not available with SHM_EXTRA_STATS, disabling it\n");
+	shm_cache_size = 0;
+	return 0;
+#endif
+
+#ifdef DBG_MALLOC
+	if (shm_memlog_size
+#ifndef INLINE_ALLOC
+	|| mem_allocator_shm == MM_F_MALLOC_DBG
+	|| mem_allocator_shm == MM_Q_MALLOC_DBG
+	|| mem_allocator_shm == MM_HP_MALLOC_DBG
+	|| mem_allocator_shm == MM_F_PARALLEL_MALLOC_DBG
+#endif
+	) {
+		LM_WARN("shm cache not available with a debug shm allocator, "
+			"disabling it\n");
+		shm_cache_size = 0;
+		return 0;
+	}
+#endif
+
+	/* a flushed list keeps half of the fragments, so at least 2 */
+	if (shm_cache_size < 2)
+		shm_cache_size = 2;
+
+	shm_cache_stats = shm_malloc(procs * sizeof *shm_cache_stats);
+	if (!shm_cache_stats) {
+		LM_ERR("oom\n");
+		return -1;
+	}
+	memset(shm_cache_stats, 0, procs * sizeof *shm_cache_stats);
+	shm_cache_procs = procs;
+
+	return 0;
+}
+
+void shm_cache_child_init(int proc_no)
+{
+	if (!shm_cache_size || !shm_cache_stats || proc_no >= shm_cache_procs)
+		return;
+
+	/* anything inherited from the parent still belongs to the parent */
+	memset(shm_cache, 0, sizeof shm_cache);
+
+	shm_cache_stat = &shm_cache_stats[proc_no];
+	memset(shm_cache_stat, 0, sizeof *shm_cache_stat);
+	shm_cache_active = 1;
+}
+
+void shm_cache_flush_class(struct shm_cache_class *c, unsigned int keep)
+{
+	void *p;
+
+	if (c->no <= keep)
+		return;
+
+	shm_lock();
+
+	while (c->no > keep) {
+		p = c->frags;
+		c->frags = *(void **)p;
+		c->no--;
+
+		shm_cache_stat->held -= shm_frag_size(p);
+#ifdef DBG_MALLOC
+		SHM_FREE(shm_block, p, __FILE__, __FUNCTION__, __LINE__);
+#else
+		SHM_FREE(shm_block, p);
+#endif
+	}
+
+	shm_threshold_check();
+
+	shm_unlock();
+}
+
+void shm_cache_flush(void)
+{
+	int i;
+
+	if (!shm_cache_active)
+		return;
+
+	for (i = 0; i < SHM_CACHE_CLASSES; i++)
+		shm_cache_flush_class(&shm_cache[i], 0);
+
+	shm_cache_active = 0;
+}
+
+#ifdef STATISTICS
+#define SHM_CACHE_SUM(_field) \
+	do { \
+		unsigned long _sum = 0; \
+		int _i; \
+		for (_i = 0; _i < shm_cache_procs; _i++) \
+			_sum += shm_cache_stats[_i]._field; \
+		return _sum; \
+	} while (0)
+
+unsigned long shm_get_cache_hits(unsigned short foo)
+{
+	SHM_CACHE_SUM(hits);
+}
+
+unsigned long shm_get_cache_misses(unsigned short foo)
+{
+	SHM_CACHE_SUM(misses);
+}
+
+unsigned long shm_get_cache_held(unsigned short foo)
+{
+	SHM_CACHE_SUM(held);
+}
+#endif
+
 mi_response_t *mi_shm_check(const mi_params_t *params,
 								struct mi_handler *async_hdl)
 {
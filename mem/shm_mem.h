@@ -314,6 +314,95 @@ inline static void shm_threshold_check(void)
 #define shm_dbg_unlock()  lock_release(mem_dbg_lock)
 #endif
 
+/*
+ * Per-process cache of small shm fragments, in front of the allocator:
+ * the fragments freed by a process are kept (per size class) in private
+ * free lists and re-used by its next allocations, without locking. When
+ * a list grows over "shm_cache_size" fragments, half of it is returned
+ * to the allocator in a single batch (under a single lock acquisition).
+ *
+ * The cache is used only by the processes forked via internal_fork() and
+ * only by the shm_malloc() / shm_free() flavors (not by the unsafe or
+ * bulk ones, as their callers already own the allocator lock).
+ */
+#define SHM_CACHE_GRAIN       16
+#define SHM_CACHE_CLASSES     32
+#define SHM_CACHE_MAX_SIZE    (SHM_CACHE_GRAIN * SHM_CACHE_CLASSES)
+
+struct shm_cache_class {
+	void *frags;        /* linked via the first word of each fragment */
+	unsigned int no;
+};
+
+struct shm_cache_stats {
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long held; /* bytes held in the cache */
+};
+
+extern unsigned int shm_cache_size;
+extern int shm_cache_active;
+extern struct shm_cache_class shm_cache[SHM_CACHE_CLASSES];
+extern struct shm_cache_stats *shm_cache_stat;
+
+/* allocates the per-process statistics of the cache */
+int init_shm_cache(int procs);
+/* enables the cache in a newly forked process */
+void shm_cache_child_init(int proc_no);
+/* returns (part of) the fragments of a size class to the allocator */
+void shm_cache_flush_class(struct shm_cache_class *c, unsigned int keep);
+/* returns all the cached fragments to the allocator */
+void shm_cache_flush(void);
+
+inline static void *shm_cache_get(unsigned long size)
+{
+	struct shm_cache_class *c;
+	void *p;
+
+	if (!shm_cache_active || size > SHM_CACHE_MAX_SIZE)
+		return NULL;
+
+	c = &shm_cache[size ? (size - 1) / SHM_CACHE_GRAIN : 0];
+	if (!c->frags) {
+		shm_cache_stat->misses++;
+		return NULL;
+	}
+
+	p = c->frags;
+	c->frags = *(void **)p;
+	c->no--;
+
+	shm_cache_stat->hits++;
+	shm_cache_stat->held -= shm_frag_size(p);
+	return p;
+}
+
+inline static int shm_cache_put(void *p)
+{
+	struct shm_cache_class *c;
+	unsigned long size;
+
+	if (!shm_cache_active || !p)
+		return 0;
+
+	/* a fragment goes in the highest class it is able to serve */
+	size = shm_frag_size(p);
+	if (size < SHM_CACHE_GRAIN ||
+	        size >= SHM_CACHE_MAX_SIZE + SHM_CACHE_GRAIN)
+		return 0;
+
+	c = &shm_cache[size / SHM_CACHE_GRAIN - 1];
+	if (c->no >= shm_cache_size)
+		shm_cache_flush_class(c, shm_cache_size / 2);
+
+	*(void **)p = c->frags;
+	c->frags = p;
+	c->no++;
+
+	shm_cache_stat->held += size;
+	return 1;
+}
+
 #ifdef SHM_EXTRA_STATS
 	#define PASTER(_x, _y) _x ## _y
 	#define VAR_STAT(_n) PASTER(_n, _mem_stat)
@@ -400,6 +489,9 @@ inline static void* _shm_malloc(unsigned long size,
 {
 	void *p;
 
+	if ((p = shm_cache_get(size)))
+		return p;
+
 	shm_lock();
 
 	p = SHM_MALLOC(shm_block, size, file, function, line);
@@ -533,6 +625,9 @@ inline static void _shm_free(void *ptr,
 {
 	int size = -1;
 
+	if (shm_cache_put(ptr))
+		return;
+
 	shm_lock();
 
 	#ifdef SHM_EXTRA_STATS
@@ -640,6 +735,9 @@ inline static void* shm_malloc(unsigned long size)
 {
 	void *p;
 
+	if ((p = shm_cache_get(size)))
+		return p;
+
 	shm_lock();
 
 	p = SHM_MALLOC(shm_block, size);
@@ -765,6 +863,9 @@ inline static void* shm_realloc_unsafe(void *ptr, unsigned long size)
 #define shm_free_func shm_free
 inline static void shm_free(void *_p)
 {
+	if (shm_cache_put(_p))
+		return;
+
 	shm_lock();
 
 	#ifdef SHM_EXTRA_STATS
@@ -898,6 +999,9 @@ inline static unsigned long shm_get_free(unsigned short foo) {
 inline static unsigned long shm_get_frags(unsigned short foo) {
 	return SHM_GET_FRAGS(shm_block);
 }
+unsigned long shm_get_cache_hits(unsigned short foo);
+unsigned long shm_get_cache_misses(unsigned short foo);
+unsigned long shm_get_cache_held(unsigned short foo);
 #endif /*STATISTICS*/
 
 #endif
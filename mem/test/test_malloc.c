@@ -308,6 +308,174 @@ static inline void test_shm_malloc(void)
 	ok(reallocs == aligned_reallocs,   "check shm_realloc() alignment");
 }
 
+/* the size classes of the shm cache quickly spill with a small cache */
+#define TEST_SHM_CACHE_SIZE 8
+
+#define shm_cache_class_of(_p) \
+	(&shm_cache[shm_frag_size(_p) / SHM_CACHE_GRAIN - 1])
+
+struct test_shm_cache_xproc {
+	void *frag;
+	int cached;
+	int reused;
+	unsigned long held;
+	volatile int done;
+};
+
+static void test_shm_cache_xproc(struct shm_cache_class *c,
+                                 unsigned long size)
+{
+	struct test_shm_cache_xproc *xp;
+	unsigned int n;
+	int i, child_pid;
+	const struct internal_fork_params ifp_sc = {
+		.proc_desc = "shm cache test",
+		.flags = OSS_PROC_NO_IPC|OSS_PROC_NO_LOAD,
+		.type = TYPE_NONE,
+	};
+
+	xp = shm_malloc(sizeof *xp);
+	if (!xp) {
+		ok(0, "shm cache: oom");
+		return;
+	}
+	memset(xp, 0, sizeof *xp);
+
+	xp->frag = shm_malloc(size);
+	n = c->no;
+
+	child_pid = internal_fork(&ifp_sc);
+	if (child_pid < 0) {
+		ok(0, "shm cache: fork");
+		return;
+	}
+
+	if (child_pid == 0) {
+		/* the forked process starts with an empty cache of its own */
+		shm_free(xp->frag);
+		xp->cached = (c->no == 1);
+		xp->reused = (shm_malloc(size) == xp->frag);
+		shm_free(xp->frag);
+
+		shm_cache_flush();
+		xp->held = shm_cache_stat->held;
+		xp->done = 1;
+
+		pt[process_no].flags |= OSS_PROC_SELFEXIT;
+		exit(0);
+	}
+
+	for (i = 0; !xp->done && i < 5000; i++)
+		usleep(1000);
+
+	ok(xp->done, "shm cache: the other process completed");
+	ok(xp->cached, "shm cache: frag freed by another process cached there");
+	ok(xp->reused, "shm cache: frag freed by another process reused there");
+	ok(xp->held == 0, "shm cache: cached frags returned when flushing");
+	ok(c->no == n, "shm cache: cache of the allocating process unchanged");
+
+	if (xp->done)
+		shm_free(xp);
+}
+
+static void _test_shm_cache(void)
+{
+	struct shm_cache_class *c;
+	unsigned long size, fsize, held, hits;
+	unsigned int i, n, m, max;
+	void *p, *q, **frags;
+	int bad;
+
+	/* alloc/free through the cache */
+	p = shm_malloc(100);
+	fsize = shm_frag_size(p);
+	c = shm_cache_class_of(p);
+	/* the largest request served by the size class of the fragment */
+	size = fsize / SHM_CACHE_GRAIN * SHM_CACHE_GRAIN;
+
+	n = c->no;
+	held = shm_cache_stat->held;
+	shm_free(p);
+	ok(c->no == n + 1 && shm_cache_stat->held == held + fsize,
+		"shm cache: freed frag is cached");
+
+	hits = shm_cache_stat->hits;
+	q = shm_malloc(size);
+	ok(q == p && c->no == n && shm_cache_stat->hits == hits + 1,
+		"shm cache: cached frag is reused");
+	shm_free(q);
+
+	/* spill back to the allocator, starting with an empty size class */
+	shm_cache_flush_class(c, 0);
+	ok(c->no == 0 && c->frags == NULL, "shm cache: size class flushed");
+
+	max = 4 * (shm_cache_size + 1);
+	frags = pkg_malloc(max * sizeof *frags);
+	if (!frags) {
+		ok(0, "shm cache: oom");
+		return;
+	}
+
+	for (n = 0, m = 0; n <= shm_cache_size && m < max; m++) {
+		frags[m] = shm_malloc(size);
+		if (!frags[m])
+			break;
+		if (shm_cache_class_of(frags[m]) == c)
+			n++;
+	}
+	ok(n == shm_cache_size + 1, "shm cache: allocate a full size class");
+
+	for (i = 0; i < m; i++)
+		if (shm_cache_class_of(frags[i]) == c)
+			shm_free(frags[i]);
+	ok(c->no == shm_cache_size / 2 + 1,
+		"shm cache: full size class spills half of it");
+
+	for (i = 0; i < m; i++)
+		if (shm_cache_class_of(frags[i]) != c)
+			shm_free(frags[i]);
+	pkg_free(frags);
+
+	for (i = 0, bad = 0; i < SHM_CACHE_CLASSES; i++)
+		if (shm_cache[i].no > shm_cache_size)
+			bad++;
+	ok(bad == 0, "shm cache: no size class over its limit");
+
+	/* free in a different process */
+	test_shm_cache_xproc(c, size);
+
+	shm_cache_flush();
+	ok(shm_cache_stat->held == 0, "shm cache: all frags returned");
+}
+
+void test_shm_cache(void)
+{
+	unsigned int old_size = shm_cache_size;
+	int was_active = shm_cache_active;
+
+	/* enable a small cache for this process, if not already configured */
+	if (!shm_cache_size) {
+		shm_cache_size = TEST_SHM_CACHE_SIZE;
+		if (init_shm_cache(counted_max_processes) != 0) {
+			ok(0, "shm cache: init");
+			goto out;
+		}
+	}
+
+	shm_cache_child_init(process_no);
+	if (!shm_cache_active)
+		LM_INFO("shm cache not available in this build, skipping tests\n");
+	else
+		_test_shm_cache();
+
+out:
+	/* leave the cache as found, so the next tests are not affected */
+	shm_cache_flush();
+	shm_cache_size = old_size;
+	if (was_active)
+		shm_cache_child_init(process_no);
+}
+
 void test_malloc(void)
 {
 	test_pkg_malloc();
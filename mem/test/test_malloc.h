@@ -29,4 +29,7 @@ void init_malloc_tests(void);
 
 void test_malloc(void);
 
+/* checks the per-process cache of small shm fragments */
+void test_shm_cache(void);
+
 #endif /* __TEST_MALLOC_H__ */
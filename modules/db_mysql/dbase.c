@@ -1471,8 +1471,44 @@ int db_last_inserted_id(const db_con_t* _h)
 }
 
 
+ /**
+  * Prints the "on duplicate key update" part of a multi-row insert_update
+  * query, each row updating the existing one with its own values.
+  * If _b is NULL, only the needed length is returned.
+  */
+static int db_mysql_print_upsert_set(char *_b, const int _l,
+	const db_key_t* _k, const int _n)
+{
+	static const str upd = str_init(" on duplicate key update ");
+	int i, ret, len;
+
+	if (!_b) {
+		for (i = 0, len = upd.len; i < _n; i++)
+			len += (i ? 1 : 0) + 2 * _k[i]->len + 9 /* =values() */;
+		return len;
+	}
+
+	ret = snprintf(_b, _l, "%.*s", upd.len, upd.s);
+	if (ret < 0 || ret >= _l) return -1;
+	len = ret;
+
+	for (i = 0; i < _n; i++) {
+		ret = snprintf(_b + len, _l - len, "%s%.*s=values(%.*s)",
+			i ? "," : "", _k[i]->len, _k[i]->s, _k[i]->len, _k[i]->s);
+		if (ret < 0 || ret >= (_l - len)) return -1;
+		len += ret;
+	}
+
+	return len;
+}
+
+
  /**
   * Insert a row into a specified table, update on duplicate key.
+  * If the connection has an upsert query list attached, the row is only
+  * queued and the rows are flushed in multi-row queries once the list
+  * fills up (or when the caller asks for a flush). The rows not fitting
+  * into a single query are pushed with additional queries.
   * \param _h structure representing database connection
   * \param _k key names
   * \param _v values of the keys
@@ -1481,7 +1517,8 @@ int db_last_inserted_id(const db_con_t* _h)
  int db_insert_update(const db_con_t* _h, const db_key_t* _k, const db_val_t* _v,
 	const int _n)
  {
-	int off, ret;
+	int off, ret, i, head_len, set_len, q_rows, no_rows = 0, err = 0;
+	db_val_t **buffered_rows = NULL;
 	static str  sql_str;
 	static char sql_buf[SQL_BUF_LEN];
 
@@ -1492,15 +1529,94 @@ int db_last_inserted_id(const db_con_t* _h)
 
 	CON_RESET_CURR_PS(_h); /* no prepared statements support */
 
+	/* upsert buffering is enabled ? */
+	if (CON_HAS_INSLIST(_h)) {
+		if (IS_INSTANT_FLUSH(_h)) {
+			/* the caller is holding the lock at this point */
+			no_rows = ql_detach_rows_unsafe(_h->ins_list, &buffered_rows);
+			CON_FLUSH_RESET(_h, _h->ins_list);
+		} else {
+			no_rows = ql_row_add(_h->ins_list, _v, &buffered_rows);
+		}
+		CON_RESET_INSLIST(_h);
+
+		if (no_rows < 0) {
+			LM_ERR("failed to queue/detach rows for insert_update\n");
+			return -1;
+		}
+
+		/* wait for queries to pile up */
+		if (no_rows == 0)
+			return 0;
+	}
+
 	ret = snprintf(sql_buf, SQL_BUF_LEN, "insert into %.*s (",
 		CON_TABLE(_h)->len, CON_TABLE(_h)->s);
 	if (ret < 0 || ret >= SQL_BUF_LEN) goto error;
 	off = ret;
 
 	ret = db_print_columns(sql_buf + off, SQL_BUF_LEN - off, _k, _n);
-	if (ret < 0) return -1;
+	if (ret < 0) goto error;
 	off += ret;
 
+	if (buffered_rows) {
+		ret = snprintf(sql_buf + off, SQL_BUF_LEN - off, ") values ");
+		if (ret < 0 || ret >= (SQL_BUF_LEN - off)) goto error;
+		off += ret;
+
+		/* the query header is kept in the buffer between the queries */
+		head_len = off;
+		set_len = db_mysql_print_upsert_set(NULL, 0, _k, _n);
+
+		for (i = 0, q_rows = 0; i < no_rows; ) {
+			/* leave room for the update part after each row */
+			if (off + 5 + set_len >= SQL_BUF_LEN)
+				goto flush;
+			if (q_rows)
+				sql_buf[off++] = ',';
+			sql_buf[off++] = '(';
+			ret = db_print_values(_h, sql_buf + off,
+				SQL_BUF_LEN - off - 2 - set_len, buffered_rows[i], _n,
+				db_mysql_val2str);
+			if (ret < 0) {
+				off -= q_rows ? 2 : 1;
+				goto flush;
+			}
+			off += ret;
+			sql_buf[off++] = ')';
+
+			shm_free(buffered_rows[i]);
+			buffered_rows[i++] = NULL;
+			q_rows++;
+			if (i < no_rows)
+				continue;
+
+flush:
+			if (q_rows == 0) {
+				LM_ERR("row does not fit into the query buffer\n");
+				goto error;
+			}
+
+			ret = db_mysql_print_upsert_set(sql_buf + off,
+				SQL_BUF_LEN - off, _k, _n);
+			if (ret < 0) goto error;
+			off += ret;
+
+			sql_str.s = sql_buf;
+			sql_str.len = off;
+			if (db_mysql_submit_query(_h, &sql_str) < 0) {
+				LM_ERR("error while submitting query\n");
+				err = -2;
+			}
+
+			LM_DBG("flushed %d rows with a single insert_update\n", q_rows);
+			off = head_len;
+			q_rows = 0;
+		}
+
+		return err;
+	}
+
 	ret = snprintf(sql_buf + off, SQL_BUF_LEN - off, ") values (");
 	if (ret < 0 || ret >= (SQL_BUF_LEN - off)) goto error;
 	off += ret;
@@ -1530,6 +1646,7 @@ int db_last_inserted_id(const db_con_t* _h)
 	return 0;
 
 error:
+	cleanup_rows(buffered_rows);
 	LM_ERR("error while preparing insert_update operation\n");
 	return -1;
 }
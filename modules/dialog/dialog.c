@@ -74,6 +74,7 @@ int seq_match_mode = SEQ_MATCH_FALLBACK;
 int options_ping_interval = 30;      /* seconds */
 int reinvite_ping_interval = 300;    /* seconds */
 int dlg_del_delay = 0;               /* in seconds, default off */
+int dlg_timer_shards = 1;
 str dlg_extra_hdrs = {NULL,0};
 int race_condition_timeout = 5; /* seconds until call termination is triggered,
 					after 200OK -> CANCEL race detection */
@@ -94,6 +95,9 @@ stat_var *delete_sent  = 0;
 stat_var *create_recv  = 0;
 stat_var *update_recv  = 0;
 stat_var *delete_recv  = 0;
+stat_var *db_flushed_dlgs = 0;
+stat_var *db_flush_batch  = 0;
+stat_var *db_flush_time   = 0;
 
 struct tm_binds d_tmb;
 struct rr_binds d_rrb;
@@ -108,6 +112,7 @@ str cdb_url = {0,0};
 
 /* dialog replication using clusterer */
 int dialog_repl_cluster = 0;
+int dialog_repl_delta = 0;
 int profile_repl_cluster = 0;
 str dlg_repl_cap = str_init("dialog-dlg-repl");
 str prof_repl_cap = str_init("dialog-prof-repl");
@@ -300,6 +305,7 @@ static const param_export_t mod_params[]={
 	{ "options_ping_interval", INT_PARAM, &options_ping_interval    },
 	{ "reinvite_ping_interval",INT_PARAM, &reinvite_ping_interval   },
 	{ "delete_delay",          INT_PARAM, &dlg_del_delay            },
+	{ "timer_shards",          INT_PARAM, &dlg_timer_shards         },
 	{ "dlg_extra_hdrs",        STR_PARAM, &dlg_extra_hdrs.s         },
 	{ "dlg_match_mode",        INT_PARAM, &seq_match_mode           },
 	{ "db_url",                STR_PARAM, &db_url.s                 },
@@ -333,6 +339,7 @@ static const param_export_t mod_params[]={
 	{ "db_flush_vals_profiles",INT_PARAM, &db_flush_vp              },
 	{ "timer_bulk_del_no",     INT_PARAM, &dlg_bulk_del_no          },
 	{ "race_condition_timeout",INT_PARAM, &race_condition_timeout	},
+	{ "profile_atomic_counters",INT_PARAM, &profile_atomic_counters },
 	/* distributed profiles stuff */
 	{ "cachedb_url",           	 STR_PARAM, &cdb_url.s              },
 	{ "profile_value_prefix",    STR_PARAM, &cdb_val_prefix.s       },
@@ -341,6 +348,7 @@ static const param_export_t mod_params[]={
 	{ "profile_timeout",         INT_PARAM, &profile_timeout        },
 	/* dialog replication through clusterer using TCP binary packets */
 	{ "dialog_replication_cluster",     INT_PARAM, &dialog_repl_cluster  },
+	{ "dialog_replication_delta",       INT_PARAM, &dialog_repl_delta    },
 	{ "profile_replication_cluster",	INT_PARAM, &profile_repl_cluster },
 	{ "replicate_profiles_timer", INT_PARAM, &repl_prof_utimer      },
 	{ "replicate_profiles_check", INT_PARAM, &repl_prof_timer_check },
@@ -363,6 +371,9 @@ static const stat_export_t mod_stats[] = {
 	{"create_recv",         0,              &create_recv       },
 	{"update_recv",         0,              &update_recv       },
 	{"delete_recv",         0,              &delete_recv       },
+	{"db_flushed_dialogs",  0,              &db_flushed_dlgs   },
+	{"db_flush_batch",      STAT_NO_RESET,  &db_flush_batch    },
+	{"db_flush_time",       STAT_NO_RESET,  &db_flush_time     },
 	{0,0,0}
 };
 
@@ -714,6 +725,26 @@ static void ctx_dlg_idx_destroy(void *v)
 		ctx_dialog_set(NULL);
 }
 
+/* registers one timer job per shard of the dialog timers, so the shards
+ * may be run in parallel by the timer processes */
+static int register_dlg_timers(char *label, timer_function f)
+{
+	char name[64];
+	long i;
+
+	if (dlg_timer_shards == 1)
+		return register_timer( label, f, NULL, 1, TIMER_FLAG_DELAY_ON_DELAY);
+
+	for (i = 0; i < dlg_timer_shards; i++) {
+		snprintf(name, sizeof name, "%s-%ld", label, i);
+		if (register_timer( name, f, (void *)i, 1,
+		TIMER_FLAG_DELAY_ON_DELAY) < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
 
 static int mod_init(void)
 {
@@ -815,6 +846,14 @@ static int mod_init(void)
 		return -1;
 	}
 
+#ifdef NO_ATOMIC_OPS
+	if (profile_atomic_counters) {
+		LM_WARN("no atomic operations support on this platform, "
+			"disabling profile_atomic_counters\n");
+		profile_atomic_counters = 0;
+	}
+#endif
+
 	/* create profile hashes */
 	if (add_profile_definitions( profiles_nv_s, 0)!=0 ) {
 		LM_ERR("failed to add profiles without value\n");
@@ -861,20 +900,23 @@ static int mod_init(void)
 		return -1;
 	}
 
-	if ( register_timer( "dlg-timer", dlg_timer_routine, NULL, 1,
-	TIMER_FLAG_DELAY_ON_DELAY)<0 ) {
+	if (dlg_timer_shards < 1) {
+		LM_WARN("invalid timer_shards %d, using 1\n", dlg_timer_shards);
+		dlg_timer_shards = 1;
+	}
+
+	if ( register_dlg_timers( "dlg-timer", dlg_timer_routine)<0 ) {
 		LM_ERR("failed to register timer\n");
 		return -1;
 	}
 
-	if ( register_timer( "dlg-options-pinger", dlg_options_routine, NULL,
-	1 /* check every second if we need to ping */, TIMER_FLAG_DELAY_ON_DELAY)<0) {
+	/* check every second if we need to ping */
+	if ( register_dlg_timers( "dlg-options-pinger", dlg_options_routine)<0) {
 		LM_ERR("failed to register timer 2\n");
 		return -1;
 	}
 
-	if ( register_timer( "dlg-reinvite-pinger", dlg_reinvite_routine, NULL,
-	1 /* check every second if we need to ping */, TIMER_FLAG_DELAY_ON_DELAY)<0) {
+	if ( register_dlg_timers( "dlg-reinvite-pinger", dlg_reinvite_routine)<0) {
 		LM_ERR("failed to register timer 2\n");
 		return -1;
 	}
@@ -76,6 +76,19 @@ extern int active_dlgs_cnt;
 extern int early_dlgs_cnt;
 extern int dlg_bulk_del_no;
 
+extern stat_var *db_flushed_dlgs;
+extern stat_var *db_flush_batch;
+extern stat_var *db_flush_time;
+
+/* upsert queue used by the timer to write back the dialogs in batches */
+static query_list_t *upsert_list = NULL;
+
+/* dialogs are written back with batched multi-row "insert or update"
+ * queries only if the DB insert queue is enabled and the driver can do it */
+#define dlg_db_batched_upsert() \
+	(query_buffer_size > 1 && \
+		DB_CAPABILITY(dialog_dbf, DB_CAP_MULTIPLE_INSERT_UPDATE))
+
 static inline void set_final_update_cols(db_val_t *, struct dlg_cell *, int);
 
 #define SET_BIGINT_VALUE(_val, _bigint)\
@@ -1629,6 +1642,135 @@ static inline void set_final_update_cols(db_val_t *vals, struct dlg_cell *cell,
 
 
 
+/* fills in all the columns of the dialog row, in the insert_keys order */
+static void set_dialog_row(db_val_t *values, struct dlg_cell *cell,
+									int callee_leg, unsigned char on_shutdown)
+{
+	SET_BIGINT_VALUE(values, dlg_get_db_id(cell));
+	SET_STR_VALUE(values+1, cell->callid);
+	SET_STR_VALUE(values+2, cell->from_uri);
+
+	SET_STR_VALUE(values+3, cell->legs[DLG_CALLER_LEG].tag);
+	SET_STR_VALUE(values+4, cell->to_uri);
+	SET_STR_VALUE(values+5, cell->legs[callee_leg].tag);
+
+	SET_STR_VALUE(values+6, *get_socket_internal_name
+		(cell->legs[DLG_CALLER_LEG].bind_addr) );
+	if (cell->legs[callee_leg].bind_addr) {
+		SET_STR_VALUE(values+7, *get_socket_internal_name
+			(cell->legs[callee_leg].bind_addr) );
+	} else {
+		VAL_NULL(values+7) = 1;
+	}
+
+	SET_INT_VALUE(values+8,  cell->start_ts);
+
+	SET_STR_VALUE(values+9, cell->legs[DLG_CALLER_LEG].route_set);
+	SET_STR_VALUE(values+10,
+		cell->legs[callee_leg].route_set);
+
+	SET_STR_VALUE(values+11,cell->legs[callee_leg].from_uri);
+	SET_STR_VALUE(values+12,cell->legs[callee_leg].to_uri);
+
+	SET_STR_VALUE(values+13, cell->legs[DLG_CALLER_LEG].contact);
+	SET_STR_VALUE(values+14,
+		cell->legs[callee_leg].contact);
+
+	SET_INT_VALUE(values+15, cell->state);
+	SET_INT_VALUE(values+16, (unsigned int)((unsigned int)(unsigned long)time(0)
+		+ cell->tl.timeout - get_ticks()) );
+
+	SET_STR_VALUE(values+17, cell->legs[DLG_CALLER_LEG].r_cseq);
+	SET_STR_VALUE(values+18, cell->legs[callee_leg].r_cseq);
+
+	SET_INT_VALUE(values+19, cell->legs[DLG_CALLER_LEG].last_gen_cseq);
+	SET_INT_VALUE(values+20, cell->legs[callee_leg].last_gen_cseq);
+
+	set_final_update_cols(values+21, cell, on_shutdown);
+	SET_INT_VALUE(values+25, cell->flags &
+		~(DLG_FLAG_NEW|DLG_FLAG_CHANGED|DLG_FLAG_VP_CHANGED|DLG_FLAG_DB_DELETED));
+
+	SET_ROUTE_VALUE(values+26, cell->rt_on_answer);
+	SET_ROUTE_VALUE(values+27, cell->rt_on_timeout);
+	SET_ROUTE_VALUE(values+28, cell->rt_on_hangup);
+}
+
+
+/* queues the full dialog row for the next batched upsert */
+static inline int upsert_dialog_row(db_key_t *keys, db_val_t *values)
+{
+	if (con_set_upsertlist(&dialog_dbf, dialog_db_handle,
+			&upsert_list, keys, DIALOG_TABLE_TOTAL_COL_NO) < 0)
+		CON_RESET_INSLIST(dialog_db_handle);
+
+	return dialog_dbf.insert_update(dialog_db_handle, keys, values,
+		DIALOG_TABLE_TOTAL_COL_NO);
+}
+
+
+/* the dialogs having rows in the upsert queue, referenced until the
+ * queue is flushed, so their DB flags are settled only afterwards */
+static struct dlg_cell **upsert_dlgs = NULL;
+static int upsert_dlgs_no = 0;
+static int upsert_dlgs_size = 0;
+
+/* keeps a dialog until the upsert queue is flushed, by holding a reference
+ * to it (its entry is not kept locked meanwhile) */
+static inline int upsert_dialog_track(struct dlg_cell *cell)
+{
+	struct dlg_cell **dlgs;
+
+	if (upsert_dlgs_no == upsert_dlgs_size) {
+		dlgs = pkg_realloc(upsert_dlgs, (upsert_dlgs_size ?
+			2 * upsert_dlgs_size : 64) * sizeof *upsert_dlgs);
+		if (!dlgs) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+		upsert_dlgs = dlgs;
+		upsert_dlgs_size = upsert_dlgs_size ? 2 * upsert_dlgs_size : 64;
+	}
+
+	ref_dlg_unsafe(cell, 1);
+	upsert_dlgs[upsert_dlgs_no++] = cell;
+	return 0;
+}
+
+/* once the upsert queue was flushed, reports the dialogs as saved or, if
+ * the flush failed, marks them as changed again, to be retried */
+static void upsert_dialogs_done(int failed, int do_lock)
+{
+	struct dlg_entry *entry;
+	struct dlg_cell *cell;
+	int i;
+
+	for (i = 0; i < upsert_dlgs_no; i++) {
+		cell = upsert_dlgs[i];
+		entry = &d_table->entries[cell->h_entry];
+		if (do_lock)
+			dlg_lock(d_table, entry);
+
+		if (failed) {
+			cell->flags |= DLG_FLAG_CHANGED;
+		} else {
+			cell->locked_by = process_no;
+			run_dlg_callbacks(DLGCB_DB_SAVED, cell, 0, DLG_DIR_NONE, -1,
+				NULL, 1, 1);
+			cell->locked_by = 0;
+		}
+
+		cell->locked_by = process_no;
+		unref_dlg_unsafe(cell, 1, entry);
+		cell->locked_by = 0;
+
+		if (do_lock)
+			dlg_unlock(d_table, entry);
+	}
+
+	upsert_dlgs_no = 0;
+}
+
+
 void dialog_update_db(unsigned int ticks, void *do_lock)
 {
 	static db_ps_t my_ps_update = NULL;
@@ -1639,8 +1781,11 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 	struct dlg_entry *entry;
 	struct dlg_cell  * cell,*next_cell;
 	unsigned char on_shutdown;
-	int callee_leg,ins_done=0;
+	int callee_leg,ins_done=0,upsert_done=0,upsert_failed=0,batched;
+	int flushed=0;
 	static query_list_t *ins_list = NULL;
+	struct timeval start;
+	long diff;
 
 	db_key_t insert_keys[DIALOG_TABLE_TOTAL_COL_NO] = {
 			&dlg_id_column,		&call_id_column,		&from_uri_column,
@@ -1659,6 +1804,8 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 		return;
 
 	on_shutdown = (ticks==0);
+	batched = dlg_db_batched_upsert();
+	gettimeofday(&start, NULL);
 
 	/*save the current dialogs information*/
 	VAL_TYPE(values) = DB_BIGINT;
@@ -1710,69 +1857,44 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 				}
 				LM_DBG("inserting new dialog %p\n",cell);
 
-				SET_BIGINT_VALUE(values, dlg_get_db_id(cell));
-				SET_STR_VALUE(values+1, cell->callid);
-				SET_STR_VALUE(values+2, cell->from_uri);
-
-				SET_STR_VALUE(values+3, cell->legs[DLG_CALLER_LEG].tag);
-				SET_STR_VALUE(values+4, cell->to_uri);
-				SET_STR_VALUE(values+5, cell->legs[callee_leg].tag);
-
-				SET_STR_VALUE(values+6, *get_socket_internal_name
-					(cell->legs[DLG_CALLER_LEG].bind_addr) );
-				if (cell->legs[callee_leg].bind_addr) {
-					SET_STR_VALUE(values+7, *get_socket_internal_name
-						(cell->legs[callee_leg].bind_addr) );
-				} else {
-					VAL_NULL(values+7) = 1;
-				}
-
-				SET_INT_VALUE(values+8,  cell->start_ts);
-
-				SET_STR_VALUE(values+9, cell->legs[DLG_CALLER_LEG].route_set);
-				SET_STR_VALUE(values+10,
-					cell->legs[callee_leg].route_set);
-
-				SET_STR_VALUE(values+11,cell->legs[callee_leg].from_uri);
-				SET_STR_VALUE(values+12,cell->legs[callee_leg].to_uri);
-
-				SET_STR_VALUE(values+13, cell->legs[DLG_CALLER_LEG].contact);
-				SET_STR_VALUE(values+14,
-					cell->legs[callee_leg].contact);
-
-				SET_INT_VALUE(values+15, cell->state);
-				SET_INT_VALUE(values+16, (unsigned int)((unsigned int)(unsigned long)time(0)
-					+ cell->tl.timeout - get_ticks()) );
-
-				SET_STR_VALUE(values+17, cell->legs[DLG_CALLER_LEG].r_cseq);
-				SET_STR_VALUE(values+18, cell->legs[callee_leg].r_cseq);
-
-				SET_INT_VALUE(values+19, cell->legs[DLG_CALLER_LEG].last_gen_cseq);
-				SET_INT_VALUE(values+20, cell->legs[callee_leg].last_gen_cseq);
+				set_dialog_row(values, cell, callee_leg, on_shutdown);
 
-				set_final_update_cols(values+21, cell, on_shutdown);
-				SET_INT_VALUE(values+25, cell->flags &
-					~(DLG_FLAG_NEW|DLG_FLAG_CHANGED|DLG_FLAG_VP_CHANGED|DLG_FLAG_DB_DELETED));
-
-				SET_ROUTE_VALUE(values+26, cell->rt_on_answer);
-				SET_ROUTE_VALUE(values+27, cell->rt_on_timeout);
-				SET_ROUTE_VALUE(values+28, cell->rt_on_hangup);
+				if (batched) {
+					/* same queue as the updates, to keep them in order; the
+					 * dialog is reported as saved after the flush */
+					if (upsert_dialog_row(insert_keys, values) != 0) {
+						LM_ERR("could not add another dialog to db - state=%d callid=%.*s\n",
+								cell->state, cell->callid.len, cell->callid.s);
+						upsert_failed = 1;
+						cell = cell->next;
+						continue;
+					}
+					upsert_done = 1;
+					flushed++;
 
-				if (con_set_inslist(&dialog_dbf, dialog_db_handle,
-						&ins_list, insert_keys, DIALOG_TABLE_TOTAL_COL_NO) < 0) {
-					CON_RESET_INSLIST(dialog_db_handle);
-				}
-				CON_SET_CURR_PS(dialog_db_handle, &my_ps_insert);
-				if((dialog_dbf.insert(dialog_db_handle, insert_keys,
-				values, DIALOG_TABLE_TOTAL_COL_NO)) !=0){
-					LM_ERR("could not add another dialog to db - state=%d callid=%.*s\n",
-							cell->state, cell->callid.len, cell->callid.s);
+					if (upsert_dialog_track(cell) == 0)
+						cell->flags &= ~(DLG_FLAG_NEW|DLG_FLAG_CHANGED|
+							DLG_FLAG_VP_CHANGED);
 					cell = cell->next;
 					continue;
-				}
+				} else {
+					if (con_set_inslist(&dialog_dbf, dialog_db_handle,
+							&ins_list, insert_keys, DIALOG_TABLE_TOTAL_COL_NO) < 0) {
+						CON_RESET_INSLIST(dialog_db_handle);
+					}
+					CON_SET_CURR_PS(dialog_db_handle, &my_ps_insert);
+					if((dialog_dbf.insert(dialog_db_handle, insert_keys,
+					values, DIALOG_TABLE_TOTAL_COL_NO)) !=0){
+						LM_ERR("could not add another dialog to db - state=%d callid=%.*s\n",
+								cell->state, cell->callid.len, cell->callid.s);
+						cell = cell->next;
+						continue;
+					}
 
-				if (ins_done==0)
-					ins_done=1;
+					if (ins_done==0)
+						ins_done=1;
+				}
+				flushed++;
 
 				/* dialog saved */
 				cell->locked_by = process_no;
@@ -1789,6 +1911,24 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 				dlg_timer_remove_from_db(cell);
 				cell=next_cell;
 				continue;
+			} else if (batched && ((cell->flags & DLG_FLAG_CHANGED)!=0 ||
+			on_shutdown || (db_flush_vp && (cell->flags & DLG_FLAG_VP_CHANGED)))){
+				LM_DBG("upserting existing dialog %p\n",cell);
+
+				set_dialog_row(values, cell, callee_leg, on_shutdown);
+
+				if (upsert_dialog_row(insert_keys, values) != 0) {
+					LM_ERR("could not update database info\n");
+					upsert_failed = 1;
+					cell = cell->next;
+					continue;
+				}
+				upsert_done = 1;
+				flushed++;
+
+				/* reported as saved after the flush */
+				if (upsert_dialog_track(cell) == 0)
+					cell->flags &= ~(DLG_FLAG_CHANGED|DLG_FLAG_VP_CHANGED);
 			} else if ( (cell->flags & DLG_FLAG_CHANGED)!=0 || on_shutdown ){
 				LM_DBG("updating existing dialog %p\n",cell);
 
@@ -1816,6 +1956,7 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 					cell = cell->next;
 					continue;
 				}
+				flushed++;
 
 				/* dialog saved */
 				cell->locked_by = process_no;
@@ -1837,6 +1978,7 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 					cell = cell->next;
 					continue;
 				}
+				flushed++;
 
 				cell->locked_by = process_no;
 				run_dlg_callbacks(DLGCB_DB_SAVED, cell, 0, DLG_DIR_NONE, -1, NULL,1, 1);
@@ -1859,7 +2001,28 @@ void dialog_update_db(unsigned int ticks, void *do_lock)
 			LM_ERR("failed to flush rows to DB\n");
 	}
 
+	if (upsert_done) {
+		LM_DBG("dlg timer attempting to flush the batched upserts\n");
+		/* the queue was already flushed each time it got full,
+		 * push the remaining rows before the deletes below */
+		if (ql_flush_rows(&dialog_dbf,dialog_db_handle,upsert_list) < 0) {
+			LM_ERR("failed to flush rows to DB\n");
+			upsert_failed = 1;
+		}
+	}
+
+	/* a failed queueing may come from a failed flush of the queue, so
+	 * any of the queued rows may be lost - retry all of them */
+	upsert_dialogs_done(upsert_failed, do_lock ? 1 : 0);
+
 	dlg_timer_flush_del();
+
+	diff = get_time_diff(&start) / 1000;
+	if_update_stat(dlg_enable_stats, db_flushed_dlgs, flushed);
+	if_update_stat(dlg_enable_stats, db_flush_batch,
+		(long)flushed - (long)get_stat_val(db_flush_batch));
+	if_update_stat(dlg_enable_stats, db_flush_time,
+		diff - (long)get_stat_val(db_flush_time));
 	return;
 }
 
@@ -1341,6 +1341,13 @@ void next_state_dlg(struct dlg_cell *dlg, int event, int dir, int *old_state,
 		raise_state_changed_event(dlg, (unsigned int)(*old_state),
 			(unsigned int)(*new_state));
 
+	/* release the ping timers of the terminated dialog without waiting
+	 * for its next ping */
+	if (*new_state==DLG_STATE_DELETED && *old_state!=DLG_STATE_DELETED) {
+		expire_ping_timer(dlg);
+		expire_reinvite_ping_timer(dlg);
+	}
+
 	 if (dialog_repl_cluster && replicate_events &&
 	(*old_state==DLG_STATE_CONFIRMED_NA || *old_state==DLG_STATE_CONFIRMED) &&
 	*new_state==DLG_STATE_DELETED )
@@ -131,6 +131,17 @@ struct dlg_leg {
 #define TOPOH_KEEP_ADV_A  (1 << 5)
 #define TOPOH_KEEP_ADV_B  (1 << 6)
 
+/* groups of fields shipped by the delta replication */
+#define DLG_REPL_FIELDS    9
+
+struct dlg_repl_state
+{
+	unsigned int         ver;    /* version of the last replicated change */
+	unsigned int         valid;  /* hash[] matches the state of the peers */
+	unsigned int         resync; /* no new resync request until this tick */
+	unsigned int         hash[DLG_REPL_FIELDS];
+};
+
 struct dlg_cell
 {
 	volatile int         ref;
@@ -155,6 +166,7 @@ struct dlg_cell
 	unsigned int         initial_t_hash_index;
 	unsigned int         initial_t_label;
 	unsigned int         replicated; /* indicates if the dialog is replicated */
+	struct dlg_repl_state repl;      /* delta replication state */
 	unsigned int         del_delay; /* if any custom delay should be done
 	                                 * when deleting this dialog */
 	struct dlg_tl        tl;
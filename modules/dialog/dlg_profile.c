@@ -51,6 +51,7 @@ str cdb_val_prefix = str_init("dlg_val_");
 str cdb_noval_prefix = str_init("dlg_noval_");
 str cdb_size_prefix = str_init("dlg_size_");
 int profile_timeout = 60 * 60 * 24;      /* 24 hours */
+int profile_atomic_counters = 0;
 str dlg_prof_val_buf = {0, 0};
 str dlg_prof_noval_buf = {0, 0};
 str dlg_prof_size_buf = {0, 0};
@@ -429,6 +430,36 @@ struct dlg_profile_table* search_dlg_profile(str *name)
 	return NULL;
 }
 
+/* the local dialogs of a profile can be counted by the atomic counters only
+ * if they are not kept in CacheDB and not split per sharing tag */
+#define prof_atomic_capable(_repl_type) \
+	((_repl_type) != REPL_CACHEDB && \
+	!((_repl_type) == REPL_PROTOBIN && profile_repl_cluster))
+
+static inline void prof_atomic_update(struct dlg_profile_table *profile,
+		long n)
+{
+	union prof_atomic_count *cnt;
+
+	/* each process updates its own slot, so no cache line is shared
+	 * between the processes; the slots are only summed when read */
+	cnt = &profile->atomic_counters[process_no & (DLG_PROF_CNT_SLOTS-1)];
+	atomic_fetch_add(&cnt->n, n);
+}
+
+static inline int prof_atomic_count(struct dlg_profile_table *profile)
+{
+	unsigned long n = 0;
+	int i;
+
+	/* a slot may wrap below zero (a dialog may be unlinked by a different
+	 * process than the one linking it), but the sum is still accurate */
+	for (i = 0; i < DLG_PROF_CNT_SLOTS; i++)
+		n += atomic_load(&profile->atomic_counters[i].n);
+
+	return (int)(long)n;
+}
+
 static struct dlg_profile_table* new_dlg_profile( str *name, unsigned int size,
 		unsigned int has_value, unsigned repl_type)
 {
@@ -488,6 +519,23 @@ static struct dlg_profile_table* new_dlg_profile( str *name, unsigned int size,
 		}
 	}
 
+	if (profile_atomic_counters && prof_atomic_capable(repl_type)) {
+		profile->atomic_counters_block = shm_malloc(DLG_PROF_CACHE_LINE +
+			DLG_PROF_CNT_SLOTS * sizeof(union prof_atomic_count));
+		if (!profile->atomic_counters_block) {
+			LM_ERR("no more shm mem\n");
+			shm_free(profile);
+			return NULL;
+		}
+		memset(profile->atomic_counters_block, 0, DLG_PROF_CACHE_LINE +
+			DLG_PROF_CNT_SLOTS * sizeof(union prof_atomic_count));
+
+		/* start the slots on a cache line boundary */
+		profile->atomic_counters = (union prof_atomic_count *)
+			(((unsigned long)profile->atomic_counters_block +
+			DLG_PROF_CACHE_LINE - 1) & ~(unsigned long)(DLG_PROF_CACHE_LINE - 1));
+	}
+
 	if( repl_type == REPL_CACHEDB ) {
 
 		profile->name.s = (char *)(profile + 1);
@@ -538,6 +586,9 @@ static void destroy_dlg_profile(struct dlg_profile_table *profile)
 			map_destroy( profile->entries[i], free_profile_val);
 	}
 
+	if (profile->atomic_counters_block)
+		shm_free(profile->atomic_counters_block);
+
 	shm_free( profile );
 	return;
 }
@@ -643,6 +694,12 @@ static void destroy_linker(struct dlg_profile_link *l, struct dlg_cell *dlg,
 	int repl_remove = 0;
 
 	if (!(l->profile->repl_type==REPL_CACHEDB)) {
+		if (l->profile->atomic_counters && !l->profile->has_value) {
+			/* no value - the atomic counter is all we need */
+			prof_atomic_update(l->profile, -1);
+			return;
+		}
+
 		lock_set_get( l->profile->locks, l->hash_idx);
 
 		if( l->profile->has_value)
@@ -653,6 +710,8 @@ static void destroy_linker(struct dlg_profile_link *l, struct dlg_cell *dlg,
 			{
 				prof_val_local_dec(dest, &dlg->shtag,
 					l->profile->repl_type==REPL_PROTOBIN);
+				if (l->profile->atomic_counters)
+					prof_atomic_update(l->profile, -1);
 
 				if( *dest == 0 )
 				{
@@ -766,6 +825,12 @@ static int link_dlg_profile(struct dlg_profile_link *linker,
 		hash = calc_hash_profile(&linker->value, dlg, profile);
 		linker->hash_idx = hash;
 
+		if (profile->atomic_counters && !profile->has_value) {
+			/* no value - the atomic counter is all we need */
+			prof_atomic_update(profile, 1);
+			goto link;
+		}
+
 		lock_set_get(profile->locks, hash);
 
 		LM_DBG("Entered here with hash = %d \n",hash);
@@ -780,6 +845,8 @@ static int link_dlg_profile(struct dlg_profile_link *linker,
 
 			prof_val_local_inc(dest, &dlg->shtag,
 				profile->repl_type == REPL_PROTOBIN);
+			if (profile->atomic_counters)
+				prof_atomic_update(profile, 1);
 		}
 		else {
 			if (profile->repl_type == REPL_PROTOBIN && profile_repl_cluster) {
@@ -837,6 +904,7 @@ static int link_dlg_profile(struct dlg_profile_link *linker,
 		}
 	}
 
+link:
 	/* link the profile into the dialog */
 	d_entry = &d_table->entries[dlg->h_entry];
 
@@ -1092,6 +1160,9 @@ unsigned int get_profile_size(struct dlg_profile_table *profile, str *value)
 					goto failed;
 				}
 
+			} else if (profile->atomic_counters) {
+				/* the total is maintained, no need to walk the values */
+				n = prof_atomic_count(profile);
 			} else {
 
 				for( i=0; i<profile->size; i++ )
@@ -1168,6 +1239,9 @@ int noval_get_local_count(struct dlg_profile_table *profile)
 	struct prof_local_count *cnt;
 	int rc;
 
+	if (profile->atomic_counters)
+		return prof_atomic_count(profile);
+
 	for (i = 0; i < profile->size; i++) {
 		lock_set_get(profile->locks, i);
 
@@ -26,6 +26,7 @@
 
 #include "../../parser/msg_parser.h"
 #include "../../locking.h"
+#include "../../atomic.h"
 #include "../../str.h"
 
 
@@ -53,6 +54,17 @@ struct prof_local_count {
 	struct prof_local_count *next;
 };
 
+/* number of (per-process) atomic counters of a profile - power of 2 */
+#define DLG_PROF_CNT_SLOTS   32
+#define DLG_PROF_CACHE_LINE  64
+
+/* padded to a full cache line, so that the processes updating different
+ * slots do not keep invalidating each other's cache */
+union prof_atomic_count {
+	atomic_t n;
+	char _pad[DLG_PROF_CACHE_LINE];
+};
+
 enum repl_types {REPL_NONE=0, REPL_CACHEDB=1, REPL_PROTOBIN};
 struct dlg_profile_table {
 	str name;
@@ -73,6 +85,13 @@ struct dlg_profile_table {
 	struct prof_local_count **noval_local_counters;
 	struct prof_rcv_count *noval_rcv_counters;
 
+	/*
+	 * lockless mode (profile_atomic_counters) - the number of local dialogs
+	 * in the profile, spread over DLG_PROF_CNT_SLOTS per-process counters
+	 */
+	union prof_atomic_count *atomic_counters;
+	void *atomic_counters_block;
+
 	struct dlg_profile_table *next;
 };
 
@@ -150,6 +169,8 @@ mi_response_t *mi_profile_terminate_2(const mi_params_t *params,
 
 void get_value_names(struct dlg_profile_table *profile, struct dlg_profile_value_name *);
 
+extern int profile_atomic_counters;
+
 /* cachedb interface */
 extern str cdb_val_prefix;
 extern str cdb_noval_prefix;
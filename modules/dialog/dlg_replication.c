@@ -115,6 +115,105 @@ not_found:
 	return 0;
 }
 
+/* groups of fields shipped by the delta updates (see DLG_REPL_FIELDS) */
+enum dlg_delta_field {
+	DLG_DELTA_STATE = 0,
+	DLG_DELTA_CSEQ,
+	DLG_DELTA_CONTACT,
+	DLG_DELTA_SDP,
+	DLG_DELTA_VARS,
+	DLG_DELTA_PROFILES,
+	DLG_DELTA_FLAGS,
+	DLG_DELTA_TIMEOUT,
+	DLG_DELTA_ROUTES,
+};
+
+#define DLG_DELTA_BIT(_f) (1 << DLG_DELTA_ ## _f)
+
+/* ticks to wait for a full update before re-requesting a resync */
+#define DLG_RESYNC_INTERVAL 2
+
+/* the dialog flags that are replicated */
+#define dlg_repl_flags(_dlg) \
+	((_dlg)->flags & ~(DLG_FLAG_NEW|DLG_FLAG_CHANGED| \
+		DLG_FLAG_VP_CHANGED|DLG_FLAG_FROM_DB|DLG_FLAG_SYNCED))
+
+#define dlg_repl_timeout(_dlg) \
+	((unsigned int)(unsigned long)time(0) + (_dlg)->tl.timeout - get_ticks())
+
+#define DELTA_HASH_INIT 2166136261u
+
+static inline unsigned int delta_hash(unsigned int h, const void *p, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		h = (h ^ ((const unsigned char *)p)[i]) * 16777619u;
+	return h;
+}
+
+static inline unsigned int delta_hash_str(unsigned int h, const str *s)
+{
+	int len = (s && s->s) ? s->len : 0;
+
+	h = delta_hash(h, &len, sizeof len);
+	return len ? delta_hash(h, s->s, len) : h;
+}
+
+static inline unsigned int delta_hash_int(unsigned int h, unsigned int v)
+{
+	return delta_hash(h, &v, sizeof v);
+}
+
+static inline unsigned int delta_hash_route(unsigned int h,
+												struct script_route_ref *ref)
+{
+	return delta_hash_str(h, ref ? &ref->name : NULL);
+}
+
+/* computes the hash of a group of replicated fields, as currently found
+ * in the dialog; the state and the timeout are kept as they are */
+static unsigned int delta_hash_field(struct dlg_cell *dlg, int field,
+												str *vars, str *profiles)
+{
+	int callee_leg = callee_idx(dlg);
+	unsigned int h = DELTA_HASH_INIT;
+
+	switch (field) {
+	case DLG_DELTA_STATE:
+		return dlg->state;
+	case DLG_DELTA_CSEQ:
+		h = delta_hash_str(h, &dlg->legs[DLG_CALLER_LEG].r_cseq);
+		return delta_hash_str(h, &dlg->legs[callee_leg].r_cseq);
+	case DLG_DELTA_CONTACT:
+		h = delta_hash_str(h, &dlg->legs[DLG_CALLER_LEG].contact);
+		return delta_hash_str(h, &dlg->legs[callee_leg].contact);
+	case DLG_DELTA_SDP:
+		h = delta_hash_str(h, &dlg->legs[DLG_CALLER_LEG].in_sdp);
+		h = delta_hash_str(h, &dlg->legs[DLG_CALLER_LEG].out_sdp);
+		h = delta_hash_str(h, &dlg->legs[callee_leg].in_sdp);
+		return delta_hash_str(h, &dlg->legs[callee_leg].out_sdp);
+	case DLG_DELTA_VARS:
+		return delta_hash_str(h, vars);
+	case DLG_DELTA_PROFILES:
+		return delta_hash_str(h, profiles);
+	case DLG_DELTA_FLAGS:
+		h = delta_hash_int(h, dlg->user_flags);
+		h = delta_hash_int(h, dlg->mod_flags);
+		return delta_hash_int(h, dlg_repl_flags(dlg));
+	case DLG_DELTA_TIMEOUT:
+		return dlg_repl_timeout(dlg);
+	case DLG_DELTA_ROUTES:
+		h = delta_hash_route(h, dlg->rt_on_answer);
+		h = delta_hash_route(h, dlg->rt_on_timeout);
+		return delta_hash_route(h, dlg->rt_on_hangup);
+	}
+
+	return h;
+}
+
+static int dlg_request_resync(int node_id, str *call_id, unsigned int h_id);
+
 int dlg_init_clustering(void)
 {
 	/* check params and register to clusterer for dialogs and
@@ -579,6 +678,11 @@ int dlg_replicated_update(bin_packet_t *packet)
 
 	dlg->flags |= DLG_FLAG_VP_CHANGED;
 
+	/* a full update is the new base for the delta updates */
+	dlg->repl.ver = 0;
+	dlg->repl.valid = 0;
+	dlg->repl.resync = 0;
+
 	ref_dlg_unsafe(dlg, 1);
 	dlg_unlock(d_table, d_entry);
 
@@ -593,6 +697,252 @@ error:
 	return -1;
 }
 
+/* the resyncs requested by this process for unknown dialogs */
+#define DLG_UNKNOWN_RESYNC_SLOTS 64
+static struct {
+	unsigned int h_entry;
+	unsigned int h_id;
+	unsigned int expires;
+} unknown_resync[DLG_UNKNOWN_RESYNC_SLOTS];
+
+/**
+ * returns 1 if a resync for the unknown dialog was recently requested,
+ * otherwise it records the request and returns 0
+ */
+static int unknown_resync_pending(unsigned int h_entry, unsigned int h_id)
+{
+	unsigned int now = get_ticks();
+	int i = (h_entry ^ h_id) % DLG_UNKNOWN_RESYNC_SLOTS;
+
+	if (unknown_resync[i].h_entry == h_entry &&
+	unknown_resync[i].h_id == h_id && now < unknown_resync[i].expires)
+		return 1;
+
+	unknown_resync[i].h_entry = h_entry;
+	unknown_resync[i].h_id = h_id;
+	unknown_resync[i].expires = now + DLG_RESYNC_INTERVAL;
+	return 0;
+}
+
+/**
+ * applies the fields shipped by a delta update of a dialog; if a previous
+ * delta was lost (version gap), a full update is requested from the sender
+ */
+int dlg_replicated_delta(bin_packet_t *packet)
+{
+	struct dlg_cell *dlg;
+	struct dlg_entry *d_entry;
+	str call_id, st, vars = STR_NULL, profiles = STR_NULL;
+	unsigned int h_id, ver, mask, timeout;
+	int h_entry, callee_leg, rcv_flags, save_new_flag, save_sync_flag;
+
+	DLG_BIN_POP(str, packet, call_id, malformed);
+	DLG_BIN_POP(int, packet, h_id, malformed);
+	DLG_BIN_POP(int, packet, ver, malformed);
+	DLG_BIN_POP(int, packet, mask, malformed);
+
+	h_entry = dlg_hash(&call_id);
+	d_entry = &d_table->entries[h_entry];
+
+	dlg_lock(d_table, d_entry);
+
+	dlg = lookup_dlg_unsafe(h_entry, h_id);
+	if (!dlg) {
+		dlg_unlock(d_table, d_entry);
+		LM_DBG("delta update for unknown dialog %.*s [%u:%u]\n",
+			call_id.len, call_id.s, h_entry, h_id);
+		/* the dialog will come with the sync data */
+		if (*dlg_sync_in_progress)
+			return 0;
+		/* a resync is already on the way */
+		if (unknown_resync_pending(h_entry, h_id))
+			return 0;
+		return dlg_request_resync(packet->src_id, &call_id, h_id);
+	}
+
+	/* discard an update for a deleted dialog */
+	if (dlg->state == DLG_STATE_DELETED) {
+		dlg_unlock(d_table, d_entry);
+		return 0;
+	}
+
+	if (ver != dlg->repl.ver + 1) {
+		LM_DBG("delta update %u for dialog %.*s, expecting %u\n",
+			ver, call_id.len, call_id.s, dlg->repl.ver + 1);
+		/* a resync is already on the way */
+		if (dlg->repl.resync && get_ticks() < dlg->repl.resync) {
+			dlg_unlock(d_table, d_entry);
+			return 0;
+		}
+		dlg->repl.resync = get_ticks() + DLG_RESYNC_INTERVAL;
+		dlg_unlock(d_table, d_entry);
+		return dlg_request_resync(packet->src_id, &call_id, h_id);
+	}
+
+	dlg->repl.ver = ver;
+	callee_leg = callee_idx(dlg);
+
+	if (mask & DLG_DELTA_BIT(STATE)) {
+		DLG_BIN_POP(int, packet, dlg->state, error);
+		dlg->repl.hash[DLG_DELTA_STATE] = dlg->state;
+	}
+
+	if (mask & DLG_DELTA_BIT(CSEQ)) {
+		DLG_BIN_POP(str, packet, st, error);
+		if (dlg_update_cseq(dlg, DLG_CALLER_LEG, &st, 0) != 0) {
+			LM_ERR("failed to update caller cseq\n");
+			goto error;
+		}
+		DLG_BIN_POP(str, packet, st, error);
+		if (dlg_update_cseq(dlg, callee_leg, &st, 0) != 0) {
+			LM_ERR("failed to update callee cseq\n");
+			goto error;
+		}
+		dlg->repl.hash[DLG_DELTA_CSEQ] =
+			delta_hash_field(dlg, DLG_DELTA_CSEQ, NULL, NULL);
+	}
+
+	if (mask & DLG_DELTA_BIT(CONTACT)) {
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[DLG_CALLER_LEG].contact, &st);
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[callee_leg].contact, &st);
+		dlg->repl.hash[DLG_DELTA_CONTACT] =
+			delta_hash_field(dlg, DLG_DELTA_CONTACT, NULL, NULL);
+	}
+
+	if (mask & DLG_DELTA_BIT(SDP)) {
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[DLG_CALLER_LEG].in_sdp, &st);
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[DLG_CALLER_LEG].out_sdp, &st);
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[callee_leg].in_sdp, &st);
+		DLG_BIN_POP(str, packet, st, error);
+		shm_str_sync(&dlg->legs[callee_leg].out_sdp, &st);
+		dlg->repl.hash[DLG_DELTA_SDP] =
+			delta_hash_field(dlg, DLG_DELTA_SDP, NULL, NULL);
+	}
+
+	if (mask & DLG_DELTA_BIT(VARS)) {
+		DLG_BIN_POP(str, packet, vars, error);
+		dlg->repl.hash[DLG_DELTA_VARS] =
+			delta_hash_field(dlg, DLG_DELTA_VARS, &vars, NULL);
+	}
+
+	if (mask & DLG_DELTA_BIT(PROFILES)) {
+		DLG_BIN_POP(str, packet, profiles, error);
+		dlg->repl.hash[DLG_DELTA_PROFILES] =
+			delta_hash_field(dlg, DLG_DELTA_PROFILES, NULL, &profiles);
+	}
+
+	if (mask & DLG_DELTA_BIT(FLAGS)) {
+		DLG_BIN_POP(int, packet, dlg->user_flags, error);
+		DLG_BIN_POP(int, packet, dlg->mod_flags, error);
+		DLG_BIN_POP(int, packet, rcv_flags, error);
+		/* same as for the full updates, keep the local-only flags */
+		save_new_flag = dlg->flags & DLG_FLAG_NEW;
+		save_sync_flag = dlg->flags & DLG_FLAG_SYNCED;
+		dlg->flags = rcv_flags;
+		dlg->flags |= ((save_new_flag ? DLG_FLAG_NEW : 0) |
+			(save_sync_flag ? DLG_FLAG_SYNCED : 0));
+		dlg->repl.hash[DLG_DELTA_FLAGS] =
+			delta_hash_field(dlg, DLG_DELTA_FLAGS, NULL, NULL);
+	}
+
+	if (mask & DLG_DELTA_BIT(TIMEOUT)) {
+		DLG_BIN_POP(int, packet, timeout, error);
+		dlg->repl.hash[DLG_DELTA_TIMEOUT] = timeout;
+
+		timeout -= time(0);
+		if (dlg->lifetime != timeout) {
+			dlg->lifetime = timeout;
+			switch (update_dlg_timer(&dlg->tl, dlg->lifetime) ) {
+			case -1:
+				LM_ERR("failed to update dialog lifetime!\n");
+				/* continue */
+			case 0:
+				/* timeout value was updated */
+				break;
+			case 1:
+				/* dlg inserted in timer list with new expire (reference it)*/
+				ref_dlg_unsafe(dlg,1);
+			}
+		}
+	}
+
+	if (mask & DLG_DELTA_BIT(ROUTES)) {
+		DLG_BIN_POP_ROUTE( packet, dlg, on_answer, error);
+		DLG_BIN_POP_ROUTE( packet, dlg, on_timeout, error);
+		DLG_BIN_POP_ROUTE( packet, dlg, on_hangup, error);
+		dlg->repl.hash[DLG_DELTA_ROUTES] =
+			delta_hash_field(dlg, DLG_DELTA_ROUTES, NULL, NULL);
+	}
+
+	if (vars.s && vars.len != 0) {
+		read_dialog_vars(vars.s, vars.len, dlg);
+		run_dlg_callbacks(DLGCB_PROCESS_VARS, dlg,
+				NULL, DLG_DIR_NONE, -1, NULL, 1, 0);
+	}
+
+	dlg->flags |= DLG_FLAG_CHANGED;
+	if (mask & (DLG_DELTA_BIT(VARS)|DLG_DELTA_BIT(PROFILES)))
+		dlg->flags |= DLG_FLAG_VP_CHANGED;
+
+	ref_dlg_unsafe(dlg, 1);
+	dlg_unlock(d_table, d_entry);
+
+	if (profiles.s && profiles.len != 0)
+		read_dialog_profiles(profiles.s, profiles.len, dlg, 1, 1);
+
+	unref_dlg(dlg, 1);
+	return 0;
+
+error:
+	/* partially applied, get back in sync with a full update */
+	dlg->repl.resync = get_ticks() + DLG_RESYNC_INTERVAL;
+	dlg_unlock(d_table, d_entry);
+	dlg_request_resync(packet->src_id, &call_id, h_id);
+	return -1;
+malformed:
+	return -1;
+}
+
+/**
+ * a node detected a gap in the delta updates of one of our dialogs,
+ * so broadcast a full update of the dialog, as the new base
+ */
+int dlg_replicated_resync(bin_packet_t *packet)
+{
+	struct dlg_cell *dlg;
+	str call_id;
+	unsigned int h_id;
+
+	DLG_BIN_POP(str, packet, call_id, malformed);
+	DLG_BIN_POP(int, packet, h_id, malformed);
+
+	dlg = lookup_dlg(dlg_hash(&call_id), h_id, 1);
+	if (!dlg) {
+		LM_DBG("resync requested for unknown dialog %.*s\n",
+			call_id.len, call_id.s);
+		return 0;
+	}
+
+	LM_DBG("node %d requested the resync of dialog %.*s\n",
+		packet->src_id, call_id.len, call_id.s);
+
+	dlg_lock_dlg(dlg);
+	dlg->repl.valid = 0;
+	dlg_unlock_dlg(dlg);
+
+	replicate_dialog_updated(dlg);
+
+	unref_dlg(dlg, 1);
+	return 0;
+malformed:
+	return -1;
+}
+
 /**
  * replicates the remote deletion of a dialog locally
  * by reading the relevant information using the Binary Packet Interface
@@ -801,11 +1151,38 @@ do { \
 	} \
 } while(0)
 
-void bin_push_dlg(bin_packet_t *packet, struct dlg_cell *dlg)
+/* lets the modules write their values/profiles, then serializes them */
+static void dlg_write_vp(struct dlg_cell *dlg, str **vars, str **profiles)
 {
-	int callee_leg;
-	str *vars, *profiles;
 	int_str isval;
+	int rc;
+
+	/* give modules the chance to write values/profiles before replicating */
+	run_dlg_callbacks(DLGCB_WRITE_VP, dlg, NULL, DLG_DIR_NONE, -1, NULL, 1, 1);
+
+	/* save sharing tag name as dlg val; it is shipped with the rest of the
+	 * vars, so no need to replicate it separately */
+	if (dlg->shtag.s) {
+		isval.s = dlg->shtag;
+		lock_start_write(dlg->vals_lock);
+		rc = store_dlg_value_unsafe(dlg, &shtag_dlg_val, &isval,
+			DLG_VAL_TYPE_STR);
+		lock_stop_write(dlg->vals_lock);
+		if (rc < 0)
+			LM_ERR("Failed to store sharing tag %.*s(%p) as dlg val\n",
+			       dlg->shtag.len, dlg->shtag.s, dlg->shtag.s);
+	}
+
+	*vars = write_dialog_vars(dlg);
+	*profiles = write_dialog_profiles(dlg->profile_links);
+}
+
+/* pushes the full dialog; if @snapshot is set, the pushed state becomes
+ * the base for the next delta updates of the dialog */
+void bin_push_dlg(bin_packet_t *packet, struct dlg_cell *dlg, int snapshot)
+{
+	int callee_leg, i;
+	str *vars, *profiles;
 
 	callee_leg = callee_idx(dlg);
 
@@ -843,32 +1220,98 @@ void bin_push_dlg(bin_packet_t *packet, struct dlg_cell *dlg)
 	bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].adv_contact);
 	bin_push_str(packet, &dlg->legs[callee_leg].adv_contact);
 
-	/* give modules the chance to write values/profiles before replicating */
-	run_dlg_callbacks(DLGCB_WRITE_VP, dlg, NULL, DLG_DIR_NONE, -1, NULL, 1, 1);
-
-   /* save sharing tag name as dlg val */
-	isval.s = dlg->shtag;
-	if (dlg->shtag.s && store_dlg_value(dlg, &shtag_dlg_val, &isval,
-		DLG_VAL_TYPE_STR) < 0)
-		LM_ERR("Failed to store sharing tag %.*s(%p) as dlg val\n",
-		       dlg->shtag.len, dlg->shtag.s, dlg->shtag.s);
-
-	vars = write_dialog_vars(dlg);
-	profiles = write_dialog_profiles(dlg->profile_links);
+	dlg_write_vp(dlg, &vars, &profiles);
 
 	bin_push_str(packet, vars);
 	bin_push_str(packet, profiles);
 	bin_push_int(packet, dlg->user_flags);
 	bin_push_int(packet, dlg->mod_flags);
-	bin_push_int(packet, dlg->flags & ~(DLG_FLAG_NEW|DLG_FLAG_CHANGED|
-		DLG_FLAG_VP_CHANGED|DLG_FLAG_FROM_DB|DLG_FLAG_SYNCED));
-	bin_push_int(packet, (unsigned int)(unsigned long)time(0) + dlg->tl.timeout - get_ticks());
+	bin_push_int(packet, dlg_repl_flags(dlg));
+	bin_push_int(packet, dlg_repl_timeout(dlg));
 	bin_push_int(packet, dlg->legs[DLG_CALLER_LEG].last_gen_cseq);
 	bin_push_int(packet, dlg->legs[callee_leg].last_gen_cseq);
 
 	DLG_BIN_PUSH_ROUTE( packet, dlg, on_answer);
 	DLG_BIN_PUSH_ROUTE( packet, dlg, on_timeout);
 	DLG_BIN_PUSH_ROUTE( packet, dlg, on_hangup);
+
+	if (snapshot && dialog_repl_delta) {
+		for (i = 0; i < DLG_REPL_FIELDS; i++)
+			dlg->repl.hash[i] = delta_hash_field(dlg, i, vars, profiles);
+		dlg->repl.ver = 0;
+		dlg->repl.valid = 1;
+	}
+}
+
+/* pushes only the groups of fields changed since the last replicated
+ * state of the dialog; returns 0 if nothing changed */
+static int bin_push_dlg_delta(bin_packet_t *packet, struct dlg_cell *dlg)
+{
+	unsigned int h[DLG_REPL_FIELDS], mask = 0;
+	int callee_leg, i;
+	str *vars, *profiles;
+
+	callee_leg = callee_idx(dlg);
+
+	dlg_write_vp(dlg, &vars, &profiles);
+
+	for (i = 0; i < DLG_REPL_FIELDS; i++) {
+		h[i] = delta_hash_field(dlg, i, vars, profiles);
+		if (h[i] != dlg->repl.hash[i])
+			mask |= 1 << i;
+	}
+
+	/* the computed timeout may drift with one second, due to rounding */
+	if ((mask & DLG_DELTA_BIT(TIMEOUT)) &&
+			h[DLG_DELTA_TIMEOUT] - dlg->repl.hash[DLG_DELTA_TIMEOUT] + 1 <= 2)
+		mask &= ~DLG_DELTA_BIT(TIMEOUT);
+
+	if (!mask)
+		return 0;
+
+	bin_push_str(packet, &dlg->callid);
+	bin_push_int(packet, dlg->h_id);
+	bin_push_int(packet, ++dlg->repl.ver);
+	bin_push_int(packet, mask);
+
+	if (mask & DLG_DELTA_BIT(STATE))
+		bin_push_int(packet, dlg->state);
+	if (mask & DLG_DELTA_BIT(CSEQ)) {
+		bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].r_cseq);
+		bin_push_str(packet, &dlg->legs[callee_leg].r_cseq);
+	}
+	if (mask & DLG_DELTA_BIT(CONTACT)) {
+		bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].contact);
+		bin_push_str(packet, &dlg->legs[callee_leg].contact);
+	}
+	if (mask & DLG_DELTA_BIT(SDP)) {
+		bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].in_sdp);
+		bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].out_sdp);
+		bin_push_str(packet, &dlg->legs[callee_leg].in_sdp);
+		bin_push_str(packet, &dlg->legs[callee_leg].out_sdp);
+	}
+	if (mask & DLG_DELTA_BIT(VARS))
+		bin_push_str(packet, vars);
+	if (mask & DLG_DELTA_BIT(PROFILES))
+		bin_push_str(packet, profiles);
+	if (mask & DLG_DELTA_BIT(FLAGS)) {
+		bin_push_int(packet, dlg->user_flags);
+		bin_push_int(packet, dlg->mod_flags);
+		bin_push_int(packet, dlg_repl_flags(dlg));
+	}
+	if (mask & DLG_DELTA_BIT(TIMEOUT))
+		bin_push_int(packet, h[DLG_DELTA_TIMEOUT]);
+	if (mask & DLG_DELTA_BIT(ROUTES)) {
+		DLG_BIN_PUSH_ROUTE( packet, dlg, on_answer);
+		DLG_BIN_PUSH_ROUTE( packet, dlg, on_timeout);
+		DLG_BIN_PUSH_ROUTE( packet, dlg, on_hangup);
+	}
+
+	for (i = 0; i < DLG_REPL_FIELDS; i++)
+		if (mask & (1 << i))
+			dlg->repl.hash[i] = h[i];
+
+	return 1;
 }
 
 /*  Binary Packet sending functions   */
@@ -923,7 +1366,7 @@ void replicate_dialog_created(struct dlg_cell *dlg)
 	if (dlg_has_reinvite_pinging(dlg) && persist_reinvite_pinging(dlg))
 		LM_ERR("failed to persist Re-INVITE pinging info\n");
 
-	bin_push_dlg(&packet, dlg);
+	bin_push_dlg(&packet, dlg, 1);
 
 	dlg->replicated = 1;
 
@@ -953,6 +1396,7 @@ no_send:
 void replicate_dialog_updated(struct dlg_cell *dlg)
 {
 	bin_packet_t packet;
+	int delta;
 
 	dlg_lock_dlg(dlg);
 	if (dlg->state < DLG_STATE_CONFIRMED_NA) {
@@ -967,13 +1411,24 @@ void replicate_dialog_updated(struct dlg_cell *dlg)
 		goto end;
 	}
 
-	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_UPDATED, BIN_VERSION, 0) != 0)
+	/* ship only the changes, if the peers know the previous state */
+	delta = dialog_repl_delta && dlg->repl.valid;
+
+	if (bin_init(&packet, &dlg_repl_cap, delta ?
+			REPLICATION_DLG_DELTA : REPLICATION_DLG_UPDATED, BIN_VERSION, 0) != 0)
 		goto init_error;
 
 	if (dlg_has_reinvite_pinging(dlg) && persist_reinvite_pinging(dlg))
 		LM_ERR("failed to persist Re-INVITE pinging info\n");
 
-	bin_push_dlg(&packet, dlg);
+	if (!delta) {
+		bin_push_dlg(&packet, dlg, 1);
+	} else if (bin_push_dlg_delta(&packet, dlg) == 0) {
+		LM_DBG("nothing changed for %p (%.*s)\n",
+			dlg, dlg->callid.len, dlg->callid.s);
+		bin_free_packet(&packet);
+		goto end;
+	}
 
 	dlg->replicated = 1;
 
@@ -986,6 +1441,8 @@ void replicate_dialog_updated(struct dlg_cell *dlg)
 	return;
 
 error:
+	/* the peers may have missed this state, send it in full next time */
+	dlg->repl.valid = 0;
 	LM_ERR("Failed to replicate updated dialog\n");
 	bin_free_packet(&packet);
 	return;
@@ -1091,6 +1548,34 @@ error:
 	LM_ERR("Failed to replicate dialog values\n");
 }
 
+/**
+ * asks the node that sent a delta update for a full update of the dialog
+ */
+static int dlg_request_resync(int node_id, str *call_id, unsigned int h_id)
+{
+	bin_packet_t packet;
+
+	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_RESYNC,
+			BIN_VERSION, 512) != 0)
+		goto error;
+
+	bin_push_str(&packet, call_id);
+	bin_push_int(&packet, h_id);
+
+	if (clusterer_api.send_to(&packet, dialog_repl_cluster, node_id) !=
+			CLUSTERER_SEND_SUCCESS) {
+		bin_free_packet(&packet);
+		goto error;
+	}
+
+	bin_free_packet(&packet);
+	return 0;
+error:
+	LM_ERR("Failed to request the resync of dialog %.*s from node %d\n",
+		call_id->len, call_id->s, node_id);
+	return -1;
+}
+
 #undef DLG_CLUSTER_SEND
 
 void receive_dlg_repl(bin_packet_t *pkt)
@@ -1137,6 +1622,18 @@ void receive_dlg_repl(bin_packet_t *pkt)
 		dlg_event_is_replicated = 1;
 		rc = dlg_replicated_value(pkt);
 		break;
+	case REPLICATION_DLG_DELTA:
+		ensure_bin_version(pkt, BIN_VERSION);
+
+		dlg_event_is_replicated = 1;
+		rc = dlg_replicated_delta(pkt);
+		if_update_stat(dlg_enable_stats, update_recv, 1);
+		break;
+	case REPLICATION_DLG_RESYNC:
+		ensure_bin_version(pkt, BIN_VERSION);
+
+		rc = dlg_replicated_resync(pkt);
+		break;
 	case SYNC_PACKET_TYPE:
 		if (ver != DLG_BIN_V3)
 			ensure_bin_version(pkt, BIN_VERSION);
@@ -1179,7 +1676,7 @@ static int receive_sync_request(int node_id)
 			if (!sync_packet)
 				goto error;
 
-			bin_push_dlg(sync_packet, dlg);
+			bin_push_dlg(sync_packet, dlg, 0);
 		}
 		dlg_unlock(d_table, &(d_table->entries[i]));
 	}
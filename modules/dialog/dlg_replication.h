@@ -33,6 +33,8 @@
 #define REPLICATION_DLG_DELETED		3
 #define REPLICATION_DLG_CSEQ		4
 #define REPLICATION_DLG_VALUE		5
+#define REPLICATION_DLG_DELTA		6
+#define REPLICATION_DLG_RESYNC		7
 
 #define DLG_BIN_V3      3
 #define DLG_BIN_V4      4
@@ -40,6 +42,7 @@
 #define BIN_VERSION DLG_BIN_V4
 
 extern int dialog_repl_cluster;
+extern int dialog_repl_delta;
 extern int profile_repl_cluster;
 
 extern str dlg_repl_cap;
@@ -63,6 +66,8 @@ int dlg_replicated_create(bin_packet_t *packet, struct dlg_cell *cell,
 	str *ftag, str *ttag, unsigned int hid, int safe, int from_sync);
 int dlg_replicated_update(bin_packet_t *packet);
 int dlg_replicated_delete(bin_packet_t *packet);
+int dlg_replicated_delta(bin_packet_t *packet);
+int dlg_replicated_resync(bin_packet_t *packet);
 
 void receive_dlg_repl(bin_packet_t *packet);
 void rcv_cluster_event(enum clusterer_event ev, int node_id);
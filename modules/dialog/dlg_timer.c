@@ -27,14 +27,16 @@
 #include "dlg_req_within.h"
 #include "dlg_replication.h"
 
+/* each timer is an array of "dlg_timer_shards" wheels, a dialog being
+ * handled by the wheel given by its hash entry */
 struct dlg_timer *d_timer = 0;
 dlg_timer_handler timer_hdl = 0;
 
 struct dlg_timer *ddel_timer = 0;
 dlg_timer_handler del_timer_hdl = 0;
 
-struct dlg_ping_timer *ping_timer=0;
-struct dlg_reinvite_ping_timer *reinvite_ping_timer=0;
+struct dlg_timer *ping_timer=0;
+struct dlg_timer *reinvite_ping_timer=0;
 str options_str=str_init("OPTIONS");
 str invite_str=str_init("INVITE");
 
@@ -48,34 +50,58 @@ extern int options_ping_interval;
  */
 #define FAKE_DIALOG_TL ((struct dlg_tl*)-1)
 
+#define tl_get_dlg(_tl_)  ((struct dlg_cell*)((char *)(_tl_)- \
+		(unsigned long)(&((struct dlg_cell*)0)->tl)))
+#define del_tl_get_dlg(_tl_)  ((struct dlg_cell*)((char *)(_tl_)- \
+		(unsigned long)(&((struct dlg_cell*)0)->del_tl)))
+#define tl_get_ping_node(_tl_)  ((struct dlg_ping_list*)((char *)(_tl_)- \
+		(unsigned long)(&((struct dlg_ping_list*)0)->tl)))
+
+#define dlg_timer_shard(_dlg) ((_dlg)->h_entry % dlg_timer_shards)
+
+static void _destroy_gen_dlg_timer(struct dlg_timer **timer);
+
 static int _init_gen_dlg_timer(struct dlg_timer **timer)
 {
-	*timer = (struct dlg_timer*)shm_malloc(sizeof(struct dlg_timer));
+	struct dlg_timer *shard;
+	struct dlg_tl *head;
+	int i, lvl, slot;
+
+	*timer = (struct dlg_timer*)shm_malloc
+		(dlg_timer_shards * sizeof(struct dlg_timer));
 	if (*timer==0) {
 		LM_ERR("no more shm mem\n");
 		return -1;
 	}
-	memset( *timer, 0, sizeof(struct dlg_timer) );
+	memset( *timer, 0, dlg_timer_shards * sizeof(struct dlg_timer) );
 
-	(*timer)->first.next = (*timer)->first.prev = &((*timer)->first);
+	for ( i=0 ; i<dlg_timer_shards ; i++ ) {
+		shard = &(*timer)[i];
 
-	(*timer)->lock = lock_alloc();
-	if ((*timer)->lock==0) {
-		LM_ERR("failed to alloc lock\n");
-		goto error0;
-	}
+		for ( lvl=0 ; lvl<DLG_WHEEL_LEVELS ; lvl++ )
+			for ( slot=0 ; slot<DLG_WHEEL_SIZE ; slot++ ) {
+				head = &shard->slots[lvl][slot];
+				head->next = head->prev = head;
+			}
+		shard->cur_tick = get_ticks();
+
+		shard->lock = lock_alloc();
+		if (shard->lock==0) {
+			LM_ERR("failed to alloc lock\n");
+			goto error;
+		}
 
-	if (lock_init( (*timer)->lock)==0) {
-		LM_ERR("failed to init lock\n");
-		goto error1;
+		if (lock_init( shard->lock)==0) {
+			LM_ERR("failed to init lock\n");
+			lock_dealloc(shard->lock);
+			shard->lock = 0;
+			goto error;
+		}
 	}
 
 	return 0;
-error1:
-	lock_dealloc((*timer)->lock);
-error0:
-	shm_free(*timer);
-	*timer = 0;
+error:
+	_destroy_gen_dlg_timer(timer);
 	return -1;
 }
 
@@ -91,10 +117,18 @@ int init_dlg_del_timer(dlg_timer_handler hdl )
 	return _init_gen_dlg_timer( &ddel_timer );
 }
 
+int init_dlg_ping_timer(void)
+{
+	return _init_gen_dlg_timer( &ping_timer );
+}
+
+int init_dlg_reinvite_ping_timer(void)
+{
+	return _init_gen_dlg_timer( &reinvite_ping_timer );
+}
+
 
 #ifdef EXTRA_DEBUG
-#define tl_get_dlg(_tl_)  ((struct dlg_cell*)((char *)(_tl_)- \
-		(unsigned long)(&((struct dlg_cell*)0)->tl)))
 void debug_detached_timer_list(struct dlg_tl *detached)
 {
 	struct dlg_cell *dlg;
@@ -121,161 +155,166 @@ void debug_gen_timer_list( struct dlg_timer *timer )
 	static int visited;
 
 	struct dlg_tl *start,*finish;
+	unsigned int n = 0;
+	int lvl, slot;
+
+	/* check each slot list is circular in both directions, with no loops
+	 * in the middle */
+	for ( lvl=0 ; lvl<DLG_WHEEL_LEVELS ; lvl++ )
+		for ( slot=0 ; slot<DLG_WHEEL_SIZE ; slot++ ) {
+			finish = &timer->slots[lvl][slot];
+
+			visited++;
+			for (start = finish->next; start != finish; start = start->next) {
+				if (start == NULL || start->visited == visited) {
+					LM_ERR("Detected something wrong with timer slot %d/%d on forward linking for entry %p \n",
+						lvl, slot, start);
+					abort();
+				}
+				start->visited = visited;
+				n++;
+			}
 
-	visited++;
-	start = finish = &(timer->first);
-	LM_DBG("testing forward loop with visited = %d\n",visited);
-
-	/* check the main list is circular in both directions from start to end,
-	 * with no loops in the middle */
-	while (start) {
-		start->visited=visited;
-		start = start->next;
-
-		if (start == finish)
-			break;
-
-		if (start == NULL || start->visited == visited) {
-			LM_ERR("Detected something wrong with main timer list on forward linking for entry %p \n",start);
-			abort();
+			visited++;
+			for (start = finish->prev; start != finish; start = start->prev) {
+				if (start == NULL || start->visited == visited) {
+					LM_ERR("Detected something wrong with timer slot %d/%d on backward linking for entry %p \n",
+						lvl, slot, start);
+					abort();
+				}
+				start->visited = visited;
+			}
 		}
-	}
 
-	visited++;
-	start = &(timer->first);
-
-	LM_DBG("testing backward loop with visited = %d\n",visited);
-
-	while (start) {
-		start->visited=visited;
-		start = start->prev;
-
-		if (start == finish)
-			break;
-
-		if (start == NULL || start->visited == visited) {
-			LM_ERR("Detected something wrong with main timer list on backward linking for entry %p \n",start);
-			abort();
-		}
+	if (n != timer->count) {
+		LM_ERR("Detected %u entries in timer, %u expected\n", n, timer->count);
+		abort();
 	}
 }
 
 #endif
 
-int init_dlg_ping_timer(void)
+
+static void _destroy_gen_dlg_timer(struct dlg_timer **timer)
 {
-	ping_timer = (struct dlg_ping_timer*)shm_malloc(sizeof(struct dlg_timer));
-	if (ping_timer==0) {
-		LM_ERR("no more shm mem\n");
-		return -1;
-	}
+	int i;
 
-	memset(ping_timer,0,sizeof(struct dlg_ping_timer));
-	ping_timer->lock = lock_alloc();
-	if (ping_timer->lock == 0) {
-		LM_ERR("failed to alloc lock\n");
-		goto error0;
-	}
+	if (*timer==0)
+		return;
 
-	if (lock_init(ping_timer->lock) == 0) {
-		LM_ERR("failed to init lock\n");
-		goto error1;
+	for ( i=0 ; i<dlg_timer_shards ; i++ ) {
+		if ((*timer)[i].lock==0)
+			break;
+		lock_destroy((*timer)[i].lock);
+		lock_dealloc((*timer)[i].lock);
 	}
 
-	return 0;
-
-error1:
-	lock_dealloc(ping_timer->lock);
-error0:
-	shm_free(ping_timer);
-	ping_timer=0;
-	return -1;
+	shm_free(*timer);
+	*timer = 0;
 }
 
-int init_dlg_reinvite_ping_timer(void)
+void destroy_dlg_timer(void)
 {
-	reinvite_ping_timer = (struct dlg_reinvite_ping_timer*)shm_malloc(sizeof(struct dlg_timer));
-	if (reinvite_ping_timer==0) {
-		LM_ERR("no more shm mem\n");
-		return -1;
-	}
-
-	memset(reinvite_ping_timer,0,sizeof(struct dlg_reinvite_ping_timer));
-	reinvite_ping_timer->lock = lock_alloc();
-	if (reinvite_ping_timer->lock == 0) {
-		LM_ERR("failed to alloc lock\n");
-		goto error0;
-	}
-
-	if (lock_init(reinvite_ping_timer->lock) == 0) {
-		LM_ERR("failed to init lock\n");
-		goto error1;
-	}
-
-	return 0;
+	_destroy_gen_dlg_timer( &d_timer );
+}
 
-error1:
-	lock_dealloc(reinvite_ping_timer->lock);
-error0:
-	shm_free(reinvite_ping_timer);
-	reinvite_ping_timer=0;
-	return -1;
+void destroy_dlg_del_timer(void)
+{
+	_destroy_gen_dlg_timer( &ddel_timer );
 }
 
 void destroy_ping_timer(void)
 {
-	if (ping_timer ==0)
-		return;
+	_destroy_gen_dlg_timer( &ping_timer );
+	_destroy_gen_dlg_timer( &reinvite_ping_timer );
+}
 
-	lock_destroy(ping_timer->lock);
-	lock_dealloc(ping_timer->lock);
 
-	shm_free(ping_timer);
-	ping_timer=0;
+/* links "tl" at the end of the wheel slot its timeout falls into */
+static inline void wheel_link_unsafe(struct dlg_timer *timer, struct dlg_tl *tl)
+{
+	struct dlg_tl *head;
+	unsigned int tick, delta;
+	int lvl;
+
+	tick = tl->timeout;
+	/* already expired - fire it at the next run */
+	if (tick < timer->cur_tick)
+		tick = timer->cur_tick;
+
+	delta = tick - timer->cur_tick;
+	for ( lvl=0 ; lvl<DLG_WHEEL_LEVELS-1 ; lvl++ )
+		if (delta < (1U << (DLG_WHEEL_BITS*(lvl+1))))
+			break;
+	/* beyond the range of the wheel - park it on the farthest slot, it
+	 * will be re-inserted when reached */
+	if (delta >= (1U << (DLG_WHEEL_BITS*DLG_WHEEL_LEVELS)))
+		tick = timer->cur_tick + (1U << (DLG_WHEEL_BITS*DLG_WHEEL_LEVELS)) - 1;
+
+	head = &timer->slots[lvl][(tick>>(DLG_WHEEL_BITS*lvl))&DLG_WHEEL_MASK];
+	tl->next = head;
+	tl->prev = head->prev;
+	head->prev->next = tl;
+	head->prev = tl;
 }
 
-
-static void _destroy_gen_dlg_timer(struct dlg_timer **timer)
+/* detaches all the links of a wheel slot, as a NULL terminated list */
+static inline struct dlg_tl *wheel_detach_slot(struct dlg_tl *head)
 {
-	if (*timer==0)
-		return;
+	struct dlg_tl *first;
 
-	lock_destroy((*timer)->lock);
-	lock_dealloc((*timer)->lock);
+	if (head->next == head)
+		return NULL;
 
-	shm_free(*timer);
-	*timer = 0;
-}
+	first = head->next;
+	head->prev->next = NULL;
+	head->next = head->prev = head;
 
-void destroy_dlg_timer(void)
-{
-	_destroy_gen_dlg_timer( &d_timer );
+	return first;
 }
 
-void destroy_dlg_del_timer(void)
+/* moves the links of the current slot of an upper level to the lower
+ * levels, as the wheel entered the span of that slot */
+static void wheel_cascade_unsafe(struct dlg_timer *timer, int lvl)
 {
-	_destroy_gen_dlg_timer( &ddel_timer );
-}
+	struct dlg_tl *tl, *tmp;
+	unsigned int idx;
 
+	idx = (timer->cur_tick >> (DLG_WHEEL_BITS*lvl)) & DLG_WHEEL_MASK;
+	/* the next upper level slot is due as well */
+	if (idx==0 && lvl<DLG_WHEEL_LEVELS-1)
+		wheel_cascade_unsafe( timer, lvl+1 );
+
+	for ( tl=wheel_detach_slot( &timer->slots[lvl][idx] ) ; tl ; tl=tmp ) {
+		tmp = tl->next;
+		wheel_link_unsafe( timer, tl );
+	}
+}
 
 static inline void insert_gen_timer_unsafe(struct dlg_timer *timer, struct dlg_tl *tl)
 {
-	struct dlg_tl* ptr;
+#ifdef EXTRA_DEBUG
+	debug_gen_timer_list( timer );
+#endif
+
+	LM_DBG("inserting %p for %d\n", tl,tl->timeout);
+	wheel_link_unsafe( timer, tl );
+	timer->count++;
 
 #ifdef EXTRA_DEBUG
 	debug_gen_timer_list( timer );
 #endif
+}
 
-	for(ptr = timer->first.prev; ptr != &(timer->first) ; ptr = ptr->prev) {
-		if ( ptr->timeout <= tl->timeout )
-			break;
-	}
+static inline void remove_gen_timer_unsafe(struct dlg_timer *timer, struct dlg_tl *tl)
+{
+#ifdef EXTRA_DEBUG
+	debug_gen_timer_list( timer );
+#endif
 
-	LM_DBG("inserting %p for %d\n", tl,tl->timeout);
-	tl->prev = ptr;
-	tl->next = ptr->next;
-	tl->prev->next = tl;
-	tl->next->prev = tl;
+	tl->prev->next = tl->next;
+	tl->next->prev = tl->prev;
+	timer->count--;
 
 #ifdef EXTRA_DEBUG
 	debug_gen_timer_list( timer );
@@ -284,19 +323,21 @@ static inline void insert_gen_timer_unsafe(struct dlg_timer *timer, struct dlg_t
 
 int insert_dlg_timer(struct dlg_tl *tl, int interval)
 {
-	lock_get( d_timer->lock);
+	struct dlg_timer *timer = &d_timer[dlg_timer_shard(tl_get_dlg(tl))];
+
+	lock_get( timer->lock);
 
 	if (tl->next!=0 || tl->prev!=0) {
-		lock_release( d_timer->lock);
+		lock_release( timer->lock);
 		LM_CRIT("Trying to insert a bogus dlg tl=%p tl->next=%p tl->prev=%p\n",
 			tl, tl->next, tl->prev);
 		return -1;
 	}
 	tl->timeout = get_ticks()+interval;
 
-	insert_gen_timer_unsafe( d_timer, tl );
+	insert_gen_timer_unsafe( timer, tl );
 
-	lock_release( d_timer->lock);
+	lock_release( timer->lock);
 
 	return 0;
 }
@@ -304,180 +345,168 @@ int insert_dlg_timer(struct dlg_tl *tl, int interval)
 
 int insert_attempt_dlg_del_timer(struct dlg_tl *tl, int interval)
 {
-	lock_get( ddel_timer->lock);
+	struct dlg_timer *timer = &ddel_timer[dlg_timer_shard(del_tl_get_dlg(tl))];
+
+	lock_get( timer->lock);
 
 	if (tl->prev==NULL) {
 		if (tl->next) {
 			/* prev is null, next not -> tl was in timer, but removed */
-			lock_release( ddel_timer->lock);
+			lock_release( timer->lock);
 			LM_DBG("TL found to be removed from timer\n");
 			return -2;
 		} else {
 			/* prev and next are null -> tl is not in timer */
 			tl->timeout = get_ticks()+interval;
-			insert_gen_timer_unsafe( ddel_timer, tl );
-			lock_release( ddel_timer->lock);
+			insert_gen_timer_unsafe( timer, tl );
+			lock_release( timer->lock);
 			LM_DBG("TL was just inserted into timer\n");
 			return 0;
 		}
 	}
-	lock_release( ddel_timer->lock);
+	lock_release( timer->lock);
 	/* prev and next are both set -> it should be in timer */
 	LM_DBG("TL found already in timer\n");
 	return -1;
 }
 
-void unsafe_insert_ping_timer(struct dlg_ping_list *node,int new_timeout)
+static inline int ping_failed(struct dlg_cell *dlg, int reinvite)
 {
-	struct dlg_ping_list *it;
-
-	node->timeout = get_ticks() + new_timeout;
-
-	if (ping_timer->first == 0) {
-		ping_timer->first = node;
-		ping_timer->last = node;
-	} else {
-		/* quick optimisation, always check if our timeout is bigger than last
-		if not, lookup our position, might be useful in the future if we want
-		to set different ping intervals per dialog */
-		if (node->timeout >= ping_timer->last->timeout) {
-			node->prev = ping_timer->last;
-			ping_timer->last->next = node;
-			ping_timer->last = node;
-		} else {
-			for (it=ping_timer->first;it;it=it->next) {
-				if (it->timeout >= node->timeout)
-					break;
-			}
-
-			/* we need to insert ourselves before the found node */
-			if (it == NULL) {
-				/* we're going to be the last node 
-				should never get here due to the above optimisation ... paranoia */
-				node->prev = ping_timer->last;
-				ping_timer->last->next = node;
-				ping_timer->last = node;
-			} else {
-				it->prev->next=node;
-				node->prev = it->prev;
-				node->next = it;
-				it->prev = node;
-			}
-
-		}
-	}
+	if (reinvite)
+		return (dlg->flags & DLG_FLAG_REINVITE_PING_CALLER
+		            && dlg->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_FAIL)
+		        || (dlg->flags & DLG_FLAG_REINVITE_PING_CALLEE
+		            && dlg->legs[callee_idx(dlg)].reinvite_confirmed == DLG_PING_FAIL);
+	else
+		return (dlg->flags & DLG_FLAG_PING_CALLER
+		            && dlg->legs[DLG_CALLER_LEG].reply_received == DLG_PING_FAIL)
+		        || (dlg->flags & DLG_FLAG_PING_CALLEE
+		            && dlg->legs[callee_idx(dlg)].reply_received == DLG_PING_FAIL);
 }
 
-int insert_ping_timer(struct dlg_cell* dlg)
+static struct dlg_ping_list *new_ping_node(struct dlg_cell *dlg)
 {
 	struct dlg_ping_list *node;
 
 	node = shm_malloc(sizeof(struct dlg_ping_list));
 	if (node == 0) {
 		LM_ERR("no more shm mem\n");
-		return -1;
+		return NULL;
 	}
 
+	memset(node, 0, sizeof(struct dlg_ping_list));
 	node->dlg = dlg;
-	node->next = 0;
-	node->prev = 0;
 
-	lock_get( ping_timer->lock );
-
-	unsafe_insert_ping_timer(node,options_ping_interval);
-	dlg->pl = node;
+	return node;
+}
 
-	dlg->legs[DLG_CALLER_LEG].reply_received = DLG_PING_SUCCESS;
-	dlg->legs[callee_idx(dlg)].reply_received = DLG_PING_SUCCESS;
+/* puts back on the wheel a ping entry taken out by the ping routine; if
+ * the pinging failed in the mean time, it will be handled at the next run */
+static void reinsert_ping_node(struct dlg_timer *timer,
+		struct dlg_ping_list *node, int interval, int reinvite)
+{
+	lock_get( timer->lock );
 
-	lock_release( ping_timer->lock);
-	LM_DBG("Inserted dlg [%p] in ping timer list\n",dlg);
+	/* a dialog terminated meanwhile could not bring the entry forward
+	 * (it was off the wheel), so release it with the next run */
+	node->tl.timeout = get_ticks() +
+		((node->dlg->state == DLG_STATE_DELETED ||
+		ping_failed(node->dlg, reinvite)) ? 0 : interval);
+	insert_gen_timer_unsafe( timer, &node->tl );
 
-	return 0;
+	lock_release( timer->lock );
 }
 
-void unsafe_insert_reinvite_ping_timer(struct dlg_ping_list *node,int new_timeout)
+/* drops a ping entry taken out by the ping routine */
+static void release_ping_node(struct dlg_timer *timer,
+		struct dlg_ping_list *node, struct dlg_ping_list **pl)
 {
-	struct dlg_ping_list *it;
+	lock_get( timer->lock );
+	*pl = 0;
+	lock_release( timer->lock );
 
-	node->timeout = get_ticks() + new_timeout;
+	shm_free(node);
+}
 
-	if (reinvite_ping_timer->first == 0) {
-		reinvite_ping_timer->first = node;
-		reinvite_ping_timer->last = node;
-	} else {
-		/* quick optimisation, always check if our timeout is bigger than last
-		if not, lookup our position, might be useful in the future if we want
-		to set different ping intervals per dialog */
-		if (node->timeout >= reinvite_ping_timer->last->timeout) {
-			node->prev = reinvite_ping_timer->last;
-			reinvite_ping_timer->last->next = node;
-			reinvite_ping_timer->last = node;
-		} else {
-			for (it=reinvite_ping_timer->first;it;it=it->next) {
-				if (it->timeout >= node->timeout)
-					break;
-			}
+/* brings forward the ping entry of a dialog, so it gets handled by the
+ * next run of the ping routine (failed pinging or terminated dialog) */
+static void expire_ping_node(struct dlg_timer *timer, struct dlg_ping_list **pl)
+{
+	struct dlg_ping_list *node;
 
-			/* we need to insert ourselves before the found node */
-			if (it == NULL) {
-				/* we're going to be the last node 
-				should never get here due to the above optimisation ... paranoia */
-				node->prev = reinvite_ping_timer->last;
-				reinvite_ping_timer->last->next = node;
-				reinvite_ping_timer->last = node;
-			} else {
-				it->prev->next=node;
-				node->prev = it->prev;
-				node->next = it;
-				it->prev = node;
-			}
-		}
+	lock_get( timer->lock );
+
+	node = *pl;
+	/* if not on the wheel, the entry is right now handled by the routine */
+	if (node && node->tl.prev) {
+		remove_gen_timer_unsafe( timer, &node->tl );
+		node->tl.timeout = get_ticks();
+		insert_gen_timer_unsafe( timer, &node->tl );
 	}
+
+	lock_release( timer->lock );
 }
 
-int insert_reinvite_ping_timer(struct dlg_cell* dlg)
+int insert_ping_timer(struct dlg_cell* dlg)
 {
+	struct dlg_timer *timer = &ping_timer[dlg_timer_shard(dlg)];
 	struct dlg_ping_list *node;
 
-	node = shm_malloc(sizeof(struct dlg_ping_list));
-	if (node == 0) {
-		LM_ERR("no more shm mem\n");
+	node = new_ping_node(dlg);
+	if (node == 0)
 		return -1;
-	}
 
-	node->dlg = dlg;
-	node->next = 0;
-	node->prev = 0;
+	lock_get( timer->lock );
 
-	lock_get( reinvite_ping_timer->lock );
+	node->tl.timeout = get_ticks() + options_ping_interval;
+	insert_gen_timer_unsafe( timer, &node->tl );
+	dlg->pl = node;
+
+	dlg->legs[DLG_CALLER_LEG].reply_received = DLG_PING_SUCCESS;
+	dlg->legs[callee_idx(dlg)].reply_received = DLG_PING_SUCCESS;
+
+	lock_release( timer->lock);
+	LM_DBG("Inserted dlg [%p] in ping timer list\n",dlg);
 
-	unsafe_insert_reinvite_ping_timer(node,reinvite_ping_interval);
+	return 0;
+}
+
+int insert_reinvite_ping_timer(struct dlg_cell* dlg)
+{
+	struct dlg_timer *timer = &reinvite_ping_timer[dlg_timer_shard(dlg)];
+	struct dlg_ping_list *node;
+
+	node = new_ping_node(dlg);
+	if (node == 0)
+		return -1;
+
+	lock_get( timer->lock );
+
+	node->tl.timeout = get_ticks() + reinvite_ping_interval;
+	insert_gen_timer_unsafe( timer, &node->tl );
 	dlg->reinvite_pl = node;
 
 	dlg->legs[DLG_CALLER_LEG].reinvite_confirmed = DLG_PING_SUCCESS;
 	dlg->legs[callee_idx(dlg)].reinvite_confirmed = DLG_PING_SUCCESS;
 
-	lock_release( reinvite_ping_timer->lock);
+	lock_release( timer->lock);
 	LM_DBG("Inserted dlg [%p] in reinvite ping timer list\n",dlg);
 
 	return 0;
 }
 
-static inline void remove_dlg_timer_unsafe(struct dlg_tl *tl)
+void expire_ping_timer(struct dlg_cell *dlg)
 {
-#ifdef EXTRA_DEBUG
-	debug_gen_timer_list( d_timer );
-#endif
-
-	tl->prev->next = tl->next;
-	tl->next->prev = tl->prev;
-
-#ifdef EXTRA_DEBUG
-	debug_gen_timer_list( d_timer );
-#endif
+	if (dlg->pl)
+		expire_ping_node( &ping_timer[dlg_timer_shard(dlg)], &dlg->pl );
 }
 
+void expire_reinvite_ping_timer(struct dlg_cell *dlg)
+{
+	if (dlg->reinvite_pl)
+		expire_ping_node( &reinvite_ping_timer[dlg_timer_shard(dlg)],
+			&dlg->reinvite_pl );
+}
 
 
 /* returns:
@@ -487,141 +516,123 @@ static inline void remove_dlg_timer_unsafe(struct dlg_tl *tl)
  */
 int remove_dlg_timer(struct dlg_tl *tl)
 {
-	lock_get( d_timer->lock);
+	struct dlg_timer *timer = &d_timer[dlg_timer_shard(tl_get_dlg(tl))];
+	lock_get( timer->lock);
 
 	if (tl->prev==NULL && tl->timeout==0) {
 		/* dialog is not in timer list; either it is completly removed
 		   (prev=next=timeout=0), either is in process by timeout routine
 		   (prev=timeout=0;next!=0) */
-		lock_release( d_timer->lock);
+		lock_release( timer->lock);
 		return 1;
 	}
 
 	if (tl->prev==NULL || tl->next==NULL || tl->next == FAKE_DIALOG_TL) {
 		LM_CRIT("bogus tl=%p tl->prev=%p tl->next=%p\n",
 			tl, tl->prev, tl->next);
-		lock_release( d_timer->lock);
+		lock_release( timer->lock);
 		return -1;
 	}
 
-	remove_dlg_timer_unsafe(tl);
+	remove_gen_timer_unsafe( timer, tl);
 	/* mark that this dialog was one a part of the timer list */
 	tl->next = FAKE_DIALOG_TL;
 	tl->prev = NULL;
 	tl->timeout = 0;
 
-	lock_release( d_timer->lock);
+	lock_release( timer->lock);
 	return 0;
 }
 
-static inline void detach_ping_node_unsafe(struct dlg_ping_list *it,int reinvite)
-{
-	if (it->next && it->prev) {
-		it->prev->next = it->next;
-		it->next->prev = it->prev;
-	}
-	else if (it->next) {
-		it->next->prev = 0;
-		if (reinvite)
-			reinvite_ping_timer->first = it->next;
-		else
-			ping_timer->first = it->next;
-	} else if (it->prev) {
-		it->prev->next = 0;
-		if (reinvite)
-			reinvite_ping_timer->last = it->prev;
-		else
-			ping_timer->last = it->prev;
-	} else {
-		if (reinvite) {
-			reinvite_ping_timer->first = 0;
-			reinvite_ping_timer->last = 0;
-		} else {
-			ping_timer->first = 0;
-			ping_timer->last = 0;
-		}
-	}
-
-	it->next = it->prev = 0;
-}
-
 /* returns :
      0 - dialog was inserted in timer list with the new timeout
      1 - dialog was inserted in timer list with the new timeout 
     -1 - failure (dialog is expired, so it cannot be added again) */
 int update_dlg_timer( struct dlg_tl *tl, int timeout )
 {
+	struct dlg_timer *timer = &d_timer[dlg_timer_shard(tl_get_dlg(tl))];
 	int ret;
 
-	lock_get( d_timer->lock);
+	lock_get( timer->lock);
 
 	if ( tl->next == FAKE_DIALOG_TL ) {
 		/* previously removed from timer list - we will not add it again */
-		lock_release( d_timer->lock);
+		lock_release( timer->lock);
 		return 0;
 	}
 
 	if ( tl->next ) {
 		if (tl->prev==0) {
-			lock_release( d_timer->lock);
+			lock_release( timer->lock);
 			return -1;
 		}
-		remove_dlg_timer_unsafe(tl);
+		remove_gen_timer_unsafe( timer, tl);
 		ret = 0;
 	} else {
 		ret = 1;
 	}
 
 	tl->timeout = get_ticks()+timeout;
-	insert_gen_timer_unsafe( d_timer, tl );
+	insert_gen_timer_unsafe( timer, tl );
 
-	lock_release( d_timer->lock);
+	lock_release( timer->lock);
 	return ret;
 }
 
+/* detaches the entries passed by the time from the wheel, as a list
+ * terminated by FAKE_DIALOG_TL */
 static inline struct dlg_tl* _get_gen_expired_dlgs(struct dlg_timer *timer, unsigned int time)
 {
-	struct dlg_tl *tl , *end, *ret;
-
-	lock_get( timer->lock);
+	struct dlg_tl *tl, *tmp, *ret, **last;
 
-	if (timer->first.next==&(timer->first)
-	|| timer->first.next->timeout > time ) {
-		lock_release( timer->lock);
+	/* quick check whether it is worth entering the lock */
+	if (timer->count==0 && timer->cur_tick==time)
 		return FAKE_DIALOG_TL;
-	}
+
+	lock_get( timer->lock);
 
 #ifdef EXTRA_DEBUG
 	debug_gen_timer_list( timer );
 #endif
 
-	end = &timer->first;
-	tl = timer->first.next;
-	LM_DBG("start with tl=%p tl->prev=%p tl->next=%p (%d) at %d "
-		"and end with end=%p end->prev=%p end->next=%p\n",
-		tl,tl->prev,tl->next,tl->timeout,time,
-		end,end->prev,end->next);
-	while( tl!=end && tl->timeout <= time) {
-		LM_DBG("getting tl=%p tl->prev=%p tl->next=%p with %d\n",
-			tl,tl->prev,tl->next,tl->timeout);
-		tl->prev = 0;
-		tl->timeout = 0;
-		tl=tl->next;
+	ret = FAKE_DIALOG_TL;
+	last = &ret;
+
+	if (timer->count==0) {
+		/* nothing to expire on the way, simply catch up with the time */
+		if (time > timer->cur_tick)
+			timer->cur_tick = time;
+		goto done;
 	}
-	LM_DBG("end with tl=%p tl->prev=%p tl->next=%p and "
-		"timer->first.next->prev=%p\n",
-		tl,tl->prev,tl->next,timer->first.next->prev);
 
-	if (tl==end && timer->first.next->prev) {
-		LM_DBG("no dialog to return\n");
-		ret = FAKE_DIALOG_TL;
-	} else {
-		ret = timer->first.next;
-		tl->prev->next = FAKE_DIALOG_TL;
-		timer->first.next = tl;
-		tl->prev = &timer->first;
+	while (1) {
+		tl = wheel_detach_slot(
+			&timer->slots[0][timer->cur_tick & DLG_WHEEL_MASK] );
+		for ( ; tl ; tl=tmp ) {
+			tmp = tl->next;
+			if (tl->timeout <= time) {
+				LM_DBG("getting tl=%p with %d\n", tl, tl->timeout);
+				tl->prev = 0;
+				tl->timeout = 0;
+				tl->next = FAKE_DIALOG_TL;
+				*last = tl;
+				last = &tl->next;
+				timer->count--;
+			} else {
+				/* not yet, only its tick was reached */
+				wheel_link_unsafe( timer, tl );
+			}
+		}
+
+		if (timer->cur_tick >= time)
+			break;
+
+		timer->cur_tick++;
+		if ((timer->cur_tick & DLG_WHEEL_MASK)==0)
+			wheel_cascade_unsafe( timer, 1 );
 	}
 
+done:
 #ifdef EXTRA_DEBUG
 	debug_gen_timer_list( timer );
 #endif
@@ -637,8 +648,9 @@ static inline struct dlg_tl* _get_gen_expired_dlgs(struct dlg_timer *timer, unsi
 void dlg_timer_routine(unsigned int ticks , void * attr)
 {
 	struct dlg_tl *tl, *ctl;
+	int shard = (int)(long)attr;
 
-	tl = _get_gen_expired_dlgs( d_timer, ticks );
+	tl = _get_gen_expired_dlgs( &d_timer[shard], ticks );
 
 	while (tl != FAKE_DIALOG_TL) {
 		ctl = tl;
@@ -652,7 +664,7 @@ void dlg_timer_routine(unsigned int ticks , void * attr)
 	if (dlg_del_delay==0)
 		return;
 
-	tl = _get_gen_expired_dlgs( ddel_timer, ticks );
+	tl = _get_gen_expired_dlgs( &ddel_timer[shard], ticks );
 
 	while (tl != FAKE_DIALOG_TL) {
 		ctl = tl;
@@ -664,85 +676,6 @@ void dlg_timer_routine(unsigned int ticks , void * attr)
 	}
 }
 
-/* removes expired dlgs from main ping_timer list
- * and links them back into a new list */
-void get_timeout_dlgs(struct dlg_ping_list **expired,
-		struct dlg_ping_list **to_be_deleted,int reinvite)
-{
-	struct dlg_ping_list *exp = NULL,*del=NULL,*it=NULL,*next=NULL;
-	struct dlg_cell *current;
-
-	if (reinvite)
-		lock_get(reinvite_ping_timer->lock);
-	else
-		lock_get(ping_timer->lock);
-
-	for (it=reinvite?reinvite_ping_timer->first:ping_timer->first;it;it=next) {
-		/* FIXME - optimisation needed here : only iterate on the nodes that we need to
-		eg. where pinging is in progress */
-
-		current = it->dlg;
-		next = it->next;
-
-		if (current->state == DLG_STATE_DELETED) {
-			/* the dialog has terminated - we remove it as well
-			 * since we also have a ref */
-			detach_ping_node_unsafe(it,reinvite);
-			if (reinvite)
-				it->dlg->reinvite_pl = 0;
-			else
-				it->dlg->pl = 0;
-
-			if (del == NULL)
-				del = it;
-			else {
-				it->next = del;
-				del = it;
-			}
-
-			continue;
-		}
-
-		/* if pinging failed on any leg: detach the timer and end the dialog */
-		if ((reinvite &&
-		        ((current->flags & DLG_FLAG_REINVITE_PING_CALLER
-		            && current->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_FAIL)
-		        || (current->flags & DLG_FLAG_REINVITE_PING_CALLEE
-		            && current->legs[callee_idx(current)].reinvite_confirmed == DLG_PING_FAIL)))
-
-		    || (!reinvite &&
-		        ((current->flags & DLG_FLAG_PING_CALLER
-		            && current->legs[DLG_CALLER_LEG].reply_received == DLG_PING_FAIL)
-		        || (current->flags & DLG_FLAG_PING_CALLEE
-		            && current->legs[callee_idx(current)].reply_received == DLG_PING_FAIL)))) {
-
-			detach_ping_node_unsafe(it,reinvite);
-
-			if (reinvite)
-				it->dlg->reinvite_pl = 0;
-			else
-				it->dlg->pl = 0;
-
-			if (exp == NULL)
-				exp = it;
-			else {
-				it->next = exp;
-				exp = it;
-			}
-
-			continue;
-		}
-	}
-
-	if (reinvite)
-		lock_release(reinvite_ping_timer->lock);
-	else
-		lock_release(ping_timer->lock);
-
-	*to_be_deleted = del;
-	*expired = exp;
-}
-
 int dlg_handle_seq_reply(struct dlg_cell *dlg, struct sip_msg* rpl,
 		int statuscode, int leg, int is_reinvite_rpl)
 {
@@ -759,8 +692,7 @@ int dlg_handle_seq_reply(struct dlg_cell *dlg, struct sip_msg* rpl,
 		LM_INFO("terminating dialog due to ping timeout on %s leg, "
 		        "ci: [%.*s]\n", leg == DLG_CALLER_LEG ? "caller" : "callee",
 		        dlg->callid.len, dlg->callid.s);
-		*ping_status = DLG_PING_FAIL;
-		return -1;
+		goto failed;
 	}
 
 	if (statuscode == 481)
@@ -770,9 +702,7 @@ int dlg_handle_seq_reply(struct dlg_cell *dlg, struct sip_msg* rpl,
 		LM_INFO("terminating dialog due to 481 ping reply on %s leg, "
 		        "ci: [%.*s]\n", leg == DLG_CALLER_LEG ? "caller" : "callee",
 		        dlg->callid.len, dlg->callid.s);
-
-		*ping_status = DLG_PING_FAIL;
-		return -1;
+		goto failed;
 	}
 
 	*ping_status = DLG_PING_SUCCESS;
@@ -780,6 +710,15 @@ int dlg_handle_seq_reply(struct dlg_cell *dlg, struct sip_msg* rpl,
 			other_leg(dlg, leg), leg, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
 		LM_ERR("cannot send ACK message!\n");
 	return 0;
+
+failed:
+	*ping_status = DLG_PING_FAIL;
+	/* no need to wait for the next ping, have the routine end the dialog */
+	if (is_reinvite_rpl)
+		expire_reinvite_ping_timer(dlg);
+	else
+		expire_ping_timer(dlg);
+	return -1;
 }
 
 
@@ -890,238 +829,205 @@ void unref_dlg_cb(void *dlg)
 
 void dlg_options_routine(unsigned int ticks , void * attr)
 {
-	struct dlg_ping_list *expired,*to_be_deleted,*it,*curr,*next;
+	struct dlg_ping_list *it;
+	struct dlg_tl *tl;
 	struct dlg_cell *dlg;
-	int current_ticks;
+	struct dlg_timer *timer = &ping_timer[(int)(long)attr];
 
-	get_timeout_dlgs(&expired,&to_be_deleted,0);
+	/* only the dialogs due to be pinged (or brought forward due to failed
+	 * pinging or termination) are taken out of the wheel */
+	tl = _get_gen_expired_dlgs( timer, ticks );
 
-	it = expired;
-	while (it) {
+	while (tl != FAKE_DIALOG_TL) {
+		it = tl_get_ping_node(tl);
+		tl = tl->next;
 		dlg = it->dlg;
-		LM_DBG("dialog %p-%.*s has expired\n",dlg,dlg->callid.len,dlg->callid.s);
-		curr = it->next;
-		shm_free(it);
-		it = curr;
-
-		if (dlg->legs[DLG_CALLER_LEG].reply_received == DLG_PING_FAIL) {
-			init_dlg_term_reason(dlg, MI_SSTR("Caller Ping Timeout"));
-		} else if (dlg->legs[callee_idx(dlg)].reply_received == DLG_PING_FAIL) {
-			init_dlg_term_reason(dlg, MI_SSTR("Callee Ping Timeout"));
-		} else {
-			LM_WARN("Ping Timeout: flags[%u] caller rr[%u] callee rr[%u]\n",
-					dlg->flags,
-					dlg->legs[DLG_CALLER_LEG].reply_received,
-					dlg->legs[callee_idx(dlg)].reply_received);
-			init_dlg_term_reason(dlg, MI_SSTR("Ping Timeout"));
+
+		if (dlg->state == DLG_STATE_DELETED) {
+			LM_DBG("dialog %p-%.*s has terminated\n",dlg,dlg->callid.len,dlg->callid.s);
+			/* if marked as to be deleted, we let it go
+			 * for the ping timer list as well */
+			release_ping_node( timer, it, &dlg->pl );
+			unref_dlg(dlg,1);
+			continue;
 		}
-		/* FIXME - maybe better not to send BYE both ways as we know for
-		 * sure one end in down . */
-		dlg_end_dlg(dlg,0,1);
 
-		/* no longer reffed in list */
-		unref_dlg(dlg,1);
-	}
+		/* if pinging failed on any leg: drop the timer and end the dialog */
+		if (ping_failed(dlg, 0)) {
+			LM_DBG("dialog %p-%.*s has expired\n",dlg,dlg->callid.len,dlg->callid.s);
+			release_ping_node( timer, it, &dlg->pl );
 
-	it = to_be_deleted;
-	while (it) {
-		dlg = it->dlg;
-		LM_DBG("dialog %p-%.*s has terminated\n",dlg,dlg->callid.len,dlg->callid.s);
-		curr = it->next;
-		/* if marked as to be deleted, we let it go
-		 * for the ping timer list as well */
-		unref_dlg(dlg,1);
-		shm_free(it);
-		it = curr;
-	}
+			if (dlg->legs[DLG_CALLER_LEG].reply_received == DLG_PING_FAIL) {
+				init_dlg_term_reason(dlg, MI_SSTR("Caller Ping Timeout"));
+			} else if (dlg->legs[callee_idx(dlg)].reply_received == DLG_PING_FAIL) {
+				init_dlg_term_reason(dlg, MI_SSTR("Callee Ping Timeout"));
+			} else {
+				LM_WARN("Ping Timeout: flags[%u] caller rr[%u] callee rr[%u]\n",
+						dlg->flags,
+						dlg->legs[DLG_CALLER_LEG].reply_received,
+						dlg->legs[callee_idx(dlg)].reply_received);
+				init_dlg_term_reason(dlg, MI_SSTR("Ping Timeout"));
+			}
+			/* FIXME - maybe better not to send BYE both ways as we know for
+			 * sure one end in down . */
+			dlg_end_dlg(dlg,0,1);
 
-	tcp_no_new_conn = 1;
+			/* no longer reffed in list */
+			unref_dlg(dlg,1);
+			continue;
+		}
 
-	current_ticks = get_ticks();
-	/* ping_timer->first now contains all active dialogs
-	ping all dialogs with a lower timeout than now */
-	lock_get(ping_timer->lock);
-	it = ping_timer->first;
-	while (it) {
-		/* iterated across all the nodes that need pinging now */
-		if (it->timeout > current_ticks)
-			break;
+		if (dialog_repl_cluster && get_shtag_state(dlg) == SHTAG_STATE_BACKUP)
+			goto next_ping;
 
-		dlg = it->dlg;
-		next=it->next;
+		tcp_no_new_conn = 1;
 
-		if (dialog_repl_cluster && get_shtag_state(dlg) == SHTAG_STATE_BACKUP) {
-			it = next;
-			continue;
+		if (dlg->flags & DLG_FLAG_PING_CALLER &&
+		        dlg->legs[DLG_CALLER_LEG].reply_received == DLG_PING_SUCCESS) {
+			ref_dlg(dlg,1);
+			if (send_leg_msg(dlg,&options_str,callee_idx(dlg),
+			DLG_CALLER_LEG,0,0,reply_from_caller,dlg,unref_dlg_cb,
+			&dlg->legs[DLG_CALLER_LEG].reply_received) < 0) {
+				LM_ERR("failed to ping caller\n");
+				unref_dlg(dlg,1);
+			}
 		}
 
-		/* do not ping ended dialogs - we might have missed them earlier or
-		 * might have terminated in the mean time - we'll clean them up on
-		 * our next iteration */
-		if (dlg->state != DLG_STATE_DELETED && it->timeout <= current_ticks) {
-			if (dlg->flags & DLG_FLAG_PING_CALLER &&
-			        dlg->legs[DLG_CALLER_LEG].reply_received == DLG_PING_SUCCESS) {
-				ref_dlg(dlg,1);
-				if (send_leg_msg(dlg,&options_str,callee_idx(dlg),
-				DLG_CALLER_LEG,0,0,reply_from_caller,dlg,unref_dlg_cb,
-				&dlg->legs[DLG_CALLER_LEG].reply_received) < 0) {
-					LM_ERR("failed to ping caller\n");
-					unref_dlg(dlg,1);
-				}
+		if (dlg->flags & DLG_FLAG_PING_CALLEE &&
+		        dlg->legs[callee_idx(dlg)].reply_received == DLG_PING_SUCCESS) {
+			ref_dlg(dlg,1);
+			if (send_leg_msg(dlg,&options_str,DLG_CALLER_LEG,
+			callee_idx(dlg),0,0,reply_from_callee,dlg,unref_dlg_cb,
+			&dlg->legs[callee_idx(dlg)].reply_received) < 0) {
+				LM_ERR("failed to ping callee\n");
+				unref_dlg(dlg,1);
 			}
+		}
 
-			if (dlg->flags & DLG_FLAG_PING_CALLEE &&
-			        dlg->legs[callee_idx(dlg)].reply_received == DLG_PING_SUCCESS) {
-				ref_dlg(dlg,1);
-				if (send_leg_msg(dlg,&options_str,DLG_CALLER_LEG,
-				callee_idx(dlg),0,0,reply_from_callee,dlg,unref_dlg_cb,
-				&dlg->legs[callee_idx(dlg)].reply_received) < 0) {
-					LM_ERR("failed to ping callee\n");
-					unref_dlg(dlg,1);
-				}
-			}
+		tcp_no_new_conn = 0;
 
-			/* we've pinged, now update the timeout & move the entry further down the list */
-			detach_ping_node_unsafe(it,0);
-			unsafe_insert_ping_timer(it,options_ping_interval);
-		}
-		it = next;
+next_ping:
+		/* we've pinged, now schedule the next ping */
+		reinsert_ping_node( timer, it, options_ping_interval, 0 );
 	}
-
-	lock_release(ping_timer->lock);
-	tcp_no_new_conn = 0;
 }
 
 void dlg_reinvite_routine(unsigned int ticks , void * attr)
 {
 	static str content_type = str_init("application/sdp");
-	struct dlg_ping_list *expired,*to_be_deleted,*it,*curr,*next;
+	struct dlg_ping_list *it;
+	struct dlg_tl *tl;
 	struct dlg_cell *dlg;
+	struct dlg_timer *timer = &reinvite_ping_timer[(int)(long)attr];
 	str extra_headers;
 	str *sdp;
-	int current_ticks;
+	int interval;
 
-	get_timeout_dlgs(&expired,&to_be_deleted,1);
+	/* only the dialogs due to be pinged (or brought forward due to failed
+	 * pinging or termination) are taken out of the wheel */
+	tl = _get_gen_expired_dlgs( timer, ticks );
 
-	it = expired;
-	while (it) {
+	while (tl != FAKE_DIALOG_TL) {
+		it = tl_get_ping_node(tl);
+		tl = tl->next;
 		dlg = it->dlg;
-		LM_DBG("dialog %p-%.*s has expired\n",dlg,dlg->callid.len,dlg->callid.s);
-		curr = it->next;
-		shm_free(it);
-		it = curr;
-
-		if (dlg->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_FAIL) {
-			init_dlg_term_reason(dlg, MI_SSTR("Caller ReINVITE Ping Timeout"));
-		} else if (dlg->legs[callee_idx(dlg)].reinvite_confirmed == DLG_PING_FAIL) {
-			init_dlg_term_reason(dlg, MI_SSTR("Callee ReINVITE Ping Timeout"));
-		} else {
-			LM_WARN("Ping Timeout: flags[%u] caller rc[%u] callee rc[%u]\n",
-					dlg->flags,
-					dlg->legs[DLG_CALLER_LEG].reinvite_confirmed,
-					dlg->legs[callee_idx(dlg)].reinvite_confirmed);
-			init_dlg_term_reason(dlg, MI_SSTR("ReINVITE Ping Timeout"));
+
+		if (dlg->state == DLG_STATE_DELETED) {
+			LM_DBG("dialog %p-%.*s has terminated\n",dlg,dlg->callid.len,dlg->callid.s);
+			/* if marked as to be deleted, we let it go
+			 * for the ping timer list as well */
+			release_ping_node( timer, it, &dlg->reinvite_pl );
+			unref_dlg(dlg,1);
+			continue;
 		}
-		/* FIXME - maybe better not to send BYE both ways as we know for
-		 * sure one end in down . */
-		dlg_end_dlg(dlg,0,1);
 
-		/* no longer reffed in list */
-		unref_dlg(dlg,1);
-	}
+		/* if pinging failed on any leg: drop the timer and end the dialog */
+		if (ping_failed(dlg, 1)) {
+			LM_DBG("dialog %p-%.*s has expired\n",dlg,dlg->callid.len,dlg->callid.s);
+			release_ping_node( timer, it, &dlg->reinvite_pl );
 
-	it = to_be_deleted;
-	while (it) {
-		dlg = it->dlg;
-		LM_DBG("dialog %p-%.*s has terminated\n",dlg,dlg->callid.len,dlg->callid.s);
-		curr = it->next;
-		/* if marked as to be deleted, we let it go
-		 * for the ping timer list as well */
-		unref_dlg(dlg,1);
-		shm_free(it);
-		it = curr;
-	}
+			if (dlg->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_FAIL) {
+				init_dlg_term_reason(dlg, MI_SSTR("Caller ReINVITE Ping Timeout"));
+			} else if (dlg->legs[callee_idx(dlg)].reinvite_confirmed == DLG_PING_FAIL) {
+				init_dlg_term_reason(dlg, MI_SSTR("Callee ReINVITE Ping Timeout"));
+			} else {
+				LM_WARN("Ping Timeout: flags[%u] caller rc[%u] callee rc[%u]\n",
+						dlg->flags,
+						dlg->legs[DLG_CALLER_LEG].reinvite_confirmed,
+						dlg->legs[callee_idx(dlg)].reinvite_confirmed);
+				init_dlg_term_reason(dlg, MI_SSTR("ReINVITE Ping Timeout"));
+			}
+			/* FIXME - maybe better not to send BYE both ways as we know for
+			 * sure one end in down . */
+			dlg_end_dlg(dlg,0,1);
 
-	tcp_no_new_conn = 1;
+			/* no longer reffed in list */
+			unref_dlg(dlg,1);
+			continue;
+		}
 
-	current_ticks = get_ticks();
-	/* reinvite_ping_timer->first now contains all active dialogs
-	ping all dialogs with a lower timeout than now */
-	lock_get(reinvite_ping_timer->lock);
-	it = reinvite_ping_timer->first;
-	while (it) {
-		/* iterated across all the nodes that need pinging now */
-		if (it->timeout > current_ticks)
-			break;
+		interval = reinvite_ping_interval;
 
-		dlg = it->dlg;
-		next=it->next;
+		if (dialog_repl_cluster && get_shtag_state(dlg) == SHTAG_STATE_BACKUP)
+			goto next_ping;
 
-		if (dialog_repl_cluster && get_shtag_state(dlg) == SHTAG_STATE_BACKUP) {
-			it = next;
-			continue;
-		}
+		tcp_no_new_conn = 1;
 
-		/* do not ping ended dialogs - we might have missed them earlier or
-		 * might have terminated in the mean time - we'll clean them up on
-		 * our next iteration */
-		if (dlg->state != DLG_STATE_DELETED && it->timeout <= current_ticks) {
-			if (dlg->flags & DLG_FLAG_REINVITE_PING_CALLER &&
-			        dlg->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_SUCCESS) {
-
-				if (!dlg_get_leg_hdrs(dlg, callee_idx(dlg),
-						DLG_CALLER_LEG, &content_type, NULL, &extra_headers)) {
-					LM_ERR("No more pkg for extra headers \n");
-					it = it->next;
-					continue;
-				}
-				sdp = (dlg->legs[DLG_CALLER_LEG].out_sdp.s?
-						&dlg->legs[DLG_CALLER_LEG].out_sdp:
-						&dlg->legs[callee_idx(dlg)].in_sdp);
-				
-				ref_dlg(dlg,1);
-				if (send_leg_msg(dlg,&invite_str,callee_idx(dlg),
-				DLG_CALLER_LEG,&extra_headers,sdp,
-				reinvite_reply_from_caller,dlg,unref_dlg_cb,
-				&dlg->legs[DLG_CALLER_LEG].reinvite_confirmed) < 0) {
-					LM_ERR("failed to ping caller\n");
-					unref_dlg(dlg,1);
-				}
+		if (dlg->flags & DLG_FLAG_REINVITE_PING_CALLER &&
+		        dlg->legs[DLG_CALLER_LEG].reinvite_confirmed == DLG_PING_SUCCESS) {
 
-				pkg_free(extra_headers.s);
+			if (!dlg_get_leg_hdrs(dlg, callee_idx(dlg),
+					DLG_CALLER_LEG, &content_type, NULL, &extra_headers)) {
+				LM_ERR("No more pkg for extra headers \n");
+				/* retry on the next run */
+				interval = 1;
+				goto next_ping_reset;
+			}
+			sdp = (dlg->legs[DLG_CALLER_LEG].out_sdp.s?
+					&dlg->legs[DLG_CALLER_LEG].out_sdp:
+					&dlg->legs[callee_idx(dlg)].in_sdp);
+
+			ref_dlg(dlg,1);
+			if (send_leg_msg(dlg,&invite_str,callee_idx(dlg),
+			DLG_CALLER_LEG,&extra_headers,sdp,
+			reinvite_reply_from_caller,dlg,unref_dlg_cb,
+			&dlg->legs[DLG_CALLER_LEG].reinvite_confirmed) < 0) {
+				LM_ERR("failed to ping caller\n");
+				unref_dlg(dlg,1);
 			}
 
-			if (dlg->flags & DLG_FLAG_REINVITE_PING_CALLEE &&
-			        dlg->legs[callee_idx(dlg)].reinvite_confirmed == DLG_PING_SUCCESS) {
+			pkg_free(extra_headers.s);
+		}
 
-				if (!dlg_get_leg_hdrs(dlg, DLG_CALLER_LEG,
-						callee_idx(dlg), &content_type, NULL, &extra_headers)) {
-					LM_ERR("No more pkg for extra headers \n");
-					it = it->next;
-					continue;
-				}
-				sdp = (dlg->legs[callee_idx(dlg)].out_sdp.s?
-						&dlg->legs[callee_idx(dlg)].out_sdp:
-						&dlg->legs[DLG_CALLER_LEG].in_sdp);
-
-				ref_dlg(dlg,1);
-				if (send_leg_msg(dlg,&invite_str,DLG_CALLER_LEG, callee_idx(dlg),
-				&extra_headers,sdp,reinvite_reply_from_callee, dlg,unref_dlg_cb,
-				&dlg->legs[callee_idx(dlg)].reinvite_confirmed) < 0) {
-					LM_ERR("failed to ping callee\n");
-					unref_dlg(dlg,1);
-				}
+		if (dlg->flags & DLG_FLAG_REINVITE_PING_CALLEE &&
+		        dlg->legs[callee_idx(dlg)].reinvite_confirmed == DLG_PING_SUCCESS) {
 
-				pkg_free(extra_headers.s);
+			if (!dlg_get_leg_hdrs(dlg, DLG_CALLER_LEG,
+					callee_idx(dlg), &content_type, NULL, &extra_headers)) {
+				LM_ERR("No more pkg for extra headers \n");
+				/* retry on the next run */
+				interval = 1;
+				goto next_ping_reset;
+			}
+			sdp = (dlg->legs[callee_idx(dlg)].out_sdp.s?
+					&dlg->legs[callee_idx(dlg)].out_sdp:
+					&dlg->legs[DLG_CALLER_LEG].in_sdp);
+
+			ref_dlg(dlg,1);
+			if (send_leg_msg(dlg,&invite_str,DLG_CALLER_LEG, callee_idx(dlg),
+			&extra_headers,sdp,reinvite_reply_from_callee, dlg,unref_dlg_cb,
+			&dlg->legs[callee_idx(dlg)].reinvite_confirmed) < 0) {
+				LM_ERR("failed to ping callee\n");
+				unref_dlg(dlg,1);
 			}
 
-			/* we've pinged, now update the timeout & move the entry further down the list */
-			detach_ping_node_unsafe(it,1);
-			unsafe_insert_reinvite_ping_timer(it,reinvite_ping_interval);
+			pkg_free(extra_headers.s);
 		}
-		it = next;
-	}
 
-	lock_release(reinvite_ping_timer->lock);
-	tcp_no_new_conn = 0;
+next_ping_reset:
+		tcp_no_new_conn = 0;
+next_ping:
+		/* we've pinged, now schedule the next ping */
+		reinsert_ping_node( timer, it, interval, 1 );
+	}
 }
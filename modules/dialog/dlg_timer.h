@@ -38,35 +38,34 @@ struct dlg_tl
 };
 
 
+/* geometry of the timing wheels: 4 levels of 64 slots each, so a wheel
+   covers 2^24 seconds (194 days); longer timeouts are parked on the last
+   slot and re-inserted when reached */
+#define DLG_WHEEL_BITS    6
+#define DLG_WHEEL_SIZE    (1<<DLG_WHEEL_BITS)
+#define DLG_WHEEL_MASK    (DLG_WHEEL_SIZE-1)
+#define DLG_WHEEL_LEVELS  4
+
+/* a hierarchical timing wheel; each slot is the head of a circular list
+   of timer links - a level 0 slot holds the links expiring in one tick,
+   a slot on an upper level spans all the slots of the level below */
 struct  dlg_timer
 {
-	struct dlg_tl   first;
+	struct dlg_tl   slots[DLG_WHEEL_LEVELS][DLG_WHEEL_SIZE];
+	unsigned int    cur_tick;  /* next tick to be expired */
+	unsigned int    count;     /* links currently on the wheel */
 	gen_lock_t      *lock;
 };
 
+/* entry of the ping timers (OPTIONS and re-INVITE pinging) */
 struct dlg_ping_list
 {
+	struct dlg_tl tl;
 	struct dlg_cell* dlg;
-	volatile unsigned int timeout;
-	struct dlg_ping_list *next;
-	struct dlg_ping_list *prev;
-};
-
-struct dlg_ping_timer
-{
-	struct dlg_ping_list *first;
-	struct dlg_ping_list *last;
-	gen_lock_t *lock;
-};
-
-struct dlg_reinvite_ping_timer
-{
-	struct dlg_ping_list *first;
-	struct dlg_ping_list *last;
-	gen_lock_t *lock;
 };
 
 extern int dlg_del_delay; /* in dialog.c, modparam */
+extern int dlg_timer_shards; /* in dialog.c, modparam */
 
 typedef void (*dlg_timer_handler)(struct dlg_tl *);
 
@@ -94,7 +93,9 @@ int insert_reinvite_ping_timer(struct dlg_cell *dlg);
 
 int remove_dlg_timer(struct dlg_tl *tl);
 
-int remove_ping_timer(struct dlg_cell *dlg);
+void expire_ping_timer(struct dlg_cell *dlg);
+
+void expire_reinvite_ping_timer(struct dlg_cell *dlg);
 
 int update_dlg_timer( struct dlg_tl *tl, int timeout );
 
@@ -917,3 +917,35 @@ void wrap_pcre_free( pcre* re)
 	shm_free(re);
 
 }
+
+/* the JIT compiler is not used on purpose: the machine code lives in
+ * private (mmap'ed) memory of the process doing the (re)load, while the
+ * rules are shared by all the processes */
+pcre_extra * wrap_pcre_study(pcre * re)
+{
+		pcre_extra * ret;
+		func_malloc old_malloc ;
+		func_free old_free;
+		const char * error = NULL;
+
+		old_malloc = pcre_malloc;
+		old_free = pcre_free;
+
+		pcre_malloc = wrap_shm_malloc;
+		pcre_free = wrap_shm_free;
+
+		ret = pcre_study(re, 0, &error);
+
+		pcre_malloc = old_malloc;
+		pcre_free = old_free;
+
+		if (error)
+			LM_DBG("failed to study the expression: %s\n", error);
+
+		return ret;
+}
+
+void wrap_pcre_free_study(pcre_extra * extra)
+{
+	shm_free(extra);
+}
@@ -32,6 +32,7 @@
 #include "../../db/db.h"
 #include "../../re.h"
 #include <pcre.h>
+#include <ctype.h>
 
 #define REGEX_OP	1
 #define EQUAL_OP	0
@@ -39,7 +40,31 @@
 #define DEFAULT_PARTITION  "default"
 
 #define DP_CASE_INSENSITIVE		1
+/* initial number of string buckets of a dpid, doubled each time the
+ * average bucket holds more than DP_INDEX_MAX_LOAD rules */
 #define DP_INDEX_HASH_SIZE		16
+#define DP_INDEX_MAX_LOAD		4
+
+/* the regex rules are also indexed in a trie by their literal prefix
+ * (if any, digits and "+*#" only), so only the rules which may match
+ * are tried */
+#define DP_RE_PREFIX_MAX		16
+#define DP_TRIE_CHARS			13
+#define DP_TRIE_DEPTH			10
+
+static inline int dp_trie_idx(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+
+	switch (c) {
+		case '+': return 10;
+		case '*': return 11;
+		case '#': return 12;
+	}
+
+	return -1;
+}
 
 typedef struct dpl_node{
 	int dpid;
@@ -49,26 +74,52 @@ typedef struct dpl_node{
 	int match_flags;
 	str match_exp, subst_exp, repl_exp; /*keeping the original strings*/
 	pcre * match_comp, * subst_comp; /*compiled patterns*/
+	pcre_extra * match_extra; /*studied match pattern*/
+	int match_minlen; /*min length of a matching input*/
+	int match_prefix_len; /*literal prefix of an anchored match pattern*/
+	char match_prefix[DP_RE_PREFIX_MAX];
+	int re_pos; /*position in the regex bucket*/
 	struct subst_expr * repl_comp;
 	str attrs;
 	str timerec;
 	tmrec_expr *parsed_timerec;
 
 	struct dpl_node * next; /*next rule*/
+	struct dpl_node * next_cand; /*next rule in the regex prefix index*/
 }dpl_node_t, *dpl_node_p;
 
-/* HASH_SIZE	buckets of matching strings (lowercase hashing)
-   1			bucket of regexps (index: HASH_SIZE) */
+/* hash_size	buckets of matching strings (lowercase hashing)
+   1			bucket of regexps (index: hash_size) */
 typedef struct dpl_index{
 	dpl_node_t * first_rule;
 	dpl_node_t * last_rule;
 
 }dpl_index_t, *dpl_index_p;
 
+#define dp_index_append(_idx, _rule, _link) \
+	do { \
+		(_rule)->_link = NULL; \
+		if (!(_idx)->first_rule) \
+			(_idx)->first_rule = (_rule); \
+		else \
+			(_idx)->last_rule->_link = (_rule); \
+		(_idx)->last_rule = (_rule); \
+	} while (0)
+
+/* the regex rules whose prefix (up to DP_TRIE_DEPTH chars) ends here */
+typedef struct dpl_trie{
+	dpl_index_t rules;
+	struct dpl_trie * child[DP_TRIE_CHARS];
+}dpl_trie_t;
+
 /*For every DPID*/
 typedef struct dpl_id{
 	int dp_id;
 	dpl_index_t* rule_hash;/*fast access :string rules are hashed*/
+	unsigned int hash_size;
+	unsigned int str_rules;
+	dpl_trie_t re_trie; /*root: the regex rules without prefix*/
+	int re_count;
 	struct dpl_id * next;
 }dpl_id_t,*dpl_id_p;
 
@@ -122,6 +173,8 @@ void repl_expr_free(struct subst_expr *se);
 int translate(struct sip_msg *msg, str user_name, str* repl_user, dpl_id_p idp, str *);
 int rule_translate(struct sip_msg *msg, str , dpl_node_t * rule,  str *);
 int test_match(str string, pcre * exp, int * out, int out_max);
+int test_match_extra(str string, pcre * exp, pcre_extra * extra,
+		int * out, int out_max);
 
 
 typedef void * (*func_malloc)(size_t );
@@ -133,6 +186,8 @@ void  wrap_shm_free(void *);
 
 pcre * wrap_pcre_compile(char *  pattern, int flags);
 void wrap_pcre_free( pcre*);
+pcre_extra * wrap_pcre_study(pcre * re);
+void wrap_pcre_free_study(pcre_extra * extra);
 
 
 extern rw_lock_t *ref_lock;
@@ -463,11 +463,58 @@ int str_to_shm(str src, str * dest)
 }
 
 
+/* extracts the literal prefix any input matching an anchored regex
+ * must start with; returns the length of the prefix (0 if none) */
+static int regex_prefix(str *exp, char *buf, int max)
+{
+	char *p, *q, *end;
+	char c;
+	int n;
+
+	p = exp->s;
+	end = exp->s + exp->len;
+
+	if (p == end || *p != '^')
+		return 0;
+
+	/* an alternative branch may start with anything */
+	if (q_memchr(p, '|', exp->len))
+		return 0;
+
+	for (p++, n = 0; p < end && n < max; p = q) {
+		c = *p;
+		if (c == '\\') {
+			/* only escaped punctuation is a literal (\d, \1, \Q etc. are not) */
+			if (p + 1 == end || isalnum((unsigned char)p[1]))
+				break;
+			c = p[1];
+			q = p + 2;
+		} else if (strchr(".[]()*+?{}^$", c)) {
+			break;
+		} else {
+			q = p + 1;
+		}
+
+		/* a quantified char may be missing from the input */
+		if (q < end && (*q == '?' || *q == '*' || *q == '{'))
+			break;
+
+		buf[n++] = c;
+
+		if (q < end && *q == '+')
+			break;
+	}
+
+	return n;
+}
+
+
 /*compile the expressions, and if ok, build the rule */
 dpl_node_t * build_rule(db_val_t * values)
 {
 	tmrec_expr *parsed_timerec;
 	pcre * match_comp, *subst_comp;
+	pcre_extra * match_extra;
 	struct subst_expr * repl_comp;
 	dpl_node_t * new_rule;
 	str match_exp, subst_exp, repl_exp, attrs, timerec;
@@ -483,6 +530,7 @@ dpl_node_t * build_rule(db_val_t * values)
 
 	parsed_timerec = 0;
 	match_comp = subst_comp = 0;
+	match_extra = 0;
 	repl_comp = 0;
 	new_rule = 0;
 
@@ -499,6 +547,9 @@ dpl_node_t * build_rule(db_val_t * values)
 				match_exp.len, match_exp.s);
 			goto err;
 		}
+
+		/* not fatal, the expression is simply matched unstudied */
+		match_extra = wrap_pcre_study(match_comp);
 	}
 
 	LM_DBG("building subst rule\n");
@@ -590,8 +641,17 @@ dpl_node_t * build_rule(db_val_t * values)
 			new_rule->timerec.len, new_rule->timerec.s);
 	}
 
-	if (match_comp)
+	if (match_comp) {
 		new_rule->match_comp = match_comp;
+		new_rule->match_extra = match_extra;
+
+		if (pcre_fullinfo(match_comp, match_extra, PCRE_INFO_MINLENGTH,
+		&new_rule->match_minlen) != 0 || new_rule->match_minlen < 0)
+			new_rule->match_minlen = 0;
+
+		new_rule->match_prefix_len = regex_prefix(&new_rule->match_exp,
+			new_rule->match_prefix, DP_RE_PREFIX_MAX);
+	}
 
 	if (subst_comp)
 		new_rule->subst_comp = subst_comp;
@@ -603,6 +663,7 @@ dpl_node_t * build_rule(db_val_t * values)
 
 err:
 	if(parsed_timerec)	shm_free(parsed_timerec);
+	if(match_extra)		wrap_pcre_free_study(match_extra);
 	if(match_comp)		wrap_pcre_free(match_comp);
 	if(subst_comp)		wrap_pcre_free(subst_comp);
 	if(repl_comp)		repl_expr_free(repl_comp);
@@ -611,11 +672,88 @@ err:
 }
 
 
+/* doubles the string buckets of a dpid; the relative order of the rules
+ * within a bucket is kept */
+static int grow_rule_hash(dpl_id_p idp)
+{
+	dpl_index_p new_hash;
+	dpl_node_p rulep, nrule;
+	unsigned int size, i, bucket;
+
+	size = idp->hash_size * 2;
+
+	new_hash = shm_malloc((size+1) * sizeof(dpl_index_t));
+	if (!new_hash) {
+		LM_ERR("out of shm memory (rule_hash)\n");
+		return -1;
+	}
+	memset(new_hash, 0, (size+1) * sizeof(dpl_index_t));
+
+	for (i = 0; i < idp->hash_size; i++)
+		for (rulep = idp->rule_hash[i].first_rule; rulep; rulep = nrule) {
+			nrule = rulep->next;
+			bucket = core_case_hash(&rulep->match_exp, NULL, size);
+			dp_index_append(&new_hash[bucket], rulep, next);
+		}
+
+	/* the regexp bucket */
+	new_hash[size] = idp->rule_hash[idp->hash_size];
+
+	shm_free(idp->rule_hash);
+	idp->rule_hash = new_hash;
+	idp->hash_size = size;
+
+	return 0;
+}
+
+
+/* returns the list of the trie node the regexp rule belongs to */
+static dpl_index_p trie_rule_list(dpl_id_p idp, dpl_node_p rule)
+{
+	dpl_trie_t *node;
+	int i, c;
+
+	node = &idp->re_trie;
+
+	for (i = 0; i < rule->match_prefix_len && i < DP_TRIE_DEPTH; i++) {
+		c = dp_trie_idx(rule->match_prefix[i]);
+		if (c < 0)
+			break;
+
+		if (!node->child[c]) {
+			node->child[c] = shm_malloc(sizeof(dpl_trie_t));
+			if (!node->child[c]) {
+				LM_ERR("out of shm memory (trie)\n");
+				return NULL;
+			}
+			memset(node->child[c], 0, sizeof(dpl_trie_t));
+		}
+
+		node = node->child[c];
+	}
+
+	return &node->rules;
+}
+
+
+static void destroy_trie(dpl_trie_t *node)
+{
+	int i;
+
+	for (i = 0; i < DP_TRIE_CHARS; i++)
+		if (node->child[i]) {
+			destroy_trie(node->child[i]);
+			shm_free(node->child[i]);
+		}
+}
+
+
 int add_rule2hash(dpl_node_t * rule, dp_connection_list_t *conn, int index)
 {
 	dpl_id_p crt_idp;
-	dpl_index_p indexp;
-	int new_id, bucket = 0;
+	dpl_index_p indexp, re_indexp = NULL;
+	int new_id;
+	unsigned int bucket = 0;
 
 	if(!conn){
 		LM_ERR("data not allocated\n");
@@ -627,31 +765,48 @@ int add_rule2hash(dpl_node_t * rule, dp_connection_list_t *conn, int index)
 	crt_idp = select_dpid(conn, rule->dpid, index);
 	/*didn't find a dpl_id*/
 	if(!crt_idp){
-		crt_idp = shm_malloc(sizeof(dpl_id_t) + (DP_INDEX_HASH_SIZE+1) * sizeof(dpl_index_t));
+		crt_idp = shm_malloc(sizeof(dpl_id_t));
 		if(!crt_idp){
 			LM_ERR("out of shm memory (crt_idp)\n");
 			return -1;
 		}
-		memset(crt_idp, 0, sizeof(dpl_id_t) + (DP_INDEX_HASH_SIZE+1) * sizeof(dpl_index_t));
+		memset(crt_idp, 0, sizeof(dpl_id_t));
+		crt_idp->rule_hash = shm_malloc((DP_INDEX_HASH_SIZE+1) * sizeof(dpl_index_t));
+		if(!crt_idp->rule_hash){
+			LM_ERR("out of shm memory (rule_hash)\n");
+			shm_free(crt_idp);
+			return -1;
+		}
+		memset(crt_idp->rule_hash, 0, (DP_INDEX_HASH_SIZE+1) * sizeof(dpl_index_t));
+		crt_idp->hash_size = DP_INDEX_HASH_SIZE;
 		crt_idp->dp_id = rule->dpid;
-		crt_idp->rule_hash = (dpl_index_t*)(crt_idp + 1);
 		new_id = 1;
 		LM_DBG("new dpl_id %i\n", rule->dpid);
 	}
 
 	switch (rule->matchop) {
 		case REGEX_OP:
-			indexp = &crt_idp->rule_hash[DP_INDEX_HASH_SIZE];
+			indexp = &crt_idp->rule_hash[crt_idp->hash_size];
+			re_indexp = trie_rule_list(crt_idp, rule);
+			if (!re_indexp)
+				goto err;
+			bucket = crt_idp->hash_size;
 			break;
 
 		case EQUAL_OP:
 			if (rule->match_exp.s == NULL || rule->match_exp.len == 0) {
 				LM_ERR("NULL matching expressions in database not accepted!!!\n");
-				return -1;
+				goto err;
 			}
-			bucket = core_case_hash(&rule->match_exp, NULL, DP_INDEX_HASH_SIZE);
+
+			/* not fatal, the buckets only get longer */
+			if (crt_idp->str_rules >= crt_idp->hash_size * DP_INDEX_MAX_LOAD)
+				grow_rule_hash(crt_idp);
+
+			bucket = core_case_hash(&rule->match_exp, NULL, crt_idp->hash_size);
 
 			indexp = &crt_idp->rule_hash[bucket];
+			crt_idp->str_rules++;
 			break;
 
 		default:
@@ -662,28 +817,30 @@ int add_rule2hash(dpl_node_t * rule, dp_connection_list_t *conn, int index)
 
 /* Add the new rule to the corresponding bucket */
 
-	rule->next = 0;
-	if(!indexp->first_rule)
-		indexp->first_rule = rule;
+	dp_index_append(indexp, rule, next);
 
-	if(indexp->last_rule)
-		indexp->last_rule->next = rule;
-
-	indexp->last_rule = rule;
+	/* the trie lists keep the order of the regex bucket */
+	if (re_indexp) {
+		rule->re_pos = crt_idp->re_count++;
+		dp_index_append(re_indexp, rule, next_cand);
+	}
 
 	if(new_id){
 		crt_idp->next = conn->hash[conn->next_index];
 		conn->hash[conn->next_index] = crt_idp;
 	}
 	LM_DBG("added the rule id %i pr %i next %p to the "
-		" %i bucket\n", rule->dpid,
-		rule->pr, rule->next, rule->matchop == REGEX_OP ? DP_INDEX_HASH_SIZE : bucket);
+		" %u bucket\n", rule->dpid,
+		rule->pr, rule->next, bucket);
 
 	return 0;
 
 err:
-	if(new_id)
+	if(new_id) {
+		destroy_trie(&crt_idp->re_trie);
+		shm_free(crt_idp->rule_hash);
 		shm_free(crt_idp);
+	}
 	return -1;
 }
 
@@ -693,7 +850,7 @@ void destroy_hash(dpl_id_t **rules_hash)
 	dpl_id_p crt_idp;
 	dpl_index_p indexp;
 	dpl_node_p rulep;
-	int i;
+	unsigned int i;
 
 	if(!rules_hash || !*rules_hash)
 		return;
@@ -701,7 +858,7 @@ void destroy_hash(dpl_id_t **rules_hash)
 	for(crt_idp = *rules_hash; crt_idp; crt_idp = *rules_hash) {
 
 		for (i = 0, indexp = &crt_idp->rule_hash[i];
-			 i <= DP_INDEX_HASH_SIZE;
+			 i <= crt_idp->hash_size;
 			 i++, indexp = &crt_idp->rule_hash[i]) {
 
 			for (rulep = indexp->first_rule; rulep; rulep=indexp->first_rule) {
@@ -715,6 +872,8 @@ void destroy_hash(dpl_id_t **rules_hash)
 		}
 		*rules_hash = crt_idp->next;
 
+		destroy_trie(&crt_idp->re_trie);
+		shm_free(crt_idp->rule_hash);
 		shm_free(crt_idp);
 		crt_idp = NULL;
 	}
@@ -731,6 +890,9 @@ void destroy_rule(dpl_node_t * rule){
 	LM_DBG("destroying rule with priority %i\n",
 		rule->pr);
 
+	if(rule->match_extra)
+		wrap_pcre_free_study(rule->match_extra);
+
 	if(rule->match_comp)
 		wrap_pcre_free(rule->match_comp);
 
@@ -781,7 +943,7 @@ void list_hash(dpl_id_t * hash, rw_lock_t * ref_lock)
 {
 	dpl_id_p crt_idp;
 	dpl_node_p rulep;
-	int i;
+	unsigned int i;
 
 	if(!hash)
 		return;
@@ -792,8 +954,8 @@ void list_hash(dpl_id_t * hash, rw_lock_t * ref_lock)
 	for(crt_idp = hash; crt_idp; crt_idp = crt_idp->next) {
 		LM_DBG("DPID: %i, pointer %p\n", crt_idp->dp_id, crt_idp);
 
-		for (i = 0; i <= DP_INDEX_HASH_SIZE; i++) {
-			LM_DBG("BUCKET %d rules:\n", i);
+		for (i = 0; i <= crt_idp->hash_size; i++) {
+			LM_DBG("BUCKET %u rules:\n", i);
 
 			for(rulep = crt_idp->rule_hash[i].first_rule; rulep;
 				rulep = rulep->next) {
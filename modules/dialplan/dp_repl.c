@@ -278,15 +278,18 @@ error:
 static char dp_attrs_buf[DP_MAX_ATTRS_LEN+1];
 int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str * attrs) {
 
-	dpl_node_p rulep, rrulep;
-	int string_res = -1, regexp_res = -1, bucket;
+	dpl_node_p rulep, rrulep, nrulep = NULL;
+	dpl_node_p cands[DP_TRIE_DEPTH+1];
+	dpl_trie_t *node;
+	int string_res = -1, regexp_res = -1, string_cmp, cands_no, i, c;
+	unsigned int bucket;
 
 	if(!input.s || !input.len) {
 		LM_ERR("invalid input string\n");
 		return -1;
 	}
 
-	bucket = core_case_hash(&input, NULL, DP_INDEX_HASH_SIZE);
+	bucket = core_case_hash(&input, NULL, idp->hash_size);
 
 	/* try to match the input in the corresponding string bucket */
 	for (rulep = idp->rule_hash[bucket].first_rule; rulep; rulep=rulep->next) {
@@ -321,21 +324,64 @@ int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str *
 		}
 	}
 
-	/* try to match the input in the regexp bucket */
-	for (rrulep = idp->rule_hash[DP_INDEX_HASH_SIZE].first_rule; rrulep; rrulep=rrulep->next) {
+	/* try to match the input in the regexp bucket - only the rules of the
+	 * trie nodes along the input (the root holding the rules without a
+	 * prefix) are tried, merged back in the order of the bucket */
+	cands_no = 0;
+	for (i = 0, node = &idp->re_trie; ; i++) {
+		if (node->rules.first_rule)
+			cands[cands_no++] = node->rules.first_rule;
+
+		if (i == input.len || i == DP_TRIE_DEPTH)
+			break;
+
+		c = dp_trie_idx(input.s[i]);
+		if (c < 0 || !node->child[c])
+			break;
+
+		node = node->child[c];
+	}
+
+	while (cands_no) {
+
+		for (c = 0, i = 1; i < cands_no; i++)
+			if (cands[i]->re_pos < cands[c]->re_pos)
+				c = i;
+
+		nrulep = cands[c];
+		if (!(cands[c] = nrulep->next_cand))
+			cands[c] = cands[--cands_no];
+
+		if (input.len < nrulep->match_minlen)
+			continue;
+
+		if (nrulep->match_prefix_len) {
+			if (input.len < nrulep->match_prefix_len)
+				continue;
+
+			if (nrulep->match_flags & DP_CASE_INSENSITIVE)
+				string_cmp = strncasecmp(nrulep->match_prefix, input.s,
+					nrulep->match_prefix_len);
+			else
+				string_cmp = memcmp(nrulep->match_prefix, input.s,
+					nrulep->match_prefix_len);
+
+			if (string_cmp != 0)
+				continue;
+		}
 
 		// Check for Time Period if Set
-		if(rrulep->parsed_timerec) {
-			LM_DBG("Timerec exists for rule checking: %.*s\n", rrulep->timerec.len, rrulep->timerec.s);
+		if(nrulep->parsed_timerec) {
+			LM_DBG("Timerec exists for rule checking: %.*s\n", nrulep->timerec.len, nrulep->timerec.s);
 			// Doesn't matches time period continue with next rule
-			if(tmrec_expr_check(rrulep->parsed_timerec) < 0) {
+			if(tmrec_expr_check(nrulep->parsed_timerec) < 0) {
 				LM_DBG("Time rule doesn't match: skip next!\n");
 				continue;
 			}
 		}
 
-		regexp_res = (test_match(input, rrulep->match_comp, matches, MAX_MATCHES)
-					>= 0 ? 0 : -1);
+		regexp_res = (test_match_extra(input, nrulep->match_comp,
+					nrulep->match_extra, matches, MAX_MATCHES) >= 0 ? 0 : -1);
 
 		LM_DBG("Regex operator testing. Got result: %d\n", regexp_res);
 
@@ -343,6 +389,7 @@ int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str *
 			break;
 		}
 	}
+	rrulep = nrulep;
 
 	if (string_res != 0 && regexp_res != 0) {
 		LM_DBG("No matching rule for input %.*s\n", input.len, input.s);
@@ -398,6 +445,13 @@ int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str *
 
 
 int test_match(str string, pcre * exp, int * out, int out_max)
+{
+	return test_match_extra(string, exp, NULL, out, out_max);
+}
+
+
+int test_match_extra(str string, pcre * exp, pcre_extra * extra,
+		int * out, int out_max)
 {
 	int i, result_count;
 	char *substring_start;
@@ -412,7 +466,7 @@ int test_match(str string, pcre * exp, int * out, int out_max)
 
 	result_count = pcre_exec(
 							exp, /* the compiled pattern */
-							NULL, /* no extra data - we didn't study the pattern */
+							extra, /* the study data, if any */
 							string.s, /* the subject string */
 							string.len, /* the length of the subject */
 							0, /* start at offset 0 in the subject */
@@ -207,6 +207,7 @@ static struct script_route_ref *trace_filter_route_ref = NULL;
 
 static int tls_read_req(struct tcp_connection* con, int* bytes_read);
 static int tls_async_write(struct tcp_connection* con,int fd);
+static int tls_conn_handshake(struct tcp_connection* con);
 static int proto_tls_conn_init(struct tcp_connection* c);
 static void proto_tls_conn_clean(struct tcp_connection* c);
 
@@ -347,6 +348,7 @@ static int proto_tls_init(struct proto_info *pi)
 	pi->net.stream.write		= tls_async_write;
 	pi->net.stream.conn.init	= proto_tls_conn_init;
 	pi->net.stream.conn.clean	= proto_tls_conn_clean;
+	pi->net.stream.conn.handshake	= tls_conn_handshake;
 	if (cert_check_on_conn_reusage)
 		pi->net.stream.conn.match	= tls_conn_extra_match;
 	else
@@ -750,6 +752,27 @@ error:
 	return -1;
 }
 
+/* does only the server side handshake of a conn, without reading any SIP
+ * data - used by the TCP handshake workers */
+static int tls_conn_handshake(struct tcp_connection* con)
+{
+	int ret;
+
+	ret=tls_mgm_api.tls_fix_read_conn(con, con->fd, tls_handshake_tout, t_dst, 1);
+	if (ret < 0) {
+		LM_ERR("failed to do pre-tls handshake!\n");
+		return -1;
+	} else if (ret == 0) {
+		LM_DBG("SSL accept still pending!\n");
+		return 0;
+	} else if (ret != 1) {
+		LM_ERR("failed to do pre-tls reading\n");
+		return -1;
+	}
+
+	return 1;
+}
+
 static int tls_async_write(struct tcp_connection* con, int fd)
 {
 	int n;
@@ -46,6 +46,9 @@ enum tls_method {
 /* SSL extra data indexes */
 #define SSL_EX_CONN_IDX 0
 #define SSL_EX_DOM_IDX 1
+/* the domain of the initial SSL_CTX (before any SNI switch), whose
+ * session cache callbacks are run by the library */
+#define SSL_EX_SESS_DOM_IDX 2
 
 #endif	/* TLS_CONFIG_HELPER_H */
 
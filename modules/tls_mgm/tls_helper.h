@@ -81,9 +81,13 @@ struct tls_domain {
 	struct _str_list *match_addresses;
 	void *ctx;  /* openssl's SSL_CTX or wolfSSL's WOLFSSL_CTX */
 	int ctx_no;  /* number of allocated contexts */
+	void *sess_data;  /* session cache and ticket keys, shared by all
+	                   * the contexts of the domain (TLS library specific) */
 	int verify_cert;
 	int require_client_cert;
 	int crl_check_all;
+	int session_cache;  /* size of the shared session cache, 0 if disabled */
+	int ticket_key_lifetime;  /* seconds between ticket keys rotations */
 	str cert;
 	str pkey;
 	char *crl_directory;
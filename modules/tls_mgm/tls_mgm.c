@@ -127,6 +127,9 @@ static const param_export_t params[] = {
 	{ "certificate",   STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_certificate},
 	{ "private_key",   STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_pk         },
 	{ "crl_check_all", STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_crl_check  },
+	{ "session_cache", STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_session_cache },
+	{ "ticket_key_lifetime", STR_PARAM|USE_FUNC_PARAM,
+		(void*)tlsp_set_ticket_key_lifetime },
 	{ "crl_dir",       STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_crldir     },
 	{ "ca_list",       STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_calist     },
 	{ "ca_dir",        STR_PARAM|USE_FUNC_PARAM,  (void*)tlsp_set_cadir      },
@@ -1256,6 +1259,14 @@ static int list_domain(mi_item_t *domains_arr, struct tls_domain *d)
 		if (add_mi_bool(domain_item, MI_SSTR("CRL_CHECKALL"), d->crl_check_all) < 0)
 			goto error;
 
+		if (add_mi_number(domain_item, MI_SSTR("SESSION_CACHE"),
+			d->session_cache) < 0)
+			goto error;
+
+		if (add_mi_number(domain_item, MI_SSTR("TICKET_KEY_LIFETIME"),
+			d->ticket_key_lifetime) < 0)
+			goto error;
+
 		if (!(d->flags & DOM_FLAG_DB))
 			if (add_mi_string(domain_item, MI_SSTR("CERT_FILE"),
 				d->cert.s, d->cert.len) < 0)
@@ -280,6 +280,42 @@ int tlsp_set_crl_check(modparam_t type, void *in)
 	return 1;
 }
 
+int tlsp_set_session_cache(modparam_t type, void *in)
+{
+	str name;
+	str val;
+	unsigned int size;
+
+	if (split_param_val((char*)in, &name, &val) < 0)
+		return -1;
+
+	if (str2int(&val, &size)!=0) {
+		LM_ERR("option is not a number [%s]\n",val.s);
+		return -1;
+	}
+
+	set_domain_attr(name, session_cache, size);
+	return 1;
+}
+
+int tlsp_set_ticket_key_lifetime(modparam_t type, void *in)
+{
+	str name;
+	str val;
+	unsigned int lifetime;
+
+	if (split_param_val((char*)in, &name, &val) < 0)
+		return -1;
+
+	if (str2int(&val, &lifetime)!=0) {
+		LM_ERR("option is not a number [%s]\n",val.s);
+		return -1;
+	}
+
+	set_domain_attr(name, ticket_key_lifetime, lifetime);
+	return 1;
+}
+
 int tlsp_set_crldir(modparam_t type, void *in)
 {
 	str name;
@@ -59,6 +59,10 @@ int tlsp_set_require(modparam_t type, void *val);
 
 int tlsp_set_crl_check(modparam_t type, void *val);
 
+int tlsp_set_session_cache(modparam_t type, void *val);
+
+int tlsp_set_ticket_key_lifetime(modparam_t type, void *val);
+
 int tlsp_set_certificate(modparam_t type, void *val);
 
 int tlsp_set_pk(modparam_t type, void *val);
@@ -40,6 +40,7 @@
 
 #include "openssl_helpers.h"
 #include "openssl_api.h"
+#include "openssl_sess_cache.h"
 
 #if (OPENSSL_VERSION_NUMBER >= 0x10100000L && defined __OS_linux)
 #include <features.h>
@@ -104,6 +105,14 @@ static const cmd_export_t cmds[] = {
 	{0,0,{{0,0,0}},0}
 };
 
+static const stat_export_t mod_stats[] = {
+	{"sess_cache_hits",   0,  &sess_cache_hits   },
+	{"sess_cache_misses", 0,  &sess_cache_misses },
+	{"ticket_hits",       0,  &ticket_hits       },
+	{"ticket_misses",     0,  &ticket_misses     },
+	{0, 0, 0}
+};
+
 struct module_exports exports = {
 	"tls_openssl",  /* module name*/
 	MOD_TYPE_DEFAULT,/* class of this module */
@@ -114,7 +123,7 @@ struct module_exports exports = {
 	cmds,          /* exported functions */
 	0,          /* exported async functions */
 	0,          /* module parameters */
-	0,          /* exported statistics */
+	mod_stats,  /* exported statistics */
 	0,          /* exported MI functions */
 	0,          /* exported pseudo-variables */
 	0,			/* exported transformations */
@@ -32,6 +32,7 @@
 #include "../tls_mgm/tls_helper.h"
 
 #include "openssl_api.h"
+#include "openssl_sess_cache.h"
 
 void tls_dump_cert_info(char* s, X509* cert);
 void tls_print_errstack(void);
@@ -753,6 +754,9 @@ int openssl_init_tls_dom(struct tls_domain *d, int init_flags)
 
 	d->ctx_no = tcp_procs;
 
+	if (openssl_sess_data_init(d) < 0)
+		return -1;
+
 	for (i = 0; i < tcp_procs; i++) {
 		/*
 		 * create context
@@ -819,8 +823,9 @@ int openssl_init_tls_dom(struct tls_domain *d, int init_flags)
 		SSL_CTX_set_verify(((void**)d->ctx)[i], verify_mode, verify_callback);
 		SSL_CTX_set_verify_depth(((void**)d->ctx)[i], VERIFY_DEPTH_S);
 
-		//SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER );
-		SSL_CTX_set_session_cache_mode(((void**)d->ctx)[i], SSL_SESS_CACHE_OFF );
+		/* no session resumption, unless the shared session cache or
+		 * ticket keys are enabled for the domain */
+		openssl_sess_ctx_setup(d, ((void**)d->ctx)[i]);
 		SSL_CTX_set_session_id_context(((void**)d->ctx)[i], (unsigned char*)OS_SSL_SESS_ID,
 				OS_SSL_SESS_ID_LEN );
 
@@ -1021,4 +1026,6 @@ void openssl_destroy_tls_dom(struct tls_domain *tls_dom)
 				SSL_CTX_free(((void**)tls_dom->ctx)[i]);
 		shm_free(tls_dom->ctx);
 	}
+
+	openssl_sess_data_destroy(tls_dom);
 }
@@ -224,7 +224,8 @@ int openssl_tls_conn_init(struct tcp_connection* c, struct tls_domain *tls_dom)
 		LM_ERR("Failed to store tcp_connection pointer in SSL struct\n");
 		return -1;
 	}
-	if (!SSL_set_ex_data(c->extra_data, SSL_EX_DOM_IDX, tls_dom)) {
+	if (!SSL_set_ex_data(c->extra_data, SSL_EX_DOM_IDX, tls_dom) ||
+	!SSL_set_ex_data(c->extra_data, SSL_EX_SESS_DOM_IDX, tls_dom)) {
 		LM_ERR("Failed to store tls_domain pointer in SSL struct\n");
 		return -1;
 	}
@@ -0,0 +1,431 @@
+/*
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ *
+ */
+
+/*
+ * Session resumption across the OpenSIPS processes: each process has its
+ * own SSL_CTX for a TLS domain, so both the internal session cache and the
+ * (randomly generated) ticket keys of OpenSSL are private to the process
+ * which did the full handshake. Here, the sessions (for the session ID
+ * based resumption) and the ticket keys (for the ticket based resumption)
+ * are kept in shared memory, per TLS domain.
+ */
+
+#include <string.h>
+
+#include <openssl/ssl.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
+#include "../../dprint.h"
+#include "../../mem/shm_mem.h"
+#include "../../locking.h"
+#include "../../timer.h"
+#include "../../hash_func.h"
+#include "../tls_mgm/tls_config_helper.h"
+
+#include "openssl_sess_cache.h"
+
+#define TICKET_KEY_NAME_LEN  16
+#define TICKET_KEY_LEN       32
+
+struct sess_entry {
+	unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+	unsigned int id_len;
+	unsigned int expires;
+	/* the DER encoded session */
+	unsigned char *der;
+	int der_len;
+};
+
+struct ticket_key {
+	unsigned char name[TICKET_KEY_NAME_LEN];
+	unsigned char aes_key[TICKET_KEY_LEN];
+	unsigned char hmac_key[TICKET_KEY_LEN];
+	unsigned int created;
+};
+
+struct openssl_sess_data {
+	gen_lock_t lock;
+	/* the session cache - direct mapped, a new session replaces
+	 * the one already stored in its slot */
+	struct sess_entry *entries;
+	unsigned int size;
+	/* the ticket keys - the current one, used for the new tickets,
+	 * and the previous one, still accepted for decryption */
+	struct ticket_key keys[2];
+	int has_prev_key;
+	unsigned int key_lifetime;
+};
+
+stat_var *sess_cache_hits;
+stat_var *sess_cache_misses;
+stat_var *ticket_hits;
+stat_var *ticket_misses;
+
+
+/* the library runs the session callbacks of the initial SSL_CTX of the
+ * connection, even if SNI switched it to the context of another domain,
+ * so the session data of the initial domain must be used too */
+static inline struct openssl_sess_data *ssl_sess_data(SSL *ssl)
+{
+	struct tls_domain *d;
+
+	d = (struct tls_domain *)SSL_get_ex_data(ssl, SSL_EX_SESS_DOM_IDX);
+	return d ? (struct openssl_sess_data *)d->sess_data : NULL;
+}
+
+static inline struct sess_entry *sess_slot(struct openssl_sess_data *sd,
+								const unsigned char *id, unsigned int id_len)
+{
+	str s;
+
+	s.s = (char *)id;
+	s.len = id_len;
+	return &sd->entries[core_hash(&s, NULL, sd->size)];
+}
+
+static inline void sess_entry_free(struct sess_entry *e)
+{
+	if (e->der) {
+		shm_free(e->der);
+		e->der = NULL;
+	}
+	e->der_len = 0;
+	e->id_len = 0;
+}
+
+static int sess_new_cb(SSL *ssl, SSL_SESSION *sess)
+{
+	struct openssl_sess_data *sd;
+	struct sess_entry *e;
+	const unsigned char *id;
+	unsigned int id_len;
+	unsigned char *der, *p;
+	int der_len;
+
+	sd = ssl_sess_data(ssl);
+	if (!sd || !sd->size)
+		return 0;
+
+	id = SSL_SESSION_get_id(sess, &id_len);
+	if (id_len == 0 || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+		return 0;
+
+	der_len = i2d_SSL_SESSION(sess, NULL);
+	if (der_len <= 0)
+		return 0;
+
+	der = shm_malloc(der_len);
+	if (!der) {
+		LM_ERR("no more shm memory for the TLS session\n");
+		return 0;
+	}
+	p = der;
+	i2d_SSL_SESSION(sess, &p);
+
+	e = sess_slot(sd, id, id_len);
+
+	lock_get(&sd->lock);
+	sess_entry_free(e);
+	memcpy(e->id, id, id_len);
+	e->id_len = id_len;
+	e->expires = get_ticks() + SSL_SESSION_get_timeout(sess);
+	e->der = der;
+	e->der_len = der_len;
+	lock_release(&sd->lock);
+
+	/* we keep our own copy, not a reference to the session */
+	return 0;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+static SSL_SESSION *sess_get_cb(SSL *ssl, const unsigned char *id,
+		int id_len, int *copy)
+#else
+static SSL_SESSION *sess_get_cb(SSL *ssl, unsigned char *id,
+		int id_len, int *copy)
+#endif
+{
+	struct openssl_sess_data *sd;
+	struct sess_entry *e;
+	SSL_SESSION *sess = NULL;
+	const unsigned char *p;
+
+	*copy = 0;
+
+	sd = ssl_sess_data(ssl);
+	if (!sd || !sd->size || id_len <= 0)
+		return NULL;
+
+	e = sess_slot(sd, id, id_len);
+
+	lock_get(&sd->lock);
+	if (e->id_len == (unsigned int)id_len && !memcmp(e->id, id, id_len)) {
+		if (e->expires > get_ticks()) {
+			p = e->der;
+			sess = d2i_SSL_SESSION(NULL, &p, e->der_len);
+		} else {
+			sess_entry_free(e);
+		}
+	}
+	lock_release(&sd->lock);
+
+	if (sess)
+		update_stat(sess_cache_hits, 1);
+	else
+		update_stat(sess_cache_misses, 1);
+
+	return sess;
+}
+
+static void sess_remove_cb(SSL_CTX *ctx, SSL_SESSION *sess)
+{
+	struct tls_domain *d;
+	struct openssl_sess_data *sd;
+	struct sess_entry *e;
+	const unsigned char *id;
+	unsigned int id_len;
+
+	/* no SSL here, the domain is attached to the context */
+	d = (struct tls_domain *)SSL_CTX_get_app_data(ctx);
+	if (!d || !(sd = d->sess_data) || !sd->size)
+		return;
+
+	id = SSL_SESSION_get_id(sess, &id_len);
+	if (id_len == 0 || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+		return;
+
+	e = sess_slot(sd, id, id_len);
+
+	lock_get(&sd->lock);
+	if (e->id_len == id_len && !memcmp(e->id, id, id_len))
+		sess_entry_free(e);
+	lock_release(&sd->lock);
+}
+
+static int ticket_key_gen(struct ticket_key *k)
+{
+	if (RAND_bytes(k->name, TICKET_KEY_NAME_LEN) != 1 ||
+		RAND_bytes(k->aes_key, TICKET_KEY_LEN) != 1 ||
+		RAND_bytes(k->hmac_key, TICKET_KEY_LEN) != 1) {
+		LM_ERR("failed to generate a TLS ticket key\n");
+		return -1;
+	}
+	k->created = get_ticks();
+
+	return 0;
+}
+
+/* rotates the ticket keys, if the current one is too old
+ * Note: the session data must be locked */
+static inline void ticket_keys_rotate(struct openssl_sess_data *sd)
+{
+	struct ticket_key k;
+
+	if (get_ticks() - sd->keys[0].created < sd->key_lifetime)
+		return;
+
+	if (ticket_key_gen(&k) < 0)
+		return;
+
+	sd->keys[1] = sd->keys[0];
+	sd->keys[0] = k;
+	sd->has_prev_key = 1;
+	LM_DBG("TLS ticket keys rotated\n");
+}
+
+/* fetches the ticket key to be used for a new ticket (enc), or the one
+ * matching the name of a received ticket; returns the index of the key
+ * (0 - current, 1 - previous) or -1 if not found */
+static int ticket_key_get(struct openssl_sess_data *sd, unsigned char *name,
+											struct ticket_key *k, int enc)
+{
+	int i = -1;
+
+	lock_get(&sd->lock);
+	ticket_keys_rotate(sd);
+	if (enc) {
+		i = 0;
+	} else if (!memcmp(name, sd->keys[0].name, TICKET_KEY_NAME_LEN)) {
+		i = 0;
+	} else if (sd->has_prev_key &&
+	!memcmp(name, sd->keys[1].name, TICKET_KEY_NAME_LEN)) {
+		i = 1;
+	}
+	if (i >= 0)
+		*k = sd->keys[i];
+	lock_release(&sd->lock);
+
+	return i;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+static int ticket_key_cb(SSL *ssl, unsigned char *key_name,
+		unsigned char *iv, EVP_CIPHER_CTX *ctx, EVP_MAC_CTX *hctx, int enc)
+#else
+static int ticket_key_cb(SSL *ssl, unsigned char *key_name,
+		unsigned char *iv, EVP_CIPHER_CTX *ctx, HMAC_CTX *hctx, int enc)
+#endif
+{
+	struct openssl_sess_data *sd;
+	struct ticket_key k;
+	int i;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	OSSL_PARAM params[3];
+#endif
+
+	sd = ssl_sess_data(ssl);
+	if (!sd || !sd->key_lifetime)
+		/* no ticket issued / accepted */
+		return 0;
+
+	i = ticket_key_get(sd, key_name, &k, enc);
+	if (i < 0) {
+		update_stat(ticket_misses, 1);
+		return 0;
+	}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY,
+		k.hmac_key, TICKET_KEY_LEN);
+	params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+		"sha256", 0);
+	params[2] = OSSL_PARAM_construct_end();
+	if (!EVP_MAC_CTX_set_params(hctx, params))
+		return -1;
+#else
+	if (!HMAC_Init_ex(hctx, k.hmac_key, TICKET_KEY_LEN, EVP_sha256(), NULL))
+		return -1;
+#endif
+
+	if (enc) {
+		memcpy(key_name, k.name, TICKET_KEY_NAME_LEN);
+		if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+			return -1;
+		if (!EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, k.aes_key, iv))
+			return -1;
+		return 1;
+	}
+
+	if (!EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, k.aes_key, iv))
+		return -1;
+	update_stat(ticket_hits, 1);
+
+	/* a ticket encrypted with the previous key is renewed */
+	return i == 0 ? 1 : 2;
+}
+
+int openssl_sess_data_init(struct tls_domain *d)
+{
+	struct openssl_sess_data *sd;
+	unsigned int size;
+
+	if (!(d->flags & DOM_FLAG_SRV) ||
+	(!d->session_cache && !d->ticket_key_lifetime))
+		return 0;
+
+	/* the hash size must be a power of 2 */
+	for (size = d->session_cache ? 1 : 0; size && size < d->session_cache;
+	size <<= 1);
+
+	sd = shm_malloc(sizeof *sd + size * sizeof *sd->entries);
+	if (!sd) {
+		LM_ERR("no more shm memory for the TLS session cache\n");
+		return -1;
+	}
+	memset(sd, 0, sizeof *sd + size * sizeof *sd->entries);
+
+	if (!lock_init(&sd->lock)) {
+		LM_ERR("failed to init the TLS session cache lock\n");
+		shm_free(sd);
+		return -1;
+	}
+
+	sd->entries = (struct sess_entry *)(sd + 1);
+	sd->size = size;
+	sd->key_lifetime = d->ticket_key_lifetime;
+	if (sd->key_lifetime && ticket_key_gen(&sd->keys[0]) < 0) {
+		lock_destroy(&sd->lock);
+		shm_free(sd);
+		return -1;
+	}
+
+	d->sess_data = sd;
+	LM_DBG("session cache of %u entries, ticket keys lifetime %us for "
+		"domain '%.*s'\n", sd->size, sd->key_lifetime,
+		d->name.len, d->name.s);
+
+	return 0;
+}
+
+void openssl_sess_ctx_setup(struct tls_domain *d, SSL_CTX *ctx)
+{
+	struct openssl_sess_data *sd = d->sess_data;
+
+	if (!sd) {
+		SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+		return;
+	}
+
+	SSL_CTX_set_app_data(ctx, d);
+
+	if (sd->size) {
+		SSL_CTX_set_session_cache_mode(ctx,
+			SSL_SESS_CACHE_SERVER|SSL_SESS_CACHE_NO_INTERNAL);
+		SSL_CTX_sess_set_new_cb(ctx, sess_new_cb);
+		SSL_CTX_sess_set_get_cb(ctx, sess_get_cb);
+		SSL_CTX_sess_set_remove_cb(ctx, sess_remove_cb);
+	} else {
+		SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+	}
+
+	if (sd->key_lifetime) {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, ticket_key_cb);
+#else
+		SSL_CTX_set_tlsext_ticket_key_cb(ctx, ticket_key_cb);
+#endif
+	} else {
+		/* the default ticket keys are private to each process, so make
+		 * the clients use the (shared) session IDs instead */
+		SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+	}
+}
+
+void openssl_sess_data_destroy(struct tls_domain *d)
+{
+	struct openssl_sess_data *sd = d->sess_data;
+	unsigned int i;
+
+	if (!sd)
+		return;
+
+	for (i = 0; i < sd->size; i++)
+		sess_entry_free(&sd->entries[i]);
+	lock_destroy(&sd->lock);
+	shm_free(sd);
+	d->sess_data = NULL;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ *
+ */
+
+#ifndef OPENSSL_SESS_CACHE_H
+#define OPENSSL_SESS_CACHE_H
+
+#include <openssl/ssl.h>
+
+#include "../../statistics.h"
+#include "../tls_mgm/tls_helper.h"
+
+extern stat_var *sess_cache_hits;
+extern stat_var *sess_cache_misses;
+extern stat_var *ticket_hits;
+extern stat_var *ticket_misses;
+
+/* allocates the session cache and the ticket keys of a server domain,
+ * shared by all its SSL contexts (one per process) */
+int openssl_sess_data_init(struct tls_domain *d);
+
+/* sets a SSL context of the domain to use the shared session data */
+void openssl_sess_ctx_setup(struct tls_domain *d, SSL_CTX *ctx);
+
+void openssl_sess_data_destroy(struct tls_domain *d);
+
+#endif /* OPENSSL_SESS_CACHE_H */
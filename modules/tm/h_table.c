@@ -38,6 +38,7 @@
  */
 
 #include <stdlib.h>
+#include <sched.h>
 
 
 #include "../../mem/shm_mem.h"
@@ -85,16 +86,50 @@ enum kill_reason get_kr(void) {
 
 void lock_hash(int i)
 {
-	lock(&tm_table->entrys[i].mutex);
+	struct entry *e = &tm_table->entrys[i];
+	int busy = e->locked || e->readers;
+
+	lock(&e->mutex);
+
+	/* no new readers may come in while we hold the mutex, so wait for the
+	 * ones still matching against the entry */
+	if (busy || e->readers)
+		e->contentions++;
+	while (e->readers)
+		sched_yield();
+
+	e->locked = 1;
 }
 
 
 void unlock_hash(int i)
 {
+	tm_table->entrys[i].locked = 0;
 	unlock(&tm_table->entrys[i].mutex);
 }
 
 
+void lock_hash_read(int i)
+{
+	struct entry *e = &tm_table->entrys[i];
+	int busy = e->locked;
+
+	/* the mutex is held only to register as reader, not for the whole
+	 * matching, so readers do not serialize with each other */
+	lock(&e->mutex);
+	if (busy)
+		e->contentions++;
+	__sync_fetch_and_add(&e->readers, 1);
+	unlock(&e->mutex);
+}
+
+
+void unlock_hash_read(int i)
+{
+	__sync_fetch_and_sub(&tm_table->entrys[i].readers, 1);
+}
+
+
 struct s_table* get_tm_table(void)
 {
 	return tm_table;
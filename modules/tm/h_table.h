@@ -62,8 +62,16 @@ struct retr_buf;
 #define LOCK_HASH(_h) lock_hash((_h))
 #define UNLOCK_HASH(_h) unlock_hash((_h))
 
+/* shared locking of an entry - only for read-only matching against its
+ * transactions; any number of processes may hold it at the same time, but
+ * it excludes the (exclusive) LOCK_HASH */
+#define LOCK_HASH_READ(_h) lock_hash_read((_h))
+#define UNLOCK_HASH_READ(_h) unlock_hash_read((_h))
+
 void lock_hash(int i);
 void unlock_hash(int i);
+void lock_hash_read(int i);
+void unlock_hash_read(int i);
 
 
 #define NO_CANCEL       ( (char*) 0 )
@@ -323,6 +331,12 @@ typedef struct entry
 	unsigned int    next_label;
 	/* sync mutex */
 	ser_lock_t      mutex;
+	/* processes currently holding the entry in shared (read) mode */
+	volatile unsigned int readers;
+	/* set while the entry is held in exclusive mode */
+	volatile unsigned int locked;
+	/* how many times the entry was found busy when trying to lock it */
+	unsigned long contentions;
 	unsigned long acc_entries;
 	unsigned long cur_entries;
 }entry_type;
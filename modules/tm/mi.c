@@ -645,6 +645,9 @@ mi_response_t *mi_tm_hash(const mi_params_t *params,
 		if (add_mi_number(resp_item, MI_SSTR("Total"),
 			tm_t->entrys[i].acc_entries) < 0)
 			goto error;
+		if (add_mi_number(resp_item, MI_SSTR("Contentions"),
+			tm_t->entrys[i].contentions) < 0)
+			goto error;
 	}
 
 	return resp;
@@ -119,8 +119,10 @@ int send_pr_buffer( struct retr_buf *rb, void *buf, int len, void* ctx);
 	LOCK_HASH( (_T_cell)->hash_index ); \
 	UNREF_UNSAFE(_T_cell); \
 	UNLOCK_HASH( (_T_cell)->hash_index ); }while(0)
+/* atomic, as it may be done under the shared (read) lock of the entry,
+ * concurrently with other processes */
 #define REF_UNSAFE(_T_cell) do {\
-	((_T_cell)->ref_count++);\
+	__sync_fetch_and_add(&(_T_cell)->ref_count, 1);\
 	LM_DBG("REF_UNSAFE:[%p] after is %d\n",_T_cell, (_T_cell)->ref_count);\
 	}while(0)
 #define INIT_REF_UNSAFE(_T_cell) ((_T_cell)->ref_count=1)
@@ -395,6 +395,7 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked )
 	struct sip_msg  *t_msg;
 	struct via_param *branch;
 	int match_status;
+	int shared;
 
 	isACK = p_msg->REQ_METHOD==METHOD_ACK;
 
@@ -420,6 +421,11 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked )
 	LM_DBG("start searching: hash=%d, isACK=%d\n",
 		p_msg->hash_index,isACK);
 
+	/* retransmissions and ACKs are only matched, so do it under the shared
+	 * lock first; the exclusive lock (and a second search) is needed only
+	 * if the entry must be left locked for inserting a new transaction */
+	shared = 1;
+again:
 
 	/* first of all, look if there is RFC3261 magic cookie in branch; if
 	 * so, we can do very quick matching and skip the old-RFC bizzar
@@ -434,7 +440,10 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked )
 	if (branch && branch->value.s && branch->value.len>MCOOKIE_LEN
 			&& memcmp(branch->value.s,MCOOKIE,MCOOKIE_LEN)==0) {
 		/* huhuhu! the cookie is there -- let's proceed fast */
-		LOCK_HASH(p_msg->hash_index);
+		if (shared)
+			LOCK_HASH_READ(p_msg->hash_index);
+		else
+			LOCK_HASH(p_msg->hash_index);
 		match_status=matching_3261(p_msg,&p_cell,
 				/* skip transactions with different method; otherwise CANCEL
 				 * would match the previous INVITE trans.  */
@@ -452,7 +461,10 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked )
 	LM_DBG("proceeding to pre-RFC3261 transaction matching\n");
 
 	/* lock the whole entry*/
-	LOCK_HASH(p_msg->hash_index);
+	if (shared)
+		LOCK_HASH_READ(p_msg->hash_index);
+	else
+		LOCK_HASH(p_msg->hash_index);
 
 	/* all the transactions from the entry are compared */
 	for ( p_cell = get_tm_table()->entrys[p_msg->hash_index].first_cell;
@@ -530,18 +542,29 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked )
 	} /* synonym loop */
 
 notfound:
+	if (shared) {
+		UNLOCK_HASH_READ(p_msg->hash_index);
+		if (leave_new_locked && !isACK) {
+			/* search again, with the entry exclusively locked, as the
+			 * transaction may have been created in the meantime */
+			shared = 0;
+			goto again;
+		}
+	} else if (!leave_new_locked || isACK) {
+		UNLOCK_HASH(p_msg->hash_index);
+	}
 	/* no transaction found */
 	set_t(0);
 	e2eack_T = NULL;
-	if (!leave_new_locked || isACK) {
-		UNLOCK_HASH(p_msg->hash_index);
-	}
 	LM_DBG("no transaction found\n");
 	return -1;
 
 e2e_ack:
 	REF_UNSAFE( p_cell );
-	UNLOCK_HASH(p_msg->hash_index);
+	if (shared)
+		UNLOCK_HASH_READ(p_msg->hash_index);
+	else
+		UNLOCK_HASH(p_msg->hash_index);
 	e2eack_T = p_cell;
 	set_t(0);
 	LM_DBG("e2e proxy ACK found\n");
@@ -551,7 +574,10 @@ found:
 	set_t(p_cell);
 	REF_UNSAFE( T );
 	set_kr(REQ_EXIST);
-	UNLOCK_HASH( p_msg->hash_index );
+	if (shared)
+		UNLOCK_HASH_READ(p_msg->hash_index);
+	else
+		UNLOCK_HASH(p_msg->hash_index);
 	LM_DBG("transaction found (T=%p)\n",T);
 	if (has_tran_tmcbs( T, TMCB_MSG_MATCHED_IN) )
 		run_trans_callbacks( TMCB_MSG_MATCHED_IN, T, p_msg, 0,0);
@@ -598,7 +624,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 	if (branch && branch->value.s && branch->value.len>MCOOKIE_LEN
 			&& memcmp(branch->value.s,MCOOKIE,MCOOKIE_LEN)==0) {
 		/* huhuhu! the cookie is there -- let's proceed fast */
-		LOCK_HASH(hash_index);
+		LOCK_HASH_READ(hash_index);
 		ret=matching_3261(p_msg, &p_cell,
 				/* we are seeking the original transaction --
 				 * skip CANCEL transactions during search
@@ -609,7 +635,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 
 	/* no cookies --proceed to old-fashioned pre-3261 t-matching */
 
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 
 	/* all the transactions from the entry are compared */
 	for (p_cell=get_tm_table()->entrys[hash_index].first_cell;
@@ -674,7 +700,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 notfound:
 	/* no transaction found */
 	LM_DBG("no CANCEL matching found! \n" );
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	cancelled_T = NULL;
 	LM_DBG("t_lookupOriginalT completed\n");
 	return 0;
@@ -683,7 +709,7 @@ found:
 	LM_DBG("canceled transaction found (%p)! \n",p_cell );
 	cancelled_T = p_cell;
 	REF_UNSAFE( p_cell );
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	/* run callback */
 	run_trans_callbacks( TMCB_TRANS_CANCELLED, cancelled_T, p_msg, 0,0);
 	LM_DBG("t_lookupOriginalT completed\n");
@@ -787,8 +813,9 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 	cseq = get_cseq(p_msg);
 
 	/* search the hash table list at entry 'hash_index'; lock the
-	   entry first */
-	LOCK_HASH(hash_index);
+	   entry first (shared, the replies of different transactions
+	   may be matched in parallel) */
+	LOCK_HASH_READ(hash_index);
 
 	for (p_cell = get_tm_table()->entrys[hash_index].first_cell; p_cell;
 		p_cell=p_cell->next_cell) {
@@ -824,7 +851,7 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 		set_t(p_cell);
 		*p_branch = branch_id;
 		REF_UNSAFE( T );
-		UNLOCK_HASH(hash_index);
+		UNLOCK_HASH_READ(hash_index);
 		LM_DBG("reply matched (T=%p)!\n",T);
 		/* if this is a 200 for INVITE, we will wish to store to-tags to be
 		 * able to distinguish retransmissions later and not to call
@@ -848,7 +875,7 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 	} /* for cycle */
 
 	/* nothing found */
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	LM_DBG("no matching transaction exists\n");
 
 nomatch2:
@@ -1215,7 +1242,7 @@ int t_lookup_ident(struct cell ** trans, unsigned int hash_index,
 		return -1;
 	}
 
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 
 	/* all the transactions from the entry are compared */
 	for ( p_cell = get_tm_table()->entrys[hash_index].first_cell;
@@ -1223,14 +1250,14 @@ int t_lookup_ident(struct cell ** trans, unsigned int hash_index,
 	{
 		if(p_cell->label == label){
 			REF_UNSAFE(p_cell);
-			UNLOCK_HASH(hash_index);
+			UNLOCK_HASH_READ(hash_index);
 			*trans=p_cell;
 			LM_DBG("transaction found\n");
 			return 1;
 		}
 	}
 
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	*trans=p_cell;
 
 	LM_DBG("transaction not found\n");
@@ -1296,7 +1323,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 	LM_DBG("created comparable cseq header field: >%.*s<\n",
 			(int)(endpos - cseq_header), cseq_header);
 
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 
 	/* all the transactions from the entry are compared */
 	p_cell = get_tm_table()->entrys[hash_index].first_cell;
@@ -1311,7 +1338,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 				p_cell->callid.len,p_cell->callid.s, p_cell->cseq_n.len,
 				p_cell->cseq_n.s);
 			REF_UNSAFE(p_cell);
-			UNLOCK_HASH(hash_index);
+			UNLOCK_HASH_READ(hash_index);
 			set_t(p_cell);
 			*trans=p_cell;
 			LM_DBG("transaction found.\n");
@@ -1322,7 +1349,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 			p_cell->cseq_n.len, p_cell->cseq_n.s);
 	}
 
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	LM_DBG("transaction not found.\n");
 
 	return -1;
@@ -34,13 +34,15 @@
   for high performance using some techniques of which timer users
   need to be aware.
 
-	One technique is "fixed-timer-length". We maintain separate
-	timer lists, all of them include elements of the same time
-	to fire. That allows *appending* new events to the list as
-	opposed to inserting them by time, which is costly due to
-	searching time spent in a mutex. The performance benefit is
-	noticeable. The limitation is you need a new timer list for
-	each new timer length.
+	One technique is the "timing wheel". Each timer list is a hierarchical
+	wheel of slots, each slot holding the elements to fire within the
+	same tick (or range of ticks, on the upper levels), so adding or
+	removing an element is O(1) regardless of its timeout (think of
+	per-transaction FR timeouts) and of the number of elements, which
+	keeps the time spent in the timer mutex short. The timer process
+	expires the level 0 slot of each tick and, once all the slots of a
+	level were passed, it moves the elements of the next upper slot
+	down to the lower levels ("cascading").
 
 	Another technique is the timer process slices off expired elements
 	from the list in a mutex, but executes the timer after the mutex
@@ -108,6 +110,7 @@
 #include "../../parser/parser_f.h"
 #include "../../ut.h"
 #include "../../context.h"
+#include "../../net/net_udp.h"
 #include "t_funcs.h"
 #include "t_reply.h"
 #include "t_cancel.h"
@@ -519,27 +522,38 @@ struct timer_table *get_timertable(void)
 
 void unlink_timer_lists(void)
 {
-	struct timer_link  *tl, *end, *tmp;
+	struct timer_link  *tl, *end, *tmp, *dl;
+	struct timer *list;
 	enum lists i;
 	unsigned int set;
+	int lvl, slot;
 
 	if (timertable==0)
 		return; /* nothing to do */
 
 	for ( set=0 ; set<timer_sets ; set++) {
 		/* remember the DELETE LIST */
-		tl = timertable[set].timers[DELETE_LIST].first_tl.next_tl;
-		end = & timertable[set].timers[DELETE_LIST].last_tl;
+		dl = NULL;
+		list = &timertable[set].timers[DELETE_LIST];
+		for ( lvl=0 ; lvl<TM_WHEEL_LEVELS ; lvl++ )
+			for ( slot=0 ; slot<TM_WHEEL_SIZE ; slot++ ) {
+				end = &list->slots[lvl][slot];
+				for ( tl=end->next_tl ; tl!=end ; tl=tmp ) {
+					tmp = tl->next_tl;
+					tl->next_tl = dl;
+					dl = tl;
+				}
+			}
 		/* unlink the timer lists */
 		for( i=0; i<NR_OF_TIMER_LISTS ; i++ )
 			reset_timer_list( set, i );
 		LM_DBG("emptying DELETE list for set %d\n",set);
-		/* deletes all cells from DELETE_LIST list 
+		/* deletes all cells from DELETE_LIST list
 		   (they are no more accessible from entries) */
-		while (tl!=end) {
-			tmp=tl->next_tl;
-			free_cell( get_dele_timer_payload(tl) );
-			tl=tmp;
+		while (dl) {
+			tmp=dl->next_tl;
+			free_cell( get_dele_timer_payload(dl) );
+			dl=tmp;
 		}
 	}
 
@@ -655,13 +669,20 @@ void free_timer_table(void)
 
 void reset_timer_list(unsigned int set, enum lists list_id)
 {
-	timertable[set].timers[list_id].first_tl.next_tl =
-		&(timertable[set].timers[list_id].last_tl );
-	timertable[set].timers[list_id].last_tl.prev_tl =
-		&(timertable[set].timers[list_id].first_tl );
-	timertable[set].timers[list_id].first_tl.prev_tl =
-		timertable[set].timers[list_id].last_tl.next_tl = NULL;
-	timertable[set].timers[list_id].last_tl.time_out = -1;
+	struct timer *list = &timertable[set].timers[list_id];
+	struct timer_link *head;
+	int lvl, slot;
+
+	for ( lvl=0 ; lvl<TM_WHEEL_LEVELS ; lvl++ )
+		for ( slot=0 ; slot<TM_WHEEL_SIZE ; slot++ ) {
+			head = &list->slots[lvl][slot];
+			head->next_tl = head->prev_tl = head;
+		}
+
+	list->tick_len = (timer_id2type[list_id]==UTIME_TYPE) ?
+		TM_UTIMER_ITV_US : TM_TIMER_ITV_S;
+	list->cur_tick = 0;
+	list->count = 0;
 }
 
 
@@ -677,15 +698,16 @@ void init_timer_list(unsigned int set, enum lists list_id)
 void print_timer_list(unsigned int set, enum lists list_id)
 {
 	struct timer* timer_list=&(timertable[set].timers[ list_id ]);
-	struct timer_link *tl ;
-
-	tl = timer_list->first_tl.next_tl;
-	while (tl!=& timer_list->last_tl)
-	{
-		LM_DBG("[%d]: %p, next=%p \n",
-			list_id, tl, tl->next_tl);
-		tl = tl->next_tl;
-	}
+	struct timer_link *tl, *head;
+	int lvl, slot;
+
+	for ( lvl=0 ; lvl<TM_WHEEL_LEVELS ; lvl++ )
+		for ( slot=0 ; slot<TM_WHEEL_SIZE ; slot++ ) {
+			head = &timer_list->slots[lvl][slot];
+			for ( tl=head->next_tl ; tl!=head ; tl=tl->next_tl )
+				LM_DBG("[%d][%d/%d]: %p, next=%p \n",
+					list_id, lvl, slot, tl, tl->next_tl);
+		}
 }
 
 
@@ -693,58 +715,32 @@ void print_timer_list(unsigned int set, enum lists list_id)
 #ifdef TM_TIMER_DEBUG
 static void check_timer_list( struct timer* timer_list, char *txt)
 {
-	struct timer_link *tl ;
-	struct timer_link *tl1 ;
+	struct timer_link *tl, *head;
+	unsigned int n = 0;
+	int lvl, slot;
 
-	if (list_id<0 || list_id>=NR_OF_TIMER_LISTS) {
+	if (timer_list->id<0 || timer_list->id>=NR_OF_TIMER_LISTS) {
 			LM_CRIT("TM TIMER list [%d] bug [%s]\n",timer_list->id, txt);
 			abort();
 	}
 
-	tl = timer_list->last_tl.prev_tl;
-	while (tl!=&timer_list->first_tl) {
-		if (tl->prev_tl==0) {
-			LM_CRIT("TM TIMER list [%d] prev_tl==0 [%s]\n",timer_list->id, txt);
-			abort();
-		}
-		tl = tl->prev_tl;
-	}
-
-	tl = timer_list->first_tl.next_tl;
-	while (tl!=&timer_list->last_tl) {
-		if (tl->next_tl==0) {
-			LM_CRIT("TM TIMER list [%d] next_tl==0 [%s]\n",timer_list->id, txt);
-			abort();
-		}
-		tl = tl->next_tl;
-	}
-
-	tl = timer_list->first_tl.next_tl;
-	while (tl!=&timer_list->last_tl) {
-		if (tl->ld_tl==0) {
-			LM_CRIT("TM TIMER list [%d] corrupted - ld=0 [%s]\n",
-				timer_list->id, txt);
-			abort();
-		}
-		if (tl->ld_tl->ld_tl!=tl) {
-			LM_CRIT("TM TIMER list [%d] corrupted - ld cycle broken [%s]\n",
-				timer_list->id, txt);
-			abort();
-		}
-
-		if (tl->ld_tl!=tl) {
-			tl1 = tl->next_tl;
-			while(tl1!=tl->ld_tl) {
-				if (tl1->ld_tl) {
-					LM_CRIT("TM TIMER list [%d] corrupted - ld!=0 inside "
-						"cycle [%s]\n", timer_list->id, txt);
+	for ( lvl=0 ; lvl<TM_WHEEL_LEVELS ; lvl++ )
+		for ( slot=0 ; slot<TM_WHEEL_SIZE ; slot++ ) {
+			head = &timer_list->slots[lvl][slot];
+			for ( tl=head->next_tl ; tl!=head ; tl=tl->next_tl, n++ ) {
+				if (tl->next_tl==0 || tl->prev_tl==0 ||
+				tl->next_tl->prev_tl!=tl) {
+					LM_CRIT("TM TIMER list [%d] slot %d/%d corrupted [%s]\n",
+						timer_list->id, lvl, slot, txt);
 					abort();
 				}
-				tl1 = tl1->next_tl;
 			}
 		}
 
-		tl = tl->ld_tl->next_tl;
+	if (n!=timer_list->count) {
+		LM_CRIT("TM TIMER list [%d] has %u links, %u expected [%s]\n",
+			timer_list->id, n, timer_list->count, txt);
+		abort();
 	}
 }
 #endif
@@ -753,9 +749,8 @@ static void check_timer_list( struct timer* timer_list, char *txt)
 static void remove_timer_unsafe(  struct timer_link* tl )
 {
 #ifdef EXTRA_DEBUG
-	if (tl && is_in_timer_list2(tl) &&
-		tl->timer_list->last_tl.prev_tl==0) {
-		LM_CRIT("Oh no, zero link in trailing timer element\n");
+	if (tl && is_in_timer_list2(tl) && tl->prev_tl==0) {
+		LM_CRIT("Oh no, zero link in timer element\n");
 		abort();
 	};
 #endif
@@ -767,34 +762,54 @@ static void remove_timer_unsafe(  struct timer_link* tl )
 #ifdef TM_TIMER_DEBUG
 		check_timer_list( tl->timer_list, "before remove" );
 #endif
-		if (tl->ld_tl && tl->ld_tl!=tl) {
-			if (tl->time_out==tl->prev_tl->time_out) {
-				tl->prev_tl->ld_tl = tl->ld_tl;
-				tl->ld_tl->ld_tl = tl->prev_tl;
-			} else {
-				tl->next_tl->ld_tl = tl->ld_tl;
-				tl->ld_tl->ld_tl = tl->next_tl;
-			}
-		}
 		tl->prev_tl->next_tl = tl->next_tl;
 		tl->next_tl->prev_tl = tl->prev_tl;
+		tl->timer_list->count--;
 #ifdef TM_TIMER_DEBUG
 		check_timer_list( tl->timer_list, "after remove" );
 #endif
 		tl->next_tl = 0;
 		tl->prev_tl = 0;
-		tl->ld_tl = 0;
 		tl->timer_list = NULL;
 	}
 }
 
 
+/* links "tl" at the end of the wheel slot its time_out falls into */
+static inline void wheel_link_unsafe( struct timer *timer_list,
+													struct timer_link *tl )
+{
+	struct timer_link *head;
+	utime_t tick, delta;
+	int lvl;
+
+	tick = tl->time_out / timer_list->tick_len;
+	/* already expired - fire it at the next run */
+	if (tick < timer_list->cur_tick)
+		tick = timer_list->cur_tick;
+
+	delta = tick - timer_list->cur_tick;
+	for ( lvl=0 ; lvl<TM_WHEEL_LEVELS-1 ; lvl++ )
+		if (delta < ((utime_t)1 << (TM_WHEEL_BITS*(lvl+1))))
+			break;
+	/* beyond the range of the wheel - park it on the farthest slot, it
+	 * will be re-inserted when reached */
+	if (delta >= ((utime_t)1 << (TM_WHEEL_BITS*TM_WHEEL_LEVELS)))
+		tick = timer_list->cur_tick +
+			((utime_t)1 << (TM_WHEEL_BITS*TM_WHEEL_LEVELS)) - 1;
+
+	head = &timer_list->slots[lvl][(tick>>(TM_WHEEL_BITS*lvl))&TM_WHEEL_MASK];
+	tl->next_tl = head;
+	tl->prev_tl = head->prev_tl;
+	head->prev_tl->next_tl = tl;
+	head->prev_tl = tl;
+}
+
+
 /* put a new linker into a timer_list */
 static void insert_timer_unsafe( struct timer *timer_list,
 									struct timer_link *tl, utime_t time_out )
 {
-	struct timer_link* ptr;
-
 	tl->time_out = time_out;
 	tl->timer_list = timer_list;
 	tl->deleted = 0;
@@ -802,25 +817,8 @@ static void insert_timer_unsafe( struct timer *timer_list,
 #ifdef TM_TIMER_DEBUG
 	check_timer_list( timer_list, "before insert" );
 #endif
-	ptr = timer_list->last_tl.prev_tl;
-	for( ; ptr != &timer_list->first_tl ; ptr = ptr->ld_tl->prev_tl) {
-		if ( ptr->time_out<=time_out )
-			break;
-	}
-
-	/* insert "tl" after "ptr" */
-	tl->prev_tl = ptr;
-	tl->next_tl = ptr->next_tl;
-	tl->prev_tl->next_tl = tl;
-	tl->next_tl->prev_tl = tl;
-
-	if (tl->time_out==ptr->time_out) {
-		tl->ld_tl = ptr->ld_tl;
-		ptr->ld_tl = 0;
-		tl->ld_tl->ld_tl = tl;
-	} else {
-		tl->ld_tl = tl;
-	}
+	wheel_link_unsafe( timer_list, tl );
+	timer_list->count++;
 #ifdef TM_TIMER_DEBUG
 	check_timer_list( timer_list, "after insert" );
 #endif
@@ -830,18 +828,52 @@ static void insert_timer_unsafe( struct timer *timer_list,
 }
 
 
+/* detaches all the links of a wheel slot, as a NULL terminated list */
+static inline struct timer_link *wheel_detach_slot( struct timer_link *head )
+{
+	struct timer_link *first;
+
+	if (head->next_tl==head)
+		return NULL;
+
+	first = head->next_tl;
+	head->prev_tl->next_tl = NULL;
+	head->next_tl = head->prev_tl = head;
+
+	return first;
+}
+
+
+/* moves the links of the current slot of an upper level to the lower
+ * levels, as the wheel entered the span of that slot */
+static void wheel_cascade_unsafe( struct timer *timer_list, int lvl )
+{
+	struct timer_link *tl, *tmp;
+	unsigned int idx;
+
+	idx = (timer_list->cur_tick >> (TM_WHEEL_BITS*lvl)) & TM_WHEEL_MASK;
+	/* the next upper level slot is due as well */
+	if (idx==0 && lvl<TM_WHEEL_LEVELS-1)
+		wheel_cascade_unsafe( timer_list, lvl+1 );
+
+	for ( tl=wheel_detach_slot( &timer_list->slots[lvl][idx] ) ; tl ; tl=tmp ) {
+		tmp = tl->next_tl;
+		wheel_link_unsafe( timer_list, tl );
+	}
+}
+
 
 /* detach items passed by the time from timer list */
 static struct timer_link  *check_and_split_time_list( struct timer *timer_list,
 		utime_t time )
 {
-	struct timer_link *tl , *end, *ret;
+	struct timer_link *tl, *tmp, *ret, **last;
+	utime_t now_tick;
 
+	now_tick = time / timer_list->tick_len;
 
 	/* quick check whether it is worth entering the lock */
-	if (timer_list->first_tl.next_tl==&timer_list->last_tl
-			|| ( /* timer_list->first_tl.next_tl
-				&& */ timer_list->first_tl.next_tl->time_out > time) )
+	if (timer_list->count==0 && timer_list->cur_tick==now_tick)
 		return NULL;
 
 	/* the entire timer list is locked now -- no one else can manipulate it */
@@ -850,37 +882,47 @@ static struct timer_link  *check_and_split_time_list( struct timer *timer_list,
 #ifdef TM_TIMER_DEBUG
 	check_timer_list( timer_list, "before split" );
 #endif
-	end = &timer_list->last_tl;
-	tl = timer_list->first_tl.next_tl;
-	while( tl!=end && tl->time_out <= time)
-		tl=tl->ld_tl->next_tl;
-
-	/* nothing to delete found */
-	if (tl->prev_tl==&(timer_list->first_tl)) {
-		ret = NULL;
-	} else { /* we did find timers to be fired! */
-		/* the detached list begins with current beginning */
-		ret = timer_list->first_tl.next_tl;
-		/* and we mark the end of the split list */
-		tl->prev_tl->next_tl = NULL;
-		/* the shortened list starts from where we suspended */
-		timer_list->first_tl.next_tl = tl;
-		tl->prev_tl = & timer_list->first_tl;
-
-		for( tl=ret ; tl ; tl=tl->next_tl )
-			tl->timer_list = DETACHED_LIST;
+	ret = NULL;
+	last = &ret;
+
+	if (timer_list->count==0) {
+		/* nothing to expire on the way, simply catch up with the time */
+		if (now_tick > timer_list->cur_tick)
+			timer_list->cur_tick = now_tick;
+		goto done;
 	}
+
+	while (1) {
+		tl = wheel_detach_slot(
+			&timer_list->slots[0][timer_list->cur_tick & TM_WHEEL_MASK] );
+		for ( ; tl ; tl=tmp ) {
+			tmp = tl->next_tl;
+			if (tl->time_out <= time) {
+				/* we did find timers to be fired! */
+				tl->timer_list = DETACHED_LIST;
+				tl->next_tl = NULL;
+				*last = tl;
+				last = &tl->next_tl;
+				timer_list->count--;
+			} else {
+				/* not yet, only its tick was reached */
+				wheel_link_unsafe( timer_list, tl );
+			}
+		}
+
+		if (timer_list->cur_tick >= now_tick)
+			break;
+
+		timer_list->cur_tick++;
+		if ((timer_list->cur_tick & TM_WHEEL_MASK)==0)
+			wheel_cascade_unsafe( timer_list, 1 );
+	}
+
+done:
 #ifdef TM_TIMER_DEBUG
 	check_timer_list( timer_list, "after split" );
 #endif
 
-#ifdef EXTRA_DEBUG
-	if (timer_list->last_tl.prev_tl==0) {
-		LM_CRIT("Oh no, zero link in trailing timer element\n");
-		abort();
-	};
-#endif
-
 	/* give the list lock away */
 	unlock(timer_list->mutex);
 
@@ -1136,6 +1178,9 @@ void utimer_routine(utime_t uticks , void *set)
 
 	clock_gettime(CLOCK_REALTIME, &begin);
 
+	/* coalesce all the UDP retransmissions of this tick */
+	udp_send_batch_start();
+
 	lock_get( timertable[(long)set].ex_lock );
 
 	for( id=RT_T1_TO_1 ; id<NR_OF_TIMER_LISTS ; id++ )
@@ -1156,6 +1201,8 @@ void utimer_routine(utime_t uticks , void *set)
 	}
 	lock_release( timertable[(long)set].ex_lock );
 
+	udp_send_batch_end();
+
 	clock_check_diff((double)TM_UTIMER_ITV_US*1000 * TM_TIMER_LOAD_WARN,
 	    "now at %d%%+ capacity, inuse_transactions: %lu", (int)(TM_TIMER_LOAD_WARN*100),
 	    (unsigned long)get_stat_val(tm_trans_inuse));
@@ -59,7 +59,6 @@ typedef struct timer_link
 {
 	struct timer_link     *next_tl;
 	struct timer_link     *prev_tl;
-	struct timer_link     *ld_tl;
 	volatile utime_t      time_out;
 	struct timer          *timer_list;
 	unsigned short        deleted;
@@ -70,11 +69,24 @@ typedef struct timer_link
 }timer_link_type ;
 
 
-/* timer list: includes head, tail and protection semaphore */
+/* geometry of the timing wheels: 4 levels of 64 slots each, so a wheel
+   covers 2^24 ticks (194 days for the 1s timers, 19 days for the 100ms
+   ones); longer timeouts are parked on the last slot and re-inserted */
+#define TM_WHEEL_BITS    6
+#define TM_WHEEL_SIZE    (1<<TM_WHEEL_BITS)
+#define TM_WHEEL_MASK    (TM_WHEEL_SIZE-1)
+#define TM_WHEEL_LEVELS  4
+
+/* timer list: a hierarchical timing wheel and its protection semaphore;
+   each slot is the head of a circular list of timer links - a level 0
+   slot holds the links expiring in one tick, a slot on an upper level
+   spans all the slots of the level below */
 typedef struct  timer
 {
-	struct timer_link  first_tl;
-	struct timer_link  last_tl;
+	struct timer_link  slots[TM_WHEEL_LEVELS][TM_WHEEL_SIZE];
+	utime_t            tick_len;  /* time units (s or us) per tick */
+	utime_t            cur_tick;  /* next tick to be expired */
+	unsigned int       count;     /* links currently on the wheel */
 	ser_lock_t*        mutex;
 	enum lists         id;
 } timer_type;
@@ -106,6 +106,7 @@ int init_slot(struct udomain* _d, hslot_t* _s, int n)
 {
 	_s->records = map_create( AVLMAP_SHARED | AVLMAP_NO_DUPLICATE);
 	_s->next_label = 0;
+	INIT_LIST_HEAD(&_s->dirty);
 
 	if( _s->records == NULL )
 		return -1;
@@ -132,6 +133,12 @@ void free_value_urecord( void * val )
  */
 void deinit_slot(hslot_t* _s)
 {
+	if (_s->timer_heap) {
+		shm_free(_s->timer_heap);
+		_s->timer_heap = NULL;
+		_s->timer_heap_len = _s->timer_heap_size = 0;
+	}
+
 	map_destroy(_s->records , free_value_urecord);
 	_s->d = 0;
 }
@@ -171,3 +178,121 @@ void slot_rem(hslot_t* _s, struct urecord* _r)
 	map_remove( _s->records, _r->aor );
 	_r->slot = 0;
 }
+
+
+static inline void slot_timer_place(hslot_t* _s, struct urecord* _r, int pos)
+{
+	_s->timer_heap[pos] = _r;
+	_r->timer_pos = pos;
+}
+
+static void slot_timer_up(hslot_t* _s, int pos)
+{
+	struct urecord *r = _s->timer_heap[pos];
+
+	while (pos > 1 && _s->timer_heap[pos/2]->timer_due > r->timer_due) {
+		slot_timer_place(_s, _s->timer_heap[pos/2], pos);
+		pos /= 2;
+	}
+
+	slot_timer_place(_s, r, pos);
+}
+
+static void slot_timer_down(hslot_t* _s, int pos)
+{
+	struct urecord *r = _s->timer_heap[pos];
+	int child;
+
+	while ((child = 2*pos) <= _s->timer_heap_len) {
+		if (child < _s->timer_heap_len && _s->timer_heap[child+1]->timer_due <
+		        _s->timer_heap[child]->timer_due)
+			child++;
+
+		if (_s->timer_heap[child]->timer_due >= r->timer_due)
+			break;
+
+		slot_timer_place(_s, _s->timer_heap[child], pos);
+		pos = child;
+	}
+
+	slot_timer_place(_s, r, pos);
+}
+
+static void slot_timer_del(hslot_t* _s, struct urecord* _r)
+{
+	int pos = _r->timer_pos;
+	struct urecord *last;
+
+	last = _s->timer_heap[_s->timer_heap_len--];
+	_r->timer_pos = 0;
+
+	if (last != _r) {
+		slot_timer_place(_s, last, pos);
+		slot_timer_up(_s, pos);
+		slot_timer_down(_s, last->timer_pos);
+	}
+}
+
+
+/*! \brief
+ * (Re)Schedule the timer check of a slot element
+ */
+int slot_timer_set(hslot_t* _s, struct urecord* _r, time_t _due)
+{
+	struct urecord **heap;
+	int size;
+
+	if (_due == 0) {
+		if (_r->timer_pos)
+			slot_timer_del(_s, _r);
+		_r->timer_due = 0;
+		return 0;
+	}
+
+	if (_r->timer_pos) {
+		if (_due == _r->timer_due)
+			return 0;
+
+		_r->timer_due = _due;
+		slot_timer_up(_s, _r->timer_pos);
+		slot_timer_down(_s, _r->timer_pos);
+		return 0;
+	}
+
+	if (_s->timer_heap_len + 1 >= _s->timer_heap_size) {
+		size = _s->timer_heap_size ? 2 * _s->timer_heap_size : 16;
+		heap = shm_realloc(_s->timer_heap, size * sizeof *heap);
+		if (!heap) {
+			LM_ERR("oom\n");
+			/* let the timer re-index the whole slot later */
+			_s->timer_rescan = 1;
+			return -1;
+		}
+
+		_s->timer_heap = heap;
+		_s->timer_heap_size = size;
+	}
+
+	_r->timer_due = _due;
+	slot_timer_place(_s, _r, ++_s->timer_heap_len);
+	slot_timer_up(_s, _r->timer_pos);
+	return 0;
+}
+
+
+/*! \brief
+ * Detach the first element due for a timer check at \a _now
+ */
+struct urecord* slot_timer_pop(hslot_t* _s, time_t _now)
+{
+	struct urecord *r;
+
+	if (_s->timer_heap_len == 0 || _s->timer_heap[1]->timer_due > _now)
+		return NULL;
+
+	r = _s->timer_heap[1];
+	slot_timer_del(_s, r);
+	r->timer_due = 0;
+
+	return r;
+}
@@ -32,6 +32,7 @@
 
 #include "../../locking.h"
 #include "../../map.h"
+#include "../../lib/list.h"
 #include "udomain.h"
 #include "urecord.h"
 
@@ -45,6 +46,14 @@ typedef struct hslot {
 	map_t records;
 	unsigned int next_label;
 
+	struct urecord **timer_heap; /*!< Records by their next timer check
+	                              * (binary min-heap, 1-based) */
+	int timer_heap_len;
+	int timer_heap_size;
+	int timer_rescan;            /*!< Re-index all records (index oom) */
+	struct list_head dirty;      /*!< Records with contacts not yet written
+	                              * back to DB */
+
 	struct udomain* d;      /*!< Domain we belong to */
 #ifdef GEN_LOCK_T_PREFERED
 	gen_lock_t *lock;       /*!< Lock for hash entry - fastlock */
@@ -76,6 +85,19 @@ int slot_add(hslot_t* _s, struct urecord* _r);
  */
 void slot_rem(hslot_t* _s, struct urecord* _r);
 
+
+/*! \brief
+ * (Re)Schedule the timer check of a slot element - a zero
+ * \a _due removes the element from the slot timer index
+ */
+int slot_timer_set(hslot_t* _s, struct urecord* _r, time_t _due);
+
+
+/*! \brief
+ * Detach the first element due for a timer check at \a _now
+ */
+struct urecord* slot_timer_pop(hslot_t* _s, time_t _now);
+
 int ul_init_locks();
 void ul_unlock_locks();
 void ul_destroy_locks();
@@ -261,6 +261,7 @@ int w_add_key(struct sip_msg* _m, void* _d, str* aor, str* key, str* value)
 		} else {
 			kv_del(r->kv_storage, key);
 		}
+		dirty_urecord_kv_store(r);
 	} else {
 		unlock_udomain(domain, aor);
 		LM_WARN("No record found - not inserting key into KV store - user not registered?\n");
@@ -325,6 +326,7 @@ int w_delete_key(struct sip_msg* _m, void* _d, str* aor, str* key)
 	get_urecord(domain, aor, &r);
 	if (r) {
 		kv_del(r->kv_storage, key);
+		dirty_urecord_kv_store(r);
 	} else {
 		unlock_udomain(domain, aor);
 		LM_WARN("No record found - not deleting value from  KV store - user not registered?\n");
@@ -55,6 +55,7 @@
 #include "utime.h"
 #include "usrloc.h"
 #include "kv_store.h"
+#include "ul_intern.h"
 
 /*
  * Determines the IP address of the next hop on the way to given contact based
@@ -94,6 +95,55 @@ static int compute_next_hop(ucontact_t *contact)
 }
 
 
+/* the string is stored in the packed area of the contact */
+#define ct_is_packed(_c, _s) \
+	((_s)->s >= (char *)((_c) + 1) && \
+	 (_s)->s <= (char *)((_c) + 1) + (_c)->packed_len)
+
+/* copy the string in the packed area of the contact */
+#define ct_pack(_p, _dst, _src) \
+	do { \
+		(_dst)->s = (_p); \
+		(_dst)->len = (_src)->len; \
+		memcpy((_p), (_src)->s, (_src)->len); \
+		(_p) += (_src)->len; \
+	} while (0)
+
+static inline void ct_free_str(ucontact_t *_c, str *_s, unsigned char _istr)
+{
+	if (!_s->s)
+		return;
+
+	if (_c->interned & _istr) {
+		ul_istr_put(_s);
+		_c->interned &= ~_istr;
+	} else if (!ct_is_packed(_c, _s)) {
+		shm_free(_s->s);
+	}
+
+	_s->s = NULL;
+	_s->len = 0;
+}
+
+static inline int ct_update_istr(ucontact_t *_c, str *_old, const str *_new,
+                                 unsigned char _istr)
+{
+	str s;
+
+	if ((_c->interned & _istr) && _old->len == _new->len &&
+	        !memcmp(_old->s, _new->s, _new->len))
+		return 0;
+
+	if (ul_istr_get(_new, &s) < 0)
+		return -1;
+
+	ct_free_str(_c, _old, _istr);
+	*_old = s;
+	_c->interned |= _istr;
+	return 0;
+}
+
+
 /*! \brief
  * Create a new contact structure
  */
@@ -103,13 +153,31 @@ new_ucontact(str* _dom, str* _aor, str* _contact, ucontact_info_t* _ci)
 	struct sip_uri ct_uri;
 	ucontact_t *c;
 	int_str_t shtag, *shtagp;
+	unsigned int len;
+	char *p;
+
+	/* the per-contact strings are packed right after the structure, while
+	 * the low-cardinality ones may be shared via the string pool */
+	len = _contact->len + _ci->callid->len;
+	if (_ci->received.s && _ci->received.len)
+		len += _ci->received.len;
+	if (_ci->instance.s && _ci->instance.len)
+		len += _ci->instance.len;
+	if (_ci->attr && _ci->attr->len)
+		len += _ci->attr->len;
+	if (!ul_intern_strings) {
+		len += _ci->user_agent->len + 1;
+		if (_ci->path && _ci->path->len)
+			len += _ci->path->len;
+	}
 
-	c = (ucontact_t*)shm_malloc(sizeof(ucontact_t));
+	c = (ucontact_t*)shm_malloc(sizeof(ucontact_t) + len);
 	if (!c) {
 		LM_ERR("no more shm memory\n");
 		return NULL;
 	}
 	memset(c, 0, sizeof(ucontact_t));
+	c->packed_len = len;
 
 	if (have_mem_storage()) {
 		if (!ZSTRP(_ci->packed_kv_storage))
@@ -127,26 +195,38 @@ new_ucontact(str* _dom, str* _aor, str* _contact, ucontact_info_t* _ci)
 		goto out_free;
 	}
 
-	if (shm_str_dup( &c->c, _contact) < 0) goto mem_error;
-	if (shm_str_dup( &c->callid, _ci->callid) < 0) goto mem_error;
+	p = (char *)(c + 1);
 
-	/* an additional null byte may be needed by "regexec" later on */
-	if (shm_nt_str_dup( &c->user_agent, _ci->user_agent) < 0) goto mem_error;
+	ct_pack(p, &c->c, _contact);
+	ct_pack(p, &c->callid, _ci->callid);
 
-	if (_ci->received.s && _ci->received.len) {
-		if (shm_str_dup( &c->received, &_ci->received) < 0) goto mem_error;
-	}
+	if (_ci->received.s && _ci->received.len)
+		ct_pack(p, &c->received, &_ci->received);
 
-	if (_ci->instance.s && _ci->instance.len) {
-		if (shm_str_dup( &c->instance, &_ci->instance) < 0) goto mem_error;
-	}
+	if (_ci->instance.s && _ci->instance.len)
+		ct_pack(p, &c->instance, &_ci->instance);
 
-	if (_ci->path && _ci->path->len) {
-		if (shm_str_dup( &c->path, _ci->path) < 0) goto mem_error;
-	}
+	if (_ci->attr && _ci->attr->len)
+		ct_pack(p, &c->attr, _ci->attr);
+
+	if (ul_intern_strings) {
+		/* pooled strings are null-terminated, as "regexec" may need it */
+		if (ul_istr_get(_ci->user_agent, &c->user_agent) < 0)
+			goto mem_error;
+		c->interned |= UL_ISTR_UA;
+
+		if (_ci->path && _ci->path->len) {
+			if (ul_istr_get(_ci->path, &c->path) < 0)
+				goto mem_error;
+			c->interned |= UL_ISTR_PATH;
+		}
+	} else {
+		/* an additional null byte may be needed by "regexec" later on */
+		ct_pack(p, &c->user_agent, _ci->user_agent);
+		*p++ = '\0';
 
-	if (_ci->attr && _ci->attr->len) {
-		if (shm_str_dup( &c->attr, _ci->attr) < 0) goto mem_error;
+		if (_ci->path && _ci->path->len)
+			ct_pack(p, &c->path, _ci->path);
 	}
 
 	if (_ci->cdb_key.s && _ci->cdb_key.len) {
@@ -201,13 +281,8 @@ mem_error:
 	LM_ERR("no more shm memory\n");
 
 out_free:
-	if (c->path.s) shm_free(c->path.s);
-	if (c->received.s) shm_free(c->received.s);
-	if (c->user_agent.s) shm_free(c->user_agent.s);
-	if (c->callid.s) shm_free(c->callid.s);
-	if (c->c.s) shm_free(c->c.s);
-	if (c->instance.s) shm_free(c->instance.s);
-	if (c->attr.s) shm_free(c->attr.s);
+	ct_free_str(c, &c->path, UL_ISTR_PATH);
+	ct_free_str(c, &c->user_agent, UL_ISTR_UA);
 	if (c->cdb_key.s) shm_free(c->cdb_key.s);
 	if (c->shtag.s) shm_free(c->shtag.s);
 	if (c->kv_storage) store_destroy(c->kv_storage);
@@ -227,13 +302,13 @@ void free_ucontact(ucontact_t* _c)
 	if (_c->flags & FL_EXTRA_HOP)
 		goto skip_fields;
 
-	if (_c->path.s) shm_free(_c->path.s);
-	if (_c->received.s) shm_free(_c->received.s);
-	if (_c->instance.s) shm_free(_c->instance.s);
-	if (_c->user_agent.s) shm_free(_c->user_agent.s);
-	if (_c->callid.s) shm_free(_c->callid.s);
-	if (_c->c.s) shm_free(_c->c.s);
-	if (_c->attr.s) shm_free(_c->attr.s);
+	ct_free_str(_c, &_c->path, UL_ISTR_PATH);
+	ct_free_str(_c, &_c->received, 0);
+	ct_free_str(_c, &_c->instance, 0);
+	ct_free_str(_c, &_c->user_agent, UL_ISTR_UA);
+	ct_free_str(_c, &_c->callid, 0);
+	ct_free_str(_c, &_c->c, 0);
+	ct_free_str(_c, &_c->attr, 0);
 	if (_c->cdb_key.s) shm_free(_c->cdb_key.s);
 	if (_c->shtag.s) shm_free(_c->shtag.s);
 	if (_c->kv_storage) store_destroy(_c->kv_storage);
@@ -256,7 +331,8 @@ int mem_update_ucontact(ucontact_t* _c, ucontact_info_t* _ci)
 			if (ptr == 0) \
 				goto out_oom; \
 			memcpy(ptr, (_new)->s, (_new)->len);\
-			if ((_old)->s) shm_free((_old)->s);\
+			if ((_old)->s && !ct_is_packed(_c, _old)) \
+				shm_free((_old)->s);\
 			(_old)->s = ptr;\
 		} else {\
 			memcpy((_old)->s, (_new)->s, (_new)->len);\
@@ -275,7 +351,13 @@ int mem_update_ucontact(ucontact_t* _c, ucontact_info_t* _ci)
 	 * always update the call ID to be safe. */
 	update_str( &_c->callid, _ci->callid, 0);
 
-	update_str( &_c->user_agent, _ci->user_agent, 1);
+	if (ul_intern_strings) {
+		if (ct_update_istr(_c, &_c->user_agent, _ci->user_agent,
+		        UL_ISTR_UA) < 0)
+			goto out_oom;
+	} else {
+		update_str( &_c->user_agent, _ci->user_agent, 1);
+	}
 
 	if (_ci->c)
 		update_str( &_c->c, _ci->c, 0);
@@ -283,25 +365,24 @@ int mem_update_ucontact(ucontact_t* _c, ucontact_info_t* _ci)
 	if (_ci->received.s && _ci->received.len) {
 		update_str( &_c->received, &_ci->received, 0);
 	} else {
-		if (_c->received.s) shm_free(_c->received.s);
-		_c->received.s = NULL;
-		_c->received.len = 0;
+		ct_free_str(_c, &_c->received, 0);
 	}
 
-	if (_ci->path) {
+	if (_ci->path && ul_intern_strings) {
+		if (!_ci->path->len)
+			ct_free_str(_c, &_c->path, UL_ISTR_PATH);
+		else if (ct_update_istr(_c, &_c->path, _ci->path, UL_ISTR_PATH) < 0)
+			goto out_oom;
+	} else if (_ci->path) {
 		update_str( &_c->path, _ci->path, 0);
 	} else {
-		if (_c->path.s) shm_free(_c->path.s);
-		_c->path.s = NULL;
-		_c->path.len = 0;
+		ct_free_str(_c, &_c->path, UL_ISTR_PATH);
 	}
 
 	if (_ci->attr && _ci->attr->s && _ci->attr->len) {
 		update_str( &_c->attr, _ci->attr, 0);
 	} else {
-		if (_c->attr.s) shm_free(_c->attr.s);
-		_c->attr.s = NULL;
-		_c->attr.len = 0;
+		ct_free_str(_c, &_c->attr, 0);
 	}
 
 	get_act_time();
@@ -690,6 +771,12 @@ int db_insert_ucontact(ucontact_t* _c,query_list_t **ins_list, int update)
 		}
 	} else {
 		/* do insert-update / replace */
+		if (ins_list) {
+			if (con_set_upsertlist(&ul_dbf,ul_dbh,ins_list,keys + start,
+						nr_vals) < 0 )
+				CON_RESET_INSLIST(ul_dbh);
+		}
+
 		CON_SET_CURR_PS(ul_dbh, &myR_ps);
 		if (ul_dbf.insert_update(ul_dbh, keys + start, vals + start, nr_vals) < 0) {
 			LM_ERR("inserting contact in db failed\n");
@@ -1011,6 +1098,7 @@ int update_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci,
 		update_contact_pos( _r, _c);
 
 	st_update_ucontact(_c);
+	sched_urecord_timer(_r);
 
 	if (sql_wmode == SQL_WRITE_THROUGH) {
 		if (persist_kv_store && persist_urecord_kv_store(_r) != 0)
@@ -138,6 +138,10 @@ typedef struct ucontact {
 	int refresh_time;         /*!< UNIX timestamp: the next refresh event >*/
 	struct list_head refresh_list;
 
+	unsigned int packed_len;  /*!< size of the strings packed right after
+	                               the structure, in the same allocation >*/
+	unsigned char interned;   /*!< UL_ISTR_* fields from the string pool >*/
+
 	struct ucontact* next;  /*!< Next contact in the linked list */
 	struct ucontact* prev;  /*!< Previous contact in the linked list */
 } ucontact_t;
@@ -201,6 +205,10 @@ int ucontact_coords_cmp(ucontact_coords a, ucontact_coords b);
 void free_ucontact_coords(ucontact_coords coords);
 int is_my_ucontact(ucontact_t *c);
 
+/* contact fields shared via the string pool (ul_intern_strings) */
+#define UL_ISTR_UA    (1<<0)
+#define UL_ISTR_PATH  (1<<1)
+
 /*! \brief
  * Non-zero but still ancient time which forces a contact to expire
  */
@@ -682,6 +682,9 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 				LM_DBG("regenerated contact id to %"PRIu64"\n", ci->contact_id);
 			}
 
+			/* the contact states changed since the insert */
+			sched_urecord_timer(r);
+
 			unlock_udomain(_d, &user);
 		}
 
@@ -1119,6 +1122,8 @@ int mem_insert_urecord(udomain_t* _d, str* _aor, struct urecord** _r)
 		return -1;
 	}
 
+	sched_urecord_timer(*_r);
+
 	ul_raise_aor_event(ei_ins_id, *_r);
 	update_stat( _d->users, 1);
 	return 0;
@@ -1131,47 +1136,66 @@ int mem_insert_urecord(udomain_t* _d, str* _aor, struct urecord** _r)
 void mem_delete_urecord(udomain_t* _d, struct urecord* _r)
 {
 	ul_raise_aor_event(ei_del_id, _r);
+	slot_timer_set(_r->slot, _r, 0);
+	if (!list_empty(&_r->dirty_list)) {
+		list_del(&_r->dirty_list);
+		INIT_LIST_HEAD(&_r->dirty_list);
+	}
 	slot_rem(_r->slot, _r);
 	free_urecord(_r);
 	update_stat( _d->users, -1);
 }
 
 
+static int reindex_urecord(void *param, str key, void *value)
+{
+	sched_urecord_timer((struct urecord *)value);
+	return 0;
+}
+
+
 int mem_timer_udomain(udomain_t* _d)
 {
-	struct urecord* ptr;
-	void ** dest;
-	int i,ret=0,flush=0;
-	map_iterator_t it,prev;
+	struct urecord *ptr, *due;
+	struct list_head *el, *next;
+	query_list_t **ups_list;
+	int i,ret=0,flush=0,err=0;
+
+	/* the contact updates are written back with batched multi-row "insert
+	 * or update" queries only if the DB driver can do it */
+	ups_list = (query_buffer_size > 1 &&
+		DB_CAPABILITY(ul_dbf, DB_CAP_MULTIPLE_INSERT_UPDATE)) ?
+		&_d->ups_list : NULL;
 
 	cid_len = 0;
 	for(i=0; i<_d->size; i++)
 	{
 		lock_ulslot(_d, i);
 
-		map_first(_d->table[i].records,&it);
-
-		while(iterator_is_valid(&it))
-		{
-
-			dest = iterator_val(&it);
-			if( dest == NULL ) {
-				unlock_ulslot(_d, i);
-				return -1;
-			}
+		if (_d->table[i].timer_rescan) {
+			_d->table[i].timer_rescan = 0;
+			map_for_each(_d->table[i].records, reindex_urecord, NULL);
+		}
 
-			ptr = (struct urecord *)*dest;
+		/* only the records having expired or not yet flushed contacts (or
+		 * no contacts at all) are due - detach all of them first, as the
+		 * checks may get a record due again (i.e. failed DB updates) */
+		due = NULL;
+		while ((ptr = slot_timer_pop(&_d->table[i], act_time))) {
+			ptr->timer_next = due;
+			due = ptr;
+		}
 
-			prev = it;
-			iterator_next(&it);
+		while (due)
+		{
+			ptr = due;
+			due = ptr->timer_next;
+			ptr->timer_next = NULL;
 
 			if ((ret =timer_urecord(ptr,&_d->ins_list)) < 0) {
 				LM_ERR("timer_urecord failed\n");
-				unlock_ulslot(_d, i);
-				return -1;
-			}
-
-			if (ret)
+				err = 1;
+			} else if (ret)
 				flush=1;
 
 			/* Remove the entire record if it is empty */
@@ -1187,8 +1211,18 @@ int mem_timer_udomain(udomain_t* _d)
 						       ptr->aor.len, ptr->aor.s);
 				}
 
-				iterator_delete(&prev);
 				mem_delete_urecord(_d, ptr);
+			} else {
+				sched_urecord_timer(ptr);
+			}
+		}
+
+		/* write back only the records having contacts not yet flushed */
+		if (rr_persist == RRP_LOAD_FROM_SQL) {
+			list_for_each_safe(el, next, &_d->table[i].dirty) {
+				ptr = list_entry(el, struct urecord, dirty_list);
+				if (wb_flush_urecord(ptr, &_d->ins_list, ups_list))
+					flush = 1;
 			}
 		}
 
@@ -1209,9 +1243,11 @@ int mem_timer_udomain(udomain_t* _d)
 		 * we are sure that DB updates will be successful */
 		if (ql_flush_rows(&ul_dbf,ul_dbh,_d->ins_list) < 0)
 			LM_ERR("failed to flush rows to DB\n");
+		if (ups_list && ql_flush_rows(&ul_dbf,ul_dbh,_d->ups_list) < 0)
+			LM_ERR("failed to flush updated rows to DB\n");
 	}
 
-	return 0;
+	return err ? -1 : 0;
 }
 
 
@@ -55,6 +55,7 @@ struct ucontact;
 typedef struct udomain {
 	str* name;                 /*!< Domain name (NULL terminated) */
 	query_list_t *ins_list;    /*!< insert buffering list for this domain */
+	query_list_t *ups_list;    /*!< update (upsert) buffering list */
 	int size;                  /*!< Hash table size */
 	struct hslot* table;       /*!< Hash table - array of collision slots */
 	/* statistics */
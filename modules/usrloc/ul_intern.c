@@ -0,0 +1,172 @@
+/*
+ * refcounted pool of shared (interned) contact strings
+ *
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <stddef.h>
+
+#include "../../mem/shm_mem.h"
+#include "../../locking.h"
+#include "../../hash_func.h"
+#include "../../dprint.h"
+
+#include "ul_intern.h"
+
+#define UL_ISTR_HASH_SIZE 1024
+#define UL_ISTR_LOCKS     64
+
+#define istr_lock(_idx)    lock_set_get(istr_locks, (_idx) & (UL_ISTR_LOCKS-1))
+#define istr_unlock(_idx)  lock_set_release(istr_locks, (_idx) & (UL_ISTR_LOCKS-1))
+
+int ul_intern_strings = 0;
+
+struct ul_istr {
+	unsigned int hash;
+	unsigned int refs;
+	int len;
+	struct ul_istr *next;
+	char buf[0];            /* the null terminated string */
+};
+
+static struct ul_istr **istr_table;
+static gen_lock_set_t *istr_locks;
+
+#define istr_entry(_s) \
+	((struct ul_istr *)((_s)->s - offsetof(struct ul_istr, buf)))
+
+
+int ul_istr_init(void)
+{
+	istr_table = shm_malloc(UL_ISTR_HASH_SIZE * sizeof *istr_table);
+	if (!istr_table) {
+		LM_ERR("oom\n");
+		return -1;
+	}
+	memset(istr_table, 0, UL_ISTR_HASH_SIZE * sizeof *istr_table);
+
+	istr_locks = lock_set_alloc(UL_ISTR_LOCKS);
+	if (!istr_locks || !lock_set_init(istr_locks)) {
+		LM_ERR("failed to init the string pool locks\n");
+		if (istr_locks)
+			lock_set_dealloc(istr_locks);
+		shm_free(istr_table);
+		istr_table = NULL;
+		istr_locks = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+
+void ul_istr_destroy(void)
+{
+	struct ul_istr *e, *next;
+	int i;
+
+	if (!istr_table)
+		return;
+
+	for (i = 0; i < UL_ISTR_HASH_SIZE; i++)
+		for (e = istr_table[i]; e; e = next) {
+			next = e->next;
+			shm_free(e);
+		}
+
+	shm_free(istr_table);
+	istr_table = NULL;
+
+	lock_set_destroy(istr_locks);
+	lock_set_dealloc(istr_locks);
+	istr_locks = NULL;
+}
+
+
+int ul_istr_get(const str *in, str *out)
+{
+	struct ul_istr *e;
+	unsigned int hash, idx;
+
+	hash = core_hash(in, NULL, 0);
+	idx = hash & (UL_ISTR_HASH_SIZE - 1);
+
+	istr_lock(idx);
+
+	for (e = istr_table[idx]; e; e = e->next)
+		if (e->hash == hash && e->len == in->len &&
+		        !memcmp(e->buf, in->s, in->len))
+			break;
+
+	if (!e) {
+		e = shm_malloc(sizeof *e + in->len + 1);
+		if (!e) {
+			istr_unlock(idx);
+			LM_ERR("oom\n");
+			return -1;
+		}
+
+		e->hash = hash;
+		e->refs = 0;
+		e->len = in->len;
+		memcpy(e->buf, in->s, in->len);
+		e->buf[in->len] = '\0';
+
+		e->next = istr_table[idx];
+		istr_table[idx] = e;
+	}
+
+	e->refs++;
+
+	istr_unlock(idx);
+
+	out->s = e->buf;
+	out->len = e->len;
+	return 0;
+}
+
+
+void ul_istr_put(str *s)
+{
+	struct ul_istr *e, **p;
+	unsigned int idx;
+
+	if (!s->s)
+		return;
+
+	e = istr_entry(s);
+	idx = e->hash & (UL_ISTR_HASH_SIZE - 1);
+
+	istr_lock(idx);
+
+	if (--e->refs == 0) {
+		for (p = &istr_table[idx]; *p; p = &(*p)->next)
+			if (*p == e) {
+				*p = e->next;
+				break;
+			}
+
+		shm_free(e);
+	}
+
+	istr_unlock(idx);
+
+	s->s = NULL;
+	s->len = 0;
+}
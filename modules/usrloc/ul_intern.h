@@ -0,0 +1,44 @@
+/*
+ * refcounted pool of shared (interned) contact strings
+ *
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#ifndef __UL_INTERN_H__
+#define __UL_INTERN_H__
+
+#include "../../str.h"
+
+/* intern the low-cardinality contact fields (User-Agent, Path) */
+extern int ul_intern_strings;
+
+int ul_istr_init(void);
+void ul_istr_destroy(void);
+
+/*
+ * Get a reference to the pooled copy of the given string, which is
+ * added to the pool if not already there. The returned string is null
+ * terminated and must not be modified. On oom, -1 is returned.
+ */
+int ul_istr_get(const str *in, str *out);
+
+/* Release a reference obtained through ul_istr_get() */
+void ul_istr_put(str *s);
+
+#endif /* __UL_INTERN_H__ */
@@ -636,6 +636,8 @@ static int mi_process_sync(void *param, str key, void *value)
 	for (c = rec->contacts; c; c = c->next) {
 		c->state = CS_NEW;
 	}
+
+	sched_urecord_timer(rec);
 	return 0;
 }
 
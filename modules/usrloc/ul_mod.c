@@ -63,6 +63,7 @@
 #include "ul_callback.h"
 #include "usrloc.h"
 #include "kv_store.h"
+#include "ul_intern.h"
 
 #define CONTACTID_COL  "contact_id"
 #define USER_COL       "username"
@@ -263,6 +264,7 @@ static const param_export_t params[] = {
 	{"hash_size",          INT_PARAM, &ul_hash_size      },
 	{"nat_bflag",          STR_PARAM, &nat_bflag_str     },
 	{"contact_refresh_timer",  INT_PARAM, &ct_refresh_timer },
+	{"intern_strings",     INT_PARAM, &ul_intern_strings },
 
 	/* data replication through clusterer using TCP binary packets */
 	{ "location_cluster",	INT_PARAM, &location_cluster   },
@@ -415,6 +417,11 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if (ul_intern_strings && ul_istr_init() != 0) {
+		LM_ERR("failed to init the shared strings pool\n");
+		return -1;
+	}
+
 	if (ul_init_cbs() < 0) {
 		LM_ERR("usrloc/callbacks initialization failed\n");
 		return -1;
@@ -549,6 +556,7 @@ static void destroy(void)
 
 	free_all_udomains();
 	ul_destroy_locks();
+	ul_istr_destroy();
 
 	/* free callbacks list */
 	destroy_ulcb_list();
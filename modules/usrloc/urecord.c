@@ -94,6 +94,7 @@ int new_urecord(str* _dom, str* _aor, urecord_t** _r)
 	(*_r)->aor.len = _aor->len;
 	(*_r)->domain = _dom;
 	(*_r)->aorhash = core_hash(_aor, NULL, 0);
+	INIT_LIST_HEAD(&(*_r)->dirty_list);
 
 	return 0;
 }
@@ -136,6 +137,119 @@ void restore_urecord_kv_store(urecord_t *_r, ucontact_t *_c)
 	}
 }
 
+/*! \brief
+ * Index the record by the next time the timer has to check it: the
+ * earliest contact expiry or, for empty records, the very next timer
+ * run. Records with contacts pending a write-back are also queued on
+ * the dirty list of their slot
+ */
+void sched_urecord_timer(urecord_t* _r)
+{
+	ucontact_t *c;
+	time_t due = 0;
+	int dirty = 0;
+
+	if (!have_mem_storage() || !_r->slot)
+		return;
+
+	if (!_r->contacts) {
+		due = UL_TIMER_ASAP;
+	} else {
+		for (c = _r->contacts; c; c = c->next) {
+			if (c->state != CS_SYNC)
+				dirty = 1;
+
+			if (c->expires != 0 && (due == 0 || c->expires < due))
+				due = c->expires;
+		}
+	}
+
+	if (dirty && rr_persist == RRP_LOAD_FROM_SQL &&
+	        list_empty(&_r->dirty_list))
+		list_add_tail(&_r->dirty_list, &_r->slot->dirty);
+
+	slot_timer_set(_r->slot, _r, due);
+}
+
+
+/*! \brief
+ * Queue the record on the dirty list of its slot, so its K/V store gets
+ * persisted by the next write-back run, even if no contact changed
+ */
+void dirty_urecord_kv_store(urecord_t* _r)
+{
+	if (!have_mem_storage() || !_r->slot || rr_persist != RRP_LOAD_FROM_SQL)
+		return;
+
+	if (list_empty(&_r->dirty_list))
+		list_add_tail(&_r->dirty_list, &_r->slot->dirty);
+}
+
+
+/*! \brief
+ * Write-back the contacts of a record which are not yet flushed. The
+ * inserts are queued on \a ins_list and, if given, the updates are
+ * queued on \a ups_list as full row "insert or update" queries. The
+ * record is dropped from the dirty list once all its contacts are synced
+ * \return 1 if rows were queued for a later flush, 0 otherwise
+ */
+int wb_flush_urecord(urecord_t* _r, query_list_t **ins_list,
+                     query_list_t **ups_list)
+{
+	ucontact_t* ptr;
+	cstate_t old_state;
+	int ret, dirty = 0, queued = 0;
+
+	if (persist_urecord_kv_store(_r) != 0)
+		LM_DBG("failed to persist latest urecord K/V storage\n");
+
+	for (ptr = _r->contacts; ptr; ptr = ptr->next) {
+		/* expired contacts are handled by the expiry checks */
+		if (!VALID_CONTACT(ptr, act_time))
+			continue;
+
+		old_state = ptr->state;
+
+		switch (st_flush_ucontact(ptr)) {
+		case 0: /* do nothing, contact is synchronized */
+			break;
+
+		case 1: /* insert */
+			if (db_insert_ucontact(ptr, ins_list, 0) < 0) {
+				LM_ERR("inserting contact into database failed\n");
+				ptr->state = old_state;
+				dirty = 1;
+			} else {
+				queued = 1;
+			}
+			break;
+
+		case 2: /* update */
+			if (ups_list)
+				ret = db_insert_ucontact(ptr, ups_list, 1);
+			else
+				ret = db_update_ucontact(ptr);
+
+			if (ret < 0) {
+				LM_ERR("updating contact in db failed\n");
+				ptr->state = old_state;
+				dirty = 1;
+			} else if (ups_list) {
+				queued = 1;
+			}
+			break;
+		}
+	}
+
+	if (!dirty) {
+		list_del(&_r->dirty_list);
+		INIT_LIST_HEAD(&_r->dirty_list);
+	}
+
+	return queued;
+}
+
+
 /*! \brief
  * Add a new contact
  * Contacts are ordered by: 1) q
@@ -186,6 +300,8 @@ ucontact_t* mem_insert_ucontact(urecord_t* _r, str* _c, ucontact_info_t* _ci)
 		_r->contacts = c;
 	}
 
+	sched_urecord_timer(_r);
+
 	ul_raise_contact_event(ei_c_ins_id, c);
 	return c;
 }
@@ -220,6 +336,8 @@ void mem_remove_ucontact(urecord_t* _r, ucontact_t* _c)
 		}
 	}
 
+	sched_urecord_timer(_r);
+
 	ul_raise_contact_event(ei_c_del_id, _c);
 }
 
@@ -930,6 +1048,9 @@ int delete_ucontact(urecord_t* _r, struct ucontact* _c,
 			if (db_only_timer(_r) < 0)
 				LM_ERR("failed to sync with db\n");
 		}
+	} else {
+		/* expired by now, leave it to the timer */
+		sched_urecord_timer(_r);
 	}
 
 	return 0;
@@ -1158,5 +1279,11 @@ int_str_t *get_urecord_key(urecord_t* _rec, const str* _key)
 int_str_t *put_urecord_key(urecord_t* _rec, const str* _key,
                            const int_str_t* _val)
 {
-	return kv_put(_rec->kv_storage, _key, _val);
+	int_str_t *val;
+
+	val = kv_put(_rec->kv_storage, _key, _val);
+	if (val)
+		dirty_urecord_kv_store(_rec);
+
+	return val;
 }
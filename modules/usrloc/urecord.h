@@ -66,6 +66,13 @@ typedef struct urecord {
 	int no_clear_ref;              /*!< Keep the record while positive */
 	int is_static;
 
+	time_t timer_due;              /*!< Next time the timer has to check
+                                    * the record (0 - never) */
+	int timer_pos;                 /*!< Position in the slot timer heap */
+	struct urecord* timer_next;    /*!< Due records, as detached by timer */
+	struct list_head dirty_list;   /*!< Link in the slot list of records
+                                    * pending a write-back */
+
 	map_t kv_storage;              /*!< data attached by API subscribers >*/
 } urecord_t;
 
@@ -95,6 +102,27 @@ void mem_remove_ucontact(urecord_t* _r, ucontact_t* _c);
 void mem_delete_ucontact(urecord_t* _r, ucontact_t* _c);
 
 
+/* timer check key for the records due at the very next timer run */
+#define UL_TIMER_ASAP 1
+
+/*
+ * Index the record for its next timer check
+ */
+void sched_urecord_timer(urecord_t* _r);
+
+/*
+ * Queue the record for the write-back of its changed K/V store
+ */
+void dirty_urecord_kv_store(urecord_t* _r);
+
+
+/*
+ * Write-back the contacts of a record which are not yet flushed
+ */
+int wb_flush_urecord(urecord_t* _r, query_list_t **ins_list,
+                     query_list_t **ups_list);
+
+
 /*
  * Timer handler
  */
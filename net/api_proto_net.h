@@ -59,6 +59,17 @@ typedef int  (*proto_net_stream_read_f)(struct tcp_connection *c, int *len);
 typedef int  (*proto_net_stream_conn_init_f)(struct tcp_connection *c);
 typedef void (*proto_net_stream_conn_clean_f)(struct tcp_connection *c);
 typedef int  (*proto_net_stream_extra_match_f)(struct tcp_connection *c, void *id);
+/**
+ * Advance the handshake (if any) of an accepted connection, without reading
+ * any application data, so it may be done by a dedicated handshake worker.
+ *
+ * Possible return values:
+ *   -1 :: error during the handshake, the @c connection must be released
+ *         by the caller
+ *    0 :: the handshake is still pending, more data is needed
+ *    1 :: the handshake is completed
+ */
+typedef int  (*proto_net_stream_conn_handshake_f)(struct tcp_connection *c);
 
 typedef void (*proto_net_report_f)( int type, unsigned long long conn_id,
 		int conn_flags, void *extra);
@@ -77,6 +88,7 @@ struct api_proto_net {
 				proto_net_stream_conn_init_f   init;
 				proto_net_stream_conn_clean_f  clean;
 				proto_net_stream_extra_match_f match;
+				proto_net_stream_conn_handshake_f handshake;
 			} conn;
 		} stream;
 	};
@@ -51,6 +51,7 @@
 #include "../reactor.h"
 #include "../timer.h"
 #include "../ipc.h"
+#include "../statistics.h"
 
 #include "tcp_passfd.h"
 #include "net_tcp_proc.h"
@@ -92,6 +93,11 @@ struct tcp_partition {
 	struct tcp_conn_alias** tcpconn_aliases_hash;
 	/*! \brief connection hash table (after connection id) */
 	struct tcp_connection** tcpconn_id_hash;
+	/*! \brief lifetime wheel - the connections are linked in the slot of
+	 * the tick they expire at; as the lifetime may be extended (without
+	 * locking) by any process, a connection found not yet expired in its
+	 * slot is simply moved to the slot of its new lifetime */
+	struct tcp_connection** tcpconn_lt_wheel;
 	gen_lock_t* tcpconn_lock;
 };
 
@@ -106,11 +112,46 @@ static unsigned int* connection_id=0;
 /* array of TCP partitions */
 static struct tcp_partition tcp_parts[TCP_PARTITION_SIZE];
 
+/* the last tick checked for expired connections - TCP main only */
+static unsigned int tcp_lt_last_tick = 0;
+
 /*!< tcp protocol number as returned by getprotobyname */
 static int tcp_proto_no=-1;
 
 /* communication socket from generic proc to TCP main */
 int unix_tcp_sock = -1;
+/* the sockets (one per TCP main shard) for talking to TCP main; the one of
+ * the first shard is unix_tcp_sock */
+static int *unix_tcp_socks = NULL;
+/* the socket pairs of all processes (and of all TCP workers) with the
+ * extra TCP main shards - [(proc or worker)*(shards-1) + shard-1]; the
+ * first shard uses the pairs from the process and TCP workers tables */
+static int (*tcp_shard_proc_socks)[2] = NULL;
+static int (*tcp_shard_worker_socks)[2] = NULL;
+/* the index of the current TCP main shard */
+static int tcp_main_shard = 0;
+
+#define TCP_SHARD_PAIR(_pairs, _idx, _shard) \
+	(_pairs)[(_idx)*(tcp_main_shards-1) + (_shard)-1]
+
+/* the socket pair of a process with a TCP main shard ([0] is the TCP main
+ * end, [1] is the process end) */
+#define tcp_proc_pair(_proc, _shard) \
+	((_shard)==0 ? pt[_proc].tcp_socks_holder : \
+		TCP_SHARD_PAIR(tcp_shard_proc_socks, _proc, _shard))
+/* the TCP main end of the socket pair with a TCP worker */
+#define tcp_worker_main_sock(_w, _shard) \
+	((_shard)==0 ? tcp_workers[_w].unix_sock : \
+		TCP_SHARD_PAIR(tcp_shard_worker_socks, _w, _shard)[0])
+/* the TCP worker end of the socket pair with TCP main */
+#define tcp_worker_sock(_w, _shard) \
+	((_shard)==0 ? tcp_workers[_w].main_unix_sock : \
+		TCP_SHARD_PAIR(tcp_shard_worker_socks, _w, _shard)[1])
+
+/* iterates the TCP partitions owned by the current TCP main shard */
+#define for_each_shard_part(_part) \
+	for( _part=tcp_main_shard ; _part<TCP_PARTITION_SIZE ; \
+		_part+=tcp_main_shards )
 
 /*!< current number of open connections */
 static int tcp_connections_no = 0;
@@ -129,12 +170,28 @@ int tcp_workers_no = UDP_WORKERS_NO;
 int tcp_workers_max_no;
 /* the name of the auto-scaling profile (optional) */
 char* tcp_auto_scaling_profile = NULL;
+/* the configured/starting number of TCP handshake workers (0 to have the
+ * handshakes done by the regular TCP workers) */
+int tcp_hs_workers_no = 0;
+/* the maximum numbers of TCP handshake workers; they follow the regular
+ * TCP workers in the TCP workers array */
+static int tcp_hs_workers_max_no = 0;
+/* the name of the auto-scaling profile of the handshake workers (optional) */
+char* tcp_hs_auto_scaling_profile = NULL;
 /* Max number of seconds that we except a full SIP message
  * to arrive in - anything above will lead to the connection to closed */
 int tcp_max_msg_time = TCP_CHILD_MAX_MSG_TIME;
 /* If the data reading may be performed across different workers (still
  * serial) or by a single worker (the TCP conns sticks to one worker) */
 int tcp_parallel_read_on_workers = 0;
+/* If non-zero, the TCP conns stick to the last worker which read from them
+ * (instead of being passed back to TCP main after each read), as long as
+ * the load of this worker does not exceed the load of the least loaded
+ * worker by more than this value (in percents) */
+int tcp_sticky_workers = 0;
+/* the number of TCP main processes; each of them accepts connections on
+ * all the TCP listeners and owns a subset of the TCP partitions */
+int tcp_main_shards = 1;
 
 #ifdef HAVE_SO_KEEPALIVE
     int tcp_keepalive = 1;
@@ -166,6 +223,22 @@ int is_tcp_main = 0;
 unsigned int last_outgoing_tcp_id = 0;
 
 static struct scaling_profile *s_profile = NULL;
+static struct scaling_profile *hs_s_profile = NULL;
+
+/* the size of the TCP workers array - regular and handshake workers */
+#define tcp_workers_all_no (tcp_workers_max_no + tcp_hs_workers_max_no)
+
+/* the number of fds passed by TCP main to other processes */
+static stat_var *tcp_fd_handoffs = NULL;
+/* the number of sticky conns passed back by a worker as being overloaded */
+stat_var *tcp_sticky_rebalances = NULL;
+/* the fds passed by TCP main during the last second (set by TCP main) */
+static unsigned long *tcp_fd_handoffs_sec = NULL;
+
+static unsigned long tcp_get_fd_handoffs_rate(void *_)
+{
+	return tcp_fd_handoffs_sec ? *tcp_fd_handoffs_sec : 0;
+}
 
 /****************************** helper functions *****************************/
 extern void handle_sigs(void);
@@ -283,13 +356,23 @@ static int send2worker(struct tcp_connection* tcpconn,int rw)
 {
 	int i;
 	int min_load;
-	int idx;
+	int idx, first, last;
 	long response[2];
 	unsigned int load;
 
+	/* the conns with a pending handshake are read by the handshake
+	 * workers, if any */
+	if (rw==IO_WATCH_READ && (tcpconn->flags&F_CONN_HANDSHAKE)) {
+		first = tcp_workers_max_no;
+		last = tcp_workers_all_no;
+	} else {
+		first = 0;
+		last = tcp_workers_max_no;
+	}
+
 	min_load=100; /* it is a percentage */
-	idx=0;
-	for (i=0; i<tcp_workers_max_no; i++){
+	idx=first;
+	for (i=first; i<last; i++){
 		if (tcp_workers[i].state==STATE_ACTIVE) {
 			load = pt_get_1m_proc_load( tcp_workers[i].pt_idx );
 #ifdef EXTRA_DEBUG
@@ -304,22 +387,80 @@ static int send2worker(struct tcp_connection* tcpconn,int rw)
 		}
 	}
 
+	/* in sticky mode, keep the reading on the worker which did the last
+	 * read, if not overloaded compared to the least loaded one */
+	if (tcp_sticky_workers && rw==IO_WATCH_READ && first==0 &&
+	(i=tcpconn->worker_id)>=0 && i!=idx &&
+	tcp_workers[i].state==STATE_ACTIVE) {
+		load = pt_get_1m_proc_load( tcp_workers[i].pt_idx );
+		if (load <= min_load + tcp_sticky_workers) {
+			min_load = load;
+			idx = i;
+		}
+	}
+
 	tcp_workers[idx].n_reqs++;
 	LM_DBG("to tcp worker %d (%d/%d) load %u, %p/%d rw %d\n", idx,
 		tcp_workers[idx].pid, tcp_workers[idx].pt_idx, min_load,
 		tcpconn, tcpconn->s, rw);
 	response[0]=(long)tcpconn;
 	response[1]=rw;
-	if (send_fd(tcp_workers[idx].unix_sock, response, sizeof(response),
-			tcpconn->s)<=0){
+	if (send_fd(tcp_worker_main_sock(idx, tcp_main_shard), response,
+			sizeof(response), tcpconn->s)<=0){
 		LM_ERR("send_fd failed\n");
 		return -1;
 	}
+	if (rw==IO_WATCH_READ && first==0)
+		tcpconn->worker_id = idx;
+	update_stat( tcp_fd_handoffs, 1);
 
 	return 0;
 }
 
 
+/* checks, in a TCP worker, if a conn should stay in the reactor of this
+ * worker after a read (sticky mode), instead of going back to TCP main;
+ * the load comparison is refreshed once per tick */
+int tcp_conn_sticky(struct tcp_connection *c)
+{
+	static unsigned int last_check = 0;
+	static int overloaded = 0;
+	unsigned int load, min_load, ticks;
+	int i, own;
+
+	if (!tcp_sticky_workers || _termination_in_progress)
+		return 0;
+
+	ticks = get_ticks();
+	if (last_check != ticks) {
+		last_check = ticks;
+
+		own = -1;
+		min_load = 100; /* it is a percentage */
+		for (i=0; i<tcp_workers_max_no; i++) {
+			if (tcp_workers[i].state!=STATE_ACTIVE)
+				continue;
+			if (tcp_workers[i].pt_idx==process_no)
+				own = i;
+			load = pt_get_1m_proc_load( tcp_workers[i].pt_idx );
+			if (min_load>load)
+				min_load = load;
+		}
+
+		/* a draining worker does not keep anything */
+		overloaded = (own<0) ? 1 : (pt_get_1m_proc_load(process_no) >
+			min_load + tcp_sticky_workers);
+	}
+
+	if (overloaded)
+		return 0;
+
+	/* the hand-back is accounted by tcp_done_reading() */
+	c->flags |= F_CONN_STICKY;
+	return 1;
+}
+
+
 
 /********************** TCP conn management functions ************************/
 
@@ -393,7 +534,9 @@ int tcp_init_listener(struct socket_info *si)
 	}
 
 	init_sock_keepalive(si->socket, &tcp_con_df_profile);
-	if (si->flags & SI_REUSEPORT)
+	/* with multiple TCP main shards, each of them binds its own socket
+	 * on the listener, so the kernel spreads the new conns over them */
+	if ((si->flags & SI_REUSEPORT) || tcp_main_shards>1)
 		set_sock_reuseport(si->socket);
 	if (bind(si->socket, &addr->s, sockaddru_len(*addr))==-1){
 		LM_ERR("bind(%x, %p, %d) on %s:%d : %s\n",
@@ -476,6 +619,7 @@ int tcp_conn_get(unsigned int id, struct ip_addr* ip, int port,
 	unsigned int part;
 	int n;
 	int fd;
+	int usock;
 
 	if (id) {
 		part = id;
@@ -555,16 +699,17 @@ found:
 	/* get the fd */
 	response[0]=(long)c;
 	response[1]=CONN_GET_FD;
-	n=send_all(unix_tcp_sock, response, sizeof(response));
+	usock = tcp_main_sock(c->id);
+	n=send_all(usock, response, sizeof(response));
 	if (n<=0){
 		LM_ERR("failed to get fd(write):%s (%d)\n",
 				strerror(errno), errno);
 		n=-1;
 		goto error;
 	}
-	LM_DBG("c= %p, n=%d, Usock=%d\n", c, n, unix_tcp_sock);
+	LM_DBG("c= %p, n=%d, Usock=%d\n", c, n, usock);
 	tmp = c;
-	n=receive_fd(unix_tcp_sock, &c, sizeof(c), &fd, MSG_WAITALL);
+	n=receive_fd(usock, &c, sizeof(c), &fd, MSG_WAITALL);
 	if (n<=0){
 		LM_ERR("failed to get fd(receive_fd):"
 			" %s (%d)\n", strerror(errno), errno);
@@ -625,6 +770,40 @@ int tcp_conn_fcntl(struct receive_info *rcv, int attr, void *value)
 }
 
 
+/*! \brief (re)links a connection in the lifetime wheel, in the slot to be
+ * checked at the given tick; only TCP main uses the wheel
+ * \note the partition lock must be held */
+static inline void tcpconn_lt_link(struct tcp_connection *c, unsigned int tick)
+{
+	int slot;
+
+	/* the slots up to the last checked tick will be checked again only
+	 * after a full turn of the wheel */
+	if ((int)(tick - tcp_lt_last_tick) <= 0)
+		tick = tcp_lt_last_tick + 1;
+
+	slot = tcp_lt_slot(tick);
+	if (c->lt_slot == slot)
+		return;
+
+	if (c->lt_slot >= 0)
+		tcpconn_listrm(TCP_PART(c->id).tcpconn_lt_wheel[c->lt_slot], c,
+			lt_next, lt_prev);
+	tcpconn_listadd(TCP_PART(c->id).tcpconn_lt_wheel[slot], c,
+		lt_next, lt_prev);
+	c->lt_slot = slot;
+}
+
+
+/*! \brief forces the connection to expire at the next lifetime check
+ * \note the partition lock must be held */
+static inline void tcpconn_force_expire(struct tcp_connection *c)
+{
+	c->lifetime = 0;
+	tcpconn_lt_link(c, get_ticks() + 1);
+}
+
+
 static struct tcp_connection* tcpconn_add(struct tcp_connection *c)
 {
 	unsigned hash;
@@ -645,6 +824,7 @@ static struct tcp_connection* tcpconn_add(struct tcp_connection *c)
 		tcpconn_listadd(TCP_PART(c->id).tcpconn_aliases_hash[hash],
 			&c->con_aliases[0], next, prev);
 		c->aliases++;
+		tcpconn_lt_link(c, c->lifetime + 1);
 		TCPCONN_UNLOCK(c->id);
 		LM_DBG("hashes: %d, %d\n", hash, c->id_hash);
 		return c;
@@ -751,6 +931,11 @@ static void __tcpconn_rm(struct tcp_connection* c, int no_event)
 	for (r=0; r<c->aliases; r++)
 		tcpconn_listrm(TCP_PART(c->id).tcpconn_aliases_hash[c->con_aliases[r].hash],
 			&c->con_aliases[r], next, prev);
+	if (c->lt_slot >= 0) {
+		tcpconn_listrm(TCP_PART(c->id).tcpconn_lt_wheel[c->lt_slot], c,
+			lt_next, lt_prev);
+		c->lt_slot = -1;
+	}
 	lock_destroy(&c->write_lock);
 
 	if (c->async) {
@@ -894,6 +1079,7 @@ static struct tcp_connection* tcpconn_new(int sock, const union sockaddr_union*
 	struct tcp_connection *c;
 	union sockaddr_union local_su;
 	unsigned int su_size;
+	unsigned int id;
 
 	c=(struct tcp_connection*)shm_malloc(sizeof(struct tcp_connection));
 	if (c==0){
@@ -903,6 +1089,8 @@ static struct tcp_connection* tcpconn_new(int sock, const union sockaddr_union*
 	memset(c, 0, sizeof(struct tcp_connection)); /* zero init */
 	c->s=sock;
 	c->fd=-1; /* not initialized */
+	c->worker_id=-1; /* not read by any TCP worker yet */
+	c->lt_slot=-1; /* not in the lifetime wheel yet */
 	if (lock_init(&c->write_lock)==0){
 		LM_ERR("init lock failed\n");
 		goto error0;
@@ -924,7 +1112,13 @@ static struct tcp_connection* tcpconn_new(int sock, const union sockaddr_union*
 	c->rcv.dst_port = su_getport(&local_su);
 	print_ip("tcpconn_new: new tcp connection to: ", &c->rcv.src_ip, "\n");
 	LM_DBG("on port %d, proto %d\n", c->rcv.src_port, si->proto);
-	c->id=(*connection_id)++;
+	/* the id gives the partition, so the TCP main shard, of the conn: the
+	 * accepted conns stay with the accepting shard, the outgoing ones are
+	 * spread over all the shards; the counter is shared by all the shards
+	 * and by the processes opening conns, so it must be atomically bumped */
+	id=__sync_fetch_and_add(connection_id, 1);
+	c->id = id*tcp_main_shards +
+		(is_tcp_main ? tcp_main_shard : id%tcp_main_shards);
 	c->cid = (unsigned long long)c->id
 				| ( (unsigned long long)(startup_time&0xFFFFFF) << 32 )
 					| ( (unsigned long long)(rand()&0xFF) << 56 );
@@ -1020,7 +1214,7 @@ int tcp_conn_send(struct tcp_connection *c)
 		fd = c->s;
 		response[0]=(long)c;
 		response[1]=ASYNC_CONNECT;
-		n=send_fd(unix_tcp_sock, response, sizeof(response), fd);
+		n=send_fd(tcp_main_sock(c->id), response, sizeof(response), fd);
 		if (n<=0) {
 			LM_ERR("Failed to send the socket to main for async connection\n");
 			goto error;
@@ -1029,7 +1223,7 @@ int tcp_conn_send(struct tcp_connection *c)
 	} else {
 		response[0]=(long)c;
 		response[1]=CONN_NEW;
-		n=send_fd(unix_tcp_sock, response, sizeof(response), c->s);
+		n=send_fd(tcp_main_sock(c->id), response, sizeof(response), c->s);
 		if (n<=0){
 			LM_ERR("failed send_fd: %s (%d)\n", strerror(errno), errno);
 			goto error;
@@ -1066,7 +1260,7 @@ static inline void tcpconn_destroy(struct tcp_connection* tcpconn)
 		tcp_connections_no--;
 	}else{
 		/* force timeout */
-		tcpconn->lifetime=0;
+		tcpconn_force_expire(tcpconn);
 		tcpconn->state=S_CONN_BAD;
 		LM_DBG("delaying (%p, flags %04x) ref = %d ...\n",
 				tcpconn, tcpconn->flags, tcpconn->refcnt);
@@ -1102,6 +1296,7 @@ static inline int handle_new_connect(const struct socket_info* si)
 	struct tcp_conn_profile prof;
 	socklen_t su_len = sizeof(su);
 	int new_sock;
+	int flags;
 	unsigned int id;
 
 	/* coverity[overrun-buffer-arg: FALSE] - union has 28 bytes, CID #200070 */
@@ -1112,9 +1307,10 @@ static inline int handle_new_connect(const struct socket_info* si)
 		LM_ERR("failed to accept connection(%d): %s\n", errno, strerror(errno));
 		return -1;
 	}
-	if (tcp_connections_no>=tcp_max_connections){
+	/* each TCP main shard gets an equal share of the connections */
+	if (tcp_connections_no>=tcp_max_connections/tcp_main_shards){
 		LM_ERR("maximum number of connections exceeded: %d/%d\n",
-					tcp_connections_no, tcp_max_connections);
+					tcp_connections_no, tcp_max_connections/tcp_main_shards);
 		close(new_sock);
 		return 1; /* success, because the accept was successful */
 	}
@@ -1126,8 +1322,14 @@ static inline int handle_new_connect(const struct socket_info* si)
 		return 1; /* success, because the accept was successful */
 	}
 
+	/* the handshake of the new conn is to be done by the handshake workers,
+	 * if any and if the proto has a handshake */
+	flags = F_CONN_ACCEPTED;
+	if (tcp_hs_workers_max_no && protos[si->proto].net.stream.conn.handshake)
+		flags |= F_CONN_HANDSHAKE;
+
 	/* add socket to list */
-	tcpconn=tcpconn_new(new_sock, &su, si, &prof, S_CONN_OK, F_CONN_ACCEPTED);
+	tcpconn=tcpconn_new(new_sock, &su, si, &prof, S_CONN_OK, flags);
 	if (tcpconn){
 		tcpconn->refcnt++; /* safe, not yet available to the
 							  outside world */
@@ -1148,7 +1350,7 @@ static inline int handle_new_connect(const struct socket_info* si)
 				 * reported as OPEN by the proto layer...this sucks a bit */
 				_tcpconn_rm(tcpconn,1);
 				close(new_sock/*same as tcpconn->s*/);
-			}else tcpconn->lifetime=0; /* force expire */
+			}else tcpconn_force_expire(tcpconn);
 			TCPCONN_UNLOCK(id);
 		}
 	}else{ /*tcpconn==0 */
@@ -1199,7 +1401,7 @@ inline static int handle_tcpconn_ev(struct tcp_connection* tcpconn, int fd_i,
 					"No worker for read");
 				_tcpconn_rm(tcpconn,0);
 				close(fd);
-			}else tcpconn->lifetime=0; /* force expire*/
+			}else tcpconn_force_expire(tcpconn);
 			TCPCONN_UNLOCK(id);
 		}
 		return 0; /* we are not interested in possibly queued io events,
@@ -1264,7 +1466,7 @@ async_write:
 						"No worker for write");
 					_tcpconn_rm(tcpconn,0);
 					close(fd);
-				}else tcpconn->lifetime=0; /* force expire*/
+				}else tcpconn_force_expire(tcpconn);
 				TCPCONN_UNLOCK(id);
 			}
 			return 0;
@@ -1276,28 +1478,31 @@ async_write:
 /*! \brief handles io from a tcp worker process
  * \param  tcp_c - pointer in the tcp_workers array, to the entry for
  *                 which an io event was detected
+ * \param  unix_sock - the socket to this worker (of the current TCP main
+ *                 shard) which triggered the event
  * \param  fd_i  - fd index in the fd_array (useful for optimizing
  *                 io_watch_deletes)
  * \return handle_* return convention: -1 on error, 0 on EAGAIN (no more
  *           io events queued), >0 on success. success/error refer only to
  *           the reads from the fd.
  */
-inline static int handle_tcp_worker(struct tcp_worker* tcp_c, int fd_i)
+inline static int handle_tcp_worker(struct tcp_worker* tcp_c, int unix_sock,
+															int fd_i)
 {
 	struct tcp_connection* tcpconn;
 	long response[2];
 	int cmd;
 	int bytes;
 
-	if (tcp_c->unix_sock<=0){
+	if (unix_sock<=0){
 		/* (we can't have a fd==0, 0 is never closed )*/
-		LM_CRIT("fd %d for %d (pid %d)\n", tcp_c->unix_sock,
+		LM_CRIT("fd %d for %d (pid %d)\n", unix_sock,
 				(int)(tcp_c-&tcp_workers[0]), tcp_c->pid);
 		goto error;
 	}
 	/* read until sizeof(response)
 	 * (this is a SOCK_STREAM so read is not atomic) */
-	bytes=recv_all(tcp_c->unix_sock, response, sizeof(response), MSG_DONTWAIT);
+	bytes=recv_all(unix_sock, response, sizeof(response), MSG_DONTWAIT);
 	if (bytes<(int)sizeof(response)){
 		if (bytes==0){
 			/* EOF -> bad, worker has died */
@@ -1305,7 +1510,7 @@ inline static int handle_tcp_worker(struct tcp_worker* tcp_c, int fd_i)
 				LM_CRIT("dead tcp worker %d (EOF received), pid %d\n",
 					(int)(tcp_c-&tcp_workers[0]), tcp_c->pid );
 			/* don't listen on it any more */
-			reactor_del_reader( tcp_c->unix_sock, fd_i, 0/*flags*/);
+			reactor_del_reader( unix_sock, fd_i, 0/*flags*/);
 			/* eof. so no more io here, it's ok to return error */
 			goto error;
 		}else if (bytes<0){
@@ -1403,6 +1608,8 @@ error:
  *
  * \param p     - pointer in the ser processes array (pt[]), to the entry for
  *                 which an io event was detected
+ * \param unix_sock - the socket to this process (of the current TCP main
+ *                 shard) which triggered the event
  * \param fd_i  - fd index in the fd_array (useful for optimizing
  *                 io_watch_deletes)
  * \return  handle_* return convention:
@@ -1412,7 +1619,8 @@ error:
  *          -  >0 on successful reads from the fd (the receive buffer might
  *             be non-empty).
  */
-inline static int handle_worker(struct process_table* p, int fd_i)
+inline static int handle_worker(struct process_table* p, int unix_sock,
+															int fd_i)
 {
 	struct tcp_connection* tcpconn;
 	long response[2];
@@ -1422,16 +1630,16 @@ inline static int handle_worker(struct process_table* p, int fd_i)
 	int fd;
 
 	ret=-1;
-	if (p->unix_sock<=0){
+	if (unix_sock<=0){
 		/* (we can't have a fd==0, 0 is never closed )*/
 		LM_CRIT("fd %d for %d (pid %d)\n",
-				p->unix_sock, (int)(p-&pt[0]), p->pid);
+				unix_sock, (int)(p-&pt[0]), p->pid);
 		goto error;
 	}
 
 	/* get all bytes and the fd (if transmitted)
 	 * (this is a SOCK_STREAM so read is not atomic) */
-	bytes=receive_fd(p->unix_sock, response, sizeof(response), &fd,
+	bytes=receive_fd(unix_sock, response, sizeof(response), &fd,
 						MSG_DONTWAIT);
 	if (bytes<(int)sizeof(response)){
 		/* too few bytes read */
@@ -1441,7 +1649,7 @@ inline static int handle_worker(struct process_table* p, int fd_i)
 				LM_CRIT("dead tcp worker %d (EOF received), pid %d\n",
 					(int)(p-&pt[0]), p->pid);
 			/* don't listen on it any more */
-			reactor_del_reader( p->unix_sock, fd_i, 0/*flags*/);
+			reactor_del_reader( unix_sock, fd_i, 0/*flags*/);
 			goto error; /* worker dead => no further io events from it */
 		}else if (bytes<0){
 			/* EAGAIN is ok if we try to empty the buffer
@@ -1490,9 +1698,11 @@ inline static int handle_worker(struct process_table* p, int fd_i)
 			/* send the requested FD  */
 			/* WARNING: take care of setting refcnt properly to
 			 * avoid race condition */
-			if (send_fd(p->unix_sock, &tcpconn, sizeof(tcpconn),
+			if (send_fd(unix_sock, &tcpconn, sizeof(tcpconn),
 							tcpconn->s)<=0){
 				LM_ERR("send_fd failed\n");
+			} else {
+				update_stat( tcp_fd_handoffs, 1);
 			}
 			break;
 		case CONN_NEW:
@@ -1531,7 +1741,9 @@ inline static int handle_worker(struct process_table* p, int fd_i)
 			break;
 		case ASYNC_WRITE_GENW:
 			if (tcpconn->state==S_CONN_BAD){
-				tcpconn->lifetime=0;
+				TCPCONN_LOCK(tcpconn->id);
+				tcpconn_force_expire(tcpconn);
+				TCPCONN_UNLOCK(tcpconn->id);
 				break;
 			}
 			tcpconn_put(tcpconn);
@@ -1577,10 +1789,10 @@ inline static int handle_io(struct fd_map* fm, int idx,int event_type)
 				event_type);
 			break;
 		case F_TCP_TCPWORKER:
-			ret = handle_tcp_worker((struct tcp_worker*)fm->data, idx);
+			ret = handle_tcp_worker((struct tcp_worker*)fm->data, fm->fd, idx);
 			break;
 		case F_TCP_WORKER:
-			ret = handle_worker((struct process_table*)fm->data, idx);
+			ret = handle_worker((struct process_table*)fm->data, fm->fd, idx);
 			break;
 		case F_IPC:
 			ipc_handle_job(fm->fd);
@@ -1601,7 +1813,7 @@ error:
 
 
 /*
- * iterates through all TCP connections and closes expired ones
+ * closes the expired TCP connections
  * Note: runs once per second at most
  */
 #define tcpconn_lifetime(last_sec) \
@@ -1609,23 +1821,69 @@ error:
 		int now; \
 		now = get_ticks(); \
 		if (last_sec != now) { \
+			tcp_fd_handoffs_tick(now - last_sec); \
 			last_sec = now; \
-			__tcpconn_lifetime(0); \
+			tcpconn_lifetime_wheel(); \
 		} \
 	} while (0)
 
 
-/*! \brief very inefficient for now - FIXME
+/* computes the rate of the fd handoffs over the last elapsed ticks */
+static inline void tcp_fd_handoffs_tick(unsigned int elapsed)
+{
+	static unsigned long last_handoffs = 0;
+	unsigned long handoffs;
+
+	handoffs = get_stat_val(tcp_fd_handoffs);
+	*tcp_fd_handoffs_sec = (handoffs - last_handoffs) / elapsed;
+	last_handoffs = handoffs;
+}
+
+
+/*! \brief closes and removes an expired connection
  * keep in sync with tcpconn_destroy, the "delete" part should be
  * the same except for io_watch_del..
- * \todo FIXME (very inefficient for now)
+ */
+static inline void __tcpconn_expire(struct tcp_connection *c,
+												unsigned int ticks, int shutdown)
+{
+	int fd;
+
+	if (!shutdown)
+		LM_DBG("timeout for conn id=%d - %p (%d > %d)\n",
+			c->id, c, ticks, c->lifetime);
+	fd=c->s;
+	/* report the closing of the connection . Note that
+	 * there are connectioned that use an foced expire to 0
+	 * as a way to be deleted - we are not interested in */
+	/* Also, do not trigger reporting when shutdown
+	 * is done */
+	if (c->lifetime>0 && !shutdown)
+		tcp_trigger_report(c, TCP_REPORT_CLOSE,
+			"Timeout on no traffic");
+	if ((!shutdown)&&(fd>0)&&(c->refcnt==0)) {
+		/* if any of read or write are set, we need to remove
+		 * the fd from the reactor */
+		if ((c->flags & F_CONN_REMOVED) != F_CONN_REMOVED){
+			reactor_del_all( fd, -1, IO_FD_CLOSING);
+			c->flags|=F_CONN_REMOVED;
+		}
+		close(fd);
+		c->s = -1;
+	}
+	_tcpconn_rm(c, shutdown?1:0);
+	tcp_connections_no--;
+}
+
+
+/*! \brief iterates through all TCP connections and closes the expired ones
+ * (or all of them, on shutdown)
  */
 static inline void __tcpconn_lifetime(int shutdown)
 {
 	struct tcp_connection *c, *next;
 	unsigned int ticks,part;
 	unsigned h;
-	int fd;
 
 	if (have_ticks())
 		ticks=get_ticks();
@@ -1638,32 +1896,8 @@ static inline void __tcpconn_lifetime(int shutdown)
 			c=TCP_PART(part).tcpconn_id_hash[h];
 			while(c){
 				next=c->id_next;
-				if (shutdown ||((c->refcnt==0) && (ticks>c->lifetime))) {
-					if (!shutdown)
-						LM_DBG("timeout for hash=%d - %p"
-								" (%d > %d)\n", h, c, ticks, c->lifetime);
-					fd=c->s;
-					/* report the closing of the connection . Note that
-					 * there are connectioned that use an foced expire to 0
-					 * as a way to be deleted - we are not interested in */
-					/* Also, do not trigger reporting when shutdown
-					 * is done */
-					if (c->lifetime>0 && !shutdown)
-						tcp_trigger_report(c, TCP_REPORT_CLOSE,
-							"Timeout on no traffic");
-					if ((!shutdown)&&(fd>0)&&(c->refcnt==0)) {
-						/* if any of read or write are set, we need to remove
-						 * the fd from the reactor */
-						if ((c->flags & F_CONN_REMOVED) != F_CONN_REMOVED){
-							reactor_del_all( fd, -1, IO_FD_CLOSING);
-							c->flags|=F_CONN_REMOVED;
-						}
-						close(fd);
-						c->s = -1;
-					}
-					_tcpconn_rm(c, shutdown?1:0);
-					tcp_connections_no--;
-				}
+				if (shutdown ||((c->refcnt==0) && (ticks>c->lifetime)))
+					__tcpconn_expire(c, ticks, shutdown);
 				c=next;
 			}
 		}
@@ -1672,10 +1906,54 @@ static inline void __tcpconn_lifetime(int shutdown)
 }
 
 
+/*! \brief checks the slots of the lifetime wheel for the ticks elapsed since
+ * the last run; a connection found in a slot is either closed (expired and
+ * not in use), checked again at the next tick (expired, but still in use) or
+ * moved to the slot of its (meanwhile extended) lifetime
+ */
+static inline void tcpconn_lifetime_wheel(void)
+{
+	struct tcp_connection *c, *next;
+	unsigned int ticks, from, t, part;
+
+	ticks = get_ticks();
+	if ((int)(ticks - tcp_lt_last_tick) <= 0)
+		return;
+
+	/* no need to go through the wheel more than once */
+	if (ticks - tcp_lt_last_tick > TCP_LT_WHEEL_SIZE)
+		from = ticks - TCP_LT_WHEEL_SIZE + 1;
+	else
+		from = tcp_lt_last_tick + 1;
+	/* from now on, the connections may be linked only in future slots */
+	tcp_lt_last_tick = ticks;
+
+	for_each_shard_part(part) {
+		TCPCONN_LOCK(part);
+		for( t=from ; t!=ticks+1 ; t++ ) {
+			c = TCP_PART(part).tcpconn_lt_wheel[tcp_lt_slot(t)];
+			while(c){
+				next=c->lt_next;
+				if (ticks>c->lifetime) {
+					if (c->refcnt==0)
+						__tcpconn_expire(c, ticks, 0);
+					else
+						tcpconn_lt_link(c, ticks + 1);
+				} else {
+					tcpconn_lt_link(c, c->lifetime + 1);
+				}
+				c=next;
+			}
+		}
+		TCPCONN_UNLOCK(part);
+	}
+}
+
+
 static void tcp_main_server(void)
 {
 	static unsigned int last_sec = 0;
-	int flags;
+	int flags, fd;
 	struct socket_info_full* sif;
 	int n;
 
@@ -1718,8 +1996,9 @@ static void tcp_main_server(void)
 	for (n=1; n<counted_max_processes; n++) {
 		/* skip myslef (as process) and -1 socks (disabled)
 		   (we can't have 0, we never close it!) */
-		if (n!=process_no && pt[n].tcp_socks_holder[0]>0)
-			if (reactor_add_reader( pt[n].tcp_socks_holder[0], F_TCP_WORKER,
+		if (n!=process_no && tcp_proc_pair(n,tcp_main_shard)[0]>0)
+			if (reactor_add_reader( tcp_proc_pair(n,tcp_main_shard)[0],
+			F_TCP_WORKER,
 			RCT_PRIO_PROC, &pt[n])<0){
 				LM_ERR("failed to add process %d (%s) unix socket "
 					"to the fd list\n", n, pt[n].desc);
@@ -1727,22 +2006,23 @@ static void tcp_main_server(void)
 			}
 	}
 	/* add all the unix sokets used for communication with the tcp workers */
-	for (n=0; n<tcp_workers_max_no; n++) {
+	for (n=0; n<tcp_workers_all_no; n++) {
+		fd = tcp_worker_main_sock(n, tcp_main_shard);
 		/*we can't have 0, we never close it!*/
-		if (tcp_workers[n].unix_sock>0) {
+		if (fd>0) {
 			/* make socket non-blocking */
-			flags=fcntl(tcp_workers[n].unix_sock, F_GETFL);
+			flags=fcntl(fd, F_GETFL);
 			if (flags==-1){
 				LM_ERR("fcntl failed: (%d) %s\n", errno, strerror(errno));
 				goto error;
 			}
-			if (fcntl(tcp_workers[n].unix_sock,F_SETFL,flags|O_NONBLOCK)==-1){
+			if (fcntl(fd,F_SETFL,flags|O_NONBLOCK)==-1){
 				LM_ERR("set non-blocking failed: (%d) %s\n",
 					errno, strerror(errno));
 				goto error;
 			}
 			/* add socket for listening */
-			if (reactor_add_reader( tcp_workers[n].unix_sock,
+			if (reactor_add_reader( fd,
 			F_TCP_TCPWORKER, RCT_PRIO_PROC, &tcp_workers[n])<0) {
 				LM_ERR("failed to add tcp worker %d unix socket to "
 						"the fd list\n", n);
@@ -1812,14 +2092,79 @@ int tcp_init(void)
 	tcp_workers_max_no = (s_profile && (tcp_workers_no<s_profile->max_procs)) ?
 		s_profile->max_procs : tcp_workers_no ;
 
+	if (tcp_hs_workers_no<0) {
+		LM_WARN("invalid tcp_handshake_workers %d, disabling\n",
+			tcp_hs_workers_no);
+		tcp_hs_workers_no = 0;
+	}
+
+	if (tcp_hs_workers_no && tcp_hs_auto_scaling_profile) {
+		hs_s_profile = get_scaling_profile(tcp_hs_auto_scaling_profile);
+		if (hs_s_profile==NULL) {
+			LM_WARN("TCP handshake scaling profile <%s> not defined "
+				"-> ignoring it...\n", tcp_hs_auto_scaling_profile);
+		} else {
+			auto_scaling_enabled = 1;
+		}
+	}
+
+	tcp_hs_workers_max_no = (hs_s_profile &&
+		(tcp_hs_workers_no<hs_s_profile->max_procs)) ?
+		hs_s_profile->max_procs : tcp_hs_workers_no ;
+
+	if (tcp_sticky_workers<0) {
+		LM_WARN("invalid tcp_sticky_workers %d, disabling\n",
+			tcp_sticky_workers);
+		tcp_sticky_workers = 0;
+	}
+
+	/* the TCP partitions must be evenly split between the shards */
+	if (tcp_main_shards<1 || tcp_main_shards>TCP_PARTITION_SIZE ||
+	(tcp_main_shards & (tcp_main_shards-1))) {
+		LM_WARN("invalid tcp_main_shards %d (must be a power of 2, up "
+			"to %d), using 1\n", tcp_main_shards, TCP_PARTITION_SIZE);
+		tcp_main_shards = 1;
+	}
+
+	tcp_fd_handoffs_sec = shm_malloc(sizeof *tcp_fd_handoffs_sec);
+	if (tcp_fd_handoffs_sec==NULL) {
+		LM_CRIT("could not alloc fd handoffs rate in shm memory\n");
+		goto error;
+	}
+	*tcp_fd_handoffs_sec = 0;
+
+	if (register_stat("net", "tcp_fd_handoffs", &tcp_fd_handoffs, 0)!=0 ||
+	register_stat("net", "tcp_fd_handoffs_rate",
+	(stat_var **)tcp_get_fd_handoffs_rate, STAT_IS_FUNC)!=0 ||
+	register_stat("net", "tcp_sticky_rebalances",
+	&tcp_sticky_rebalances, 0)!=0) {
+		LM_ERR("failed to register the TCP dispatching stats\n");
+		goto error;
+	}
+
+	/* the load of the handshake workers, apart from the SIP load */
+	if (tcp_hs_workers_max_no && (
+	register_stat2("load", "load-handshake",
+	(stat_var **)pt_get_rt_type_load, STAT_IS_FUNC,
+	(void*)(long)TYPE_TCP_HANDSHAKE, 0)!=0 ||
+	register_stat2("load", "load1m-handshake",
+	(stat_var **)pt_get_1m_type_load, STAT_IS_FUNC,
+	(void*)(long)TYPE_TCP_HANDSHAKE, 0)!=0 ||
+	register_stat2("load", "load10m-handshake",
+	(stat_var **)pt_get_10m_type_load, STAT_IS_FUNC,
+	(void*)(long)TYPE_TCP_HANDSHAKE, 0)!=0)) {
+		LM_ERR("failed to register the TCP handshake load stats\n");
+		goto error;
+	}
+
 	/* init tcp workers array */
 	tcp_workers = (struct tcp_worker*)shm_malloc
-		( tcp_workers_max_no*sizeof(struct tcp_worker) );
+		( tcp_workers_all_no*sizeof(struct tcp_worker) );
 	if (tcp_workers==0) {
 		LM_CRIT("could not alloc tcp_workers array in shm memory\n");
 		goto error;
 	}
-	memset( tcp_workers, 0, tcp_workers_max_no*sizeof(struct tcp_worker));
+	memset( tcp_workers, 0, tcp_workers_all_no*sizeof(struct tcp_worker));
 	/* init globals */
 	connection_id=(unsigned int*)shm_malloc(sizeof(unsigned int));
 	if (connection_id==0){
@@ -1862,6 +2207,15 @@ int tcp_init(void)
 			TCP_ALIAS_HASH_SIZE * sizeof(struct tcp_conn_alias*));
 		memset((void*)tcp_parts[i].tcpconn_id_hash, 0,
 			TCP_ID_HASH_SIZE * sizeof(struct tcp_connection*));
+		/* alloc the lifetime wheel */
+		tcp_parts[i].tcpconn_lt_wheel=(struct tcp_connection**)
+			shm_malloc(TCP_LT_WHEEL_SIZE*sizeof(struct tcp_connection*));
+		if (tcp_parts[i].tcpconn_lt_wheel==0){
+			LM_CRIT("could not alloc lifetime wheel in shm memory\n");
+			goto error;
+		}
+		memset((void*)tcp_parts[i].tcpconn_lt_wheel, 0,
+			TCP_LT_WHEEL_SIZE * sizeof(struct tcp_connection*));
 	}
 
 	return 0;
@@ -1886,6 +2240,11 @@ void tcp_destroy(void)
 		connection_id=0;
 	}
 
+	if (tcp_fd_handoffs_sec){
+		shm_free(tcp_fd_handoffs_sec);
+		tcp_fd_handoffs_sec=0;
+	}
+
 	for ( part=0 ; part<TCP_PARTITION_SIZE ; part++ ) {
 		if (tcp_parts[part].tcpconn_id_hash){
 			shm_free(tcp_parts[part].tcpconn_id_hash);
@@ -1895,6 +2254,10 @@ void tcp_destroy(void)
 			shm_free(tcp_parts[part].tcpconn_aliases_hash);
 			tcp_parts[part].tcpconn_aliases_hash=0;
 		}
+		if (tcp_parts[part].tcpconn_lt_wheel){
+			shm_free(tcp_parts[part].tcpconn_lt_wheel);
+			tcp_parts[part].tcpconn_lt_wheel=0;
+		}
 		if (tcp_parts[part].tcpconn_lock){
 			lock_destroy(tcp_parts[part].tcpconn_lock);
 			lock_dealloc((void*)tcp_parts[part].tcpconn_lock);
@@ -1906,30 +2269,53 @@ void tcp_destroy(void)
 
 int tcp_create_comm_proc_socks( int proc_no)
 {
-	int i;
+	int i, n;
 
 	if (tcp_disabled)
 		return 0;
 
-	for( i=0 ; i<proc_no ; i++ ) {
-		if (socketpair(AF_UNIX, SOCK_STREAM, 0, pt[i].tcp_socks_holder)<0){
-			LM_ERR("socketpair failed for process %d: %d/%s\n",
-				i, errno, strerror(errno));
+	unix_tcp_socks = (int*)pkg_malloc(tcp_main_shards*sizeof(int));
+	if (unix_tcp_socks==NULL) {
+		LM_ERR("no more pkg memory for the TCP main sockets\n");
+		return -1;
+	}
+	for( n=0 ; n<tcp_main_shards ; n++ )
+		unix_tcp_socks[n] = -1;
+
+	if (tcp_main_shards>1) {
+		tcp_shard_proc_socks = pkg_malloc( proc_no*(tcp_main_shards-1)*
+			sizeof *tcp_shard_proc_socks);
+		if (tcp_shard_proc_socks==NULL) {
+			LM_ERR("no more pkg memory for the TCP main shards sockets\n");
 			return -1;
 		}
 	}
 
+	for( i=0 ; i<proc_no ; i++ ) {
+		for( n=0 ; n<tcp_main_shards ; n++ ) {
+			if (socketpair(AF_UNIX, SOCK_STREAM, 0, tcp_proc_pair(i,n))<0){
+				LM_ERR("socketpair failed for process %d: %d/%s\n",
+					i, errno, strerror(errno));
+				return -1;
+			}
+		}
+	}
+
 	return 0;
 }
 
 
 int tcp_activate_comm_proc_socks( int proc_no)
 {
+	int n;
+
 	if (tcp_disabled)
 		return 0;
 
 	unix_tcp_sock = pt[proc_no].tcp_socks_holder[1];
 	pt[proc_no].unix_sock = pt[proc_no].tcp_socks_holder[0];
+	for( n=0 ; n<tcp_main_shards ; n++ )
+		unix_tcp_socks[n] = tcp_proc_pair(proc_no,n)[1];
 
 	return 0;
 }
@@ -1937,24 +2323,58 @@ int tcp_activate_comm_proc_socks( int proc_no)
 
 void tcp_connect_proc_to_tcp_main( int proc_no, int worker )
 {
+	int n;
+
 	if (tcp_disabled)
 		return;
 
 	if (worker) {
 		close( pt[proc_no].unix_sock );
+		for( n=1 ; n<tcp_main_shards ; n++ )
+			close( tcp_proc_pair(proc_no,n)[0] );
 	} else {
 		unix_tcp_sock = -1;
+		for( n=0 ; n<tcp_main_shards ; n++ )
+			unix_tcp_socks[n] = -1;
 	}
 }
 
 
+int tcp_main_sock(unsigned int conn_id)
+{
+	if (unix_tcp_socks==NULL)
+		return unix_tcp_sock;
+
+	return unix_tcp_socks[TCPCONN_GET_SHARD(conn_id)];
+}
+
+
+/* builds the list (one per TCP main shard) of the sockets of a TCP worker
+ * with TCP main */
+static int* tcp_worker_socks(int w)
+{
+	int *socks;
+	int n;
+
+	socks = (int*)pkg_malloc(tcp_main_shards*sizeof(int));
+	if (socks==NULL) {
+		LM_ERR("no more pkg memory for the TCP worker sockets\n");
+		return NULL;
+	}
+	for( n=0 ; n<tcp_main_shards ; n++ )
+		socks[n] = tcp_worker_sock(w,n);
+
+	return socks;
+}
+
+
 int _get_own_tcp_worker_id(void)
 {
 	pid_t pid;
 	int i;
 
 	pid = getpid();
-	for( i=0 ; i<tcp_workers_max_no ; i++)
+	for( i=0 ; i<tcp_workers_all_no ; i++)
 		if(tcp_workers[i].pid==pid)
 			return i;
 
@@ -1974,36 +2394,34 @@ void tcp_reset_worker_slot(void)
 }
 
 
-static int fork_dynamic_tcp_process(void *foo)
+/* forks a new TCP worker, in the first free slot of the [first,last)
+ * range of the TCP workers table */
+static int __fork_dynamic_tcp_process(int first, int last,
+						const struct internal_fork_params *ifp, char *desc)
 {
 	int p_id;
 	int r;
-	const struct internal_fork_params ifp_sr_tcp = {
-		.proc_desc = "SIP receiver TCP",
-		.flags = OSS_PROC_DYNAMIC|OSS_PROC_NEEDS_SCRIPT,
-		.type = TYPE_TCP,
-	};
 
 	/* search for free slot in the TCP workers table */
-	for( r=0 ; r<tcp_workers_max_no ; r++ )
+	for( r=first ; r<last ; r++ )
 		if (tcp_workers[r].state==STATE_INACTIVE)
 			break;
 
-	if (r==tcp_workers_max_no) {
-		LM_BUG("trying to fork one more TCP worker but no free slots in "
-			"the TCP table (size=%d)\n",tcp_workers_max_no);
+	if (r==last) {
+		LM_BUG("trying to fork one more %s but no free slots in "
+			"the TCP table (size=%d)\n", desc, last-first);
 		return -1;
 	}
 
-	if((p_id=internal_fork(&ifp_sr_tcp))<0){
-		LM_ERR("cannot fork dynamic TCP worker process\n");
+	if((p_id=internal_fork(ifp))<0){
+		LM_ERR("cannot fork dynamic %s process\n", desc);
 		return(-1);
 	}else if (p_id==0){
 		/* new TCP process */
-		set_proc_attrs("TCP receiver");
+		set_proc_attrs("%s", desc);
 		tcp_workers[r].pid = getpid();
 
-		if (tcp_worker_proc_reactor_init(tcp_workers[r].main_unix_sock)<0||
+		if (tcp_worker_proc_reactor_init(tcp_worker_socks(r))<0||
 		init_child(20000) < 0) {
 			goto error;
 		}
@@ -2032,6 +2450,33 @@ error:
 }
 
 
+static int fork_dynamic_tcp_process(void *foo)
+{
+	const struct internal_fork_params ifp_sr_tcp = {
+		.proc_desc = "SIP receiver TCP",
+		.flags = OSS_PROC_DYNAMIC|OSS_PROC_NEEDS_SCRIPT,
+		.type = TYPE_TCP,
+	};
+
+	return __fork_dynamic_tcp_process( 0, tcp_workers_max_no,
+		&ifp_sr_tcp, "TCP receiver");
+}
+
+
+static int fork_dynamic_tcp_hs_process(void *foo)
+{
+	/* the script is still needed, by the proto init of the conns */
+	const struct internal_fork_params ifp_hs_tcp = {
+		.proc_desc = "TCP handshake",
+		.flags = OSS_PROC_DYNAMIC|OSS_PROC_NEEDS_SCRIPT|OSS_PROC_IS_EXTRA,
+		.type = TYPE_TCP_HANDSHAKE,
+	};
+
+	return __fork_dynamic_tcp_process( tcp_workers_max_no, tcp_workers_all_no,
+		&ifp_hs_tcp, "TCP handshake");
+}
+
+
 static void tcp_process_graceful_terminate(int sender, void *param)
 {
 	int i;
@@ -2065,13 +2510,14 @@ int tcp_count_processes(unsigned int *extra)
 		return 0;
 
 
-	if (s_profile && extra) {
+	if (extra) {
 		/* how many can be forked over the number of procs to start with ?*/
-		if (s_profile->max_procs > tcp_workers_no)
-			*extra = s_profile->max_procs - tcp_workers_no;
+		*extra = (tcp_workers_max_no - tcp_workers_no) +
+			(tcp_hs_workers_max_no - tcp_hs_workers_no);
 	}
 
-	return 1/* tcp main */ + tcp_workers_no /*workers to start with*/;
+	return tcp_main_shards/* tcp main */ + tcp_workers_no /*workers to start with*/
+		+ tcp_hs_workers_no /*handshake workers to start with*/;
 }
 
 
@@ -2079,12 +2525,18 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 {
 	int r, n, p_id;
 	int reader_fd[2]; /* for comm. with the tcp workers read  */
+	int *pair;
 	struct socket_info_full *sif;
 	const struct internal_fork_params ifp_sr_tcp = {
 		.proc_desc = "SIP receiver TCP",
 		.flags = OSS_PROC_NEEDS_SCRIPT,
 		.type = TYPE_TCP,
 	};
+	const struct internal_fork_params ifp_hs_tcp = {
+		.proc_desc = "TCP handshake",
+		.flags = OSS_PROC_NEEDS_SCRIPT|OSS_PROC_IS_EXTRA,
+		.type = TYPE_TCP_HANDSHAKE,
+	};
 
 	if (tcp_disabled)
 		return 0;
@@ -2098,7 +2550,7 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 			for(sif=protos[n].listeners; sif ; sif=sif->next,r++ );
 
 	/* create the socket pairs for ALL potential processes */
-	for(r=0; r<tcp_workers_max_no; r++){
+	for(r=0; r<tcp_workers_all_no; r++){
 		/* create sock to communicate from TCP main to worker */
 		if (socketpair(AF_UNIX, SOCK_STREAM, 0, reader_fd)<0){
 			LM_ERR("socketpair failed: %s\n", strerror(errno));
@@ -2107,6 +2559,23 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 		tcp_workers[r].unix_sock = reader_fd[0]; /* worker's end */
 		tcp_workers[r].main_unix_sock = reader_fd[1]; /* main's end */
 	}
+	/* and the ones with the extra TCP main shards */
+	if (tcp_main_shards>1) {
+		tcp_shard_worker_socks = pkg_malloc( tcp_workers_all_no*
+			(tcp_main_shards-1)*sizeof *tcp_shard_worker_socks);
+		if (tcp_shard_worker_socks==NULL) {
+			LM_ERR("no more pkg memory for the TCP main shards sockets\n");
+			goto error;
+		}
+		for( r=0 ; r<tcp_workers_all_no ; r++ )
+			for( n=1 ; n<tcp_main_shards ; n++ ) {
+				pair = TCP_SHARD_PAIR(tcp_shard_worker_socks, r, n);
+				if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair)<0){
+					LM_ERR("socketpair failed: %s\n", strerror(errno));
+					goto error;
+				}
+			}
+	}
 
 	if ( auto_scaling_enabled && s_profile &&
 	create_process_group( TYPE_TCP, NULL, s_profile,
@@ -2114,6 +2583,12 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 		LM_ERR("failed to create group of TCP processes for, "
 			"auto forking will not be possible\n");
 
+	if ( auto_scaling_enabled && hs_s_profile &&
+	create_process_group( TYPE_TCP_HANDSHAKE, NULL, hs_s_profile,
+	fork_dynamic_tcp_hs_process, tcp_process_graceful_terminate)!=0)
+		LM_ERR("failed to create group of TCP handshake processes, "
+			"auto forking will not be possible\n");
+
 	/* start the TCP workers */
 	for(r=0; r<tcp_workers_no; r++){
 		(*chd_rank)++;
@@ -2130,7 +2605,7 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 			/* child */
 			set_proc_attrs("TCP receiver");
 			tcp_workers[r].pid = getpid();
-			if (tcp_worker_proc_reactor_init(tcp_workers[r].main_unix_sock)<0||
+			if (tcp_worker_proc_reactor_init(tcp_worker_socks(r))<0||
 					init_child(*chd_rank) < 0) {
 				LM_ERR("init_children failed\n");
 				report_failure_status();
@@ -2157,6 +2632,37 @@ int tcp_start_processes(int *chd_rank, int *startup_done)
 		}
 	}
 
+	/* start the TCP handshake workers, after the regular ones */
+	for(r=tcp_workers_max_no; r<tcp_workers_max_no+tcp_hs_workers_no; r++){
+		(*chd_rank)++;
+		p_id=internal_fork(&ifp_hs_tcp);
+		if (p_id<0){
+			LM_ERR("fork failed\n");
+			goto error;
+		}else if (p_id>0){
+			/* parent */
+			tcp_workers[r].state=STATE_ACTIVE;
+			tcp_workers[r].n_reqs=0;
+			tcp_workers[r].pt_idx=p_id;
+		}else{
+			/* child */
+			set_proc_attrs("TCP handshake");
+			tcp_workers[r].pid = getpid();
+			if (tcp_worker_proc_reactor_init(tcp_worker_socks(r))<0||
+					init_child(*chd_rank) < 0) {
+				LM_ERR("init_children failed\n");
+				report_failure_status();
+				if (startup_done)
+					*startup_done = -1;
+				exit(-1);
+			}
+
+			report_conditional_status( (!no_daemon_mode), 0);
+
+			tcp_worker_proc_loop();
+		}
+	}
+
 	/* wait for the startup route to be executed */
 	if (startup_done)
 		while (!(*startup_done)) {
@@ -2172,7 +2678,7 @@ error:
 
 int tcp_start_listener(void)
 {
-	int p_id;
+	int p_id, n;
 	const struct internal_fork_params ifp_tcp_main = {
 		.proc_desc = "TCP main",
 		.flags = 0,
@@ -2182,26 +2688,36 @@ int tcp_start_listener(void)
 	if (tcp_disabled)
 		return 0;
 
-	/* start the TCP manager process */
-	if ( (p_id=internal_fork(&ifp_tcp_main))<0 ) {
-		LM_CRIT("cannot fork tcp main process\n");
-		goto error;
-	}else if (p_id==0){
-			/* child */
-		/* close the TCP inter-process sockets */
-		close(unix_tcp_sock);
-		unix_tcp_sock = -1;
-		close(pt[process_no].unix_sock);
-		pt[process_no].unix_sock = -1;
+	/* start the TCP manager processes, one per shard */
+	for( tcp_main_shard=0 ; tcp_main_shard<tcp_main_shards ;
+	tcp_main_shard++ ) {
+		if ( (p_id=internal_fork(&ifp_tcp_main))<0 ) {
+			LM_CRIT("cannot fork tcp main process %d\n", tcp_main_shard);
+			goto error;
+		}else if (p_id==0){
+				/* child */
+			/* close the TCP inter-process sockets */
+			close(unix_tcp_sock);
+			unix_tcp_sock = -1;
+			close(pt[process_no].unix_sock);
+			pt[process_no].unix_sock = -1;
+			unix_tcp_socks[0] = -1;
+			for( n=1 ; n<tcp_main_shards ; n++ ) {
+				close(unix_tcp_socks[n]);
+				unix_tcp_socks[n] = -1;
+			}
 
-		report_conditional_status( (!no_daemon_mode), 0);
+			report_conditional_status( (!no_daemon_mode), 0);
 
-		tcp_main_server();
-		exit(-1);
+			tcp_main_server();
+			exit(-1);
+		}
 	}
+	tcp_main_shard = 0;
 
 	return 0;
 error:
+	tcp_main_shard = 0;
 	return -1;
 }
 
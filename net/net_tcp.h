@@ -57,13 +57,17 @@ int tcp_activate_comm_proc_socks( int proc_no );
 /* same as above, but to be called after forking, both in child and parent */
 void tcp_connect_proc_to_tcp_main( int proc_no, int chid );
 
+/* the socket to be used by the current process for talking to the TCP MAIN
+   process (shard) owning the connection with the given id */
+int tcp_main_sock(unsigned int conn_id);
+
 /* tells how many processes the TCP layer will create */
 int tcp_count_processes(unsigned int *extra);
 
 /* starts all TCP worker processes */
 int tcp_start_processes(int *chd_rank, int *startup_done);
 
-/* starts the TCP listening process */
+/* starts the TCP listening processes (the TCP main shards) */
 int tcp_start_listener(void);
 
 void tcp_reset_worker_slot(void);
@@ -111,6 +115,12 @@ int tcp_get_correlation_id( unsigned int id, unsigned long long *cid);
 
 int tcp_done_reading(struct tcp_connection* c);
 
+/* checks if a conn should stay in the current TCP worker after a read */
+int tcp_conn_sticky(struct tcp_connection* c);
+
+/* the number of sticky conns passed back by a worker as being overloaded */
+extern stat_var *tcp_sticky_rebalances;
+
 extern unsigned int last_outgoing_tcp_id;
 
 #endif /* _NET_TCP_H_ */
@@ -33,20 +33,21 @@
 
 #include "tcp_conn.h"
 #include "tcp_passfd.h"
+#include "net_tcp.h"
 #include "net_tcp_report.h"
 #include "trans.h"
 #include "net_tcp_dbg.h"
 
-/*!< the FD currently used by the process to communicate with TCP MAIN*/
-static int _my_fd_to_tcp_main = -1;
+/*!< the FDs currently used by the process to communicate with TCP MAIN
+ * (one per TCP main shard) */
+static int *_my_fds_to_tcp_main = NULL;
 
 /*!< list of tcp connections handled by this process */
 static struct tcp_connection* tcp_conn_lst=0;
 
 static int _tcp_done_reading_marker = 0;
 
-static int tcpmain_sock=-1;
-extern int unix_tcp_sock;
+static int *tcpmain_socks=NULL;
 
 extern struct struct_hist_list *con_hist;
 
@@ -76,8 +77,8 @@ static void tcpconn_release(struct tcp_connection* c, long state, int writer,
 	response[0]=(long)c;
 	response[1]=state;
 
-	if (send_all( as_tcp_worker?tcpmain_sock:unix_tcp_sock, response,
-	sizeof(response))<=0)
+	if (send_all( as_tcp_worker ? tcpmain_socks[TCPCONN_GET_SHARD(c->id)] :
+	tcp_main_sock(c->id), response, sizeof(response))<=0)
 		LM_ERR("send_all failed state=%ld con=%p\n", state, c);
 }
 
@@ -110,6 +111,11 @@ int tcp_done_reading(struct tcp_connection* con)
 		tcpconn_check_del(con);
 		tcpconn_listrm(tcp_conn_lst, con, c_next, c_prev);
 		if (con->fd!=-1) { close(con->fd); con->fd = -1; }
+		/* a conn kept by this worker so far, now handed back */
+		if (con->flags & F_CONN_STICKY) {
+			con->flags &= ~F_CONN_STICKY;
+			update_stat( tcp_sticky_rebalances, 1);
+		}
 		sh_log(con->hist, TCP_SEND2MAIN,
 			"parallel read OK - releasing, ref: %d", con->refcnt);
 		tcpconn_release(con, CONN_RELEASE, 0, 1 /*as TCP proc*/);
@@ -160,6 +166,7 @@ static void tcp_receive_timeout(void)
 
 			/* connection is going to main */
 			con->proc_id = -1;
+			con->flags &= ~F_CONN_STICKY;
 			if (con->fd!=-1) { close(con->fd); con->fd = -1; }
 
 			sh_log(con->hist, TCP_SEND2MAIN, "timeout: %d, att: %d",
@@ -332,7 +339,20 @@ again:
 			if (event_type & IO_WATCH_READ) {
 				con=(struct tcp_connection*)fm->data;
 				_tcp_done_reading_marker = 0;
-				resp = protos[con->type].net.stream.read( con, &ret );
+				if (con->flags & F_CONN_HANDSHAKE) {
+					/* only the handshake here, the conn goes back to TCP
+					 * main (and to a regular worker) once completed */
+					resp = protos[con->type].net.stream.conn.handshake(con);
+					if (resp>=0) {
+						if (resp==1) {
+							con->flags &= ~F_CONN_HANDSHAKE;
+							tcp_done_reading( con );
+						}
+						break;
+					}
+				} else {
+					resp = protos[con->type].net.stream.read( con, &ret );
+				}
 				if (resp<0) {
 					ret=-1; /* some error occurred */
 					con->state=S_CONN_BAD;
@@ -361,7 +381,7 @@ again:
 						resp, con->msg_attempts);
 					tcpconn_release(con, CONN_EOF, 0, 1 /*as TCP proc*/);
 				} else {
-					if (con->profile.parallel_read)
+					if (con->profile.parallel_read && !tcp_conn_sticky(con))
 						/* return the connection if not already */
 						tcp_done_reading( con );
 					break;
@@ -406,16 +426,23 @@ error:
 
 
 
-int tcp_worker_proc_reactor_init( int unix_sock)
+int tcp_worker_proc_reactor_init( int *unix_socks)
 {
+	int i;
+
+	if (unix_socks==NULL)
+		return -1;
+
 	/* init reactor for TCP worker */
-	tcpmain_sock=unix_sock; /* init com. socket */
+	tcpmain_socks=unix_socks; /* init com. sockets */
 	if ( init_worker_reactor( "TCP_worker", RCT_PRIO_MAX)<0 ) {
 		goto error;
 	}
 
-	/* start watching for the timer jobs */
-	if (reactor_add_reader( timer_fd_out, F_TIMER_JOB, RCT_PRIO_TIMER,NULL)<0){
+	/* start watching for the timer jobs; the handshake workers are kept
+	 * away from any other work, so neither these, nor the dispatched jobs */
+	if (pt[process_no].type!=TYPE_TCP_HANDSHAKE &&
+	reactor_add_reader( timer_fd_out, F_TIMER_JOB, RCT_PRIO_TIMER,NULL)<0){
 		LM_CRIT("failed to add timer pipe_out to reactor\n");
 		goto error;
 	}
@@ -427,17 +454,20 @@ int tcp_worker_proc_reactor_init( int unix_sock)
 	}
 
 	/* init: start watching for IPC "dispatched" jobs */
-	if (reactor_add_reader(IPC_FD_READ_SHARED, F_IPC, RCT_PRIO_ASYNC, NULL)<0){
+	if (pt[process_no].type!=TYPE_TCP_HANDSHAKE &&
+	reactor_add_reader(IPC_FD_READ_SHARED, F_IPC, RCT_PRIO_ASYNC, NULL)<0){
 		LM_CRIT("failed to add IPC shared pipe to reactor\n");
 		return -1;
 	}
 
-	/* add the unix socket */
-	if (reactor_add_reader( tcpmain_sock, F_TCPMAIN, RCT_PRIO_PROC, NULL)<0) {
-		LM_CRIT("failed to add socket to the fd list\n");
-		goto error;
-	}
-	_my_fd_to_tcp_main = tcpmain_sock;
+	/* add the unix sockets, one per TCP main shard */
+	for (i=0; i<tcp_main_shards; i++)
+		if (reactor_add_reader( tcpmain_socks[i], F_TCPMAIN, RCT_PRIO_PROC,
+		NULL)<0) {
+			LM_CRIT("failed to add socket to the fd list\n");
+			goto error;
+		}
+	_my_fds_to_tcp_main = tcpmain_socks;
 
 	return 0;
 error:
@@ -458,19 +488,24 @@ error:
 
 void tcp_terminate_worker(void)
 {
+	int i;
+
 	/*remove from reactor all the shared fds, so we stop reading from them */
 
-	/*remove timer jobs pipe */
-	reactor_del_reader( timer_fd_out, -1, 0);
+	if (pt[process_no].type!=TYPE_TCP_HANDSHAKE) {
+		/*remove timer jobs pipe */
+		reactor_del_reader( timer_fd_out, -1, 0);
 
-	/*remove IPC dispatcher pipe */
-	reactor_del_reader( IPC_FD_READ_SHARED, -1, 0);
+		/*remove IPC dispatcher pipe */
+		reactor_del_reader( IPC_FD_READ_SHARED, -1, 0);
+	}
 
 	/*remove private IPC pipe */
 	reactor_del_reader( IPC_FD_READ_SELF, -1, 0);
 
-	/*remove unix sock to TCP main */
-	reactor_del_reader( _my_fd_to_tcp_main, -1, 0);
+	/*remove unix socks to TCP main */
+	for (i=0; i<tcp_main_shards; i++)
+		reactor_del_reader( _my_fds_to_tcp_main[i], -1, 0);
 
 	_termination_in_progress = 1;
 
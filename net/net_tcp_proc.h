@@ -28,7 +28,7 @@
 
 /* Loop implementing a TCP worker */
 void tcp_worker_proc_loop(void);
-int tcp_worker_proc_reactor_init( int fd);
+int tcp_worker_proc_reactor_init( int *unix_socks);
 
 /* function to terminate TCP workers at runtime; it must be call within
  * the context of the process to be terminated */
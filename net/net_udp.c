@@ -41,6 +41,8 @@
 /* if the UDP network layer is used or not by some protos */
 static int udp_disabled = 1;
 
+int udp_exclusive_wakeup = 0;
+
 extern void handle_sigs(void);
 
 /* initializes the UDP network layer */
@@ -53,6 +55,12 @@ int udp_init(void)
 	for ( i=PROTO_FIRST ; i<PROTO_LAST ; i++ )
 		if (is_udp_based_proto(i)) {udp_disabled=0;break;}
 
+	if (udp_init_send_batch(udp_disabled)<0)
+		return -1;
+
+	if (udp_init_worker_sockets(udp_disabled)<0)
+		return -1;
+
 	return 0;
 }
 
@@ -181,7 +189,8 @@ int udp_init_listener(struct socket_info *si, int status_flags)
 		goto error;
 	}
 
-	if (si->flags & SI_REUSEPORT) {
+	/* the per-worker sockets join the reuseport group of the listener */
+	if ((si->flags & SI_REUSEPORT) || udp_has_worker_sockets(si)) {
 		optval=1;
 		if (setsockopt(si->socket, SOL_SOCKET, SO_REUSEPORT ,
 						(void*)&optval, sizeof(optval)) ==-1){
@@ -310,8 +319,12 @@ inline static int handle_io(struct fd_map* fm, int idx,int event_type)
 
 	switch(fm->type){
 		case F_UDP_READ:
+			read = -1;
 			n = protos[((struct socket_info*)fm->data)->proto].net.
 				dgram.read( fm->data /*si*/, &read);
+			/* only the protos reporting the read bytes can be accounted */
+			if (read>=0)
+				pt_account_wakeup(read==0);
 			break;
 		case F_TIMER_JOB:
 			handle_timer_job();
@@ -349,9 +362,12 @@ inline static int handle_io(struct fd_map* fm, int idx,int event_type)
 }
 
 
-int udp_proc_reactor_init( struct socket_info *si )
+int udp_proc_reactor_init( struct socket_info *si, int own_socket )
 {
 
+	if (udp_worker_socket_open(si, own_socket)<0)
+		return -1;
+
 	/* create the reactor for UDP proc */
 	if ( init_worker_reactor( "UDP_worker", RCT_PRIO_MAX)<0 ) {
 		LM_ERR("failed to init reactor\n");
@@ -376,8 +392,11 @@ int udp_proc_reactor_init( struct socket_info *si )
 		return -1;
 	}
 
-	/* init: start watching the SIP UDP fd */
-	if (reactor_add_reader( si->socket, F_UDP_READ, RCT_PRIO_NET, si)<0) {
+	/* init: start watching the SIP UDP fd; as the socket is shared by all
+	 * the UDP workers, optionally wake up only one of them per packet */
+	if ((udp_exclusive_wakeup && !udp_has_worker_sockets(si) ?
+	reactor_add_exclusive_reader( si->socket, F_UDP_READ, RCT_PRIO_NET, si) :
+	reactor_add_reader( si->socket, F_UDP_READ, RCT_PRIO_NET, si))<0) {
 		LM_CRIT("failed to add UDP listen socket to reactor\n");
 		goto error;
 	}
@@ -411,7 +430,7 @@ static int fork_dynamic_udp_process(void *si_filter)
 		bind_address=si; /* shortcut */
 		/* we first need to init the reactor to be able to add fd
 		 * into it in child_init routines */
-		if (udp_proc_reactor_init(si) < 0 ||
+		if (udp_proc_reactor_init(si, 1) < 0 ||
 		init_child(10000/*FIXME*/) < 0) {
 			goto error;
 		}
@@ -433,6 +452,26 @@ error:
 }
 
 
+/* takes over the reading of the listener socket from a terminating worker */
+static void udp_process_take_listener(int sender, void *param)
+{
+	struct socket_info *si = (struct socket_info *)param;
+
+	/* we are on the way out too, pass it further */
+	if (pt[process_no].flags&OSS_PROC_TO_TERMINATE) {
+		udp_worker_socket_handover(si, udp_process_take_listener);
+		return;
+	}
+
+	reactor_del_reader( si->socket, -1, 0);
+
+	if (udp_worker_socket_takeover(si)<0 ||
+	reactor_add_reader( si->socket, F_UDP_READ, RCT_PRIO_NET, si)<0)
+		LM_CRIT("failed to take over the listener socket of %.*s\n",
+			si->sock_str.len, si->sock_str.s);
+}
+
+
 static void udp_process_graceful_terminate(int sender, void *param)
 {
 	/* we accept this only from the main proccess */
@@ -453,6 +492,13 @@ static void udp_process_graceful_terminate(int sender, void *param)
 	/*remove network interface */
 	reactor_del_reader( bind_address->socket, -1, 0);
 
+	/* leave the reuseport group, consuming what is still queued on our
+	 * own socket, if any; if we were reading the listener socket, let
+	 * another worker read it, as it stays in the reuseport group */
+	if (udp_worker_socket_close((struct socket_info *)bind_address)==1)
+		udp_worker_socket_handover((struct socket_info *)bind_address,
+			udp_process_take_listener);
+
 	/*remove private IPC pipe */
 	reactor_del_reader( IPC_FD_READ_SELF, -1, 0);
 
@@ -499,6 +545,9 @@ int udp_start_processes(int *chd_rank, int *startup_done)
 					"auto forking will not be possible\n",
 					si->name.len, si->name.s);
 
+			if (udp_worker_sockets_prepare(si)<0)
+				goto error;
+
 			for (i=0;i<si->workers;i++) {
 				(*chd_rank)++;
 				if ( (p_id=internal_fork(&ifp_udp_rcv))<0 ) {
@@ -512,8 +561,9 @@ int udp_start_processes(int *chd_rank, int *startup_done)
 					pt[process_no].pg_filter = si;
 					bind_address=si; /* shortcut */
 					/* we first need to init the reactor to be able to add fd
-					 * into it in child_init routines */
-					if (udp_proc_reactor_init(si) < 0 ||
+					 * into it in child_init routines; with per-worker sockets,
+					 * the first worker keeps reading the listener socket */
+					if (udp_proc_reactor_init(si, i!=0) < 0 ||
 							init_child(*chd_rank) < 0) {
 						report_failure_status();
 						if (*chd_rank == 1 && startup_done)
@@ -564,4 +614,3 @@ int udp_start_processes(int *chd_rank, int *startup_done)
 error:
 	return -1;
 }
-
@@ -27,6 +27,7 @@
 #define _NET_UDP_H_
 
 #include "../socket_info.h"
+#include "../ipc.h"
 
 
 /**************************** Control functions ******************************/
@@ -43,6 +44,9 @@ int udp_count_processes(unsigned int *extra);
 /* starts all UDP related processes */
 int udp_start_processes(int *chd_rank, int *startup_done);
 
+/* if the UDP workers sharing a listener should be woken up one at a time */
+extern int udp_exclusive_wakeup;
+
 /**************************** Listener functions *****************************/
 
 struct socket_info* udp_find_listener(union sockaddr_union* to, int proto);
@@ -53,4 +57,67 @@ int udp_init_listener(struct socket_info *si, int status_flags);
 /* binds and initialized UDP listener */
 int udp_bind_listener(struct socket_info *si);
 
+/****************************** Send batching ********************************/
+
+/* max number of datagrams to be coalesced into a single sendmmsg() call;
+ * 0/1 means the send batching is disabled */
+extern int udp_send_batch;
+
+#define UDP_MAX_SEND_BATCH  64
+
+/* validates the send batching settings and registers its statistics */
+int udp_init_send_batch(int udp_disabled);
+
+/* opens a send batching scope in the current process - all the UDP sends
+ * done until the matching udp_send_batch_end() are queued and flushed
+ * together; scopes may be nested, only the outermost one flushes */
+void udp_send_batch_start(void);
+
+/* closes a send batching scope, flushing the queued datagrams if this was
+ * the outermost scope */
+void udp_send_batch_end(void);
+
+/* queues a datagram into the current batch, if any is opened in this
+ * process; returns @len if the datagram was queued, 0 if there is no
+ * opened batch (so the datagram must be sent right away) */
+int udp_send_batch_queue(int fd, char *buf, unsigned int len,
+		const union sockaddr_union *to);
+
+/**************************** Per-worker sockets *****************************/
+
+/* if each UDP worker of a plain UDP listener reads from its own
+ * SO_REUSEPORT socket, instead of all sharing the listener socket */
+extern int udp_worker_sockets;
+
+/* if the datagrams are steered to the worker sockets by their Call-ID */
+extern int udp_callid_steering;
+
+#define udp_has_worker_sockets(_si) \
+	(udp_worker_sockets && (_si)->proto==PROTO_UDP)
+
+/* validates the per-worker sockets settings */
+int udp_init_worker_sockets(int udp_disabled);
+
+/* prepares the listener (in main, before forking its workers) for having
+ * per-worker sockets, like attaching the Call-ID steering to it */
+int udp_worker_sockets_prepare(struct socket_info *si);
+
+/* sets up the socket of the listener in the current worker - if
+ * @own_socket, a new socket is bound to replace the listener one */
+int udp_worker_socket_open(struct socket_info *si, int own_socket);
+
+/* removes the current worker from the listener, draining and closing its
+ * own socket, if any; returns 1 if the worker was reading the listener
+ * socket itself, so it must be handed over to another worker */
+int udp_worker_socket_close(struct socket_info *si);
+
+/* asks (via @take_rpc) another worker of the listener to read the
+ * listener socket, see udp_worker_socket_takeover() */
+int udp_worker_socket_handover(struct socket_info *si, ipc_rpc_f *take_rpc);
+
+/* makes the current worker read the listener socket, instead of its own
+ * socket (drained and closed); to be run by the @take_rpc of a handover,
+ * after removing the own socket from the reactor */
+int udp_worker_socket_takeover(struct socket_info *si);
+
 #endif /* _NET_UDP_H_ */
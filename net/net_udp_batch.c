@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+/*
+ * UDP send batching - the datagrams sent by a process while inside a
+ * batching scope (like all the branches of a parallel forking or all the
+ * retransmissions fired by a timer tick) are queued and pushed to the
+ * kernel with as few sendmmsg() calls as possible.
+ */
+
+#ifdef HAVE_SENDMMSG
+/* make sendmmsg() available */
+#define _GNU_SOURCE
+#include <sys/socket.h>
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "../dprint.h"
+#include "../mem/mem.h"
+#include "../statistics.h"
+#include "net_udp.h"
+
+
+int udp_send_batch = 0;
+
+#ifdef HAVE_SENDMMSG
+
+/* total size of the per-process buffer holding the queued datagrams */
+#define UDP_SEND_BATCH_BUF  (BUF_SIZE+1)
+
+struct udp_send_queue {
+	int fd;      /* socket the queued datagrams are to be sent on */
+	int no;      /* number of queued datagrams */
+	int used;    /* bytes used in the data buffer */
+	struct mmsghdr hdrs[UDP_MAX_SEND_BATCH];
+	struct iovec iovs[UDP_MAX_SEND_BATCH];
+	union sockaddr_union to[UDP_MAX_SEND_BATCH];
+	char buf[UDP_SEND_BATCH_BUF];
+};
+
+/* per process queue, allocated at the first batch */
+static struct udp_send_queue *send_q = NULL;
+/* nesting level of the batching scopes */
+static int send_batch_level = 0;
+
+static stat_var *udp_send_batches;
+static stat_var *udp_batched_sends;
+
+static unsigned long udp_send_batch_avg(void *_)
+{
+	unsigned long batches = get_stat_val(udp_send_batches);
+
+	return batches ? get_stat_val(udp_batched_sends) / batches : 0;
+}
+#endif
+
+
+int udp_init_send_batch(int udp_disabled)
+{
+	if (udp_disabled) {
+		udp_send_batch = 0;
+		return 0;
+	}
+
+	if (udp_send_batch<0 || udp_send_batch>UDP_MAX_SEND_BATCH) {
+		LM_WARN("invalid UDP send batch %d (allowed 0..%d), disabling\n",
+			udp_send_batch, UDP_MAX_SEND_BATCH);
+		udp_send_batch = 0;
+	}
+
+	if (udp_send_batch<=1)
+		return 0;
+
+#ifdef HAVE_SENDMMSG
+	if (register_stat("net", "udp_send_batches", &udp_send_batches, 0)!=0 ||
+	register_stat("net", "udp_batched_sends", &udp_batched_sends, 0)!=0 ||
+	register_stat("net", "udp_send_batch_avg",
+	(stat_var **)udp_send_batch_avg, STAT_IS_FUNC)!=0) {
+		LM_ERR("failed to register the UDP send batching stats\n");
+		return -1;
+	}
+#else
+	LM_WARN("UDP send batching not supported by this build, ignoring it\n");
+	udp_send_batch = 0;
+#endif
+
+	return 0;
+}
+
+
+#ifdef HAVE_SENDMMSG
+static void udp_send_batch_flush(void)
+{
+	struct udp_send_queue *q = send_q;
+	int i, n;
+
+	if (q->no==0)
+		return;
+
+	update_stat(udp_send_batches, 1);
+	update_stat(udp_batched_sends, q->no);
+
+	for (i = 0; i < q->no; ) {
+		n = sendmmsg(q->fd, q->hdrs + i, q->no - i, 0);
+		if (n==-1) {
+			if (errno==EINTR || errno==EAGAIN)
+				continue;
+			LM_ERR("sendmmsg(%d,%d msgs): %s(%d) [%s:%hu]\n", q->fd,
+				q->no - i, strerror(errno), errno,
+				inet_ntoa(q->to[i].sin.sin_addr),
+				ntohs(q->to[i].sin.sin_port));
+			/* drop the failing datagram and carry on with the rest */
+			i++;
+			continue;
+		}
+		i += n;
+	}
+
+	q->no = 0;
+	q->used = 0;
+}
+
+
+void udp_send_batch_start(void)
+{
+	if (udp_send_batch<=1)
+		return;
+
+	if (send_q==NULL) {
+		send_q = pkg_malloc(sizeof *send_q);
+		if (send_q==NULL) {
+			LM_ERR("no more pkg mem for the UDP send queue, "
+				"sending without batching\n");
+			return;
+		}
+		memset(send_q, 0, sizeof *send_q);
+	}
+
+	send_batch_level++;
+}
+
+
+void udp_send_batch_end(void)
+{
+	if (send_batch_level==0)
+		return;
+
+	if (--send_batch_level==0)
+		udp_send_batch_flush();
+}
+
+
+int udp_send_batch_queue(int fd, char *buf, unsigned int len,
+		const union sockaddr_union *to)
+{
+	struct udp_send_queue *q = send_q;
+	int idx;
+
+	if (send_batch_level==0)
+		return 0;
+
+	/* a batch goes out via a single socket and the datagrams must keep
+	 * their order, so flush whatever cannot be sent together */
+	if (q->no && (q->fd!=fd || q->no==udp_send_batch ||
+	q->used + len > UDP_SEND_BATCH_BUF))
+		udp_send_batch_flush();
+
+	/* too large to be batched, send it right away */
+	if (len > UDP_SEND_BATCH_BUF)
+		return 0;
+
+	idx = q->no++;
+	q->fd = fd;
+
+	memcpy(q->buf + q->used, buf, len);
+	q->iovs[idx].iov_base = q->buf + q->used;
+	q->iovs[idx].iov_len = len;
+	q->used += len;
+
+	q->to[idx] = *to;
+	q->hdrs[idx].msg_hdr.msg_name = &q->to[idx].s;
+	q->hdrs[idx].msg_hdr.msg_namelen = sockaddru_len(*to);
+	q->hdrs[idx].msg_hdr.msg_iov = &q->iovs[idx];
+	q->hdrs[idx].msg_hdr.msg_iovlen = 1;
+
+	return len;
+}
+
+#else
+
+void udp_send_batch_start(void)
+{
+}
+
+void udp_send_batch_end(void)
+{
+}
+
+int udp_send_batch_queue(int fd, char *buf, unsigned int len,
+		const union sockaddr_union *to)
+{
+	return 0;
+}
+
+#endif
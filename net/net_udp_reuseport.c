@@ -0,0 +1,753 @@
+/*
+ * Copyright (C) 2026 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+/*
+ * Per-worker UDP sockets - instead of all the UDP workers of a listener
+ * sharing the same fd, each worker binds its own SO_REUSEPORT socket on
+ * the listener address and the kernel distributes the incoming datagrams
+ * between them. The socket created by the main process (used for sending
+ * by all the other processes) is kept by the first worker of the listener;
+ * if that worker is terminated by the auto scaling, it hands the listener
+ * socket over to another worker of the listener, which drops its own.
+ *
+ * Optionally, an eBPF program is attached to the reuseport group in order
+ * to steer the datagrams by the hash of their Call-ID, so all the requests
+ * and replies of a call are handled by the same worker. The program picks
+ * one of the "active" slots of the listener, each slot pointing to the
+ * socket of a worker. As workers are forked or terminated by the auto
+ * scaling, the slots are kept compact, by moving the last slot over the
+ * one being freed.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef HAVE_REUSEPORT_BPF
+#include <stddef.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/btf.h>
+#endif
+
+#include "../dprint.h"
+#include "../pt.h"
+#include "../ipc.h"
+#include "../locking.h"
+#include "../mem/mem.h"
+#include "../mem/shm_mem.h"
+#include "../socket_info.h"
+#include "net_udp.h"
+
+
+int udp_worker_sockets = 0;
+int udp_callid_steering = 0;
+
+/* the listener fd created by main, as this process replaced it with its
+ * own socket (-1 if the listener fd is not replaced) */
+static int udp_shared_fd = -1;
+
+#ifdef HAVE_REUSEPORT_BPF
+
+/* the Call-ID steering of a listener; the BPF objects are created by main,
+ * before forking the workers, so their fds are inherited by all of them */
+struct udp_steering {
+	const struct socket_info *si;
+	int socks_fd;        /* BPF sockarray, the worker sockets by process_no */
+	int slots_fd;        /* BPF array, [0] - active slots, [1..] - process_no */
+	int prog_fd;
+	gen_lock_t *lock;    /* serializes the changes of the slots */
+	unsigned int *active;/* shm mirror of the active slots, with owners */
+	int *owners;
+	unsigned int max_slots;
+	struct udp_steering *next;
+};
+
+static struct udp_steering *steerings = NULL;
+
+
+static long udp_bpf(int cmd, union bpf_attr *attr)
+{
+	return syscall(__NR_bpf, cmd, attr, sizeof *attr);
+}
+
+static int udp_bpf_map_create(int type, unsigned int entries)
+{
+	union bpf_attr attr;
+
+	memset(&attr, 0, sizeof attr);
+	attr.map_type = type;
+	attr.key_size = sizeof(__u32);
+	attr.value_size = sizeof(__u32);
+	attr.max_entries = entries;
+
+	return udp_bpf(BPF_MAP_CREATE, &attr);
+}
+
+static int udp_bpf_map_set(int map_fd, __u32 key, __u32 val)
+{
+	union bpf_attr attr;
+
+	memset(&attr, 0, sizeof attr);
+	attr.map_fd = map_fd;
+	attr.key = (unsigned long)&key;
+	attr.value = (unsigned long)&val;
+	attr.flags = BPF_ANY;
+
+	return udp_bpf(BPF_MAP_UPDATE_ELEM, &attr);
+}
+
+static int udp_bpf_map_del(int map_fd, __u32 key)
+{
+	union bpf_attr attr;
+
+	memset(&attr, 0, sizeof attr);
+	attr.map_fd = map_fd;
+	attr.key = (unsigned long)&key;
+
+	return udp_bpf(BPF_MAP_DELETE_ELEM, &attr);
+}
+
+
+/* instruction encoding helpers */
+#define BPF_RAW(_code, _dst, _src, _off, _imm) \
+	((struct bpf_insn){ .code=(_code), .dst_reg=(_dst), .src_reg=(_src), \
+		.off=(_off), .imm=(_imm) })
+#define I_MOV64_R(_d, _s)        BPF_RAW(BPF_ALU64|BPF_MOV|BPF_X, _d, _s, 0, 0)
+#define I_MOV64_K(_d, _k)        BPF_RAW(BPF_ALU64|BPF_MOV|BPF_K, _d, 0, 0, _k)
+#define I_ALU64_K(_op, _d, _k)   BPF_RAW(BPF_ALU64|(_op)|BPF_K, _d, 0, 0, _k)
+#define I_ALU64_R(_op, _d, _s)   BPF_RAW(BPF_ALU64|(_op)|BPF_X, _d, _s, 0, 0)
+#define I_LDX(_sz, _d, _s, _off) BPF_RAW(BPF_LDX|(_sz)|BPF_MEM, _d, _s, _off, 0)
+#define I_STX(_sz, _d, _s, _off) BPF_RAW(BPF_STX|(_sz)|BPF_MEM, _d, _s, _off, 0)
+#define I_ST(_sz, _d, _off, _k)  BPF_RAW(BPF_ST|(_sz)|BPF_MEM, _d, 0, _off, _k)
+#define I_JMP_K(_op, _d, _k, _l) BPF_RAW(BPF_JMP|(_op)|BPF_K, _d, 0, _l, _k)
+#define I_JMP_R(_op, _d, _s, _l) BPF_RAW(BPF_JMP|(_op)|BPF_X, _d, _s, _l, 0)
+#define I_JA(_l)                 BPF_RAW(BPF_JMP|BPF_JA, 0, 0, _l, 0)
+#define I_CALL(_f)               BPF_RAW(BPF_JMP|BPF_CALL, 0, 0, 0, _f)
+#define I_EXIT()                 BPF_RAW(BPF_JMP|BPF_EXIT, 0, 0, 0, 0)
+/* 16 bytes instructions, emitted as two */
+#define I_LD_MAP(_d, _fd) \
+	BPF_RAW(BPF_LD|BPF_DW|BPF_IMM, _d, BPF_PSEUDO_MAP_FD, 0, _fd)
+#define I_LD_FUNC(_d, _l) \
+	BPF_RAW(BPF_LD|BPF_DW|BPF_IMM, _d, BPF_PSEUDO_FUNC, 0, _l)
+#define I_LD_HI()                BPF_RAW(0, 0, 0, 0, 0)
+
+/* max number of payload bytes searched for the Call-ID header and max
+ * number of bytes hashed out of its value */
+#define STEER_SCAN_MAX   2048
+#define STEER_HASH_MAX   128
+#define STEER_MAX_INSNS  128
+
+enum steer_labels { L_PASS, L_SEARCH, L_S_CONT, L_S_BRK, L_S_COMPACT,
+	L_HASH, L_H_CONT, L_H_BRK, L_MAX };
+
+/* the scan context, on the stack of the main function */
+#define SC_HASH      0
+#define SC_POS       8
+#define SC_DATA_END 16
+#define SC_DATA     24
+#define SC_SIZE     32
+
+/* builds the SK_REUSEPORT program; the Call-ID is searched and hashed by
+ * two bpf_loop() callbacks, so the verifier checks their bodies only once,
+ * no matter the length of the scanned data.
+ * Returns the number of instructions, while @fi gets the start of the three
+ * functions (main + 2 callbacks) */
+static int steer_build_prog(struct bpf_insn *p, int slots_fd, int socks_fd,
+		struct bpf_func_info *fi)
+{
+	static const char hdr[] = "all-id:";
+	int lbl[L_MAX], n = 0, i;
+
+#define EMIT(_i)   (p[n++] = _i)
+#define LABEL(_l)  (lbl[_l] = n)
+
+	/* main function, r6 = ctx */
+	EMIT(I_MOV64_R(BPF_REG_6, BPF_REG_1));
+	EMIT(I_LDX(BPF_DW, BPF_REG_2, BPF_REG_6,
+		offsetof(struct sk_reuseport_md, data)));
+	EMIT(I_STX(BPF_DW, BPF_REG_10, BPF_REG_2, SC_DATA - SC_SIZE));
+	EMIT(I_LDX(BPF_DW, BPF_REG_2, BPF_REG_6,
+		offsetof(struct sk_reuseport_md, data_end)));
+	EMIT(I_STX(BPF_DW, BPF_REG_10, BPF_REG_2, SC_DATA_END - SC_SIZE));
+	EMIT(I_ST(BPF_DW, BPF_REG_10, SC_POS - SC_SIZE, 0));
+	EMIT(I_ST(BPF_DW, BPF_REG_10, SC_HASH - SC_SIZE, 0));
+
+	/* look for the Call-ID header */
+	EMIT(I_MOV64_K(BPF_REG_1, STEER_SCAN_MAX));
+	EMIT(I_LD_FUNC(BPF_REG_2, L_SEARCH));
+	EMIT(I_LD_HI());
+	EMIT(I_MOV64_R(BPF_REG_3, BPF_REG_10));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_3, -SC_SIZE));
+	EMIT(I_MOV64_K(BPF_REG_4, 0));
+	EMIT(I_CALL(BPF_FUNC_loop));
+	EMIT(I_LDX(BPF_DW, BPF_REG_1, BPF_REG_10, SC_POS - SC_SIZE));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_1, 0, L_PASS));
+
+	/* hash its value */
+	EMIT(I_MOV64_K(BPF_REG_1, STEER_HASH_MAX));
+	EMIT(I_LD_FUNC(BPF_REG_2, L_HASH));
+	EMIT(I_LD_HI());
+	EMIT(I_MOV64_R(BPF_REG_3, BPF_REG_10));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_3, -SC_SIZE));
+	EMIT(I_MOV64_K(BPF_REG_4, 0));
+	EMIT(I_CALL(BPF_FUNC_loop));
+
+	/* slot = hash % active, then select the socket of the slot owner */
+	EMIT(I_LDX(BPF_DW, BPF_REG_7, BPF_REG_10, SC_HASH - SC_SIZE));
+	EMIT(I_ST(BPF_W, BPF_REG_10, -SC_SIZE-4, 0));
+	EMIT(I_LD_MAP(BPF_REG_1, slots_fd));
+	EMIT(I_LD_HI());
+	EMIT(I_MOV64_R(BPF_REG_2, BPF_REG_10));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_2, -SC_SIZE-4));
+	EMIT(I_CALL(BPF_FUNC_map_lookup_elem));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, 0, L_PASS));
+	EMIT(I_LDX(BPF_W, BPF_REG_1, BPF_REG_0, 0));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_1, 0, L_PASS));
+	EMIT(I_ALU64_R(BPF_MOD, BPF_REG_7, BPF_REG_1));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_7, 1));
+	EMIT(I_STX(BPF_W, BPF_REG_10, BPF_REG_7, -SC_SIZE-4));
+	EMIT(I_LD_MAP(BPF_REG_1, slots_fd));
+	EMIT(I_LD_HI());
+	EMIT(I_MOV64_R(BPF_REG_2, BPF_REG_10));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_2, -SC_SIZE-4));
+	EMIT(I_CALL(BPF_FUNC_map_lookup_elem));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, 0, L_PASS));
+	EMIT(I_LDX(BPF_W, BPF_REG_3, BPF_REG_0, 0));
+	EMIT(I_STX(BPF_W, BPF_REG_10, BPF_REG_3, -SC_SIZE-8));
+	EMIT(I_MOV64_R(BPF_REG_1, BPF_REG_6));
+	EMIT(I_LD_MAP(BPF_REG_2, socks_fd));
+	EMIT(I_LD_HI());
+	EMIT(I_MOV64_R(BPF_REG_3, BPF_REG_10));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_3, -SC_SIZE-8));
+	EMIT(I_MOV64_K(BPF_REG_4, 0));
+	EMIT(I_CALL(BPF_FUNC_sk_select_reuseport));
+
+	/* if nothing was selected, the kernel does its default distribution */
+	LABEL(L_PASS);
+	EMIT(I_MOV64_K(BPF_REG_0, SK_PASS));
+	EMIT(I_EXIT());
+
+	/* search callback - r1 = offset in the UDP payload, r2 = scan ctx;
+	 * looks for "\nCall-ID:" or "\ni:" and stores the value offset */
+	LABEL(L_SEARCH);
+	EMIT(I_JMP_K(BPF_JGT, BPF_REG_1, STEER_SCAN_MAX, L_S_BRK));
+	EMIT(I_LDX(BPF_DW, BPF_REG_3, BPF_REG_2, SC_DATA));
+	EMIT(I_LDX(BPF_DW, BPF_REG_4, BPF_REG_2, SC_DATA_END));
+	EMIT(I_ALU64_R(BPF_ADD, BPF_REG_3, BPF_REG_1));
+	EMIT(I_MOV64_R(BPF_REG_5, BPF_REG_3));
+	/* the data starts with the UDP header */
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_5, 8+2+sizeof(hdr)-1));
+	EMIT(I_JMP_R(BPF_JGT, BPF_REG_5, BPF_REG_4, L_S_BRK));
+	EMIT(I_LDX(BPF_B, BPF_REG_0, BPF_REG_3, 8));
+	EMIT(I_JMP_K(BPF_JNE, BPF_REG_0, '\n', L_S_CONT));
+	EMIT(I_LDX(BPF_B, BPF_REG_0, BPF_REG_3, 8+1));
+	EMIT(I_ALU64_K(BPF_OR, BPF_REG_0, 0x20));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, 'i', L_S_COMPACT));
+	EMIT(I_JMP_K(BPF_JNE, BPF_REG_0, 'c', L_S_CONT));
+	for (i = 0; i < sizeof(hdr)-1; i++) {
+		EMIT(I_LDX(BPF_B, BPF_REG_0, BPF_REG_3, 8+2+i));
+		EMIT(I_ALU64_K(BPF_OR, BPF_REG_0, 0x20));
+		EMIT(I_JMP_K(BPF_JNE, BPF_REG_0, hdr[i], L_S_CONT));
+	}
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_1, 8+2+sizeof(hdr)-1));
+	EMIT(I_STX(BPF_DW, BPF_REG_2, BPF_REG_1, SC_POS));
+	EMIT(I_JA(L_S_BRK));
+	LABEL(L_S_COMPACT);
+	EMIT(I_LDX(BPF_B, BPF_REG_0, BPF_REG_3, 8+2));
+	EMIT(I_JMP_K(BPF_JNE, BPF_REG_0, ':', L_S_CONT));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_1, 8+3));
+	EMIT(I_STX(BPF_DW, BPF_REG_2, BPF_REG_1, SC_POS));
+	EMIT(I_JA(L_S_BRK));
+	LABEL(L_S_CONT);
+	EMIT(I_MOV64_K(BPF_REG_0, 0));
+	EMIT(I_EXIT());
+	LABEL(L_S_BRK);
+	EMIT(I_MOV64_K(BPF_REG_0, 1));
+	EMIT(I_EXIT());
+
+	/* hash callback - r1 = offset in the Call-ID value, r2 = scan ctx;
+	 * hashes the value up to the end of line, skipping the whitespaces */
+	LABEL(L_HASH);
+	EMIT(I_JMP_K(BPF_JGT, BPF_REG_1, STEER_HASH_MAX, L_H_BRK));
+	EMIT(I_LDX(BPF_DW, BPF_REG_5, BPF_REG_2, SC_POS));
+	EMIT(I_JMP_K(BPF_JGT, BPF_REG_5, STEER_SCAN_MAX+32, L_H_BRK));
+	EMIT(I_LDX(BPF_DW, BPF_REG_3, BPF_REG_2, SC_DATA));
+	EMIT(I_LDX(BPF_DW, BPF_REG_4, BPF_REG_2, SC_DATA_END));
+	EMIT(I_ALU64_R(BPF_ADD, BPF_REG_3, BPF_REG_5));
+	EMIT(I_ALU64_R(BPF_ADD, BPF_REG_3, BPF_REG_1));
+	EMIT(I_MOV64_R(BPF_REG_5, BPF_REG_3));
+	EMIT(I_ALU64_K(BPF_ADD, BPF_REG_5, 1));
+	EMIT(I_JMP_R(BPF_JGT, BPF_REG_5, BPF_REG_4, L_H_BRK));
+	EMIT(I_LDX(BPF_B, BPF_REG_0, BPF_REG_3, 0));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, '\r', L_H_BRK));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, '\n', L_H_BRK));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, ' ', L_H_CONT));
+	EMIT(I_JMP_K(BPF_JEQ, BPF_REG_0, '\t', L_H_CONT));
+	EMIT(I_LDX(BPF_DW, BPF_REG_5, BPF_REG_2, SC_HASH));
+	EMIT(I_ALU64_K(BPF_MUL, BPF_REG_5, 31));
+	EMIT(I_ALU64_R(BPF_ADD, BPF_REG_5, BPF_REG_0));
+	EMIT(I_STX(BPF_DW, BPF_REG_2, BPF_REG_5, SC_HASH));
+	LABEL(L_H_CONT);
+	EMIT(I_MOV64_K(BPF_REG_0, 0));
+	EMIT(I_EXIT());
+	LABEL(L_H_BRK);
+	EMIT(I_MOV64_K(BPF_REG_0, 1));
+	EMIT(I_EXIT());
+
+#undef EMIT
+#undef LABEL
+
+	/* resolve the labels into relative offsets */
+	for (i = 0; i < n; i++) {
+		if (p[i].code==(BPF_LD|BPF_DW|BPF_IMM) &&
+		p[i].src_reg==BPF_PSEUDO_FUNC)
+			p[i].imm = lbl[p[i].imm] - (i+1);
+		else if (BPF_CLASS(p[i].code)==BPF_JMP &&
+		BPF_OP(p[i].code)!=BPF_CALL && BPF_OP(p[i].code)!=BPF_EXIT)
+			p[i].off = lbl[p[i].off] - (i+1);
+	}
+
+	/* BTF type ids of the functions, see steer_load_btf() */
+	fi[0].insn_off = 0;
+	fi[0].type_id = 2;
+	fi[1].insn_off = lbl[L_SEARCH];
+	fi[1].type_id = 3;
+	fi[2].insn_off = lbl[L_HASH];
+	fi[2].type_id = 4;
+
+	return n;
+}
+
+
+#define BTF_INFO_ENC(_kind, _kflag, _vlen) \
+	(((_kflag)<<31) | ((_kind)<<24) | (_vlen))
+
+/* minimal BTF describing the functions of the program, as required by the
+ * kernel for the bpf_loop() callbacks: a "void f(void)" prototype, then one
+ * static function for the main program and one for each callback */
+static int steer_load_btf(void)
+{
+	static const char strs[] = "\0steer\0steer_search\0steer_hash";
+	struct {
+		struct btf_header hdr;
+		struct btf_type types[4];
+		char strs[sizeof(strs)];
+	} __attribute__((packed)) b;
+	union bpf_attr attr;
+	int i;
+
+	memset(&b, 0, sizeof b);
+	b.hdr.magic = BTF_MAGIC;
+	b.hdr.version = BTF_VERSION;
+	b.hdr.hdr_len = sizeof b.hdr;
+	b.hdr.type_off = 0;
+	b.hdr.type_len = sizeof b.types;
+	b.hdr.str_off = sizeof b.types;
+	b.hdr.str_len = sizeof strs;
+
+	b.types[0].info = BTF_INFO_ENC(BTF_KIND_FUNC_PROTO, 0, 0);
+	b.types[1].name_off = 1;
+	b.types[2].name_off = 7;
+	b.types[3].name_off = 20;
+	for (i = 1; i < 4; i++) {
+		b.types[i].info = BTF_INFO_ENC(BTF_KIND_FUNC, 0, BTF_FUNC_STATIC);
+		b.types[i].type = 1;
+	}
+	memcpy(b.strs, strs, sizeof strs);
+
+	memset(&attr, 0, sizeof attr);
+	attr.btf = (unsigned long)&b;
+	attr.btf_size = sizeof b;
+
+	return udp_bpf(BPF_BTF_LOAD, &attr);
+}
+
+
+static int steer_load_prog(struct udp_steering *st)
+{
+	struct bpf_insn insns[STEER_MAX_INSNS];
+	struct bpf_func_info fi[3];
+	union bpf_attr attr;
+	int btf_fd, n;
+
+	if ((btf_fd=steer_load_btf())<0) {
+		LM_ERR("failed to load the BTF: %s (%d)\n", strerror(errno), errno);
+		return -1;
+	}
+
+	n = steer_build_prog(insns, st->slots_fd, st->socks_fd, fi);
+
+	memset(&attr, 0, sizeof attr);
+	attr.prog_type = BPF_PROG_TYPE_SK_REUSEPORT;
+	attr.insns = (unsigned long)insns;
+	attr.insn_cnt = n;
+	attr.license = (unsigned long)"GPL";
+	attr.prog_btf_fd = btf_fd;
+	attr.func_info = (unsigned long)fi;
+	attr.func_info_cnt = 3;
+	attr.func_info_rec_size = sizeof fi[0];
+
+	st->prog_fd = udp_bpf(BPF_PROG_LOAD, &attr);
+	close(btf_fd);
+	if (st->prog_fd<0) {
+		LM_ERR("failed to load the BPF program: %s (%d)\n",
+			strerror(errno), errno);
+		return -1;
+	}
+
+	return 0;
+}
+
+
+static struct udp_steering *udp_get_steering(const struct socket_info *si)
+{
+	struct udp_steering *st;
+
+	for (st = steerings; st && st->si!=si; st = st->next);
+	return st;
+}
+
+
+/* creates the steering of a listener and attaches it to the reuseport
+ * group of the listener socket; to be called by main, after binding the
+ * listener and before forking its workers */
+static int udp_init_steering(struct socket_info *si)
+{
+	struct udp_steering *st;
+	unsigned int max_slots;
+
+	max_slots = si->workers;
+	if (si->s_profile && si->s_profile->max_procs > max_slots)
+		max_slots = si->s_profile->max_procs;
+
+	st = pkg_malloc(sizeof *st);
+	if (st==NULL) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+	memset(st, 0, sizeof *st);
+	st->si = si;
+	st->max_slots = max_slots;
+	st->socks_fd = st->slots_fd = st->prog_fd = -1;
+
+	st->lock = lock_alloc();
+	st->active = shm_malloc((1 + max_slots) * sizeof(int));
+	if (st->lock==NULL || st->active==NULL) {
+		LM_ERR("no more shm memory\n");
+		goto error;
+	}
+	lock_init(st->lock);
+	memset(st->active, 0, (1 + max_slots) * sizeof(int));
+	st->owners = (int *)(st->active + 1);
+
+	st->socks_fd = udp_bpf_map_create(BPF_MAP_TYPE_REUSEPORT_SOCKARRAY,
+		counted_max_processes);
+	st->slots_fd = udp_bpf_map_create(BPF_MAP_TYPE_ARRAY, 1 + max_slots);
+	if (st->socks_fd<0 || st->slots_fd<0) {
+		LM_ERR("failed to create the BPF maps: %s (%d)\n",
+			strerror(errno), errno);
+		goto error;
+	}
+
+	if (steer_load_prog(st)<0)
+		goto error;
+
+	/* the program applies to the whole reuseport group */
+	if (setsockopt(si->socket, SOL_SOCKET, SO_ATTACH_REUSEPORT_EBPF,
+	&st->prog_fd, sizeof st->prog_fd)<0) {
+		LM_ERR("failed to attach the BPF program to %.*s: %s (%d)\n",
+			si->sock_str.len, si->sock_str.s, strerror(errno), errno);
+		goto error;
+	}
+
+	st->next = steerings;
+	steerings = st;
+
+	return 0;
+error:
+	if (st->prog_fd>=0) close(st->prog_fd);
+	if (st->slots_fd>=0) close(st->slots_fd);
+	if (st->socks_fd>=0) close(st->socks_fd);
+	if (st->active) shm_free(st->active);
+	if (st->lock) lock_dealloc(st->lock);
+	pkg_free(st);
+	return -1;
+}
+
+
+/* adds the socket of the current worker to the steering, as last slot */
+static void udp_steering_join(struct udp_steering *st, int fd)
+{
+	unsigned int slot;
+
+	lock_get(st->lock);
+
+	if (*st->active==st->max_slots) {
+		LM_BUG("no free steering slot for process %d on %.*s\n",
+			process_no, st->si->sock_str.len, st->si->sock_str.s);
+		goto done;
+	}
+
+	/* the socket must be in the map before the slot becomes active */
+	if (udp_bpf_map_set(st->socks_fd, process_no, fd)<0) {
+		LM_ERR("failed to add the socket of process %d to the steering "
+			"of %.*s: %s (%d)\n", process_no, st->si->sock_str.len,
+			st->si->sock_str.s, strerror(errno), errno);
+		goto done;
+	}
+
+	slot = *st->active;
+	if (udp_bpf_map_set(st->slots_fd, 1 + slot, process_no)<0 ||
+	udp_bpf_map_set(st->slots_fd, 0, slot + 1)<0) {
+		LM_ERR("failed to update the steering slots of %.*s: %s (%d)\n",
+			st->si->sock_str.len, st->si->sock_str.s, strerror(errno), errno);
+		goto done;
+	}
+	st->owners[slot] = process_no;
+	(*st->active)++;
+
+	LM_DBG("process %d joined the steering of %.*s on slot %u\n",
+		process_no, st->si->sock_str.len, st->si->sock_str.s, slot);
+done:
+	lock_release(st->lock);
+}
+
+
+/* removes the socket of the current worker from the steering; the last
+ * slot is moved over the freed one, so the active slots stay compact */
+static void udp_steering_leave(struct udp_steering *st)
+{
+	unsigned int slot, last;
+
+	lock_get(st->lock);
+
+	for (slot = 0; slot < *st->active && st->owners[slot]!=process_no;
+		slot++);
+	if (slot==*st->active)
+		goto done;
+
+	last = *st->active - 1;
+	/* while moving, both slots point to the same (valid) socket */
+	if (slot!=last) {
+		if (udp_bpf_map_set(st->slots_fd, 1 + slot, st->owners[last])<0) {
+			LM_ERR("failed to move steering slot %u of %.*s: %s (%d)\n",
+				last, st->si->sock_str.len, st->si->sock_str.s,
+				strerror(errno), errno);
+			goto done;
+		}
+		st->owners[slot] = st->owners[last];
+	}
+	if (udp_bpf_map_set(st->slots_fd, 0, last)<0)
+		LM_ERR("failed to update the steering slots of %.*s: %s (%d)\n",
+			st->si->sock_str.len, st->si->sock_str.s, strerror(errno), errno);
+	*st->active = last;
+
+	udp_bpf_map_del(st->socks_fd, process_no);
+
+	LM_DBG("process %d left the steering of %.*s, %u slots left\n",
+		process_no, st->si->sock_str.len, st->si->sock_str.s, last);
+done:
+	lock_release(st->lock);
+}
+
+#endif /* HAVE_REUSEPORT_BPF */
+
+
+int udp_init_worker_sockets(int udp_disabled)
+{
+	if (udp_disabled || !udp_worker_sockets) {
+		udp_worker_sockets = 0;
+		udp_callid_steering = 0;
+		return 0;
+	}
+
+#ifndef __OS_linux
+	LM_WARN("per-worker UDP sockets are supported only on Linux, "
+		"ignoring them\n");
+	udp_worker_sockets = 0;
+	udp_callid_steering = 0;
+#endif
+
+#ifndef HAVE_REUSEPORT_BPF
+	if (udp_callid_steering) {
+		LM_WARN("Call-ID steering not supported by this build, "
+			"ignoring it\n");
+		udp_callid_steering = 0;
+	}
+#endif
+
+	return 0;
+}
+
+
+int udp_worker_sockets_prepare(struct socket_info *si)
+{
+	if (!udp_has_worker_sockets(si))
+		return 0;
+
+#ifdef HAVE_REUSEPORT_BPF
+	if (udp_callid_steering && udp_get_steering(si)==NULL &&
+	udp_init_steering(si)<0)
+		LM_WARN("Call-ID steering not available for %.*s, using the "
+			"kernel's distribution of the datagrams\n",
+			si->sock_str.len, si->sock_str.s);
+#endif
+
+	return 0;
+}
+
+
+int udp_worker_socket_open(struct socket_info *si, int own_socket)
+{
+	struct proto_info *pi = &protos[si->proto];
+#ifdef HAVE_REUSEPORT_BPF
+	struct udp_steering *st;
+#endif
+
+	if (!udp_has_worker_sockets(si))
+		return 0;
+
+	if (own_socket) {
+		/* bind a new socket on the listener address - it joins the
+		 * reuseport group of the listener */
+		udp_shared_fd = si->socket;
+		if (pi->tran.init_listener(si)<0 || pi->tran.bind_listener(si)<0) {
+			LM_ERR("failed to open the worker socket on %.*s\n",
+				si->sock_str.len, si->sock_str.s);
+			if (si->socket>=0 && si->socket!=udp_shared_fd)
+				close(si->socket);
+			si->socket = udp_shared_fd;
+			udp_shared_fd = -1;
+			return -1;
+		}
+		LM_DBG("process %d uses its own socket %d on %.*s\n", process_no,
+			si->socket, si->sock_str.len, si->sock_str.s);
+	}
+
+#ifdef HAVE_REUSEPORT_BPF
+	if ((st=udp_get_steering(si))!=NULL)
+		udp_steering_join(st, si->socket);
+#endif
+
+	return 0;
+}
+
+
+/* drains and closes the own socket of the current worker; from now on,
+ * the worker uses (for sending) the listener socket */
+static void udp_worker_socket_drop(struct socket_info *si)
+{
+	struct proto_info *pi = &protos[si->proto];
+	int read;
+
+	/* consume whatever is already queued on the socket, otherwise it
+	 * will be lost when closing it */
+	do {
+		read = -1;
+		if (pi->net.dgram.read(si, &read)<0)
+			break;
+	} while (read>0);
+
+	close(si->socket);
+	si->socket = udp_shared_fd;
+	udp_shared_fd = -1;
+}
+
+
+int udp_worker_socket_close(struct socket_info *si)
+{
+#ifdef HAVE_REUSEPORT_BPF
+	struct udp_steering *st;
+#endif
+
+	if (!udp_has_worker_sockets(si))
+		return 0;
+
+#ifdef HAVE_REUSEPORT_BPF
+	/* first stop getting steered datagrams */
+	if ((st=udp_get_steering(si))!=NULL)
+		udp_steering_leave(st);
+#endif
+
+	/* the listener socket stays in the reuseport group, as it is open in
+	 * all the processes - somebody else has to read it */
+	if (udp_shared_fd<0)
+		return 1;
+
+	udp_worker_socket_drop(si);
+	return 0;
+}
+
+
+int udp_worker_socket_handover(struct socket_info *si, ipc_rpc_f *take_rpc)
+{
+	int i;
+
+	for (i = 0; i < counted_max_processes; i++)
+		if (i!=process_no && is_process_running(i) &&
+		!(pt[i].flags&OSS_PROC_TO_TERMINATE) && pt[i].type==TYPE_UDP &&
+		pt[i].pg_filter==si)
+			break;
+
+	if (i==counted_max_processes) {
+		LM_ERR("no UDP worker left to read the listener socket of %.*s\n",
+			si->sock_str.len, si->sock_str.s);
+		return -1;
+	}
+
+	if (ipc_send_rpc(i, take_rpc, si)<0) {
+		LM_ERR("failed to hand over the listener socket of %.*s to "
+			"process %d\n", si->sock_str.len, si->sock_str.s, i);
+		return -1;
+	}
+
+	LM_DBG("process %d hands over the listener socket of %.*s to "
+		"process %d\n", process_no, si->sock_str.len, si->sock_str.s, i);
+	return 0;
+}
+
+
+int udp_worker_socket_takeover(struct socket_info *si)
+{
+#ifdef HAVE_REUSEPORT_BPF
+	struct udp_steering *st;
+#endif
+
+	if (!udp_has_worker_sockets(si) || udp_shared_fd<0)
+		return 0;
+
+#ifdef HAVE_REUSEPORT_BPF
+	if ((st=udp_get_steering(si))!=NULL)
+		udp_steering_leave(st);
+#endif
+
+	/* our own socket leaves the reuseport group once closed */
+	udp_worker_socket_drop(si);
+
+#ifdef HAVE_REUSEPORT_BPF
+	if (st)
+		udp_steering_join(st, si->socket);
+#endif
+
+	LM_DBG("process %d now reads the listener socket of %.*s\n",
+		process_no, si->sock_str.len, si->sock_str.s);
+	return 0;
+}
@@ -408,7 +408,7 @@ static inline int tcp_handle_req(struct tcp_req *req,
 				/* If parallel handling, make a copy (null terminted) of the
 				 * current reading buffer (so we can continue its handling)
 				 * and release the TCP conn on READ */
-				if ( (_parallel_handling!=0) &&
+				if ( (_parallel_handling!=0) && !tcp_conn_sticky(con) &&
 				(msg_buf_cpy=(char*)pkg_malloc( msg_len+1 )) !=NULL ) {
 					memcpy( msg_buf_cpy, msg_buf, msg_len);
 					msg_buf_cpy[msg_len] = 0;
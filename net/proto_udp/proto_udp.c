@@ -24,6 +24,12 @@
  *  2015-02-11  first version (bogdan)
  */
 
+#ifdef HAVE_RECVMMSG
+/* make recvmmsg() available */
+#define _GNU_SOURCE
+#include <sys/socket.h>
+#endif
+
 #include <errno.h>
 #include <unistd.h>
 #include <netinet/tcp.h>
@@ -34,6 +40,7 @@
 #include "../../timer.h"
 #include "../../socket_info.h"
 #include "../../receive.h"
+#include "../../statistics.h"
 #include "../api_proto.h"
 #include "../api_proto_net.h"
 #include "../net_udp.h"
@@ -54,6 +61,27 @@ static callback_list* cb_list = NULL;
 
 static int udp_port = SIP_PORT;
 
+/* default number of datagrams to be drained with a single syscall, for the
+ * listeners not defining their own "recv_batch" value; 0/1 means disabled */
+static int udp_recv_batch = 0;
+
+#define UDP_MAX_RECV_BATCH  64
+
+#ifdef HAVE_RECVMMSG
+/* per listener batching statistics */
+struct udp_batch_stats {
+	const struct socket_info *si;
+	stat_var *reads;   /* number of batched read syscalls */
+	stat_var *dgrams;  /* number of datagrams received via batched reads */
+	struct udp_batch_stats *next;
+};
+
+static struct udp_batch_stats *batch_stats_list = NULL;
+
+static int udp_read_req_batch(const struct socket_info *si, int* bytes_read);
+static int udp_init_batch_stats(void);
+#endif
+
 
 static const cmd_export_t cmds[] = {
 	{"proto_init", (cmd_function)proto_udp_init, {{0,0,0}}, 0},
@@ -63,6 +91,11 @@ static const cmd_export_t cmds[] = {
 
 static const param_export_t params[] = {
 	{ "udp_port",    INT_PARAM,   &udp_port   },
+	{ "udp_recv_batch", INT_PARAM, &udp_recv_batch },
+	{ "udp_send_batch", INT_PARAM, &udp_send_batch },
+	{ "udp_exclusive_wakeup", INT_PARAM, &udp_exclusive_wakeup },
+	{ "udp_worker_sockets", INT_PARAM, &udp_worker_sockets },
+	{ "udp_callid_steering", INT_PARAM, &udp_callid_steering },
 	{0, 0, 0}
 };
 
@@ -94,6 +127,20 @@ struct module_exports proto_udp_exports = {
 static int mod_init(void)
 {
 	LM_INFO("initializing UDP-plain protocol\n");
+
+	if (udp_recv_batch<0 || udp_recv_batch>UDP_MAX_RECV_BATCH) {
+		LM_WARN("invalid udp_recv_batch %d (allowed 0..%d), disabling\n",
+			udp_recv_batch, UDP_MAX_RECV_BATCH);
+		udp_recv_batch = 0;
+	}
+
+#ifdef HAVE_RECVMMSG
+	if (udp_init_batch_stats()<0) {
+		LM_ERR("failed to init the receive batching statistics\n");
+		return -1;
+	}
+#endif
+
 	return 0;
 }
 
@@ -117,6 +164,23 @@ static int proto_udp_init(struct proto_info *pi)
 
 static int proto_udp_init_listener(struct socket_info *si)
 {
+	if (si->recv_batch==0)
+		si->recv_batch = udp_recv_batch;
+	if (si->recv_batch>UDP_MAX_RECV_BATCH) {
+		LM_WARN("recv_batch %d on <%.*s> too large, limiting to %d\n",
+			si->recv_batch, si->sock_str.len, si->sock_str.s,
+			UDP_MAX_RECV_BATCH);
+		si->recv_batch = UDP_MAX_RECV_BATCH;
+	}
+#ifndef HAVE_RECVMMSG
+	if (si->recv_batch>1) {
+		LM_WARN("receive batching not supported by this build, "
+			"ignoring recv_batch on <%.*s>\n",
+			si->sock_str.len, si->sock_str.s);
+		si->recv_batch = 0;
+	}
+#endif
+
 	/* we do not do anything particular to UDP plain here, so
 	 * transparently use the generic listener init from net UDP layer */
 	return udp_init_listener(si, O_NONBLOCK);
@@ -127,36 +191,25 @@ static int proto_udp_bind_listener(struct socket_info *si)
 	return udp_bind_listener(si);
 }
 
-static int udp_read_req(const struct socket_info *si, int* bytes_read)
+/* runs the receiving logic for a single datagram already read from the
+ * network; the @buf must have room for the trailing 0 */
+static inline void udp_handle_dgram(const struct socket_info *si,
+										char *buf, int len, union sockaddr_union *from)
 {
 	struct receive_info ri;
-	int len;
-	static char buf [BUF_SIZE+1];
 	char *tmp;
-	unsigned int fromlen;
 	callback_list* p;
 	str msg;
 
-	fromlen=sockaddru_len(si->su);
-	/* coverity[overrun-buffer-arg: FALSE] - union has 28 bytes, CID #200029 */
-	len=recvfrom(si->socket, buf, BUF_SIZE,0,&ri.src_su.s,&fromlen);
-	if (len==-1){
-		if (errno==EAGAIN)
-			return 0;
-		if ((errno==EINTR)||(errno==EWOULDBLOCK)|| (errno==ECONNREFUSED))
-			return -1;
-		LM_ERR("recvfrom:[%d] %s\n", errno, strerror(errno));
-		return -2;
-	}
-
 	if (len<MIN_UDP_PACKET) {
 		LM_DBG("probing packet received len = %d\n", len);
-		return 0;
+		return;
 	}
 
 	/* we must 0-term the messages, receive_msg expects it */
 	buf[len]=0; /* no need to save the previous char */
 
+	ri.src_su = *from;
 	ri.bind_address = si;
 	ri.dst_port = si->port_no;
 	ri.dst_ip = si->address;
@@ -179,22 +232,205 @@ static int udp_read_req(const struct socket_info *si, int* bytes_read)
 				}
 			}
 		}
-		if (p) return 0;
+		if (p) return;
 	}
 
 	if (ri.src_port==0){
 		tmp=ip_addr2a(&ri.src_ip);
 		LM_INFO("dropping 0 port packet from %s\n", tmp);
-		return 0;
+		return;
 	}
 
 	/* receive_msg must free buf too!*/
 	receive_msg( msg.s, msg.len, &ri, NULL, 0);
+}
+
+static int udp_read_req(const struct socket_info *si, int* bytes_read)
+{
+	union sockaddr_union from;
+	int len;
+	static char buf [BUF_SIZE+1];
+	unsigned int fromlen;
+
+#ifdef HAVE_RECVMMSG
+	if (si->recv_batch>1)
+		return udp_read_req_batch(si, bytes_read);
+#endif
+
+	fromlen=sockaddru_len(si->su);
+	/* coverity[overrun-buffer-arg: FALSE] - union has 28 bytes, CID #200029 */
+	len=recvfrom(si->socket, buf, BUF_SIZE,0,&from.s,&fromlen);
+	if (len==-1){
+		if (errno==EAGAIN) {
+			/* woken up, but the packet was already taken by another proc */
+			*bytes_read = 0;
+			return 0;
+		}
+		if ((errno==EINTR)||(errno==EWOULDBLOCK)|| (errno==ECONNREFUSED))
+			return -1;
+		LM_ERR("recvfrom:[%d] %s\n", errno, strerror(errno));
+		return -2;
+	}
+
+	*bytes_read = len;
+	udp_handle_dgram(si, buf, len, &from);
 
 	return 0;
 }
 
 
+#ifdef HAVE_RECVMMSG
+static unsigned long udp_batch_fill(void *ctx)
+{
+	struct udp_batch_stats *bs = (struct udp_batch_stats *)ctx;
+	unsigned long reads;
+
+	reads = get_stat_val(bs->reads) * bs->si->recv_batch;
+	if (reads==0)
+		return 0;
+
+	/* average filling of the batch, in percents */
+	return get_stat_val(bs->dgrams) * 100 / reads;
+}
+
+static int udp_register_batch_stat(const struct socket_info *si,
+		const char *prefix, stat_var **pvar, void *ctx)
+{
+	char sock_name[MAX_SOCKET_STR+1];
+	str stat_prefix;
+	char *stat_name;
+
+	memcpy(sock_name, si->sock_str.s, si->sock_str.len);
+	sock_name[si->sock_str.len] = 0;
+
+	stat_prefix.s = (char *)prefix;
+	stat_prefix.len = strlen(prefix);
+
+	if ( (stat_name = build_stat_name(&stat_prefix, sock_name))==NULL ||
+	register_stat2("net", stat_name, pvar,
+	STAT_SHM_NAME|(ctx?STAT_IS_FUNC:0), ctx, 0)!=0) {
+		LM_ERR("failed to add stat %s for <%.*s>\n", prefix,
+			si->sock_str.len, si->sock_str.s);
+		return -1;
+	}
+
+	return 0;
+}
+
+/* registers the "batch_reads", "batch_dgrams" and "batch_fill" stats for
+ * each UDP listener doing batched reads */
+static int udp_init_batch_stats(void)
+{
+	struct socket_info_full *sif;
+	struct socket_info *si;
+	struct udp_batch_stats *bs;
+	int batch;
+
+	for (sif = protos[PROTO_UDP].listeners; sif; sif = sif->next) {
+		si = &sif->socket_info;
+
+		/* the listener is not initialized yet, so check the batch size
+		 * it is going to use */
+		batch = si->recv_batch ? si->recv_batch : udp_recv_batch;
+		if (batch<=1)
+			continue;
+
+		bs = pkg_malloc(sizeof *bs);
+		if (!bs) {
+			LM_ERR("oom\n");
+			return -1;
+		}
+		memset(bs, 0, sizeof *bs);
+		bs->si = si;
+
+		if (udp_register_batch_stat(si, "batch_reads", &bs->reads, NULL)<0 ||
+		udp_register_batch_stat(si, "batch_dgrams", &bs->dgrams, NULL)<0 ||
+		udp_register_batch_stat(si, "batch_fill",
+		(stat_var **)udp_batch_fill, bs)<0) {
+			pkg_free(bs);
+			return -1;
+		}
+
+		bs->next = batch_stats_list;
+		batch_stats_list = bs;
+	}
+
+	return 0;
+}
+
+/* drains up to si->recv_batch datagrams with a single recvmmsg() call and
+ * runs them, one after the other, through the receiving logic. As a UDP
+ * worker serves a single listener, the ring of buffers is allocated only
+ * once per process, at the first read */
+static int udp_read_req_batch(const struct socket_info *si, int* bytes_read)
+{
+	static struct mmsghdr *hdrs;
+	static struct iovec *iovs;
+	static union sockaddr_union *from;
+	static char *bufs;
+	static struct udp_batch_stats *bs;
+	static int depth;
+	int i, n;
+
+	if (hdrs==NULL || depth!=si->recv_batch) {
+		if (hdrs)
+			pkg_free(hdrs);
+		depth = si->recv_batch;
+		/* one chunk holding all the headers, vectors, addresses and the
+		 * ring of data buffers, in this order */
+		hdrs = pkg_malloc(depth * (sizeof *hdrs + sizeof *iovs +
+			sizeof *from + BUF_SIZE+1));
+		if (!hdrs) {
+			LM_ERR("oom for a batch of %d UDP buffers\n", depth);
+			depth = 0;
+			return -2;
+		}
+		iovs = (struct iovec *)(hdrs + depth);
+		from = (union sockaddr_union *)(iovs + depth);
+		bufs = (char *)(from + depth);
+
+		memset(hdrs, 0, depth * sizeof *hdrs);
+		for (i = 0; i < depth; i++) {
+			iovs[i].iov_base = bufs + i * (BUF_SIZE+1);
+			iovs[i].iov_len = BUF_SIZE;
+			hdrs[i].msg_hdr.msg_iov = &iovs[i];
+			hdrs[i].msg_hdr.msg_iovlen = 1;
+			hdrs[i].msg_hdr.msg_name = &from[i].s;
+		}
+
+		for (bs = batch_stats_list; bs && bs->si!=si; bs = bs->next);
+	}
+
+	for (i = 0; i < depth; i++)
+		hdrs[i].msg_hdr.msg_namelen = sockaddru_len(si->su);
+
+	n = recvmmsg(si->socket, hdrs, depth, 0, NULL);
+	if (n==-1){
+		if (errno==EAGAIN) {
+			*bytes_read = 0;
+			return 0;
+		}
+		if ((errno==EINTR)||(errno==EWOULDBLOCK)|| (errno==ECONNREFUSED))
+			return -1;
+		LM_ERR("recvmmsg:[%d] %s\n", errno, strerror(errno));
+		return -2;
+	}
+
+	if (bs) {
+		update_stat(bs->reads, 1);
+		update_stat(bs->dgrams, n);
+	}
+
+	for (i = 0, *bytes_read = 0; i < n; i++) {
+		*bytes_read += hdrs[i].msg_len;
+		udp_handle_dgram(si, iovs[i].iov_base, hdrs[i].msg_len, &from[i]);
+	}
+
+	return 0;
+}
+#endif
+
+
 /**
  * Main UDP send function, called from msg_send.
  * \see msg_send
@@ -210,6 +446,10 @@ static int proto_udp_send(const struct socket_info* source,
 {
 	int n, tolen;
 
+	/* if a send batch is in progress, the datagram is just queued */
+	if ((n=udp_send_batch_queue(source->socket, buf, len, to))!=0)
+		return n;
+
 	tolen=sockaddru_len(*to);
 again:
 	n=sendto(source->socket, buf, len, 0, &to->s, tolen);
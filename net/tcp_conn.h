@@ -135,6 +135,8 @@ static inline int tcpconn_list_find(struct tcp_connection *con,
 
 #define TCPCONN_GET_PART(_id)  (_id%TCP_PARTITION_SIZE)
 #define TCP_PART(_id)  (tcp_parts[TCPCONN_GET_PART(_id)])
+/* the TCP main shard owning the partition of the conn */
+#define TCPCONN_GET_SHARD(_id)  (TCPCONN_GET_PART(_id)%tcp_main_shards)
 
 #define TCPCONN_LOCK(_id) \
 	lock_get(tcp_parts[TCPCONN_GET_PART(_id)].tcpconn_lock);
@@ -144,6 +146,10 @@ static inline int tcpconn_list_find(struct tcp_connection *con,
 #define TCP_ALIAS_HASH_SIZE 1024
 #define TCP_ID_HASH_SIZE 1024
 
+/* slots (one per tick) of the per-partition lifetime wheel */
+#define TCP_LT_WHEEL_SIZE 512
+#define tcp_lt_slot(_tick) ((_tick)&(TCP_LT_WHEEL_SIZE-1))
+
 static inline unsigned tcp_addr_hash(struct ip_addr* ip, unsigned short port)
 {
 	if(ip->len==4) return (ip->u.addr32[0]^port)&(TCP_ALIAS_HASH_SIZE-1);
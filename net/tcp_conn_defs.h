@@ -84,6 +84,8 @@
 /*!< no longer in "main" reactor for read or write */
 #define F_CONN_REMOVED			(F_CONN_REMOVED_READ|F_CONN_REMOVED_WRITE)
 #define F_CONN_INIT				(1<<5) /*!< the connection was initialized */
+#define F_CONN_HANDSHAKE		(1<<6) /*!< handshake pending (handshake workers) */
+#define F_CONN_STICKY			(1<<7) /*!< kept by its worker after a read */
 
 enum tcp_conn_states { S_CONN_ERROR=-2, S_CONN_BAD=-1, S_CONN_OK=0,
 		S_CONN_CONNECTING, S_CONN_EOF };
@@ -150,6 +152,7 @@ struct tcp_connection{
 	int s;					/*!< socket, used by "tcp main" */
 	int fd;					/*!< used only by "children", don't modify it! private data! */
 	int proc_id;				/*!< used only by "children", contains the pt table ID of the TCP worker currently holding the connection, or -1 if in TCP main */
+	int worker_id;				/*!< used only by "tcp main", index of the TCP worker the connection was last passed to for reading, or -1 */
 	gen_lock_t write_lock;
 	unsigned int id;				/*!< id (unique!) used to retrieve a specific connection when reply-ing*/
 	unsigned long long cid;					/*!< connection id (unique!) used to uniquely identify connections across space and time */
@@ -169,6 +172,9 @@ struct tcp_connection{
 	struct tcp_connection* id_prev;		/*!< prev in id hash table */
 	struct tcp_connection* c_next;		/*!< Child next (use locally) */
 	struct tcp_connection* c_prev;		/*!< Child prev (use locally */
+	struct tcp_connection* lt_next;		/*!< next in the lifetime wheel slot */
+	struct tcp_connection* lt_prev;		/*!< prev in the lifetime wheel slot */
+	int lt_slot;				/*!< lifetime wheel slot, -1 if not linked */
 	struct tcp_conn_alias con_aliases[TCP_CON_MAX_ALIASES];	/*!< Aliases for this connection */
 	int aliases;				/*!< Number of aliases, at least 1 */
 	struct tcp_req *con_req;	/*!< Per connection req buffer */
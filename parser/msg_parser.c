@@ -110,7 +110,7 @@ char* get_hdr_field_aux(char* buf, char* end, struct hdr_field* hdr,int sip_well
 			   replies for diagnostic purposes */
 			via_cnt++;
 			if (sip_well_known_parse) {
-				vb=pkg_malloc(sizeof(struct via_body));
+				vb=pkg_near_malloc(hdr, sizeof(struct via_body));
 				if (vb==0){
 					LM_ERR("out of pkg memory\n");
 					goto error;
@@ -153,7 +153,7 @@ char* get_hdr_field_aux(char* buf, char* end, struct hdr_field* hdr,int sip_well
 			break;
 		case HDR_CSEQ_T:
 			if (sip_well_known_parse) {
-				cseq_b=pkg_malloc(sizeof(struct cseq_body));
+				cseq_b=pkg_near_malloc(hdr, sizeof(struct cseq_body));
 				if (cseq_b==0){
 					LM_ERR("out of pkg memory\n");
 					goto error;
@@ -198,7 +198,7 @@ char* get_hdr_field_aux(char* buf, char* end, struct hdr_field* hdr,int sip_well
 			break;
 		case HDR_TO_T:
 			if (sip_well_known_parse) {
-				to_b=pkg_malloc(sizeof(struct to_body));
+				to_b=pkg_near_malloc(hdr, sizeof(struct to_body));
 				if (to_b==0){
 					LM_ERR("out of pkg memory\n");
 					goto error;
@@ -400,7 +400,7 @@ int parse_headers_aux(struct sip_msg* msg, hdr_flags_t flags, int next, int sip_
 
 	LM_DBG("flags=%llx\n", (unsigned long long)flags);
 	while( tmp<end && (flags & msg->parsed_flag) != flags){
-		hf=pkg_malloc(sizeof(struct hdr_field));
+		hf=pkg_msg_malloc(msg, sizeof(struct hdr_field));
 		if (hf==0){
 			ser_error=E_OUT_OF_MEM;
 			LM_ERR("pkg memory allocation failed\n");
@@ -58,7 +58,7 @@ int parse_from_header( struct sip_msg *msg)
 
 	/* bad luck! :-( - we have to parse it */
 	/* first, get some memory */
-	from_b = pkg_malloc(sizeof(struct to_body));
+	from_b = pkg_msg_malloc(msg, sizeof(struct to_body));
 	if (from_b == 0) {
 		LM_ERR("out of pkg_memory\n");
 		goto error;
@@ -286,7 +286,7 @@ static inline char* parse_to_param(char *buffer, char *end,
 						add_param(param,to_b);
 					case E_PARA_VALUE:
 						param = (struct to_param*)
-							pkg_malloc(sizeof(struct to_param));
+							pkg_near_malloc(to_b, sizeof(struct to_param));
 						if (!param){
 							LM_ERR("out of pkg memory\n" );
 							goto error;
@@ -621,7 +621,7 @@ static inline char* _parse_to(char* buffer, char *end, struct to_body *to_b,
 						if (multi==0)
 							goto parse_error;
 						to_b->next = (struct to_body*)
-							pkg_malloc(sizeof(struct to_body));
+							pkg_near_malloc(to_b, sizeof(struct to_body));
 						if (to_b->next==NULL) {
 							LM_ERR("failed to allocate new TO body\n");
 							goto error;
@@ -736,7 +736,7 @@ static inline char* _parse_to(char* buffer, char *end, struct to_body *to_b,
 						if (to_b->error!=PARSE_ERROR && multi && *tmp==',') {
 							/* continue with a new body instance */
 							to_b->next = (struct to_body*)
-								pkg_malloc(sizeof(struct to_body));
+								pkg_near_malloc(to_b, sizeof(struct to_body));
 							if (to_b->next==NULL) {
 								LM_ERR("failed to allocate new TO body\n");
 								goto error;
@@ -879,7 +879,7 @@ int parse_to_header( struct sip_msg *msg)
 
 	/* bad luck! :-( - we have to parse it */
 	/* first, get some memory */
-	to_b = pkg_malloc(sizeof(struct to_body));
+	to_b = pkg_msg_malloc(msg, sizeof(struct to_body));
 	if (to_b == 0) {
 		LM_ERR("out of pkg_memory\n");
 		goto error;
@@ -2114,7 +2114,7 @@ parse_again:
 					case F_PARAM:
 						/*state=P_PARAM*/;
 						if(vb->params.s==0) vb->params.s=param_start;
-						param=pkg_malloc(sizeof(struct via_param));
+						param=pkg_near_malloc(vb, sizeof(struct via_param));
 						if (param==0){
 							LM_ERR("no pkg memory left\n");
 							goto error;
@@ -2277,7 +2277,7 @@ nextvia:
 					goto parse_error;
 		}
 	}
-	vb->next=pkg_malloc(sizeof(struct via_body));
+	vb->next=pkg_near_malloc(vb, sizeof(struct via_body));
 	if (vb->next==0){
 		LM_ERR(" out of pkg memory\n");
 		goto error;
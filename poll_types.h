@@ -30,7 +30,7 @@
 
 enum poll_types { POLL_NONE, POLL_POLL, POLL_EPOLL,
 					POLL_SIGIO_RT, POLL_SELECT, POLL_KQUEUE, POLL_DEVPOLL,
-					POLL_END};
+					POLL_IO_URING, POLL_END};
 
 /* all the function and vars are defined in io_wait.c */
 
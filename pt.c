@@ -143,6 +143,12 @@ int init_multi_proc_support(void)
 		return -1;
 	}
 
+	/* create the stats of the per-process shm caches */
+	if (init_shm_cache(counted_max_processes)!=0) {
+		LM_ERR("failed to init the shm cache\n");
+		return -1;
+	}
+
 	/* create the pkg_mem stats */
 	#ifdef PKG_MALLOC
 	if (init_pkg_stats(counted_max_processes)!=0) {
@@ -192,6 +198,12 @@ int init_multi_proc_support(void)
 		return -1;
 	}
 
+	if ( register_stat2( "load", "spurious_wakeups",
+	(stat_var**)pt_get_spurious_wakeups, STAT_IS_FUNC, NULL, 0) != 0) {
+		LM_ERR("failed to add spurious_wakeups stat\n");
+		return -1;
+	}
+
 	if ( register_stat2( "load", "processes_number",
 	(stat_var**)count_running_processes,
 	STAT_IS_FUNC, NULL, 0) != 0) {
@@ -248,6 +260,8 @@ void reset_process_slot( int p_id )
 	pt[p_id].load_rt->flags |= STAT_HIDDEN;
 	pt[p_id].load_1m->flags |= STAT_HIDDEN;
 	pt[p_id].load_10m->flags |= STAT_HIDDEN;
+	pt[p_id].wakeups->flags |= STAT_HIDDEN;
+	pt[p_id].spurious_wakeups->flags |= STAT_HIDDEN;
 	#ifdef PKG_MALLOC
 	pt[p_id].pkg_total->flags |= STAT_HIDDEN;
 	pt[p_id].pkg_used->flags |= STAT_HIDDEN;
@@ -351,6 +365,8 @@ int internal_fork(const struct internal_fork_params *ifpp)
 		process_no = new_idx;
 		/* set attributes, pid etc */
 		set_proc_attrs(ifpp->proc_desc);
+		/* start with an empty shm cache of our own */
+		shm_cache_child_init(process_no);
 
 		pt[process_no].flags |= ifpp->flags;
 		pt[process_no].type = ifpp->type;
@@ -359,6 +375,8 @@ int internal_fork(const struct internal_fork_params *ifpp)
 			pt[process_no].load_rt->flags &= (~STAT_HIDDEN);
 			pt[process_no].load_1m->flags &= (~STAT_HIDDEN);
 			pt[process_no].load_10m->flags &= (~STAT_HIDDEN);
+			pt[process_no].wakeups->flags &= (~STAT_HIDDEN);
+			pt[process_no].spurious_wakeups->flags &= (~STAT_HIDDEN);
 			#ifdef PKG_MALLOC
 			pt[process_no].pkg_total->flags &= (~STAT_HIDDEN);
 			pt[process_no].pkg_used->flags &= (~STAT_HIDDEN);
@@ -492,6 +510,9 @@ void dynamic_process_final_exit(void)
 
 	pt_become_idle();
 
+	/* return the cached shm fragments, as nobody else will use them */
+	shm_cache_flush();
+
 	/* mark myself as DYNAMIC (just in case) to have an err-less termination */
 	pt[process_no].flags |= OSS_PROC_SELFEXIT;
 	LM_INFO("doing self termination\n");
@@ -34,7 +34,7 @@
 #define MAX_PT_DESC	128
 
 enum process_type { TYPE_NONE=0, TYPE_UDP, TYPE_TCP,
-	TYPE_TIMER, TYPE_MODULE};
+	TYPE_TIMER, TYPE_MODULE, TYPE_TCP_HANDSHAKE};
 
 #include "pt_scaling.h"
 
@@ -84,6 +84,8 @@ struct process_table {
 	stat_var *load_rt;
 	stat_var *load_1m;
 	stat_var *load_10m;
+	stat_var *wakeups;
+	stat_var *spurious_wakeups;
 	stat_var *pkg_total;
 	stat_var *pkg_used;
 	stat_var *pkg_rused;
@@ -135,6 +135,16 @@ void pt_become_idle(void)
 }
 
 
+/* to be called by a process after being woken up to read from a listener;
+ * "spurious" is set if there was nothing to read */
+void pt_account_wakeup(int spurious)
+{
+	MY_LOAD.wakeups++;
+	if (spurious)
+		MY_LOAD.spurious_wakeups++;
+}
+
+
 #define SUM_UP_LOAD(_now, _pno, _TYPE, _ratio) \
 	do { \
 		/* check if the entire time window has the same status */ \
@@ -377,6 +387,96 @@ unsigned int pt_get_10m_loadall(int _)
 }
 
 
+unsigned int pt_get_rt_type_load(int type)
+{
+	utime_t usec_now;
+	struct timeval tv;
+	int idx_old, idx_new, idx_start, i; /* used inside the macro */
+	unsigned int n, summed_procs=0;
+	unsigned long long used = 0;
+
+	gettimeofday( &tv, NULL);
+	usec_now = ((utime_t)(tv.tv_sec)) * 1000000 + tv.tv_usec;
+
+	for( n=0 ; n<counted_max_processes; n++)
+		if ( is_process_running(n) && pt[n].type==type ) {
+			SUM_UP_LOAD( usec_now, n, ST, 1);
+			summed_procs++;
+		}
+	if (!summed_procs)
+		return 0;
+
+	return (used*100/((long long)ST_WINDOW_TIME*summed_procs));
+}
+
+unsigned int pt_get_1m_type_load(int type)
+{
+	utime_t usec_now;
+	struct timeval tv;
+	int idx_old, idx_new, idx_start, i; /* used inside the macro */
+	unsigned int n, summed_procs=0;
+	unsigned long long used = 0;
+
+	gettimeofday( &tv, NULL);
+	usec_now = ((utime_t)(tv.tv_sec)) * 1000000 + tv.tv_usec;
+
+	for( n=0 ; n<counted_max_processes; n++)
+		if ( is_process_running(n) && pt[n].type==type ) {
+			SUM_UP_LOAD( usec_now, n, LT, LT_1m_RATIO);
+			summed_procs++;
+		}
+	if (!summed_procs)
+		return 0;
+
+	return (used*100/((long long)LT_WINDOW_TIME*summed_procs*LT_1m_RATIO));
+}
+
+unsigned int pt_get_10m_type_load(int type)
+{
+	utime_t usec_now;
+	struct timeval tv;
+	int idx_old, idx_new, idx_start, i; /* used inside the macro */
+	unsigned int n, summed_procs=0;
+	unsigned long long used = 0;
+
+	gettimeofday( &tv, NULL);
+	usec_now = ((utime_t)(tv.tv_sec)) * 1000000 + tv.tv_usec;
+
+	for( n=0 ; n<counted_max_processes; n++)
+		if ( is_process_running(n) && pt[n].type==type ) {
+			SUM_UP_LOAD( usec_now, n, LT, 1);
+			summed_procs++;
+		}
+	if (!summed_procs)
+		return 0;
+
+	return (used*100/((long long)LT_WINDOW_TIME*summed_procs));
+}
+
+unsigned int pt_get_proc_wakeups(int pno)
+{
+	return PT_LOAD(pno).wakeups;
+}
+
+
+unsigned int pt_get_proc_spurious_wakeups(int pno)
+{
+	return PT_LOAD(pno).spurious_wakeups;
+}
+
+
+unsigned int pt_get_spurious_wakeups(int _)
+{
+	unsigned int n, sum = 0;
+
+	for( n=0 ; n<counted_max_processes; n++)
+		if ( is_process_running(n) )
+			sum += PT_LOAD(n).spurious_wakeups;
+
+	return sum;
+}
+
+
 int register_processes_load_stats(int procs_no)
 {
 	char *stat_name;
@@ -386,6 +486,7 @@ int register_processes_load_stats(int procs_no)
 	int pno;
 
 	group_stats *load_proc_grp, *load_proc_1m_grp, *load_proc_10m_grp;
+	group_stats *wakeups_grp;
 
 	load_proc_grp = register_stats_group("proc_load");
 	if (!load_proc_grp) {
@@ -402,6 +503,11 @@ int register_processes_load_stats(int procs_no)
 		LM_ERR("could not register stats group proc_load10m");
 		return -1;
 	}
+	wakeups_grp = register_stats_group("proc_wakeups");
+	if (!wakeups_grp) {
+		LM_ERR("could not register stats group proc_wakeups");
+		return -1;
+	}
 
 	/* build the stats and register them for each potential process
 	 * skipp the attendant, id 0 */
@@ -450,6 +556,36 @@ int register_processes_load_stats(int procs_no)
 		pt[pno].load_10m = get_stat(&name);
 		pt[pno].load_10m->flags |= STAT_HIDDEN;
 		add_stats_group(load_proc_10m_grp, pt[pno].load_10m);
+
+		stat_prefix.s = "wakeups-proc";
+		stat_prefix.len = sizeof("wakeups-proc")-1;
+		if ( (stat_name = build_stat_name( &stat_prefix, pno_s)) == 0 ||
+		register_stat2( "load", stat_name, (stat_var**)pt_get_proc_wakeups,
+		STAT_IS_FUNC|STAT_PER_PROC, (void*)(long)pno, 0) != 0) {
+			LM_ERR("failed to add wakeups stat for process %d\n",pno);
+			return -1;
+		}
+		name.s = stat_name;
+		name.len = strlen(stat_name);
+		pt[pno].wakeups = get_stat(&name);
+		pt[pno].wakeups->flags |= STAT_HIDDEN;
+		add_stats_group(wakeups_grp, pt[pno].wakeups);
+
+		stat_prefix.s = "spurious_wakeups-proc";
+		stat_prefix.len = sizeof("spurious_wakeups-proc")-1;
+		if ( (stat_name = build_stat_name( &stat_prefix, pno_s)) == 0 ||
+		register_stat2( "load", stat_name,
+		(stat_var**)pt_get_proc_spurious_wakeups,
+		STAT_IS_FUNC|STAT_PER_PROC, (void*)(long)pno, 0) != 0) {
+			LM_ERR("failed to add spurious wakeups stat for process %d\n",
+				pno);
+			return -1;
+		}
+		name.s = stat_name;
+		name.len = strlen(stat_name);
+		pt[pno].spurious_wakeups = get_stat(&name);
+		pt[pno].spurious_wakeups->flags |= STAT_HIDDEN;
+		add_stats_group(wakeups_grp, pt[pno].spurious_wakeups);
 	}
 
 	return 0;
@@ -54,10 +54,16 @@ struct proc_load_info {
 	/* set to 1 when the process switched to busy; set on 0 if idle */
 	unsigned char is_busy;
 
+	/* how many times the process was woken up to read from a listener
+	 * and, out of these, how many times there was nothing to read
+	 * (the data was already consumed by another process) */
+	unsigned int wakeups;
+	unsigned int spurious_wakeups;
 };
 
 void pt_become_active(void);
 void pt_become_idle(void);
+void pt_account_wakeup(int spurious);
 
 unsigned int pt_get_rt_load(int _);
 unsigned int pt_get_1m_load(int _);
@@ -67,11 +73,20 @@ unsigned int pt_get_rt_loadall(int _);
 unsigned int pt_get_1m_loadall(int _);
 unsigned int pt_get_10m_loadall(int _);
 
+/* the average load of the running processes of a given type */
+unsigned int pt_get_rt_type_load(int type);
+unsigned int pt_get_1m_type_load(int type);
+unsigned int pt_get_10m_type_load(int type);
+
 
 unsigned int pt_get_rt_proc_load(int pid);
 unsigned int pt_get_1m_proc_load(int pid);
 unsigned int pt_get_10m_proc_load(int pid);
 
+unsigned int pt_get_proc_wakeups(int pno);
+unsigned int pt_get_proc_spurious_wakeups(int pno);
+unsigned int pt_get_spurious_wakeups(int _);
+
 /* OpenSIPS startup */
 int register_processes_load_stats(int procs_no);
 
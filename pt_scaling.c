@@ -158,6 +158,8 @@ struct scaling_profile *get_scaling_profile(char *name)
 			(_s).s = "UDP"; (_s).len = 3;   \
 		} else if (_type==TYPE_TCP) {       \
 			(_s).s = "TCP"; (_s).len = 3;   \
+		} else if (_type==TYPE_TCP_HANDSHAKE) { \
+			(_s).s = "TCP_HANDSHAKE"; (_s).len = 13; \
 		} else if (_type==TYPE_TIMER) {     \
 			(_s).s = "TIMER"; (_s).len = 5; \
 		} else {                            \
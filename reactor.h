@@ -106,6 +106,19 @@
 #endif
 
 
+#ifdef HAVE_IO_URING
+#define reactor_IO_URING_CASE(_timeout_sec, _loop_extra) \
+		case POLL_IO_URING: \
+			while(1){ \
+				io_wait_loop_io_uring(&_worker_io, _timeout_sec, 0); \
+				_loop_extra;\
+			} \
+			break;
+#else
+#define reactor_IO_URING_CASE(_timeout_sec, _loop_extra)
+#endif
+
+
 #define reactor_main_loop( _timeout_sec, _err, _loop_extra) \
 	switch(_worker_io.poll_method) { \
 		case POLL_POLL: \
@@ -119,6 +132,7 @@
 		reactor_EPOLL_CASE(_timeout_sec, _loop_extra) \
 		reactor_KQUEUE_CASE(_timeout_sec, _loop_extra) \
 		reactor_DEVPOLL_CASE(_timeout_sec, _loop_extra) \
+		reactor_IO_URING_CASE(_timeout_sec, _loop_extra) \
 		default:\
 			LM_CRIT("no support for poll method %s (%d)\n", \
 				poll_method_name(_worker_io.poll_method), \
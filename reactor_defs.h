@@ -80,6 +80,10 @@ int init_reactor_size(void);
 #define reactor_add_reader( _fd, _type, _prio, _data) \
 	io_watch_add(&_worker_io, _fd, _type, _data, _prio, 0, IO_WATCH_READ)
 
+#define reactor_add_exclusive_reader( _fd, _type, _prio, _data) \
+	io_watch_add(&_worker_io, _fd, _type, _data, _prio, 0, \
+		IO_WATCH_READ|IO_WATCH_EXCLUSIVE)
+
 #define reactor_add_reader_with_timeout( _fd, _type, _prio, _t, _data) \
 	io_watch_add(&_worker_io, _fd, _type, _data, _prio, _t, IO_WATCH_READ)
 
@@ -99,7 +103,8 @@ int init_reactor_size(void);
 	destroy_io_wait(&_worker_io)
 
 #define reactor_has_async() \
-	(io_poll_method==POLL_POLL || io_poll_method==POLL_EPOLL)
+	(io_poll_method==POLL_POLL || io_poll_method==POLL_EPOLL || \
+	io_poll_method==POLL_IO_URING)
 
 #define reactor_is_empty() \
 	(_worker_io.fd_no==0)
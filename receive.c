@@ -115,6 +115,7 @@ int receive_msg(char* buf, unsigned int len, struct receive_info* rcv_info,
 	int rc, old_route_type;
 	char *tmp;
 	str in_buff;
+	void *arena_owner;
 
 	in_buff.len = len;
 	in_buff.s = buf;
@@ -134,11 +135,16 @@ int receive_msg(char* buf, unsigned int len, struct receive_info* rcv_info,
 	/* update the length for further processing */
 	len = in_buff.len;
 
-	msg=pkg_malloc(sizeof(struct sip_msg));
+	/* the message and its parsed parts live in the pkg arena (if enabled),
+	 * all released in one shot once the message is done with */
+	arena_owner = pkg_arena_enter();
+	msg=pkg_arena_malloc(sizeof(struct sip_msg));
 	if (msg==0) {
 		LM_ERR("no pkg mem left for sip_msg\n");
+		pkg_arena_leave(arena_owner);
 		goto error;
 	}
+	pkg_arena_set_owner(msg);
 	msg_no++;
 	/* number of vias parsed -- good for diagnostic info in replies */
 	via_cnt=0;
@@ -296,6 +302,7 @@ end:
 	LM_DBG("cleaning up\n");
 	free_sip_msg(msg);
 	pkg_free(msg);
+	pkg_arena_leave(arena_owner);
 	if (in_buff.s != buf)
 		pkg_free(in_buff.s);
 	return 0;
@@ -305,6 +312,7 @@ parse_error:
 	exec_parse_err_cb(msg);
 	free_sip_msg(msg);
 	pkg_free(msg);
+	pkg_arena_leave(arena_owner);
 error:
 	if (in_buff.s != buf)
 		pkg_free(in_buff.s);
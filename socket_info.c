@@ -173,10 +173,14 @@ struct socket_info_full* new_sock_info( struct socket_id *sid)
 		if (sid->auto_scaling_profile)
 			LM_WARN("auto-scaling for non UDP-based <%.*s> listener not "
 				"supported -> ignoring...\n", si->name.len, si->name.s);
+		if (sid->recv_batch)
+			LM_WARN("receive batching for non UDP-based <%.*s> listener not "
+				"supported -> ignoring...\n", si->name.len, si->name.s);
 	} else {
 		if (sid->workers)
 			si->workers = sid->workers;
 		si->tos = sid->tos;
+		si->recv_batch = sid->recv_batch;
 		if (sid->auto_scaling_profile) {
 			si->s_profile = get_scaling_profile(sid->auto_scaling_profile);
 			if (si->s_profile==NULL) {
@@ -489,6 +493,7 @@ static int expand_interface(const struct socket_info *si, struct socket_info_ful
 	sid.proto = si->proto;
 	sid.workers = si->workers;
 	sid.tos = si->tos;
+	sid.recv_batch = si->recv_batch;
 	sid.auto_scaling_profile = si->s_profile?si->s_profile->name:NULL;
 	sid.adv_port = si->adv_port;
 	sid.adv_name = si->adv_name_str.s; /* it is NULL terminated */
@@ -1447,5 +1452,6 @@ struct socket_id *socket_info2id(struct socket_info *si)
 	sid.proto = si->proto;
 	sid.port = si->port_no;
 	sid.workers = si->workers;
+	sid.recv_batch = si->recv_batch;
 	return &sid;
 }
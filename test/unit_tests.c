@@ -63,6 +63,7 @@ int run_unit_tests(void)
 		/* remember to update the Makefile.test OpenSIPS command-line with at
 		 * least "-m2048 -M128" before stress-testing any of the allocators! */
 		//test_malloc();
+		test_shm_cache();
 		test_cachedb();
 		test_lib_csv();
 		test_parser();
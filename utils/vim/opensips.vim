@@ -36,7 +36,8 @@ syn keyword osGlobalParam db_max_async_connections include_file avp_aliases
 syn keyword osGlobalParam alias dns_try_ipv6 dns_try_naptr
 syn keyword osGlobalParam dns_retr_time dns_retr_no dns_servers_no maxbuffer
 syn keyword osGlobalParam dns_use_search_list shm_hash_split_percentage
-syn keyword osGlobalParam shm_secondary_hash_size mem_warming mem_warming_enabled
+syn keyword osGlobalParam shm_secondary_hash_size shm_cache_size pkg_arena_size
+syn keyword osGlobalParam mem_warming mem_warming_enabled
 syn keyword osGlobalParam mem_warming_pattern_file mem_warming_percentage
 syn keyword osGlobalParam mem_log mem_dump execmsgthreshold execdnsthreshold
 syn keyword osGlobalParam dns_use_search_list shm_hash_split_percentage
@@ -52,6 +53,8 @@ syn keyword osGlobalParam max_while_loops disable_stateless_fwd db_default_url
 syn keyword osGlobalParam disable_503_translation import_file server_header
 syn keyword osGlobalParam tcp_max_msg_time abort_on_assert anycast
 syn keyword osGlobalParam log_prefix tcp_parallel_read_on_workers
+syn keyword osGlobalParam tcp_sticky_workers
+syn keyword osGlobalParam tcp_main_shards tcp_handshake_workers
 syn keyword osGlobalParam stderror_log_format syslog_log_format
 syn keyword osGlobalParam log_json_buf_size log_msg_buf_size
 syn keyword osGlobalParam log_event_enabled log_event_level_filter